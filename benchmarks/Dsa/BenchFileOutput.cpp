@@ -0,0 +1,108 @@
+/**
+ * @file BenchFileOutput.cpp
+ * @brief Write throughput of Dsa::FileOutputRange, the body type behind GetFileResponse, against std::ofstream.
+ *
+ * Every case writes through an output iterator one byte at a time, the way Http1::ParseBody fills a body.
+ *
+ *   - Ofstream/Put      : std::ofstream::put per byte (what FileOutputRange used to do)
+ *   - Ofstream/Write    : a single std::ofstream::write, the upper bound of iostreams
+ *   - Range             : FileOutputRange, buffered pwrite
+ *   - Range/Preallocate : + fallocate of the final size
+ *   - Range/NoReuse     : + posix_fadvise, written pages leave the page cache
+ *   - Range/Direct      : + O_DIRECT
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <Thoth/Dsa/FileOutputRange.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <ranges>
+#include <string>
+
+
+namespace fs = std::filesystem;
+
+using Thoth::Dsa::BinFileOutputRange;
+using Thoth::Dsa::FileOutputOptions;
+
+namespace {
+    const fs::path& BenchPath() {
+        static const fs::path path{ fs::temp_directory_path() / "thoth_bench_file_output.bin" };
+        return path;
+    }
+
+    const std::string& Payload(const size_t size) {
+        static std::string payload;
+        if (payload.size() != size) {
+            payload.resize(size);
+            for (size_t i{}; i < size; ++i)
+                payload[i] = static_cast<char>('a' + i % 26);
+        }
+        return payload;
+    }
+
+    void Finish(benchmark::State& state, const size_t size) {
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size));
+        fs::remove(BenchPath());
+    }
+
+    void RangeWith(benchmark::State& state, FileOutputOptions options) {
+        const auto size{ static_cast<size_t>(state.range(0)) };
+        const auto& payload{ Payload(size) };
+
+        if (options.preallocate) options.preallocate = size;
+
+        for (auto _ : state) {
+            BinFileOutputRange file{ BenchPath(), options };
+            std::ranges::copy(payload | std::views::transform([](const char c) { return std::byte(c); }), file.begin());
+
+            benchmark::DoNotOptimize(file.Flush());
+        }
+
+        Finish(state, size);
+    }
+}
+
+
+static void BM_Ofstream_Put(benchmark::State& state) {
+    const auto size{ static_cast<size_t>(state.range(0)) };
+    const auto& payload{ Payload(size) };
+
+    for (auto _ : state) {
+        std::ofstream file{ BenchPath(), std::ios::out | std::ios::binary };
+        for (const char c : payload)
+            file.put(c);
+        file.flush();
+    }
+
+    Finish(state, size);
+}
+
+static void BM_Ofstream_Write(benchmark::State& state) {
+    const auto size{ static_cast<size_t>(state.range(0)) };
+    const auto& payload{ Payload(size) };
+
+    for (auto _ : state) {
+        std::ofstream file{ BenchPath(), std::ios::out | std::ios::binary };
+        file.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+        file.flush();
+    }
+
+    Finish(state, size);
+}
+
+static void BM_Range(benchmark::State& state)             { RangeWith(state, {}); }
+static void BM_Range_Preallocate(benchmark::State& state) { RangeWith(state, { .preallocate = 0 }); }
+static void BM_Range_NoReuse(benchmark::State& state)     { RangeWith(state, { .noReuse = true }); }
+static void BM_Range_Direct(benchmark::State& state)      { RangeWith(state, { .directIo = true }); }
+
+
+BENCHMARK(BM_Ofstream_Put)     ->Name("FileOutput/Ofstream/Put")      ->Arg(1 << 20)->Arg(64 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Ofstream_Write)   ->Name("FileOutput/Ofstream/Write")    ->Arg(1 << 20)->Arg(64 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Range)            ->Name("FileOutput/Range")             ->Arg(1 << 20)->Arg(64 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Range_Preallocate)->Name("FileOutput/Range/Preallocate") ->Arg(1 << 20)->Arg(64 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Range_NoReuse)    ->Name("FileOutput/Range/NoReuse")     ->Arg(1 << 20)->Arg(64 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Range_Direct)     ->Name("FileOutput/Range/Direct")      ->Arg(1 << 20)->Arg(64 << 20)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,90 @@
+/**
+ * @file BenchLinearMap.cpp
+ * @brief Building and querying the sorted vector maps behind JsonObject and QueryParams.
+ *
+ * Keys are short strings given in a shuffled order, values are a vector of strings like QueryValues.
+ *
+ *   - LinearMap/Build/TryEmplace   : a `try_emplace` per pair, what the parsers used to do
+ *   - LinearMap/Build/FromUnsorted : the same pairs collected, then `FromUnsorted`
+ *   - LinearMap/Find               : every key looked up, keys and values interleaved
+ *   - SoaLinearMap/Find            : the same lookups, keys apart from the values
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <Thoth/Dsa/LinearMap.hpp>
+#include <Thoth/Dsa/SoaLinearMap.hpp>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+using Thoth::Dsa::LinearMap;
+using Thoth::Dsa::SoaLinearMap;
+
+
+namespace {
+    using Values = std::vector<std::string>;
+    using Pairs  = std::vector<std::pair<std::string, Values>>;
+
+    Pairs MakePairs(const size_t size) {
+        Pairs res;
+        res.reserve(size);
+
+        for (size_t i{}; i < size; ++i)
+            res.emplace_back("key_" + std::to_string(i * 7919 % 100003), Values{ "value", std::to_string(i) });
+
+        std::ranges::shuffle(res, std::mt19937{ 42 });
+        return res;
+    }
+
+    void Sizes(benchmark::internal::Benchmark* bench) {
+        for (const int64_t size : { 8, 16, 64, 512, 4096 })
+            bench->Arg(size);
+    }
+
+    template<class MapT>
+    void Find(benchmark::State& state) {
+        const auto pairs{ MakePairs(static_cast<size_t>(state.range(0))) };
+        const auto map{ MapT::FromUnsorted(pairs) };
+
+        for (auto _ : state)
+            for (const auto& [key, _] : pairs)
+                benchmark::DoNotOptimize(map.find(key));
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+}
+
+
+static void BM_LinearMap_Build_TryEmplace(benchmark::State& state) {
+    const auto pairs{ MakePairs(static_cast<size_t>(state.range(0))) };
+
+    for (auto _ : state) {
+        LinearMap<std::string, Values> map;
+        for (const auto& [key, val] : pairs)
+            map.try_emplace(key, val);
+
+        benchmark::DoNotOptimize(map);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_LinearMap_Build_FromUnsorted(benchmark::State& state) {
+    const auto pairs{ MakePairs(static_cast<size_t>(state.range(0))) };
+
+    for (auto _ : state) {
+        auto map{ LinearMap<std::string, Values>::FromUnsorted(pairs) };
+        benchmark::DoNotOptimize(map);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+
+BENCHMARK(BM_LinearMap_Build_TryEmplace)  ->Name("LinearMap/Build/TryEmplace")  ->Apply(Sizes);
+BENCHMARK(BM_LinearMap_Build_FromUnsorted)->Name("LinearMap/Build/FromUnsorted")->Apply(Sizes);
+BENCHMARK(Find<LinearMap<std::string, Values>>)   ->Name("LinearMap/Find")   ->Apply(Sizes);
+BENCHMARK(Find<SoaLinearMap<std::string, Values>>)->Name("SoaLinearMap/Find")->Apply(Sizes);
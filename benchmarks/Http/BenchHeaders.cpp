@@ -0,0 +1,144 @@
+/**
+ * @file BenchHeaders.cpp
+ * @brief Header lookups on a typical response head, the checks made while framing every message.
+ *
+ *   - Headers/Lookup/Name    : `Exists`/`Get` of content-length, transfer-encoding and connection by name
+ *   - Headers/Lookup/Id      : the same three fields through `NHeaders::HeaderIdEnum`
+ *   - Headers/Lookup/Unknown : an extension header (`x-request-id`), compared by name
+ *   - Headers/Parse          : `Headers::Parse` of the raw block
+ *   - Headers/View/Parse     : `HeadersView::Parse` of the same block, moved into the view after one copy
+ *   - Headers/View/Lookup/Id : the framing lookups on the view
+ *   - Headers/Typed/Repeated : `ContentLength()` and `ContentType()` read again, served from the parsed values
+ *   - Headers/Typed/Once     : `Content-Length` set then read once, as the framing of a new message does
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <Thoth/Http/NHeaders/Headers.hpp>
+#include <Thoth/Http/NHeaders/HeadersView.hpp>
+
+#include <string>
+#include <string_view>
+
+using namespace Thoth::Http;
+
+
+namespace {
+    constexpr std::string_view k_rawHeaders{
+        "Date: Mon, 19 Oct 2026 10:00:00 GMT\r\n"
+        "Server: nginx/1.25.3\r\n"
+        "Content-Type: application/json; charset=utf-8\r\n"
+        "Cache-Control: private, max-age=0\r\n"
+        "Vary: Accept-Encoding\r\n"
+        "ETag: \"5f2b-1a2b3c\"\r\n"
+        "X-Request-Id: 3b1f2c4d-9e8a-4b7c-a1d2-e3f4a5b6c7d8\r\n"
+        "X-Frame-Options: DENY\r\n"
+        "Strict-Transport-Security: max-age=31536000\r\n"
+        "Connection: keep-alive\r\n"
+        "Content-Length: 1234\r\n"
+    };
+
+    const Headers& SampleHeaders() {
+        static const Headers headers{ Headers::Parse(k_rawHeaders).value() };
+        return headers;
+    }
+}
+
+
+static void BM_Headers_Lookup_Name(benchmark::State& state) {
+    const auto& headers{ SampleHeaders() };
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(headers.Exists("content-length"));
+        benchmark::DoNotOptimize(headers.Exists("transfer-encoding"));
+        benchmark::DoNotOptimize(headers.Get("connection"));
+    }
+
+    state.SetItemsProcessed(state.iterations() * 3);
+}
+
+static void BM_Headers_Lookup_Id(benchmark::State& state) {
+    using enum NHeaders::HeaderIdEnum;
+    const auto& headers{ SampleHeaders() };
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(headers.Exists(ContentLength));
+        benchmark::DoNotOptimize(headers.Exists(TransferEncoding));
+        benchmark::DoNotOptimize(headers.Get(Connection));
+    }
+
+    state.SetItemsProcessed(state.iterations() * 3);
+}
+
+static void BM_Headers_Lookup_Unknown(benchmark::State& state) {
+    const auto& headers{ SampleHeaders() };
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(headers.Get("x-request-id"));
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_Headers_Parse(benchmark::State& state) {
+    for (auto _ : state) {
+        auto headers{ Headers::Parse(k_rawHeaders) };
+        benchmark::DoNotOptimize(headers);
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(k_rawHeaders.size()));
+}
+
+static void BM_Headers_View_Parse(benchmark::State& state) {
+    for (auto _ : state) {
+        auto view{ HeadersView::Parse(std::string{ k_rawHeaders }) };
+        benchmark::DoNotOptimize(view);
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(k_rawHeaders.size()));
+}
+
+static void BM_Headers_View_Lookup_Id(benchmark::State& state) {
+    using enum NHeaders::HeaderIdEnum;
+    const auto view{ HeadersView::Parse(std::string{ k_rawHeaders }).value() };
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(view.Exists(ContentLength));
+        benchmark::DoNotOptimize(view.Exists(TransferEncoding));
+        benchmark::DoNotOptimize(view.Get(Connection));
+    }
+
+    state.SetItemsProcessed(state.iterations() * 3);
+}
+
+static void BM_Headers_Typed_Repeated(benchmark::State& state) {
+    const auto& headers{ SampleHeaders() };
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(headers.ContentLength().GetAsOpt());
+        benchmark::DoNotOptimize(headers.ContentType().GetAsOpt());
+    }
+
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+
+static void BM_Headers_Typed_Once(benchmark::State& state) {
+    auto headers{ SampleHeaders() };
+
+    for (auto _ : state) {
+        // Drops the parsed value, each read is the first one.
+        headers.Set("content-length", "1234");
+        benchmark::DoNotOptimize(headers.ContentLength().GetAsOpt());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+
+BENCHMARK(BM_Headers_Lookup_Name)   ->Name("Headers/Lookup/Name");
+BENCHMARK(BM_Headers_Lookup_Id)     ->Name("Headers/Lookup/Id");
+BENCHMARK(BM_Headers_Lookup_Unknown)->Name("Headers/Lookup/Unknown");
+BENCHMARK(BM_Headers_Parse)         ->Name("Headers/Parse");
+BENCHMARK(BM_Headers_View_Parse)    ->Name("Headers/View/Parse");
+BENCHMARK(BM_Headers_View_Lookup_Id)->Name("Headers/View/Lookup/Id");
+BENCHMARK(BM_Headers_Typed_Repeated)->Name("Headers/Typed/Repeated");
+BENCHMARK(BM_Headers_Typed_Once)    ->Name("Headers/Typed/Once");
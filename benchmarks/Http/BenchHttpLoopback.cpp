@@ -0,0 +1,264 @@
+/**
+ * @file BenchHttpLoopback.cpp
+ * @brief Reproducible HTTP client benchmarks against the in-process LoopbackServer.
+ *
+ * No network and no external server: every request goes to 127.0.0.1, so the numbers show the cost of the
+ * client itself. Two groups:
+ *
+ *   - Loopback/... : whole exchanges (sized / chunked bodies, keep-alive / close, delays, parallel threads)
+ *   - Overhead/... : single steps of Client::Send without any socket (head serialization, response parsing,
+ *                    body copy, name resolution, pool acquire)
+ *
+ * Every scenario reports `req/s`, and the Thoth ones `allocs/req`: the `operator new` calls of the benchmark thread
+ * per request (libcurl allocates with malloc, it would always read zero).
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "LoopbackServer.hpp"
+
+#include <Thoth/Http/Client/Client.hpp>
+#include <Thoth/Http/Methods/GetMethod.hpp>
+#include <Thoth/Http/Methods/PostMethod.hpp>
+#include <Thoth/Http/_base/Http1.hpp>
+#include <Thoth/Utils/Ranges/SharedInputView.hpp>
+
+#include <curl/curl.h>
+
+#include <cstdlib>
+#include <format>
+#include <new>
+#include <string>
+
+using namespace Thoth::Http;
+using Bench::LoopbackServer;
+
+
+#pragma region Allocation counting
+
+namespace {
+    // Per thread, the server threads allocate too and must not be counted.
+    thread_local uint64_t t_allocations{};
+    thread_local bool t_countAllocations{};
+}
+
+void* operator new(const std::size_t size) {
+    if (t_countAllocations) ++t_allocations;
+
+    if (void* ptr{ std::malloc(size == 0 ? 1 : size) })
+        return ptr;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+namespace {
+    //! Counts the allocations of the calling thread while alive, then reports them per iteration.
+    struct AllocationCounter {
+        benchmark::State& state;
+        uint64_t start{ t_allocations };
+
+        explicit AllocationCounter(benchmark::State& state) : state{ state } { t_countAllocations = true; }
+
+        ~AllocationCounter() {
+            t_countAllocations = false;
+
+            state.counters["allocs/req"] = benchmark::Counter(
+                static_cast<double>(t_allocations - start), benchmark::Counter::kAvgIterations);
+            state.counters["req/s"] = benchmark::Counter(
+                1, benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kAvgThreads);
+        }
+    };
+}
+
+#pragma endregion
+
+
+#pragma region Helpers
+
+namespace {
+    std::string Target(const int64_t size, const std::string_view extra = {}) {
+        return std::format("/bytes?size={}{}", size, extra);
+    }
+
+    GetRequest MakeGet(const std::string_view target) {
+        return GetRequest::FromUrl(LoopbackServer::Instance().Url(target)).value();
+    }
+
+    template<class Request>
+    void RunThoth(benchmark::State& state, const Request& request, const int64_t bodySize) {
+        {
+            // Warms the pool, the first connect isn't what we measure.
+            const auto warm{ Client::Send(request) };
+            if (!warm) {
+                state.SkipWithError("LoopbackServer unreachable");
+                return;
+            }
+        }
+
+        {
+            AllocationCounter allocations{ state };
+
+            for (auto _ : state) {
+                auto response{ Client::Send(request) };
+                if (!response) [[unlikely]] {
+                    state.SkipWithError("request failed");
+                    break;
+                }
+                benchmark::DoNotOptimize(response->body.data());
+            }
+        }
+
+        state.SetBytesProcessed(state.iterations() * bodySize);
+    }
+
+    size_t SinkWrite(char*, const size_t, const size_t nmemb, void*) {
+        return nmemb;
+    }
+}
+
+#pragma endregion
+
+
+#pragma region Loopback
+
+static void BM_Loopback_Thoth_Sized(benchmark::State& state) {
+    RunThoth(state, MakeGet(Target(state.range(0))), state.range(0));
+}
+
+static void BM_Loopback_Thoth_Chunked(benchmark::State& state) {
+    RunThoth(state, MakeGet(Target(state.range(0), "&framing=chunked")), state.range(0));
+}
+
+// Every request connects: the cost of a pool miss plus the TCP handshake on loopback.
+static void BM_Loopback_Thoth_Close(benchmark::State& state) {
+    RunThoth(state, MakeGet(Target(0, "&connection=close")), 0);
+}
+
+static void BM_Loopback_Thoth_Post(benchmark::State& state) {
+    const auto url{ LoopbackServer::Instance().Url(Target(0)) };
+    RunThoth(state, PostRequest::FromUrl(url, std::string(static_cast<size_t>(state.range(0)), 'p')).value(), state.range(0));
+}
+
+// A 1 ms server delay, run from several threads: shows how the pool and its lock behave under contention.
+static void BM_Loopback_Thoth_Parallel(benchmark::State& state) {
+    RunThoth(state, MakeGet(Target(1024, "&delay=1")), 1024);
+}
+
+// Reference point: the same exchange with a reused libcurl handle.
+static void BM_Loopback_Curl_Sized(benchmark::State& state) {
+    const auto url{ LoopbackServer::Instance().Url(Target(state.range(0))) };
+
+    CURL* handle{ curl_easy_init() };
+    curl_easy_setopt(handle, CURLOPT_URL, url.c_str());
+    curl_easy_setopt(handle, CURLOPT_WRITEFUNCTION, SinkWrite);
+    curl_easy_setopt(handle, CURLOPT_TCP_NODELAY, 1L);
+    curl_easy_perform(handle);
+
+    for (auto _ : state)
+        if (curl_easy_perform(handle) != CURLE_OK) [[unlikely]] {
+            state.SkipWithError("request failed");
+            break;
+        }
+
+    curl_easy_cleanup(handle);
+    state.counters["req/s"] = benchmark::Counter(1, benchmark::Counter::kIsIterationInvariantRate);
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+#pragma endregion
+
+
+#pragma region Overhead
+
+// What Http1::SendMessageHead formats before writing: request line and headers.
+static void BM_Overhead_HeadSerialization(benchmark::State& state) {
+    auto request{ MakeGet(Target(0)) };
+    request.headers.Add("host", "127.0.0.1");
+    request.headers.Add("accept", "application/json");
+    request.headers.Add("user-agent", "Thoth-Bench");
+
+    AllocationCounter allocations{ state };
+    for (auto _ : state) {
+        auto head{ std::format("{} {}", GetMethod::MethodName(), static_cast<const RequestHead&>(request)) };
+        benchmark::DoNotOptimize(head.data());
+    }
+}
+
+// Status line, headers and a body of `range(0)` bytes parsed from memory, as Client reads them from a socket.
+static void BM_Overhead_ParseResponse(benchmark::State& state) {
+    const auto size{ static_cast<size_t>(state.range(0)) };
+    const auto raw{ std::format(
+        "HTTP/1.1 200 OK\r\nContent-Type: application/octet-stream\r\nConnection: keep-alive\r\n"
+        "Date: Sun, 06 Nov 1994 08:49:37 GMT\r\nServer: Bench\r\nContent-Length: {}\r\n\r\n{}",
+        size, std::string(size, 'x')
+    ) };
+
+    const auto emptyBody{ [](const ResponseHead&) -> std::expected<std::string, Thoth::ThothError> { return {}; } };
+
+    {
+        AllocationCounter allocations{ state };
+        for (auto _ : state) {
+            auto response{ details_::Http1::BuildResponse<GetMethod, std::string>(
+                Thoth::Utils::SharedInputView{ std::string_view{ raw } }, emptyBody
+            ) };
+            benchmark::DoNotOptimize(response->body.data());
+        }
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(raw.size()));
+}
+
+// Client::Send resolves the host on every request, even a literal address.
+static void BM_Overhead_Resolve(benchmark::State& state) {
+    const auto port{ std::to_string(LoopbackServer::Instance().Port()) };
+
+    AllocationCounter allocations{ state };
+    for (auto _ : state)
+        benchmark::DoNotOptimize(Hermes::IpEndpoint::TryResolve("127.0.0.1", port));
+}
+
+// Taking a pooled connection and giving it back, as Client::Send does around a keep-alive exchange.
+static void BM_Overhead_PoolAcquire(benchmark::State& state) {
+    auto& server{ LoopbackServer::Instance() };
+    if (!Client::Send(MakeGet(Target(0)))) {
+        state.SkipWithError("LoopbackServer unreachable");
+        return;
+    }
+
+    const auto endpoint{ Hermes::IpEndpoint::TryResolve("127.0.0.1", std::to_string(server.Port())) };
+    const ClientConnectionKey key{ *endpoint, "http", "127.0.0.1" };
+
+    ClientJanitor& janitor{ ClientJanitor::Instance() };
+
+    AllocationCounter allocations{ state };
+    for (auto _ : state) {
+        std::shared_ptr<ClientConnection> conn;
+        {
+            std::lock_guard lock{ janitor.poolMutex };
+            auto& pooled{ janitor.connectionPool.find(key)->second };
+            conn = std::move(pooled.back());
+            pooled.pop_back();
+        }
+        {
+            std::lock_guard lock{ janitor.poolMutex };
+            janitor.connectionPool[key].emplace_back(std::move(conn));
+        }
+    }
+}
+
+#pragma endregion
+
+
+BENCHMARK(BM_Loopback_Thoth_Sized)   ->Name("Loopback/Thoth/Sized")   ->Arg(0)->Arg(1 << 10)->Arg(64 << 10)->Arg(1 << 20)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Loopback_Thoth_Chunked) ->Name("Loopback/Thoth/Chunked") ->Arg(1 << 10)->Arg(64 << 10)->Arg(1 << 20)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Loopback_Thoth_Close)   ->Name("Loopback/Thoth/Close")   ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Loopback_Thoth_Post)    ->Name("Loopback/Thoth/Post")    ->Arg(1 << 10)->Arg(1 << 20)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Loopback_Thoth_Parallel)->Name("Loopback/Thoth/Parallel")->ThreadRange(1, 16)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Loopback_Curl_Sized)    ->Name("Loopback/Curl/Sized")    ->Arg(0)->Arg(1 << 10)->Arg(64 << 10)->Arg(1 << 20)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_Overhead_HeadSerialization)->Name("Overhead/HeadSerialization");
+BENCHMARK(BM_Overhead_ParseResponse)    ->Name("Overhead/ParseResponse")->Arg(0)->Arg(1 << 10)->Arg(64 << 10)->Arg(1 << 20);
+BENCHMARK(BM_Overhead_Resolve)          ->Name("Overhead/Resolve");
+BENCHMARK(BM_Overhead_PoolAcquire)      ->Name("Overhead/PoolAcquire");
@@ -0,0 +1,252 @@
+/**
+ * @file BenchHttpServer.cpp
+ * @brief wrk-style throughput of Http::Server on loopback.
+ *
+ * Every benchmark thread is one client holding one keep-alive connection, as a wrk connection: it writes a
+ * request, reads the whole response and starts again. The client is a few lines of raw socket code, so the
+ * numbers are the server's (and the kernel's), not a client library's.
+ *
+ *   - Server/Thoth/...     : Http::Server with an in-memory handler
+ *   - Server/Static/...    : Http::Server with StaticFiles, bodies sent with `sendfile`
+ *   - Server/Reference/... : the thread-per-connection Bench::LoopbackServer, same client and same bodies
+ *
+ * Every scenario reports `req/s`, summed over the threads.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "LoopbackServer.hpp"
+
+#include <Thoth/Http/Server.hpp>
+#include <Thoth/Http/StaticFiles.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <charconv>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <string>
+#include <string_view>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace Thoth::Http;
+using Bench::LoopbackServer;
+
+
+#pragma region Server
+
+namespace {
+    constexpr size_t k_maxBodySize{ 64 << 10 };
+
+    Server& ThothServer() {
+        static const std::string body(k_maxBodySize, 'x');
+
+        static Server server{ Server::Listen([](const ServerRequest& req, ServerResponse& res) {
+            // `/N` answers N bytes.
+            size_t size{};
+            const auto path{ req.url.GetPathOrSep().substr(1) };
+            std::from_chars(path.data(), path.data() + path.size(), size);
+
+            res.headers.Set("content-type", "application/octet-stream");
+            res.body.assign(body, 0, std::min(size, k_maxBodySize));
+        }).value() };
+
+        return server;
+    }
+
+    //! Serves files named after their size from a temporary directory.
+    Server& StaticServer() {
+        static const auto root{ [] {
+            const auto dir{ std::filesystem::temp_directory_path() / "thoth-bench-static" };
+            std::filesystem::create_directories(dir);
+
+            for (const size_t size : { 1 << 10, 64 << 10, 1 << 20 })
+                std::ofstream{ dir / std::to_string(size), std::ios::binary } << std::string(size, 'x');
+            return dir;
+        }() };
+
+        static Server server{ Server::Listen(StaticFiles{ root }).value() };
+        return server;
+    }
+}
+
+#pragma endregion
+
+
+#pragma region Client
+
+namespace {
+    //! Requests per second of the whole run: each thread reports its own rate, averaged back into the total.
+    benchmark::Counter RequestRate(const double perIteration) {
+        return benchmark::Counter(perIteration, benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kAvgThreads);
+    }
+
+    //! One keep-alive connection that writes requests and reads `Content-Length` framed responses.
+    struct RawClient {
+        explicit RawClient(const uint16_t port) {
+            m_fd = socket(AF_INET, SOCK_STREAM, 0);
+
+            sockaddr_in addr{ .sin_family = AF_INET, .sin_port = htons(port) };
+            inet_pton(AF_INET, "127.0.0.1", &addr.sin_addr);
+            if (connect(m_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == -1) {
+                close(m_fd);
+                m_fd = -1;
+                return;
+            }
+
+            constexpr int on{ 1 };
+            setsockopt(m_fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+        }
+
+        RawClient(const RawClient&) = delete;
+        RawClient& operator=(const RawClient&) = delete;
+
+        ~RawClient() { if (m_fd != -1) close(m_fd); }
+
+        [[nodiscard]] bool IsOpen() const { return m_fd != -1; }
+
+        bool Send(const std::string_view data) const {
+            for (size_t sent{}; sent < data.size();) {
+                const auto res{ send(m_fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL) };
+                if (res <= 0) return false;
+                sent += static_cast<size_t>(res);
+            }
+            return true;
+        }
+
+        //! Reads one response, what follows it stays buffered for the next call.
+        bool ReadResponse() {
+            size_t headEnd;
+            while ((headEnd = m_buffer.find("\r\n\r\n")) == std::string::npos)
+                if (!Fill_()) return false;
+            headEnd += 4;
+
+            const auto total{ headEnd + ContentLength_({ m_buffer.data(), headEnd }) };
+            while (m_buffer.size() < total)
+                if (!Fill_()) return false;
+
+            m_buffer.erase(0, total);
+            return true;
+        }
+
+    private:
+        bool Fill_() {
+            const auto got{ recv(m_fd, m_readBuffer.data(), m_readBuffer.size(), 0) };
+            if (got <= 0) return false;
+
+            m_buffer.append(m_readBuffer.data(), static_cast<size_t>(got));
+            return true;
+        }
+
+        static size_t ContentLength_(const std::string_view head) {
+            static constexpr std::string_view k_name{ "\ncontent-length:" };
+
+            const auto it{ std::ranges::search(head, k_name, [](const char a, const char b) {
+                return std::tolower(static_cast<unsigned char>(a)) == b;
+            }) };
+            if (it.empty()) return 0;
+
+            auto pos{ static_cast<size_t>(it.end() - head.begin()) };
+            while (head[pos] == ' ') ++pos;
+
+            size_t length{};
+            std::from_chars(head.data() + pos, head.data() + head.size(), length);
+            return length;
+        }
+
+        int m_fd{ -1 };
+        std::string m_buffer;
+        std::array<char, 64 << 10> m_readBuffer;
+    };
+
+    //! Keep-alive requests on one connection, `depth` of them written before reading the answers (wrk's pipeline).
+    void RunKeepAlive(benchmark::State& state, const uint16_t port, const std::string_view target, const int64_t depth = 1) {
+        RawClient client{ port };
+        if (!client.IsOpen()) {
+            state.SkipWithError("server unreachable");
+            return;
+        }
+
+        std::string requests;
+        for (int64_t i{}; i < depth; ++i)
+            std::format_to(std::back_inserter(requests), "GET {} HTTP/1.1\r\nHost: 127.0.0.1\r\n\r\n", target);
+
+        for (auto _ : state) {
+            bool ok{ client.Send(requests) };
+            for (int64_t i{}; ok && i < depth; ++i)
+                ok = client.ReadResponse();
+
+            if (!ok) [[unlikely]] {
+                state.SkipWithError("request failed");
+                break;
+            }
+        }
+
+        state.counters["req/s"] = RequestRate(static_cast<double>(depth));
+    }
+}
+
+#pragma endregion
+
+
+#pragma region Thoth
+
+static void BM_Server_Thoth_Sized(benchmark::State& state) {
+    RunKeepAlive(state, ThothServer().Port(), std::format("/{}", state.range(0)));
+}
+
+static void BM_Server_Thoth_Pipelined(benchmark::State& state) {
+    RunKeepAlive(state, ThothServer().Port(), "/0", state.range(0));
+}
+
+// A connection per request: accept, epoll registration and close on the server side.
+static void BM_Server_Thoth_Close(benchmark::State& state) {
+    const auto port{ ThothServer().Port() };
+
+    for (auto _ : state) {
+        RawClient client{ port };
+        if (!client.IsOpen() || !client.Send("GET /0 HTTP/1.1\r\nHost: 127.0.0.1\r\nConnection: close\r\n\r\n")
+                || !client.ReadResponse()) [[unlikely]] {
+            state.SkipWithError("request failed");
+            break;
+        }
+    }
+
+    state.counters["req/s"] = RequestRate(1);
+}
+
+#pragma endregion
+
+
+#pragma region Static
+
+static void BM_Server_Static_Sized(benchmark::State& state) {
+    RunKeepAlive(state, StaticServer().Port(), std::format("/{}", state.range(0)));
+}
+
+#pragma endregion
+
+
+#pragma region Reference
+
+static void BM_Server_Reference_Sized(benchmark::State& state) {
+    RunKeepAlive(state, LoopbackServer::Instance().Port(), std::format("/bytes?size={}", state.range(0)));
+}
+
+#pragma endregion
+
+
+BENCHMARK(BM_Server_Thoth_Sized)    ->Name("Server/Thoth/Sized")    ->Arg(0)->Arg(1 << 10)->Arg(64 << 10)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_Server_Thoth_Pipelined)->Name("Server/Thoth/Pipelined")->Arg(16)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(BM_Server_Thoth_Close)    ->Name("Server/Thoth/Close")    ->ThreadRange(1, 16)->UseRealTime();
+
+BENCHMARK(BM_Server_Static_Sized)   ->Name("Server/Static/Sized")   ->Arg(1 << 10)->Arg(64 << 10)->Arg(1 << 20)->ThreadRange(1, 64)->UseRealTime();
+
+BENCHMARK(BM_Server_Reference_Sized)->Name("Server/Reference/Sized")->Arg(0)->Arg(1 << 10)->Arg(64 << 10)->ThreadRange(1, 64)->UseRealTime();
@@ -0,0 +1,269 @@
+/**
+ * @file BenchRouter.cpp
+ * @brief Route lookup: Http::RouteTable against a linear list of patterns.
+ *
+ *   - Router/Radix/...  : RouteTable::Match
+ *   - Router/Linear/... : every pattern compared segment by segment until one matches, the usual hand-written
+ *                         `if (path == ...) else if ...` chain generalised to `{param}` captures
+ *
+ * `Api` is a hand-written REST table built at compile time, `Generated/N` are N routes built at startup.
+ * Every scenario looks up the same shuffled paths, one per iteration, all of them matching a route.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <Thoth/Http/Methods/DeleteMethod.hpp>
+#include <Thoth/Http/Methods/GetMethod.hpp>
+#include <Thoth/Http/Methods/PatchMethod.hpp>
+#include <Thoth/Http/Methods/PostMethod.hpp>
+#include <Thoth/Http/Router.hpp>
+
+#include <algorithm>
+#include <array>
+#include <format>
+#include <memory>
+#include <optional>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using namespace Thoth::Http;
+
+
+#pragma region Linear
+
+namespace {
+    //! The naive matcher: patterns tried in order, segment by segment.
+    struct LinearRouter {
+        explicit LinearRouter(const std::span<const Route> routes) : m_routes{ routes.begin(), routes.end() } { }
+
+        [[nodiscard]] std::optional<size_t> Match(const std::string_view method, std::string_view path,
+                RouteParams& params) const {
+            for (size_t idx{}; idx < m_routes.size(); ++idx) {
+                params.count = 0;
+                if (m_routes[idx].method == method && Matches_(m_routes[idx].pattern, path, params))
+                    return idx;
+            }
+            return std::nullopt;
+        }
+
+    private:
+        static bool Matches_(std::string_view pattern, std::string_view path, RouteParams& params) {
+            while (!pattern.empty() && !path.empty()) {
+                pattern.remove_prefix(1);
+                path.remove_prefix(1);
+
+                const auto patternSegment{ pattern.substr(0, pattern.find('/')) };
+                const auto pathSegment   { path.substr(0, path.find('/')) };
+
+                if (patternSegment.ends_with("...}")) {
+                    params.values[params.count++] = path;
+                    return true;
+                }
+                if (patternSegment.starts_with('{')) {
+                    if (pathSegment.empty()) return false;
+                    params.values[params.count++] = pathSegment;
+                }
+                else if (patternSegment != pathSegment)
+                    return false;
+
+                pattern.remove_prefix(patternSegment.size());
+                path.remove_prefix(pathSegment.size());
+            }
+            return pattern.empty() && path.empty();
+        }
+
+        std::vector<Route> m_routes;
+    };
+}
+
+#pragma endregion
+
+
+#pragma region Routes
+
+namespace {
+    constexpr std::array k_apiRoutes{
+        Route::For<GetMethod>   ("/"),
+        Route::For<GetMethod>   ("/health"),
+        Route::For<GetMethod>   ("/users"),
+        Route::For<PostMethod>  ("/users"),
+        Route::For<GetMethod>   ("/users/{user}"),
+        Route::For<PatchMethod> ("/users/{user}"),
+        Route::For<DeleteMethod>("/users/{user}"),
+        Route::For<GetMethod>   ("/users/{user}/repos"),
+        Route::For<GetMethod>   ("/users/{user}/followers"),
+        Route::For<GetMethod>   ("/users/{user}/following"),
+        Route::For<GetMethod>   ("/users/{user}/gists"),
+        Route::For<GetMethod>   ("/orgs/{org}"),
+        Route::For<GetMethod>   ("/orgs/{org}/members"),
+        Route::For<GetMethod>   ("/orgs/{org}/repos"),
+        Route::For<PostMethod>  ("/orgs/{org}/repos"),
+        Route::For<GetMethod>   ("/repos/{owner}/{repo}"),
+        Route::For<PatchMethod> ("/repos/{owner}/{repo}"),
+        Route::For<DeleteMethod>("/repos/{owner}/{repo}"),
+        Route::For<GetMethod>   ("/repos/{owner}/{repo}/branches"),
+        Route::For<GetMethod>   ("/repos/{owner}/{repo}/branches/{branch}"),
+        Route::For<GetMethod>   ("/repos/{owner}/{repo}/commits"),
+        Route::For<GetMethod>   ("/repos/{owner}/{repo}/commits/{sha}"),
+        Route::For<GetMethod>   ("/repos/{owner}/{repo}/issues"),
+        Route::For<PostMethod>  ("/repos/{owner}/{repo}/issues"),
+        Route::For<GetMethod>   ("/repos/{owner}/{repo}/issues/{number}"),
+        Route::For<PatchMethod> ("/repos/{owner}/{repo}/issues/{number}"),
+        Route::For<GetMethod>   ("/repos/{owner}/{repo}/issues/{number}/comments"),
+        Route::For<PostMethod>  ("/repos/{owner}/{repo}/issues/{number}/comments"),
+        Route::For<GetMethod>   ("/repos/{owner}/{repo}/pulls"),
+        Route::For<GetMethod>   ("/repos/{owner}/{repo}/pulls/{number}"),
+        Route::For<GetMethod>   ("/repos/{owner}/{repo}/contents/{path...}"),
+        Route::For<GetMethod>   ("/search/repositories"),
+    };
+
+    constexpr auto k_apiTable{ MakeRouteTable<k_apiRoutes>() };
+
+    //! Patterns and the requests hitting them, shuffled so the lookups don't walk the table in order.
+    struct Workload {
+        std::vector<std::string> patterns;
+        std::vector<Route> routes;
+        std::vector<std::pair<std::string_view, std::string>> requests;
+
+        void Shuffle() {
+            std::ranges::shuffle(requests, std::mt19937{ 42 });
+        }
+    };
+
+    //! A concrete path for `pattern`: every `{param}` becomes `p<i>`.
+    std::string Instantiate(const std::string_view pattern, const size_t seed) {
+        std::string path;
+        for (size_t pos{}; pos < pattern.size();) {
+            const auto open{ std::min(pattern.find('{', pos), pattern.size()) };
+            path.append(pattern, pos, open - pos);
+            if (open == pattern.size()) break;
+
+            std::format_to(std::back_inserter(path), "p{}", seed);
+            pos = pattern.find('}', open) + 1;
+        }
+        return path;
+    }
+
+    const Workload& ApiWorkload() {
+        static const Workload workload{ [] {
+            Workload res;
+            res.routes.assign(k_apiRoutes.begin(), k_apiRoutes.end());
+            for (size_t i{}; i < 4096; ++i) {
+                const auto& route{ k_apiRoutes[i % k_apiRoutes.size()] };
+                res.requests.emplace_back(route.method, Instantiate(route.pattern, i));
+            }
+
+            res.Shuffle();
+            return res;
+        }() };
+        return workload;
+    }
+
+    //! Resources under a few API versions, each with a collection, an item and a nested item route.
+    template<size_t RouteCount>
+    const Workload& GeneratedWorkload() {
+        static const Workload workload{ [] {
+            Workload res;
+            for (size_t i{}; res.patterns.size() < RouteCount; ++i) {
+                const auto base{ std::format("/api/v{}/resource{}", i % 4, i) };
+                res.patterns.push_back(base);
+                res.patterns.push_back(std::format("{}/{{id}}", base));
+                res.patterns.push_back(std::format("{}/{{id}}/items/{{item}}", base));
+            }
+            res.patterns.resize(RouteCount);
+
+            for (const auto& pattern : res.patterns)
+                res.routes.push_back({ "GET", pattern });
+
+            for (size_t i{}; i < 4096; ++i)
+                res.requests.emplace_back("GET", Instantiate(res.patterns[i * 7919 % RouteCount], i));
+
+            res.Shuffle();
+            return res;
+        }() };
+        return workload;
+    }
+
+    template<class Matcher>
+    void RunLookups(benchmark::State& state, const Workload& workload, const Matcher& match) {
+        size_t next{};
+        for (auto _ : state) {
+            const auto& [method, path]{ workload.requests[next] };
+            next = (next + 1) % workload.requests.size();
+
+            auto res{ match(method, path) };
+            benchmark::DoNotOptimize(res);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+}
+
+#pragma endregion
+
+
+#pragma region Api
+
+static void BM_Router_Radix_Api(benchmark::State& state) {
+    RunLookups(state, ApiWorkload(), [](const std::string_view method, const std::string_view path) {
+        return k_apiTable.Match(method, path);
+    });
+}
+
+static void BM_Router_Linear_Api(benchmark::State& state) {
+    const LinearRouter router{ ApiWorkload().routes };
+
+    RunLookups(state, ApiWorkload(), [&](const std::string_view method, const std::string_view path) {
+        RouteParams params;
+        return std::pair{ router.Match(method, path, params), params };
+    });
+}
+
+#pragma endregion
+
+
+#pragma region Generated
+
+template<size_t RouteCount>
+static void BM_Router_Radix_Generated(benchmark::State& state) {
+    const auto& workload{ GeneratedWorkload<RouteCount>() };
+
+    // The longest generated pattern is well under 64 characters, one node per character bounds the tree.
+    const auto table{ std::make_unique<RouteTable<RouteCount, 64 * RouteCount>>() };
+    if (!table->Build(workload.routes)) {
+        state.SkipWithError("invalid routes");
+        return;
+    }
+
+    RunLookups(state, workload, [&](const std::string_view method, const std::string_view path) {
+        return table->Match(method, path);
+    });
+}
+
+template<size_t RouteCount>
+static void BM_Router_Linear_Generated(benchmark::State& state) {
+    const auto& workload{ GeneratedWorkload<RouteCount>() };
+    const LinearRouter router{ workload.routes };
+
+    RunLookups(state, workload, [&](const std::string_view method, const std::string_view path) {
+        RouteParams params;
+        return std::pair{ router.Match(method, path, params), params };
+    });
+}
+
+#pragma endregion
+
+
+BENCHMARK(BM_Router_Radix_Api) ->Name("Router/Radix/Api");
+BENCHMARK(BM_Router_Linear_Api)->Name("Router/Linear/Api");
+
+BENCHMARK(BM_Router_Radix_Generated<256>)  ->Name("Router/Radix/Generated/256");
+BENCHMARK(BM_Router_Radix_Generated<1024>) ->Name("Router/Radix/Generated/1024");
+BENCHMARK(BM_Router_Radix_Generated<4096>) ->Name("Router/Radix/Generated/4096");
+BENCHMARK(BM_Router_Linear_Generated<256>) ->Name("Router/Linear/Generated/256");
+BENCHMARK(BM_Router_Linear_Generated<1024>)->Name("Router/Linear/Generated/1024");
+BENCHMARK(BM_Router_Linear_Generated<4096>)->Name("Router/Linear/Generated/4096");
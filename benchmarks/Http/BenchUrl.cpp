@@ -0,0 +1,148 @@
+/**
+ * @file BenchUrl.cpp
+ * @brief URL construction on the client hot path: parsing, reading the authority and building from a template.
+ *
+ *   - Url/Parse            : `Url::FromUrl` of a copy of an API URL
+ *   - Url/View/Parse       : `UrlView::FromUrl` of the same text, nothing copied
+ *   - Url/GetAuthority     : `Url::GetAuthority` host and port, an `AuthorityView` built per call
+ *   - Url/View/Host        : `UrlView::GetHost`/`GetPort`, the text as written
+ *   - Url/Template/Format  : `std::format` of base, segments and params, then `Url::FromUrl`
+ *   - Url/Template/Builder : the same URL through `UrlBuilder` from a base parsed once
+ *   - Url/Encode           : `Url::Encode` of a realistic query string, mostly unreserved runs
+ *   - Url/Decode           : `Url::TryDecode` of the encoded query string
+ *   - Url/Decode/InPlace   : `Url::DecodeInPlace` over a copy of it, no second buffer
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <Thoth/Http/Url/Url.hpp>
+#include <Thoth/Http/Url/UrlBuilder.hpp>
+#include <Thoth/Http/Url/UrlView.hpp>
+
+#include <format>
+#include <string>
+#include <string_view>
+
+using namespace Thoth::Http;
+
+
+namespace {
+    constexpr std::string_view k_rawUrl{ "https://user@api.example.com:8443/v1/users/42/orders?page=2&limit=50#top" };
+    constexpr std::string_view k_base  { "https://api.example.com/v1" };
+    constexpr std::string_view k_query {
+        "q=thoth http client&sort=-updated_at&filter[status]=open,in_progress&since=2024-05-01T12:00:00Z"
+        "&redirect_uri=https://app.example.com/callback?state=xyz&name=Jos\xC3\xA9 N\xC3\xBA\xC3\xB1ez" };
+}
+
+
+static void BM_Url_Parse(benchmark::State& state) {
+    for (auto _ : state) {
+        auto url{ Url::FromUrl(std::string{ k_rawUrl }) };
+        benchmark::DoNotOptimize(url);
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(k_rawUrl.size()));
+}
+
+static void BM_Url_View_Parse(benchmark::State& state) {
+    for (auto _ : state) {
+        auto view{ UrlView::FromUrl(k_rawUrl) };
+        benchmark::DoNotOptimize(view);
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(k_rawUrl.size()));
+}
+
+static void BM_Url_GetAuthority(benchmark::State& state) {
+    const auto url{ Url::FromUrl(std::string{ k_rawUrl }).value() };
+
+    for (auto _ : state) {
+        const auto authority{ url.GetAuthority() };
+        benchmark::DoNotOptimize(authority->host);
+        benchmark::DoNotOptimize(authority->port);
+    }
+}
+
+static void BM_Url_View_Host(benchmark::State& state) {
+    const auto view{ UrlView::FromUrl(k_rawUrl).value() };
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(view.GetHost());
+        benchmark::DoNotOptimize(view.GetPort());
+    }
+}
+
+static void BM_Url_Template_Format(benchmark::State& state) {
+    int64_t id{};
+
+    for (auto _ : state) {
+        ++id;
+        auto url{ Url::FromUrl(std::format("{}/users/{}/orders?page={}&limit=50", k_base, id, id % 7)) };
+        benchmark::DoNotOptimize(url);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_Url_Template_Builder(benchmark::State& state) {
+    const auto base{ Url::FromUrl(std::string{ k_base }).value() };
+    int64_t id{};
+
+    for (auto _ : state) {
+        ++id;
+        auto url{ UrlBuilder{ base, 96 }
+            .AppendPath("users")
+            .AppendPath(std::to_string(id))
+            .AppendPath("orders")
+            .AppendQuery("page", std::to_string(id % 7))
+            .AppendQuery("limit", "50")
+            .Build() };
+        benchmark::DoNotOptimize(url);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_Url_Encode(benchmark::State& state) {
+    for (auto _ : state) {
+        auto encoded{ Url::Encode(k_query) };
+        benchmark::DoNotOptimize(encoded);
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(k_query.size()));
+}
+
+static void BM_Url_Decode(benchmark::State& state) {
+    const auto encoded{ Url::Encode(k_query) };
+
+    for (auto _ : state) {
+        auto decoded{ Url::TryDecode(encoded) };
+        benchmark::DoNotOptimize(decoded);
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(encoded.size()));
+}
+
+static void BM_Url_Decode_InPlace(benchmark::State& state) {
+    const auto encoded{ Url::Encode(k_query) };
+    std::string buffer;
+    buffer.reserve(encoded.size());
+
+    for (auto _ : state) {
+        buffer.assign(encoded);
+        benchmark::DoNotOptimize(Url::DecodeInPlace(buffer));
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(encoded.size()));
+}
+
+
+BENCHMARK(BM_Url_Parse)           ->Name("Url/Parse");
+BENCHMARK(BM_Url_View_Parse)      ->Name("Url/View/Parse");
+BENCHMARK(BM_Url_GetAuthority)    ->Name("Url/GetAuthority");
+BENCHMARK(BM_Url_View_Host)       ->Name("Url/View/Host");
+BENCHMARK(BM_Url_Template_Format) ->Name("Url/Template/Format");
+BENCHMARK(BM_Url_Template_Builder)->Name("Url/Template/Builder");
+BENCHMARK(BM_Url_Encode)          ->Name("Url/Encode");
+BENCHMARK(BM_Url_Decode)          ->Name("Url/Decode");
+BENCHMARK(BM_Url_Decode_InPlace)  ->Name("Url/Decode/InPlace");
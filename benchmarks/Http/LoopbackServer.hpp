@@ -0,0 +1,366 @@
+/**
+ * @file LoopbackServer.hpp
+ * @brief In-process HTTP/1.1 server on 127.0.0.1 for reproducible client benchmarks.
+ *
+ * The response is chosen by the query string of the request target, so a single server covers every scenario:
+ *
+ *   GET /bytes?size=65536&framing=chunked&connection=close&delay=2
+ *
+ *   - size       : body length in bytes (default 0)
+ *   - framing    : `sized` (Content-Length, default) or `chunked`
+ *   - connection : `keep-alive` (default) or `close`
+ *   - delay      : milliseconds slept before answering (default 0)
+ *
+ * Request bodies (sized or chunked) are read and discarded. Bodies are served from a prebuilt buffer and the
+ * head is formatted once per request into a reused string, so the server costs as little as possible next to
+ * the client under test. One thread per connection, blocking sockets: the server never becomes the bottleneck
+ * of a single client thread.
+ */
+
+#pragma once
+
+#ifdef _WIN32
+#  ifndef WIN32_LEAN_AND_MEAN
+#    define WIN32_LEAN_AND_MEAN
+#  endif
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  include <winsock2.h>
+#  include <ws2tcpip.h>
+#else
+#  include <arpa/inet.h>
+#  include <netinet/in.h>
+#  include <netinet/tcp.h>
+#  include <sys/socket.h>
+#  include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <climits>
+#include <cctype>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <format>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_set>
+
+
+namespace Bench {
+    struct LoopbackServer {
+#ifdef _WIN32
+        using Socket = SOCKET;
+        static constexpr Socket k_invalidSocket{ INVALID_SOCKET };
+#else
+        using Socket = int;
+        static constexpr Socket k_invalidSocket{ -1 };
+#endif
+
+        static constexpr size_t k_maxBodySize { 64 << 20 };
+        static constexpr size_t k_chunkSize   { 16 << 10 };
+
+        //! @brief Starts listening on an ephemeral loopback port.
+        LoopbackServer() : m_body(k_maxBodySize, 'x') {
+#ifdef _WIN32
+            WSADATA wsaData;
+            WSAStartup(MAKEWORD(2, 2), &wsaData);
+#endif
+            m_listener = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+            if (m_listener == k_invalidSocket)
+                throw std::runtime_error{ "LoopbackServer: socket() failed" };
+
+            sockaddr_in addr{};
+            addr.sin_family      = AF_INET;
+            addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            addr.sin_port        = 0;
+
+            socklen_t addrLen{ sizeof(addr) };
+            if (::bind(m_listener, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0
+                || ::listen(m_listener, SOMAXCONN) != 0
+                || ::getsockname(m_listener, reinterpret_cast<sockaddr*>(&addr), &addrLen) != 0)
+                throw std::runtime_error{ "LoopbackServer: unable to listen on 127.0.0.1" };
+
+            m_port = ntohs(addr.sin_port);
+            m_acceptThread = std::thread{ [this] { AcceptLoop_(); } };
+        }
+
+        LoopbackServer(const LoopbackServer&)            = delete;
+        LoopbackServer& operator=(const LoopbackServer&) = delete;
+
+        ~LoopbackServer() {
+            m_stopping = true;
+            Close_(m_listener);
+            m_acceptThread.join();
+
+            // Wakes the connections blocked in recv, each one closes its socket and leaves.
+            std::unique_lock lock{ m_connectionsMutex };
+            for (const Socket socket : m_connections)
+                ShutDown_(socket);
+            m_idle.wait(lock, [this] { return m_connections.empty(); });
+#ifdef _WIN32
+            WSACleanup();
+#endif
+        }
+
+        //! @brief The server shared by every benchmark of the executable.
+        static LoopbackServer& Instance() {
+            static LoopbackServer server;
+            return server;
+        }
+
+        [[nodiscard]] uint16_t Port() const { return m_port; }
+
+        //! @brief `http://127.0.0.1:<port><target>`.
+        [[nodiscard]] std::string Url(std::string_view target) const {
+            return std::format("http://127.0.0.1:{}{}", m_port, target);
+        }
+
+        //! @brief Requests answered since the server started.
+        [[nodiscard]] uint64_t Served() const { return m_served; }
+
+        //! @brief Connections accepted since the server started.
+        [[nodiscard]] uint64_t Accepted() const { return m_accepted; }
+
+    private:
+        struct ResponseSpec {
+            size_t size{};
+            bool chunked{};
+            bool close{};
+            std::chrono::milliseconds delay{};
+        };
+
+
+        static void Close_(const Socket socket) {
+#ifdef _WIN32
+            ::shutdown(socket, SD_BOTH);
+            ::closesocket(socket);
+#else
+            ::shutdown(socket, SHUT_RDWR);
+            ::close(socket);
+#endif
+        }
+
+        static void ShutDown_(const Socket socket) {
+#ifdef _WIN32
+            ::shutdown(socket, SD_BOTH);
+#else
+            ::shutdown(socket, SHUT_RDWR);
+#endif
+        }
+
+        static bool SendAll_(const Socket socket, std::string_view data) {
+            while (!data.empty()) {
+                const auto sent{ ::send(socket, data.data(), static_cast<int>(std::min<size_t>(data.size(), INT32_MAX)), 0) };
+                if (sent <= 0) return false;
+                data.remove_prefix(static_cast<size_t>(sent));
+            }
+            return true;
+        }
+
+        static std::optional<std::string_view> QueryValue_(std::string_view target, const std::string_view key) {
+            const auto query{ target.find('?') };
+            if (query == std::string_view::npos) return std::nullopt;
+
+            for (target.remove_prefix(query + 1); !target.empty();) {
+                const auto amp  { target.find('&') };
+                const auto param{ target.substr(0, amp) };
+
+                if (const auto eq{ param.find('=') }; eq != std::string_view::npos && param.substr(0, eq) == key)
+                    return param.substr(eq + 1);
+
+                if (amp == std::string_view::npos) break;
+                target.remove_prefix(amp + 1);
+            }
+
+            return std::nullopt;
+        }
+
+        static size_t QueryNumber_(const std::string_view target, const std::string_view key) {
+            size_t res{};
+            if (const auto value{ QueryValue_(target, key) })
+                std::from_chars(value->data(), value->data() + value->size(), res);
+            return res;
+        }
+
+        //! `head` is lowercase.
+        static std::optional<std::string_view> HeaderValue_(const std::string_view head, const std::string_view name) {
+            const auto line{ head.find(std::format("\r\n{}:", name)) };
+            if (line == std::string_view::npos) return std::nullopt;
+
+            const auto valueStart{ line + name.size() + 3 };
+            return head.substr(valueStart, head.find("\r\n", valueStart) - valueStart);
+        }
+
+        static bool HasToken_(const std::string_view head, const std::string_view name, const std::string_view token) {
+            const auto value{ HeaderValue_(head, name) };
+            return value && value->find(token) != std::string_view::npos;
+        }
+
+        static ResponseSpec ParseSpec_(const std::string_view head) {
+            const auto targetStart{ head.find(' ') + 1 };
+            const auto target     { head.substr(targetStart, head.find(' ', targetStart) - targetStart) };
+
+            return {
+                .size    = std::min(QueryNumber_(target, "size"), k_maxBodySize),
+                .chunked = QueryValue_(target, "framing") == "chunked",
+                .close   = QueryValue_(target, "connection") == "close" || HasToken_(head, "connection", "close"),
+                .delay   = std::chrono::milliseconds{ QueryNumber_(target, "delay") },
+            };
+        }
+
+
+        void AcceptLoop_() {
+            while (!m_stopping) {
+                const Socket client{ ::accept(m_listener, nullptr, nullptr) };
+                if (client == k_invalidSocket) continue;
+
+                int noDelay{ 1 };
+                ::setsockopt(client, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&noDelay), sizeof(noDelay));
+
+                ++m_accepted;
+
+                std::lock_guard lock{ m_connectionsMutex };
+                if (m_stopping) {
+                    Close_(client);
+                    break;
+                }
+
+                // Detached, a `connection: close` scenario opens thousands of them. The destructor waits for
+                // `m_connections` to drain instead of joining.
+                m_connections.insert(client);
+                std::thread{ [this, client] { Serve_(client); } }.detach();
+            }
+        }
+
+        //! Reads from `buffer` (refilled from the socket) until `delimiter`, returns the position after it.
+        static std::optional<size_t> ReadUntil_(const Socket socket, std::string& buffer, const std::string_view delimiter, size_t from = 0) {
+            char chunk[16 << 10];
+
+            for (;;) {
+                if (const auto pos{ buffer.find(delimiter, from) }; pos != std::string::npos)
+                    return pos + delimiter.size();
+
+                from = buffer.size() >= delimiter.size() ? buffer.size() - delimiter.size() + 1 : 0;
+
+                const auto received{ ::recv(socket, chunk, sizeof(chunk), 0) };
+                if (received <= 0) return std::nullopt;
+                buffer.append(chunk, static_cast<size_t>(received));
+            }
+        }
+
+        static bool ReadExactly_(const Socket socket, std::string& buffer, const size_t count) {
+            char chunk[16 << 10];
+
+            while (buffer.size() < count) {
+                const auto received{ ::recv(socket, chunk, sizeof(chunk), 0) };
+                if (received <= 0) return false;
+                buffer.append(chunk, static_cast<size_t>(received));
+            }
+            return true;
+        }
+
+        //! Drops the request body from `buffer`, `headEnd` being the position after the head.
+        static bool SkipBody_(const Socket socket, std::string& buffer, const std::string_view head, size_t headEnd) {
+            if (HasToken_(head, "transfer-encoding", "chunked")) {
+                for (;;) {
+                    const auto lineEnd{ ReadUntil_(socket, buffer, "\r\n", headEnd) };
+                    if (!lineEnd) return false;
+
+                    size_t chunkSize{};
+                    std::from_chars(buffer.data() + headEnd, buffer.data() + *lineEnd, chunkSize, 16);
+
+                    // The last chunk has no data, only its CRLF (trailers aren't sent by the client).
+                    if (!ReadExactly_(socket, buffer, *lineEnd + chunkSize + 2)) return false;
+                    headEnd = *lineEnd + chunkSize + 2;
+
+                    if (chunkSize == 0) break;
+                }
+            } else if (auto value{ HeaderValue_(head, "content-length") }) {
+                while (value->starts_with(' ')) value->remove_prefix(1);
+
+                size_t length{};
+                std::from_chars(value->data(), value->data() + value->size(), length);
+
+                if (!ReadExactly_(socket, buffer, headEnd + length)) return false;
+                headEnd += length;
+            }
+
+            buffer.erase(0, headEnd);
+            return true;
+        }
+
+        void Serve_(const Socket socket) {
+            std::string buffer;
+            std::string responseHead;
+
+            for (bool open{ true }; open && !m_stopping;) {
+                const auto headEnd{ ReadUntil_(socket, buffer, "\r\n\r\n") };
+                if (!headEnd) break;
+
+                std::string head{ buffer.substr(0, *headEnd) };
+                std::ranges::transform(head, head.begin(), [](const unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+                const auto spec{ ParseSpec_(head) };
+
+                if (!SkipBody_(socket, buffer, head, *headEnd)) break;
+
+                if (spec.delay.count() != 0)
+                    std::this_thread::sleep_for(spec.delay);
+
+                responseHead.clear();
+                std::format_to(std::back_inserter(responseHead),
+                    "HTTP/1.1 200 OK\r\nContent-Type: application/octet-stream\r\nConnection: {}\r\n",
+                    spec.close ? "close" : "keep-alive");
+
+                const std::string_view body{ m_body.data(), spec.size };
+
+                if (!spec.chunked) {
+                    std::format_to(std::back_inserter(responseHead), "Content-Length: {}\r\n\r\n", spec.size);
+                    open = SendAll_(socket, responseHead) && SendAll_(socket, body);
+                } else {
+                    responseHead += "Transfer-Encoding: chunked\r\n\r\n";
+                    open = SendAll_(socket, responseHead);
+
+                    for (size_t pos{}; open && pos < body.size(); pos += k_chunkSize) {
+                        const auto chunk{ body.substr(pos, k_chunkSize) };
+                        open = SendAll_(socket, std::format("{:x}\r\n", chunk.size()))
+                               && SendAll_(socket, chunk) && SendAll_(socket, "\r\n");
+                    }
+
+                    open = open && SendAll_(socket, "0\r\n\r\n");
+                }
+
+                ++m_served;
+                open = open && !spec.close;
+            }
+
+            std::lock_guard lock{ m_connectionsMutex };
+            m_connections.erase(socket);
+            Close_(socket);
+            m_idle.notify_all();
+        }
+
+
+        const std::string m_body;
+
+        Socket m_listener{ k_invalidSocket };
+        uint16_t m_port{};
+
+        std::atomic<bool> m_stopping{};
+        std::atomic<uint64_t> m_served{};
+        std::atomic<uint64_t> m_accepted{};
+
+        std::thread m_acceptThread;
+        std::mutex m_connectionsMutex;
+        std::condition_variable m_idle;
+        std::unordered_set<Socket> m_connections;
+    };
+}
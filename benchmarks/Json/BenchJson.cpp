@@ -10,7 +10,9 @@
  *   - ParseNoCopy       : zero-copy / on-demand where supported
  *   - Stringify         : DOM → string
  *   - KeyAccess         : random key look-up on parsed object
+ *   - KeyAccess/Wide    : every member of a wide object looked up, against the pair layout JsonObject used before
  *   - ArrayIteration    : walk every element of a parsed array
+ *   - ShortStrings      : parse, then read, an array of mostly short strings (the ones JsonString keeps inline)
  *   - BuildObject       : programmatic construction of a complex object
  *   - BuildArray        : programmatic construction of a large array
  *   - RoundTrip         : Parse → modify one key → Stringify
@@ -33,6 +35,8 @@
 // ── Thoth ─────────────────────────────────────────────────────────────
 #include <Thoth/NJson/Json.hpp>
 #include <Thoth/NJson/JsonObject.hpp>
+#include <Thoth/NJson/JsonLiteral.hpp>
+#include <Thoth/Dsa/LinearMap.hpp>
 
 // ── nlohmann ──────────────────────────────────────────────────────────
 #include <nlohmann/json.hpp>
@@ -47,7 +51,9 @@
 #include <rapidjson/error/en.h>
 
 // ── std ───────────────────────────────────────────────────────────────
+#include <algorithm>
 #include <fstream>
+#include <random>
 #include <sstream>
 #include <string>
 #include <format>
@@ -171,6 +177,28 @@ static void BM_Thoth_Parse_NoCopy(benchmark::State& state) {
     state.SetLabel(std::string(DSName(ds)) + "/nocopy");
 }
 
+template<DS ds>
+static void BM_Thoth_Parse_LazyNumbers(benchmark::State& state) {
+    const std::string& src{ Pick(ds) };
+    for (auto _ : state) {
+        auto result{ Thoth::NJson::Json::ParseText(src, true, true, true) };
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(src.size()));
+    state.SetLabel(std::string(DSName(ds)) + "/lazy");
+}
+
+template<DS ds>
+static void BM_Thoth_Parse_LazyUnescape(benchmark::State& state) {
+    const std::string& src{ Pick(ds) };
+    for (auto _ : state) {
+        auto result{ Thoth::NJson::Json::ParseText(src, { .lazyUnescape = true }) };
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(src.size()));
+    state.SetLabel(std::string(DSName(ds)) + "/lazy_unescape");
+}
+
 // ── Stringify ──────────────────────────────────────────────────────────
 
 template<DS ds>
@@ -203,6 +231,99 @@ static void BM_Thoth_KeyAccess_Medium(benchmark::State& state) {
     }
 }
 
+// Map is JsonObject::MapType (keys apart from the values) or the LinearMap of pairs it replaced. Every member is a
+// small object, so the pair layout drags it through the cache while bisecting the keys.
+template<class Map>
+static void BM_Thoth_KeyAccess_Wide(benchmark::State& state) {
+    using namespace Thoth::NJson;
+    const auto count{ static_cast<size_t>(state.range(0)) };
+
+    std::vector<std::pair<std::string, Json>> pairs;
+    std::vector<std::string> keys;
+    for (size_t i{}; i < count; ++i) {
+        keys.push_back(std::format("member_{:05}", i));
+        pairs.emplace_back(keys.back(), JsonObject{
+            { "id",     static_cast<int64_t>(i) },
+            { "name",   "Alice" },
+            { "email",  "alice@example.com" },
+            { "active", true },
+        });
+    }
+
+    const auto map{ Map::FromUnsorted(std::move(pairs), Thoth::Dsa::DuplicateKeyEnum::KeepLast) };
+    std::ranges::shuffle(keys, std::mt19937{ 42 });
+
+    for (auto _ : state)
+        for (const auto& key : keys)
+            benchmark::DoNotOptimize(map.find(std::string_view{ key }));
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+
+// ── Error Path ─────────────────────────────────────────────────────────
+
+static void BM_Thoth_GetOrError_Medium(benchmark::State& state) {
+    // One hit, one missing key and one wrong type: every miss returns a ThothError through std::expected
+    auto parsed{ Thoth::NJson::Json::Parse(Dataset::Get().medium) };
+    if (!parsed) { state.SkipWithError("parse failed"); return; }
+
+    for (auto _ : state) {
+        auto total  { parsed->GetOrError("total")   };
+        auto missing{ parsed->GetOrError("missing") };
+        auto wrong  { parsed->EnsureRefOrError<Thoth::NJson::Array>() };
+        benchmark::DoNotOptimize(total);
+        benchmark::DoNotOptimize(missing);
+        benchmark::DoNotOptimize(wrong);
+    }
+}
+
+// ── Literal ────────────────────────────────────────────────────────────
+
+// A canned response embedded in the binary, built from a compile-time literal or parsed from its text.
+#define CANNED_RESPONSE                                                                                 \
+    R"({"status": "ok", "code": 200, "message": "The request was processed successfully", )"            \
+    R"("data": {"items": [], "page": 1, "pageSize": 50, "total": 0}, )"                                 \
+    R"("links": {"self": "/api/v1/items?page=1", "next": null}, "ratio": 0.75, )"                       \
+    R"("tags": ["default", "cached", "public"]})"
+
+static void BM_Thoth_Literal_Canned(benchmark::State& state) {
+    using namespace Thoth::NJson::Literals;
+    for (auto _ : state) {
+        Thoth::NJson::Json json{ CANNED_RESPONSE ""_json };
+        benchmark::DoNotOptimize(json);
+    }
+}
+
+static void BM_Thoth_Parse_Canned(benchmark::State& state) {
+    for (auto _ : state) {
+        auto json{ Thoth::NJson::Json::Parse(CANNED_RESPONSE) };
+        benchmark::DoNotOptimize(json);
+    }
+}
+
+// ── Hash ───────────────────────────────────────────────────────────────
+
+static void BM_Thoth_Hash_Medium(benchmark::State& state) {
+    auto parsed{ Thoth::NJson::Json::Parse(Dataset::Get().medium) };
+    if (!parsed) { state.SkipWithError("parse failed"); return; }
+
+    for (auto _ : state) {
+        auto hash{ parsed->Hash() };
+        benchmark::DoNotOptimize(hash);
+    }
+}
+
+static void BM_Thoth_Canonical_Medium(benchmark::State& state) {
+    // The alternative cache key: the canonical text of the document
+    auto parsed{ Thoth::NJson::Json::Parse(Dataset::Get().medium) };
+    if (!parsed) { state.SkipWithError("parse failed"); return; }
+
+    for (auto _ : state) {
+        std::string out{ std::format("{:c}", *parsed) };
+        benchmark::DoNotOptimize(out);
+    }
+}
+
 // ── Array Iteration ────────────────────────────────────────────────────
 
 static void BM_Thoth_ArrayIteration_Array(benchmark::State& state) {
@@ -236,6 +357,92 @@ static void BM_Thoth_ArrayIteration_Large(benchmark::State& state) {
     }
 }
 
+// ── Short Strings ──────────────────────────────────────────────────────
+
+// 20 000 strings, 4 in 5 of 3 to 16 chars and the others of 23 to 64, one in 8 ending with an escape.
+static const std::string& ShortStrings() {
+    static const std::string text{ [] {
+        std::mt19937 rng{ 42 };
+        std::uniform_int_distribution roll{ 0, 39 };
+        std::uniform_int_distribution shortSize{ 3, 16 };
+        std::uniform_int_distribution longSize{ 23, 64 };
+
+        std::string res{ "[" };
+        for (int i{}; i < 20'000; ++i) {
+            const int kind{ roll(rng) };
+            const int size{ kind < 32 ? shortSize(rng) : longSize(rng) };
+
+            res += i ? ",\"" : "\"";
+            for (int c{}; c < size; ++c)
+                res += static_cast<char>('a' + (i + c) % 26);
+            if (kind % 8 == 0)
+                res += "\\n";
+            res += '"';
+        }
+        return res + "]";
+    }() };
+    return text;
+}
+
+static void BM_Thoth_Parse_ShortStrings(benchmark::State& state) {
+    const std::string& src{ ShortStrings() };
+    for (auto _ : state) {
+        auto result{ Thoth::NJson::Json::Parse(src) };
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(src.size()));
+    state.counters["sizeof(Json)"]   = sizeof(Thoth::NJson::Json);
+    state.counters["sizeof(String)"] = sizeof(Thoth::NJson::String);
+}
+
+static void BM_Thoth_Iterate_ShortStrings(benchmark::State& state) {
+    auto parsed{ Thoth::NJson::Json::Parse(ShortStrings()) };
+    if (!parsed) { state.SkipWithError("parse failed"); return; }
+
+    const auto& arr{ parsed->AsRef<Thoth::NJson::Array>() };
+    for (auto _ : state) {
+        std::size_t chars{};
+        for (const auto& elem : arr)
+            chars += elem.AsRef<Thoth::NJson::String>().AsView().size();
+        benchmark::DoNotOptimize(chars);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(arr.size()));
+}
+
+// ── Parallel ───────────────────────────────────────────────────────────
+
+// Elements of large.json whose "name" has a '7', filtered on state.range(0) threads.
+static bool HasSeven(const Thoth::NJson::Json& elem) {
+    const auto name{ elem.Get("name") };
+    return name && (*name)->IsOf<Thoth::NJson::String>() && (*name)->AsRef<Thoth::NJson::String>().AsView().contains('7');
+}
+
+static void BM_Thoth_ParallelFilter_Large(benchmark::State& state) {
+    auto parsed{ Thoth::NJson::Json::Parse(Dataset::Get().large) };
+    if (!parsed) { state.SkipWithError("parse failed"); return; }
+
+    const auto& data{ **parsed->Get("data") };
+    const Thoth::NJson::ParallelOptions options{ .threads = static_cast<size_t>(state.range(0)), .grain = 256 };
+
+    for (auto _ : state) {
+        auto filtered{ data.ParallelFilter(HasSeven, options) };
+        benchmark::DoNotOptimize(filtered);
+    }
+}
+
+static void BM_Thoth_ParallelTransform_Large(benchmark::State& state) {
+    auto parsed{ Thoth::NJson::Json::Parse(Dataset::Get().large) };
+    if (!parsed) { state.SkipWithError("parse failed"); return; }
+
+    const auto& data{ **parsed->Get("data") };
+    const Thoth::NJson::ParallelOptions options{ .threads = static_cast<size_t>(state.range(0)), .grain = 256 };
+
+    for (auto _ : state) {
+        auto names{ data.ParallelTransform([](const Thoth::NJson::Json& elem) { return elem.GetCopyOrNull("name"); }, options) };
+        benchmark::DoNotOptimize(names);
+    }
+}
+
 // ── Path Traversal ─────────────────────────────────────────────────────
 
 static void BM_Thoth_PathTraversal_Nested(benchmark::State& state) {
@@ -815,6 +1022,10 @@ BENCH_PARSE_ALL(Rapidjson);
 // ── Parse NoCopy / InSitu ──────────────────────────────────────────────
 BENCHMARK_TEMPLATE(BM_Thoth_Parse_NoCopy,     DS::Medium)->Name("Parse/Thoth/Medium/NoCopy");
 BENCHMARK_TEMPLATE(BM_Thoth_Parse_NoCopy,     DS::Large) ->Name("Parse/Thoth/Large/NoCopy");
+BENCHMARK_TEMPLATE(BM_Thoth_Parse_LazyNumbers, DS::Numbers)->Name("Parse/Thoth/Numbers/LazyNumbers");
+BENCHMARK_TEMPLATE(BM_Thoth_Parse_LazyNumbers, DS::Twitter)->Name("Parse/Thoth/Twitter/LazyNumbers");
+BENCHMARK_TEMPLATE(BM_Thoth_Parse_LazyUnescape, DS::Strings)->Name("Parse/Thoth/Strings/LazyUnescape");
+BENCHMARK_TEMPLATE(BM_Thoth_Parse_LazyUnescape, DS::Twitter)->Name("Parse/Thoth/Twitter/LazyUnescape");
 BENCHMARK_TEMPLATE(BM_Simdjson_DOM_Parse,     DS::Medium)->Name("Parse/Simdjson_DOM/Medium");
 BENCHMARK_TEMPLATE(BM_Simdjson_DOM_Parse,     DS::Large) ->Name("Parse/Simdjson_DOM/Large");
 BENCHMARK_TEMPLATE(BM_Rapidjson_Parse_InSitu, DS::Medium)->Name("Parse/Rapidjson/Medium/InSitu");
@@ -839,6 +1050,21 @@ BENCHMARK(BM_Thoth_KeyAccess_Medium)    ->Name("KeyAccess/Thoth/Medium");
 BENCHMARK(BM_Nlohmann_KeyAccess_Medium) ->Name("KeyAccess/Nlohmann/Medium");
 BENCHMARK(BM_Simdjson_KeyAccess_Medium) ->Name("KeyAccess/Simdjson_DOM/Medium");
 BENCHMARK(BM_Rapidjson_KeyAccess_Medium)->Name("KeyAccess/Rapidjson/Medium");
+BENCHMARK(BM_Thoth_KeyAccess_Wide<Thoth::NJson::JsonObject::MapType>)
+    ->Name("KeyAccess/Thoth/Wide")->RangeMultiplier(4)->Range(16, 4096);
+BENCHMARK(BM_Thoth_KeyAccess_Wide<Thoth::Dsa::LinearMap<std::string, Thoth::NJson::Json>>)
+    ->Name("KeyAccess/Thoth/Wide/PairLayout")->RangeMultiplier(4)->Range(16, 4096);
+
+// ── Error Path ─────────────────────────────────────────────────────────
+BENCHMARK(BM_Thoth_GetOrError_Medium)->Name("ErrorPath/Thoth/Medium");
+
+// ── Literal ────────────────────────────────────────────────────────────
+BENCHMARK(BM_Thoth_Literal_Canned)->Name("Literal/Thoth/Canned");
+BENCHMARK(BM_Thoth_Parse_Canned)  ->Name("Literal/Thoth/Canned/Parse");
+
+// ── Hash ───────────────────────────────────────────────────────────────
+BENCHMARK(BM_Thoth_Hash_Medium)     ->Name("Hash/Thoth/Medium");
+BENCHMARK(BM_Thoth_Canonical_Medium)->Name("Hash/Thoth/Medium/Canonical");
 
 // ── Array Iteration ────────────────────────────────────────────────────
 BENCHMARK(BM_Thoth_ArrayIteration_Array)    ->Name("ArrayIteration/Thoth/Array");
@@ -851,6 +1077,14 @@ BENCHMARK(BM_Nlohmann_ArrayIteration_Large) ->Name("ArrayIteration/Nlohmann/Larg
 BENCHMARK(BM_Simdjson_ArrayIteration_Large) ->Name("ArrayIteration/Simdjson_DOM/Large");
 BENCHMARK(BM_Rapidjson_ArrayIteration_Large)->Name("ArrayIteration/Rapidjson/Large");
 
+// ── Short Strings ──────────────────────────────────────────────────────
+BENCHMARK(BM_Thoth_Parse_ShortStrings)  ->Name("Parse/Thoth/ShortStrings");
+BENCHMARK(BM_Thoth_Iterate_ShortStrings)->Name("Iterate/Thoth/ShortStrings");
+
+// ── Parallel ───────────────────────────────────────────────────────────
+BENCHMARK(BM_Thoth_ParallelFilter_Large)   ->Name("Parallel/Filter/Thoth/Large")   ->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+BENCHMARK(BM_Thoth_ParallelTransform_Large)->Name("Parallel/Transform/Thoth/Large")->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+
 // ── Build Object ───────────────────────────────────────────────────────
 BENCHMARK(BM_Thoth_BuildObject)    ->Name("Build/Object/Thoth");
 BENCHMARK(BM_Nlohmann_BuildObject) ->Name("Build/Object/Nlohmann");
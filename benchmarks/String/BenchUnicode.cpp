@@ -0,0 +1,147 @@
+/**
+ * @file BenchUnicode.cpp
+ * @brief UTF-8 validation and transcoding throughput of String::UnicodeViewer, 1 KiB to 1 MiB.
+ *
+ * Each scenario runs over two texts: ASCII only (a JSON payload in English) and mixed, a third of the chars taking
+ * two to four bytes. The ASCII blocks use AVX2 when built with it (`-mavx2`, `/arch:AVX2`), SSE2 or NEON otherwise.
+ *
+ *   - Unicode/Iterator/IsValid : every rune decoded through `Utf8View`, looking for `UnknownChar`
+ *   - Unicode/IsValid          : `Utf8View::IsValid`
+ *   - Unicode/Iterator/ToUtf16 : every rune decoded and pushed back, the string grown as it goes
+ *   - Unicode/ToUtf16          : `Utf8View::ConvertTo<char16_t>`, sized once
+ *   - Unicode/ToUtf32          : `Utf8View::ConvertTo<char32_t>`, sized once
+ *   - Unicode/FromUtf16        : `Utf16View::ConvertTo<char8_t>` of the text converted above
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <Thoth/String/UnicodeViewer.hpp>
+
+#include <random>
+#include <string>
+#include <string_view>
+
+using namespace Thoth::String;
+
+
+namespace {
+    const std::u8string& Text(const size_t size, const bool mixed) {
+        static std::u8string text;
+        static bool textMixed{};
+
+        if (text.size() != size || textMixed != mixed) {
+            constexpr std::u8string_view k_runes[]{ u8"é", u8"ñ", u8"中", u8"文", u8"\U0001F600" };
+            std::mt19937 rng{ 42 };
+
+            text.clear();
+            while (text.size() < size) {
+                if (mixed && rng() % 3 == 0)
+                    text += k_runes[rng() % std::size(k_runes)];
+                else
+                    text += static_cast<char8_t>(' ' + rng() % 95);
+            }
+
+            // never cut a rune
+            while (text.size() > size)
+                text.pop_back();
+            while (!text.empty() && text.back() >= 0x80)
+                text.back() = u8'x';
+
+            textMixed = mixed;
+        }
+
+        return text;
+    }
+
+    void SetLabel(benchmark::State& state) {
+        state.SetLabel(state.range(1) ? "mixed" : "ascii");
+        state.SetBytesProcessed(state.iterations() * state.range(0));
+    }
+
+    // 1 KiB, 32 KiB and 1 MiB, of both texts
+    void Args(benchmark::internal::Benchmark* bench) {
+        bench->ArgsProduct({ benchmark::CreateRange(1 << 10, 1 << 20, 32), { 0, 1 } });
+    }
+}
+
+
+static void BM_Unicode_Iterator_IsValid(benchmark::State& state) {
+    const auto& text{ Text(static_cast<size_t>(state.range(0)), state.range(1)) };
+
+    for (auto _ : state) {
+        bool valid{ true };
+        for (const auto rune : Utf8View{ text })
+            valid &= rune != UnknownChar;
+        benchmark::DoNotOptimize(valid);
+    }
+
+    SetLabel(state);
+}
+
+static void BM_Unicode_IsValid(benchmark::State& state) {
+    const auto& text{ Text(static_cast<size_t>(state.range(0)), state.range(1)) };
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(Utf8View::IsValid(text));
+
+    SetLabel(state);
+}
+
+static void BM_Unicode_Iterator_ToUtf16(benchmark::State& state) {
+    const auto& text{ Text(static_cast<size_t>(state.range(0)), state.range(1)) };
+
+    for (auto _ : state) {
+        std::u16string res;
+        for (const auto rune : Utf8View{ text }) {
+            if (rune > 0xFFFF) {
+                res.push_back(static_cast<char16_t>(0xD7C0u + (rune >> 10u)));
+                res.push_back(static_cast<char16_t>(0xDC00u + (rune & 0x3FFu)));
+            } else
+                res.push_back(static_cast<char16_t>(rune));
+        }
+        benchmark::DoNotOptimize(res);
+    }
+
+    SetLabel(state);
+}
+
+static void BM_Unicode_ToUtf16(benchmark::State& state) {
+    const auto& text{ Text(static_cast<size_t>(state.range(0)), state.range(1)) };
+
+    for (auto _ : state) {
+        auto res{ Utf8View::ConvertTo<char16_t>(text) };
+        benchmark::DoNotOptimize(res);
+    }
+
+    SetLabel(state);
+}
+
+static void BM_Unicode_ToUtf32(benchmark::State& state) {
+    const auto& text{ Text(static_cast<size_t>(state.range(0)), state.range(1)) };
+
+    for (auto _ : state) {
+        auto res{ Utf8View::ConvertTo<char32_t>(text) };
+        benchmark::DoNotOptimize(res);
+    }
+
+    SetLabel(state);
+}
+
+static void BM_Unicode_FromUtf16(benchmark::State& state) {
+    const auto utf16{ Utf8View::ConvertTo<char16_t>(Text(static_cast<size_t>(state.range(0)), state.range(1))) };
+
+    for (auto _ : state) {
+        auto res{ Utf16View::ConvertTo<char8_t>(utf16) };
+        benchmark::DoNotOptimize(res);
+    }
+
+    SetLabel(state);
+}
+
+
+BENCHMARK(BM_Unicode_Iterator_IsValid)->Name("Unicode/Iterator/IsValid")->Apply(Args);
+BENCHMARK(BM_Unicode_IsValid)         ->Name("Unicode/IsValid")         ->Apply(Args);
+BENCHMARK(BM_Unicode_Iterator_ToUtf16)->Name("Unicode/Iterator/ToUtf16")->Apply(Args);
+BENCHMARK(BM_Unicode_ToUtf16)         ->Name("Unicode/ToUtf16")         ->Apply(Args);
+BENCHMARK(BM_Unicode_ToUtf32)         ->Name("Unicode/ToUtf32")         ->Apply(Args);
+BENCHMARK(BM_Unicode_FromUtf16)       ->Name("Unicode/FromUtf16")       ->Apply(Args);
@@ -2,20 +2,105 @@
 #include <Hermes/Socket/_base.hpp>
 #include <Thoth/Dsa/FileOutputRange.hpp>
 #include <Thoth/Http/NHeaders/Headers.hpp>
+#include <cstdint>
 #include <filesystem>
-#include <fstream>
+#include <memory>
+#include <span>
 
 namespace Thoth::Dsa {
+    //! @brief How a @ref FileOutputRange opens and writes its file.
+    struct FileOutputOptions {
+        //! `std::ios` flags combined with the range default, as in the path constructor.
+        int mode{};
+        //! Offset of the first written byte.
+        uint64_t offset{};
+        //! Writes in place over the current content instead of truncating the file, whatever the offset. Needed to
+        //! write a part of a file, the other parts being written by someone else.
+        bool keepContent{};
+        //! Reserves the given size on disk up front (`fallocate`), avoiding fragmentation and late `ENOSPC`. The
+        //! file size is left alone, it only grows with the bytes actually written.
+        std::optional<uint64_t> preallocate{};
+        //! Bypasses the page cache (`O_DIRECT`) when the file system allows it, for files much larger than the RAM.
+        bool directIo{};
+        //! Drops the written pages from the page cache (`posix_fadvise`), so a huge download doesn't evict
+        //! everything else. Ignored with `directIo`.
+        bool noReuse{};
+    };
+
     struct FileBuilderParams {
         std::filesystem::path path;
         std::optional<std::vector<Http::NHeaders::MimeType>> acceptedTypes{};
         int maxSize{ INT_MAX };
         int mode{};
+        //! Preallocates the `Content-Length` of the response.
+        bool preallocate{};
+        //! @copydoc FileOutputOptions::directIo
+        bool directIo{};
+        //! @copydoc FileOutputOptions::noReuse
+        bool noReuse{};
     };
 
+    namespace details_ {
+        //! @brief Buffered file writer behind @ref FileOutputRange.
+        //!
+        //! Bytes are gathered in a page aligned buffer and handed to the kernel with `pwrite` (`_write` on Windows)
+        //! once it fills, so writing byte by byte costs a store and a compare.
+        struct FileWriter {
+            static constexpr size_t k_alignment { 4096 };
+            static constexpr size_t k_bufferSize{ 1 << 20 };
+
+            //! @param defaultMode `std::ios` flags added to `options.mode`.
+            FileWriter(const std::filesystem::path& path, const FileOutputOptions& options, int defaultMode);
+
+            FileWriter(const FileWriter&)            = delete;
+            FileWriter& operator=(const FileWriter&) = delete;
+
+            ~FileWriter();
+
+            void Put(const char c) {
+                if (m_size == k_bufferSize) [[unlikely]]
+                    (void)Flush_();
+                m_buffer[m_size++] = c;
+            }
+
+            void Write(std::span<const char> data);
+
+            //! @brief Writes the buffered bytes to the file.
+            ThothResultOper Flush();
+
+            [[nodiscard]] bool IsOpen() const;
+
+            //! @brief The first error found while writing, if any.
+            [[nodiscard]] std::error_code Error() const;
+
+            //! @brief Bytes written or buffered since the file was opened.
+            [[nodiscard]] uint64_t Written() const;
+
+        private:
+            struct AlignedDelete {
+                void operator()(char* ptr) const;
+            };
+
+            bool Flush_();
+            std::ptrdiff_t WriteAt_(const char* data, size_t size) const;
+            void DropCache_(uint64_t offset, uint64_t size) const;
+
+            std::unique_ptr<char[], AlignedDelete> m_buffer{};
+            size_t m_size{};
+
+            int m_fd{ -1 };
+            uint64_t m_start{};
+            uint64_t m_position{};
+            bool m_append{};
+            bool m_directIo{};
+            bool m_noReuse{};
+            int m_error{};
+        };
+    }
+
     template<Hermes::ByteLike T>
     struct FileOutputIterator {
-        std::ofstream* stream{};
+        details_::FileWriter* writer{};
         using difference_type = std::ptrdiff_t;
 
         FileOutputIterator& operator*() { return *this; }
@@ -23,12 +108,22 @@ namespace Thoth::Dsa {
         FileOutputIterator operator++(int) { return *this; }
 
         FileOutputIterator& operator=(T val) {
-            stream->put(static_cast<char>(val));
+            writer->Put(static_cast<char>(val));
             return *this;
         }
     };
 
 
+    //! @brief Writable body that streams into a file.
+    //!
+    //! The bytes go through a 1 MiB aligned buffer and raw positional writes instead of an `std::ofstream`.
+    //! The buffer is flushed when it fills and on destruction; call @ref Flush before to see write errors.
+    //!
+    //! @par Example
+    //! @code{.cpp}
+    //! // Writes the 206 of a byte range in place.
+    //! BinFileOutputRange part{ "big.iso", FileOutputOptions{ .offset = 8 << 20, .keepContent = true } };
+    //! @endcode
     template<Hermes::ByteLike T = char>
     struct FileOutputRange {
 
@@ -44,7 +139,7 @@ namespace Thoth::Dsa {
         explicit FileOutputRange(const std::filesystem::path& path, int mode = 0);
         explicit FileOutputRange(std::filesystem::path&& path, int mode = 0);
 
-        explicit FileOutputRange(std::basic_ofstream<T>&& file);
+        FileOutputRange(const std::filesystem::path& path, const FileOutputOptions& options);
 
         FileOutputRange(FileOutputRange&& other) noexcept;
         FileOutputRange(const FileOutputRange& other) = delete;
@@ -58,8 +153,15 @@ namespace Thoth::Dsa {
 
         [[nodiscard]] static std::unreachable_sentinel_t end();
 
+        //! @brief Whether the file could be opened.
+        [[nodiscard]] bool IsOpen() const;
+
+        //! @brief Writes the buffered bytes, returning the first error found while writing.
+        ThothResultOper Flush();
+
     private:
-        std::ofstream m_outStream;
+        // Behind a pointer so the iterators handed out stay valid when the range moves.
+        std::unique_ptr<details_::FileWriter> m_writer;
     };
 
     using TextFileOutputRange = FileOutputRange<>;
@@ -39,7 +39,15 @@ namespace Thoth::Dsa {
                 std::filesystem::create_directories(params.path.parent_path(), ec);
                 if (ec) return ThothUnex{{ GenericError{ "Unable to create file path" } }};
 
-                return FileOutputRange{ params.path, params.mode };
+                FileOutputRange file{ params.path, FileOutputOptions{
+                    .mode        = params.mode,
+                    .preallocate = params.preallocate ? head.headers.ContentLength().GetAsOpt() : std::nullopt,
+                    .directIo    = params.directIo,
+                    .noReuse     = params.noReuse
+                } };
+                if (!file.IsOpen()) return ThothUnex{{ GenericError{ "Unable to open the file" } }};
+
+                return file;
             } };
 
             return checkLen().and_then(checkType).and_then(happyPath);
@@ -78,7 +86,15 @@ namespace Thoth::Dsa {
                 std::filesystem::create_directories(params.path.parent_path(), ec);
                 if (ec) return ThothUnex{{ GenericError{ "Unable to create file path" } }};
 
-                return FileOutputRange{ std::move(params.path), params.mode };
+                FileOutputRange file{ params.path, FileOutputOptions{
+                    .mode        = params.mode,
+                    .preallocate = params.preallocate ? head.headers.ContentLength().GetAsOpt() : std::nullopt,
+                    .directIo    = params.directIo,
+                    .noReuse     = params.noReuse
+                } };
+                if (!file.IsOpen()) return ThothUnex{{ GenericError{ "Unable to open the file" } }};
+
+                return file;
             } };
 
             return checkLen().and_then(checkType).and_then(happyPath);
@@ -86,32 +102,46 @@ namespace Thoth::Dsa {
     }
 
     template<Hermes::ByteLike T>
-    FileOutputRange<T>::FileOutputRange(const std::filesystem::path& path, const int mode) : m_outStream{ path, Mode() | mode } {}
+    FileOutputRange<T>::FileOutputRange(const std::filesystem::path& path, const int mode)
+        : FileOutputRange{ path, FileOutputOptions{ .mode = mode } } {}
 
     template<Hermes::ByteLike T>
-    FileOutputRange<T>::FileOutputRange(std::filesystem::path&& path, const int mode) : m_outStream{ std::move(path), Mode() | mode } {}
+    FileOutputRange<T>::FileOutputRange(std::filesystem::path&& path, const int mode)
+        : FileOutputRange{ path, FileOutputOptions{ .mode = mode } } {}
 
     template<Hermes::ByteLike T>
-    FileOutputRange<T>::FileOutputRange(std::basic_ofstream<T> &&file) : m_outStream{ std::move(file) } {}
+    FileOutputRange<T>::FileOutputRange(const std::filesystem::path& path, const FileOutputOptions& options)
+        : m_writer{ std::make_unique<details_::FileWriter>(path, options, Mode()) } {}
 
     template<Hermes::ByteLike T>
-    FileOutputRange<T>::FileOutputRange(FileOutputRange&& other) noexcept : m_outStream{ std::move(other.m_outStream) } {}
+    FileOutputRange<T>::FileOutputRange(FileOutputRange&& other) noexcept : m_writer{ std::move(other.m_writer) } {}
 
     template<Hermes::ByteLike T>
     FileOutputRange<T> & FileOutputRange<T>::operator=(FileOutputRange &&other) noexcept {
-        m_outStream = std::move(other.m_outStream);
+        m_writer = std::move(other.m_writer);
         return *this;
     }
 
     template<Hermes::ByteLike T>
     FileOutputIterator<T> FileOutputRange<T>::begin() {
-        return FileOutputIterator<T>{ &m_outStream };
+        return FileOutputIterator<T>{ m_writer.get() };
     }
 
     template<Hermes::ByteLike T>
     std::unreachable_sentinel_t FileOutputRange<T>::end() {
         return std::unreachable_sentinel;
     }
+
+    template<Hermes::ByteLike T>
+    bool FileOutputRange<T>::IsOpen() const {
+        return m_writer && m_writer->IsOpen();
+    }
+
+    template<Hermes::ByteLike T>
+    ThothResultOper FileOutputRange<T>::Flush() {
+        if (!m_writer) return ThothUnex{{ GenericError{ "Moved from file" } }};
+        return m_writer->Flush();
+    }
 }
 
 template<Hermes::ByteLike T>
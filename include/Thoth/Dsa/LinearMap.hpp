@@ -1,10 +1,13 @@
 #pragma once
 
 #include <vector>
+#include <cstdint>
 #include <utility>
 #include <concepts>
 #include <functional>
 #include <compare>
+#include <ranges>
+#include <type_traits>
 
 namespace Thoth::Dsa {
 
@@ -13,6 +16,14 @@ namespace Thoth::Dsa {
            requires(Relation r, Key a, Key b) { { std::invoke(r, a, b) } -> std::same_as<std::strong_ordering>; }
         || requires(Relation r, Key a, Key b) { { std::invoke(r, a, b) } -> std::convertible_to<bool>; };
 
+    //! @brief Which value `FromUnsorted` keeps when a key is given more than once.
+    enum class DuplicateKeyEnum : uint8_t {
+        //! The first one in the order of the input, like repeated calls to `try_emplace`.
+        KeepFirst,
+        //! The last one in the order of the input, like repeated calls to `insert_or_assign`.
+        KeepLast
+    };
+
     template<class KeyT, class ValT, class Pred = std::less<>>
         requires strong_order_relation<KeyT, Pred>
     struct LinearMap {
@@ -25,6 +36,10 @@ namespace Thoth::Dsa {
         using const_iterator = container_type::const_iterator;
         using size_type      = container_type::size_type;
 
+        //! Up to this size lookups scan the keys in order instead of bisecting them. Scalar compares are cheap enough
+        //! to win up to 16 keys, strings only make up for the mispredictions of a bisection on a handful of them.
+        static constexpr size_type k_linearScanMax{ std::is_scalar_v<KeyT> ? 16u : 4u };
+
     private:
         container_type m_data;
         [[no_unique_address]] key_compare m_compare; // Otimização para comparadores sem estado (stateless)
@@ -46,6 +61,29 @@ namespace Thoth::Dsa {
         constexpr explicit LinearMap(const key_compare& comp);
         constexpr LinearMap(std::initializer_list<value_type> init, const key_compare& comp = key_compare{});
 
+        //! @brief Builds the map from pairs in any order, sorting them once instead of inserting one by one.
+        //!
+        //! O(n log n), against the O(n²) of a `try_emplace` per pair. The pairs are moved from when `pairs` is
+        //! an rvalue.
+        //!
+        //! @par Example
+        //! @code{.cpp}
+        //! auto map{ LinearMap<std::string, int>::FromUnsorted(std::move(pairs), DuplicateKeyEnum::KeepLast) };
+        //! @endcode
+        template<std::ranges::input_range R>
+            requires std::constructible_from<std::pair<KeyT, ValT>, std::ranges::range_reference_t<R>>
+        static LinearMap FromUnsorted(
+            R&& pairs,
+            DuplicateKeyEnum policy = DuplicateKeyEnum::KeepFirst,
+            const key_compare& comp = key_compare{});
+
+        //! @brief @ref FromUnsorted, folding the values of a repeated key into the first one.
+        //! @param merge Called as `merge(kept, std::move(repeated))`, in the order of `pairs`.
+        template<std::ranges::input_range R, class MergeF>
+            requires std::constructible_from<std::pair<KeyT, ValT>, std::ranges::range_reference_t<R>>
+                  && std::invocable<MergeF&, ValT&, ValT&&>
+        static LinearMap FromUnsorted(R&& pairs, MergeF merge, const key_compare& comp = key_compare{});
+
         constexpr LinearMap& operator=(const LinearMap&) = default;
         constexpr LinearMap& operator=(LinearMap&&) noexcept = default;
 
@@ -3,6 +3,58 @@
 
 #include <Hermes/Utils/Hash.hpp>
 
+namespace Thoth::Dsa::details_ {
+    // The policies of `FromUnsorted` as merge functions.
+    struct KeepFirst_ {
+        template<class ValT>
+        constexpr void operator()(ValT&, ValT&&) const noexcept {}
+    };
+
+    struct KeepLast_ {
+        template<class ValT>
+        constexpr void operator()(ValT& kept, ValT&& repeated) const { kept = std::move(repeated); }
+    };
+
+    // Sorts by key, keeping equivalent keys in their order, then folds each run of them into its first element.
+    template<class KeyT, class ValT, class Compare, class MergeF>
+    void SortUnique(std::vector<std::pair<KeyT, ValT>>& pairs, const Compare& comp, MergeF& merge) {
+        constexpr auto key{ &std::pair<KeyT, ValT>::first };
+
+        // Already sorted input (written by a serializer, or a map re-read) skips the sort.
+        if (!std::ranges::is_sorted(pairs, comp, key))
+            std::ranges::stable_sort(pairs, comp, key);
+
+        auto out{ pairs.begin() };
+        for (auto it{ pairs.begin() }; it != pairs.end(); ++out) {
+            if (out != it)
+                *out = std::move(*it);
+
+            for (++it; it != pairs.end() && !std::invoke(comp, out->first, it->first); ++it)
+                merge(out->second, std::move(it->second));
+        }
+
+        pairs.erase(out, pairs.end());
+    }
+
+    template<class KeyT, class ValT, class R>
+    std::vector<std::pair<KeyT, ValT>> CollectPairs(R&& pairs) {
+        if constexpr (std::same_as<std::remove_cvref_t<R>, std::vector<std::pair<KeyT, ValT>>>
+                   && !std::is_lvalue_reference_v<R>)
+            return std::move(pairs);
+        else {
+            std::vector<std::pair<KeyT, ValT>> res;
+            if constexpr (std::ranges::sized_range<R>)
+                res.reserve(std::ranges::size(pairs));
+
+            for (auto&& pair : pairs)
+                res.emplace_back(std::forward<decltype(pair)>(pair));
+
+            return res;
+        }
+    }
+}
+
+
 namespace Thoth::Dsa {
     template<class KeyT, class ValT, class Pred>
         requires strong_order_relation<KeyT, Pred>
@@ -23,6 +75,36 @@ namespace Thoth::Dsa {
         m_data.erase(firstToErase, last);
     }
 
+    template<class KeyT, class ValT, class Pred>
+        requires strong_order_relation<KeyT, Pred>
+    template<std::ranges::input_range R>
+        requires std::constructible_from<std::pair<KeyT, ValT>, std::ranges::range_reference_t<R>>
+    LinearMap<KeyT, ValT, Pred> LinearMap<KeyT, ValT, Pred>::FromUnsorted(
+            R&& pairs,
+            const DuplicateKeyEnum policy,
+            const key_compare& comp) {
+        if (policy == DuplicateKeyEnum::KeepLast)
+            return FromUnsorted(std::forward<R>(pairs), details_::KeepLast_{}, comp);
+
+        return FromUnsorted(std::forward<R>(pairs), details_::KeepFirst_{}, comp);
+    }
+
+    template<class KeyT, class ValT, class Pred>
+        requires strong_order_relation<KeyT, Pred>
+    template<std::ranges::input_range R, class MergeF>
+        requires std::constructible_from<std::pair<KeyT, ValT>, std::ranges::range_reference_t<R>>
+              && std::invocable<MergeF&, ValT&, ValT&&>
+    LinearMap<KeyT, ValT, Pred> LinearMap<KeyT, ValT, Pred>::FromUnsorted(
+            R&& pairs,
+            MergeF merge,
+            const key_compare& comp) {
+        LinearMap res{ comp };
+        res.m_data = details_::CollectPairs<KeyT, ValT>(std::forward<R>(pairs));
+
+        details_::SortUnique(res.m_data, res.m_compare, merge);
+        return res;
+    }
+
     template<class KeyT, class ValT, class Pred>
         requires strong_order_relation<KeyT, Pred>
     constexpr bool LinearMap<KeyT, ValT, Pred>::operator==(const LinearMap& other) const {
@@ -40,7 +122,8 @@ namespace Thoth::Dsa {
     template<class LookupKeyT>
     typename LinearMap<KeyT, ValT, Pred>::iterator
     constexpr LinearMap<KeyT, ValT, Pred>::find_position(const LookupKeyT& key) {
-        return std::ranges::lower_bound(m_data, key, m_compare, &value_type::first);
+        const auto pos{ std::as_const(*this).find_position(key) };
+        return m_data.begin() + (pos - m_data.cbegin());
     }
 
     template<class KeyT, class ValT, class Pred>
@@ -48,6 +131,12 @@ namespace Thoth::Dsa {
     template<class LookupKeyT>
     typename LinearMap<KeyT, ValT, Pred>::const_iterator
     constexpr LinearMap<KeyT, ValT, Pred>::find_position(const LookupKeyT& key) const {
+        // A few predictable compares beat the mispredicted branches of a bisection on small maps.
+        if (m_data.size() <= k_linearScanMax)
+            return std::ranges::find_if(m_data, [&](const KeyT& elem) {
+                return !std::invoke(m_compare, elem, key);
+            }, &value_type::first);
+
         return std::ranges::lower_bound(m_data, key, m_compare, &value_type::first);
     }
 
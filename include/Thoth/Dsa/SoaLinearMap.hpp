@@ -0,0 +1,182 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <vector>
+
+#include <Thoth/Dsa/LinearMap.hpp>
+
+namespace Thoth::Dsa {
+    //! @brief @ref LinearMap with its keys and values in two vectors (structure of arrays).
+    //!
+    //! Lookups only go through the keys, so the values (a whole `Json`, a vector of strings...) stay out of the
+    //! cache until one is found, and inserting shifts the keys without dragging the values along in the same
+    //! pass. The price is that the elements are not `std::pair`s: iterating yields `pair<const KeyT&, ValT&>`.
+    //!
+    //! @par Example
+    //! @code{.cpp}
+    //! auto map{ SoaLinearMap<std::string, Json>::FromUnsorted(std::move(pairs), DuplicateKeyEnum::KeepLast) };
+    //! for (auto [key, val] : map)
+    //!     ...
+    //! @endcode
+    template<class KeyT, class ValT, class Pred = std::less<>>
+        requires strong_order_relation<KeyT, Pred>
+    struct SoaLinearMap {
+        using key_type              = KeyT;
+        using mapped_type           = ValT;
+        using value_type            = std::pair<KeyT, ValT>;
+        using key_compare           = Pred;
+        using key_container_type    = std::vector<KeyT>;
+        using mapped_container_type = std::vector<ValT>;
+        using size_type             = key_container_type::size_type;
+
+        //! Up to this size lookups scan the keys in order instead of bisecting them.
+        static constexpr size_type k_linearScanMax{ LinearMap<KeyT, ValT, Pred>::k_linearScanMax };
+
+        //! @brief Walks both vectors at once, yielding a pair of references.
+        template<bool Const>
+        struct Iterator {
+            using MappedPtr = std::conditional_t<Const, const ValT*, ValT*>;
+
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type        = std::pair<KeyT, ValT>;
+            using difference_type   = std::ptrdiff_t;
+            using reference         = std::pair<const KeyT&, std::conditional_t<Const, const ValT&, ValT&>>;
+
+            //! @brief What `->` points to, `reference` is a temporary.
+            struct Arrow {
+                reference ref;
+                constexpr const reference* operator->() const noexcept { return &ref; }
+            };
+
+            constexpr Iterator() = default;
+            constexpr Iterator(const KeyT* key, MappedPtr val) noexcept;
+            template<bool OtherConst>
+                requires (Const && !OtherConst)
+            // NOLINTNEXTLINE(*-explicit-constructor)
+            constexpr Iterator(const Iterator<OtherConst>& other) noexcept;
+
+            [[nodiscard]] constexpr reference operator*() const noexcept;
+            [[nodiscard]] constexpr Arrow operator->() const noexcept;
+            [[nodiscard]] constexpr reference operator[](difference_type n) const noexcept;
+
+            constexpr Iterator& operator++() noexcept;
+            constexpr Iterator operator++(int) noexcept;
+            constexpr Iterator& operator--() noexcept;
+            constexpr Iterator operator--(int) noexcept;
+            constexpr Iterator& operator+=(difference_type n) noexcept;
+            constexpr Iterator& operator-=(difference_type n) noexcept;
+
+            [[nodiscard]] constexpr Iterator operator+(difference_type n) const noexcept;
+            [[nodiscard]] constexpr Iterator operator-(difference_type n) const noexcept;
+            [[nodiscard]] constexpr difference_type operator-(const Iterator& other) const noexcept;
+
+            [[nodiscard]] constexpr bool operator==(const Iterator& other) const noexcept;
+            [[nodiscard]] constexpr std::strong_ordering operator<=>(const Iterator& other) const noexcept;
+
+        private:
+            template<bool>
+            friend struct Iterator;
+
+            const KeyT* m_key{};
+            MappedPtr   m_val{};
+        };
+
+        using iterator       = Iterator<false>;
+        using const_iterator = Iterator<true>;
+
+    private:
+        key_container_type    m_keys;
+        mapped_container_type m_values;
+        [[no_unique_address]] key_compare m_compare;
+
+        template<class LookupKeyT>
+        constexpr size_type find_position(const LookupKeyT& key) const;
+
+        template<class LookupKeyT>
+        constexpr bool is_equivalent(size_type idx, const LookupKeyT& key) const;
+
+        constexpr iterator at_index(size_type idx);
+        constexpr const_iterator at_index(size_type idx) const;
+
+        template<class LookupKeyT, class MappedT>
+        constexpr iterator insert_at(size_type idx, LookupKeyT&& key, MappedT&& val);
+
+    public:
+        constexpr SoaLinearMap() = default;
+        constexpr SoaLinearMap(const SoaLinearMap&) = default;
+        constexpr SoaLinearMap(SoaLinearMap&&) = default;
+
+        constexpr explicit SoaLinearMap(const key_compare& comp);
+        constexpr SoaLinearMap(std::initializer_list<value_type> init, const key_compare& comp = key_compare{});
+
+        constexpr SoaLinearMap& operator=(const SoaLinearMap&) = default;
+        constexpr SoaLinearMap& operator=(SoaLinearMap&&) noexcept = default;
+
+        constexpr bool operator==(const SoaLinearMap& other) const;
+
+        //! @brief Builds the map from pairs in any order, sorting them once, see @ref LinearMap::FromUnsorted.
+        template<std::ranges::input_range R>
+            requires std::constructible_from<std::pair<KeyT, ValT>, std::ranges::range_reference_t<R>>
+        static SoaLinearMap FromUnsorted(
+            R&& pairs,
+            DuplicateKeyEnum policy = DuplicateKeyEnum::KeepFirst,
+            const key_compare& comp = key_compare{});
+
+        //! @brief @ref FromUnsorted, folding the values of a repeated key into the first one.
+        //! @param merge Called as `merge(kept, std::move(repeated))`, in the order of `pairs`.
+        template<std::ranges::input_range R, class MergeF>
+            requires std::constructible_from<std::pair<KeyT, ValT>, std::ranges::range_reference_t<R>>
+                  && std::invocable<MergeF&, ValT&, ValT&&>
+        static SoaLinearMap FromUnsorted(R&& pairs, MergeF merge, const key_compare& comp = key_compare{});
+
+        constexpr void clear();
+        constexpr void reserve(size_type capacity);
+
+        constexpr iterator begin();
+        constexpr iterator end();
+        constexpr const_iterator begin() const;
+        constexpr const_iterator end() const;
+        constexpr const_iterator cbegin() const;
+        constexpr const_iterator cend() const;
+
+        //! @brief The keys, sorted.
+        constexpr std::span<const KeyT> keys() const noexcept;
+        //! @brief The values, in the order of @ref keys.
+        constexpr std::span<ValT> values() noexcept;
+        constexpr std::span<const ValT> values() const noexcept;
+
+        [[nodiscard]] constexpr bool empty() const;
+        constexpr size_type size() const;
+
+        template<class LookupKeyT, class MappedT>
+        constexpr std::pair<iterator, bool> try_emplace(LookupKeyT&& key, MappedT&& val);
+
+        template<class LookupKeyT, class MappedT>
+        constexpr std::pair<iterator, bool> insert_or_assign(LookupKeyT&& key, MappedT&& val);
+
+        template<class LookupKeyT>
+        constexpr bool erase(const LookupKeyT& key);
+
+        constexpr iterator erase(iterator pos);
+        constexpr iterator erase(const_iterator pos);
+
+        template<class LookupKeyT>
+        constexpr iterator find(const LookupKeyT& key);
+
+        template<class LookupKeyT>
+        constexpr const_iterator find(const LookupKeyT& key) const;
+
+        template<class LookupKeyT>
+        constexpr bool exists(const LookupKeyT& key) const;
+
+        template<class LookupKeyT>
+        constexpr bool contains(const LookupKeyT& key) const;
+
+        template<class LookupKeyT>
+        ValT& operator[](LookupKeyT&& key);
+    };
+}
+
+#include <Thoth/Dsa/SoaLinearMap.tpp>
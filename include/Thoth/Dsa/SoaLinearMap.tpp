@@ -0,0 +1,365 @@
+#pragma once
+#include <algorithm>
+
+#include <Hermes/Utils/Hash.hpp>
+
+namespace Thoth::Dsa {
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    template<bool Const>
+    constexpr SoaLinearMap<KeyT, ValT, Pred>::Iterator<Const>::Iterator(const KeyT* key, MappedPtr val) noexcept
+        : m_key{ key }, m_val{ val } {}
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    template<bool Const>
+    template<bool OtherConst>
+        requires (Const && !OtherConst)
+    constexpr SoaLinearMap<KeyT, ValT, Pred>::Iterator<Const>::Iterator(const Iterator<OtherConst>& other) noexcept
+        : m_key{ other.m_key }, m_val{ other.m_val } {}
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    template<bool Const>
+    constexpr auto SoaLinearMap<KeyT, ValT, Pred>::Iterator<Const>::operator*() const noexcept -> reference {
+        return { *m_key, *m_val };
+    }
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    template<bool Const>
+    constexpr auto SoaLinearMap<KeyT, ValT, Pred>::Iterator<Const>::operator->() const noexcept -> Arrow {
+        return { **this };
+    }
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    template<bool Const>
+    constexpr auto SoaLinearMap<KeyT, ValT, Pred>::Iterator<Const>::operator[](const difference_type n) const noexcept
+            -> reference {
+        return { m_key[n], m_val[n] };
+    }
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    template<bool Const>
+    constexpr auto SoaLinearMap<KeyT, ValT, Pred>::Iterator<Const>::operator++() noexcept -> Iterator& {
+        ++m_key;
+        ++m_val;
+        return *this;
+    }
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    template<bool Const>
+    constexpr auto SoaLinearMap<KeyT, ValT, Pred>::Iterator<Const>::operator++(int) noexcept -> Iterator {
+        auto res{ *this };
+        ++*this;
+        return res;
+    }
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    template<bool Const>
+    constexpr auto SoaLinearMap<KeyT, ValT, Pred>::Iterator<Const>::operator--() noexcept -> Iterator& {
+        --m_key;
+        --m_val;
+        return *this;
+    }
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    template<bool Const>
+    constexpr auto SoaLinearMap<KeyT, ValT, Pred>::Iterator<Const>::operator--(int) noexcept -> Iterator {
+        auto res{ *this };
+        --*this;
+        return res;
+    }
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    template<bool Const>
+    constexpr auto SoaLinearMap<KeyT, ValT, Pred>::Iterator<Const>::operator+=(const difference_type n) noexcept
+            -> Iterator& {
+        m_key += n;
+        m_val += n;
+        return *this;
+    }
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    template<bool Const>
+    constexpr auto SoaLinearMap<KeyT, ValT, Pred>::Iterator<Const>::operator-=(const difference_type n) noexcept
+            -> Iterator& {
+        return *this += -n;
+    }
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    template<bool Const>
+    constexpr auto SoaLinearMap<KeyT, ValT, Pred>::Iterator<Const>::operator+(const difference_type n) const noexcept
+            -> Iterator {
+        return Iterator{ *this } += n;
+    }
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    template<bool Const>
+    constexpr auto SoaLinearMap<KeyT, ValT, Pred>::Iterator<Const>::operator-(const difference_type n) const noexcept
+            -> Iterator {
+        return Iterator{ *this } -= n;
+    }
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    template<bool Const>
+    constexpr auto SoaLinearMap<KeyT, ValT, Pred>::Iterator<Const>::operator-(const Iterator& other) const noexcept
+            -> difference_type {
+        return m_key - other.m_key;
+    }
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    template<bool Const>
+    constexpr bool SoaLinearMap<KeyT, ValT, Pred>::Iterator<Const>::operator==(const Iterator& other) const noexcept {
+        return m_key == other.m_key;
+    }
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    template<bool Const>
+    constexpr std::strong_ordering SoaLinearMap<KeyT, ValT, Pred>::Iterator<Const>::operator<=>(
+            const Iterator& other) const noexcept {
+        return m_key <=> other.m_key;
+    }
+
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    constexpr SoaLinearMap<KeyT, ValT, Pred>::SoaLinearMap(const key_compare& comp)
+        : m_compare(comp) {}
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    constexpr SoaLinearMap<KeyT, ValT, Pred>::SoaLinearMap(std::initializer_list<value_type> init, const key_compare& comp)
+        : m_compare(comp) {
+        reserve(init.size());
+
+        for (const auto& [key, val] : init)
+            try_emplace(key, val);
+    }
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    template<std::ranges::input_range R>
+        requires std::constructible_from<std::pair<KeyT, ValT>, std::ranges::range_reference_t<R>>
+    SoaLinearMap<KeyT, ValT, Pred> SoaLinearMap<KeyT, ValT, Pred>::FromUnsorted(
+            R&& pairs,
+            const DuplicateKeyEnum policy,
+            const key_compare& comp) {
+        if (policy == DuplicateKeyEnum::KeepLast)
+            return FromUnsorted(std::forward<R>(pairs), details_::KeepLast_{}, comp);
+
+        return FromUnsorted(std::forward<R>(pairs), details_::KeepFirst_{}, comp);
+    }
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    template<std::ranges::input_range R, class MergeF>
+        requires std::constructible_from<std::pair<KeyT, ValT>, std::ranges::range_reference_t<R>>
+              && std::invocable<MergeF&, ValT&, ValT&&>
+    SoaLinearMap<KeyT, ValT, Pred> SoaLinearMap<KeyT, ValT, Pred>::FromUnsorted(
+            R&& pairs,
+            MergeF merge,
+            const key_compare& comp) {
+        auto sorted{ details_::CollectPairs<KeyT, ValT>(std::forward<R>(pairs)) };
+        details_::SortUnique(sorted, comp, merge);
+
+        SoaLinearMap res{ comp };
+        res.reserve(sorted.size());
+
+        for (auto& [key, val] : sorted) {
+            res.m_keys.push_back(std::move(key));
+            res.m_values.push_back(std::move(val));
+        }
+
+        return res;
+    }
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    constexpr bool SoaLinearMap<KeyT, ValT, Pred>::operator==(const SoaLinearMap& other) const {
+        return m_keys == other.m_keys && m_values == other.m_values;
+    }
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    constexpr void SoaLinearMap<KeyT, ValT, Pred>::clear() {
+        m_keys.clear();
+        m_values.clear();
+    }
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    constexpr void SoaLinearMap<KeyT, ValT, Pred>::reserve(const size_type capacity) {
+        m_keys.reserve(capacity);
+        m_values.reserve(capacity);
+    }
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    template<class LookupKeyT>
+    constexpr typename SoaLinearMap<KeyT, ValT, Pred>::size_type
+    SoaLinearMap<KeyT, ValT, Pred>::find_position(const LookupKeyT& key) const {
+        // A few predictable compares beat the mispredicted branches of a bisection on small maps.
+        if (m_keys.size() <= k_linearScanMax) {
+            size_type idx{};
+            while (idx < m_keys.size() && std::invoke(m_compare, m_keys[idx], key))
+                ++idx;
+
+            return idx;
+        }
+
+        return static_cast<size_type>(std::ranges::lower_bound(m_keys, key, m_compare) - m_keys.begin());
+    }
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    template<class LookupKeyT>
+    constexpr bool SoaLinearMap<KeyT, ValT, Pred>::is_equivalent(const size_type idx, const LookupKeyT& key) const {
+        return idx < m_keys.size() && !std::invoke(m_compare, key, m_keys[idx]);
+    }
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    constexpr typename SoaLinearMap<KeyT, ValT, Pred>::iterator SoaLinearMap<KeyT, ValT, Pred>::at_index(
+            const size_type idx) {
+        return { m_keys.data() + idx, m_values.data() + idx };
+    }
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    constexpr typename SoaLinearMap<KeyT, ValT, Pred>::const_iterator SoaLinearMap<KeyT, ValT, Pred>::at_index(
+            const size_type idx) const {
+        return { m_keys.data() + idx, m_values.data() + idx };
+    }
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    template<class LookupKeyT, class MappedT>
+    constexpr typename SoaLinearMap<KeyT, ValT, Pred>::iterator SoaLinearMap<KeyT, ValT, Pred>::insert_at(
+            const size_type idx, LookupKeyT&& key, MappedT&& val) {
+        const auto offset{ static_cast<std::ptrdiff_t>(idx) };
+
+        m_keys.emplace(m_keys.begin() + offset, std::forward<LookupKeyT>(key));
+        try {
+            m_values.emplace(m_values.begin() + offset, std::forward<MappedT>(val));
+        } catch (...) {
+            m_keys.erase(m_keys.begin() + offset);
+            throw;
+        }
+
+        return at_index(idx);
+    }
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    constexpr typename SoaLinearMap<KeyT, ValT, Pred>::iterator SoaLinearMap<KeyT, ValT, Pred>::begin()  { return at_index(0); }
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    constexpr typename SoaLinearMap<KeyT, ValT, Pred>::iterator SoaLinearMap<KeyT, ValT, Pred>::end()    { return at_index(size()); }
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    constexpr typename SoaLinearMap<KeyT, ValT, Pred>::const_iterator SoaLinearMap<KeyT, ValT, Pred>::begin() const  { return at_index(0); }
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    constexpr typename SoaLinearMap<KeyT, ValT, Pred>::const_iterator SoaLinearMap<KeyT, ValT, Pred>::end() const    { return at_index(size()); }
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    constexpr typename SoaLinearMap<KeyT, ValT, Pred>::const_iterator SoaLinearMap<KeyT, ValT, Pred>::cbegin() const { return at_index(0); }
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    constexpr typename SoaLinearMap<KeyT, ValT, Pred>::const_iterator SoaLinearMap<KeyT, ValT, Pred>::cend() const   { return at_index(size()); }
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    constexpr std::span<const KeyT> SoaLinearMap<KeyT, ValT, Pred>::keys() const noexcept { return m_keys; }
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    constexpr std::span<ValT> SoaLinearMap<KeyT, ValT, Pred>::values() noexcept { return m_values; }
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    constexpr std::span<const ValT> SoaLinearMap<KeyT, ValT, Pred>::values() const noexcept { return m_values; }
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    constexpr bool SoaLinearMap<KeyT, ValT, Pred>::empty() const { return m_keys.empty(); }
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    constexpr typename SoaLinearMap<KeyT, ValT, Pred>::size_type SoaLinearMap<KeyT, ValT, Pred>::size() const { return m_keys.size(); }
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    template<class LookupKeyT, class MappedT>
+    constexpr std::pair<typename SoaLinearMap<KeyT, ValT, Pred>::iterator, bool>
+    SoaLinearMap<KeyT, ValT, Pred>::try_emplace(LookupKeyT&& key, MappedT&& val) {
+        const auto idx{ find_position(key) };
+
+        if (is_equivalent(idx, key))
+            return { at_index(idx), false };
+
+        return { insert_at(idx, std::forward<LookupKeyT>(key), std::forward<MappedT>(val)), true };
+    }
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    template<class LookupKeyT, class MappedT>
+    constexpr std::pair<typename SoaLinearMap<KeyT, ValT, Pred>::iterator, bool>
+    SoaLinearMap<KeyT, ValT, Pred>::insert_or_assign(LookupKeyT&& key, MappedT&& val) {
+        const auto idx{ find_position(key) };
+
+        if (is_equivalent(idx, key)) {
+            m_values[idx] = std::forward<MappedT>(val);
+            return { at_index(idx), false };
+        }
+
+        return { insert_at(idx, std::forward<LookupKeyT>(key), std::forward<MappedT>(val)), true };
+    }
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    template<class LookupKeyT>
+    constexpr bool SoaLinearMap<KeyT, ValT, Pred>::erase(const LookupKeyT& key) {
+        const auto idx{ find_position(key) };
+
+        if (!is_equivalent(idx, key))
+            return false;
+
+        erase(at_index(idx));
+        return true;
+    }
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    constexpr typename SoaLinearMap<KeyT, ValT, Pred>::iterator SoaLinearMap<KeyT, ValT, Pred>::erase(
+            const iterator pos) {
+        return erase(const_iterator{ pos });
+    }
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    constexpr typename SoaLinearMap<KeyT, ValT, Pred>::iterator SoaLinearMap<KeyT, ValT, Pred>::erase(
+            const const_iterator pos) {
+        const auto offset{ pos - cbegin() };
+
+        m_keys.erase(m_keys.begin() + offset);
+        m_values.erase(m_values.begin() + offset);
+        return at_index(static_cast<size_type>(offset));
+    }
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    template<class LookupKeyT>
+    constexpr typename SoaLinearMap<KeyT, ValT, Pred>::iterator SoaLinearMap<KeyT, ValT, Pred>::find(const LookupKeyT& key) {
+        const auto idx{ find_position(key) };
+        return is_equivalent(idx, key) ? at_index(idx) : end();
+    }
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    template<class LookupKeyT>
+    constexpr typename SoaLinearMap<KeyT, ValT, Pred>::const_iterator SoaLinearMap<KeyT, ValT, Pred>::find(
+            const LookupKeyT& key) const {
+        const auto idx{ find_position(key) };
+        return is_equivalent(idx, key) ? at_index(idx) : end();
+    }
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    template<class LookupKeyT>
+    constexpr bool SoaLinearMap<KeyT, ValT, Pred>::exists(const LookupKeyT& key) const { return is_equivalent(find_position(key), key); }
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    template<class LookupKeyT>
+    constexpr bool SoaLinearMap<KeyT, ValT, Pred>::contains(const LookupKeyT& key) const { return exists(key); }
+
+    template<class KeyT, class ValT, class Pred> requires strong_order_relation<KeyT, Pred>
+    template<class LookupKeyT>
+    ValT& SoaLinearMap<KeyT, ValT, Pred>::operator[](LookupKeyT&& key) {
+        const auto idx{ find_position(key) };
+
+        if (!is_equivalent(idx, key))
+            insert_at(idx, std::forward<LookupKeyT>(key), mapped_type{});
+
+        return m_values[idx];
+    }
+}
+
+
+template<class K, class V, class P>
+    requires requires(const K& k){ std::hash<K>{}(k); } && requires(const V& v){ std::hash<V>{}(v); }
+struct std::hash<Thoth::Dsa::SoaLinearMap<K,V,P>> {
+    size_t operator()(const Thoth::Dsa::SoaLinearMap<K,V,P>& m) const noexcept {
+        using Hermes::Utils::HashCombine;
+        size_t seed{ 1469598103934665603ULL };
+
+        for (const auto& [key, val] : m) {
+            HashCombine(seed, std::hash<K>{}(key));
+            HashCombine(seed, std::hash<V>{}(val));
+        }
+        HashCombine(seed, std::hash<size_t>{}(m.size()));
+        return seed;
+    }
+};
@@ -4,10 +4,12 @@
 #include <Thoth/Http/Request/Request.hpp>
 #include <Thoth/Http/Response/Response.hpp>
 #include <Thoth/Http/Client/Definitions.hpp>
+#include <Thoth/Http/Client/Download.hpp>
 #include <Thoth/ThothError.hpp>
 
 #include <future>
 #include <chrono>
+#include <filesystem>
 #include <optional>
 
 
@@ -97,6 +99,28 @@ namespace Thoth::Http {
             requires ResponseBodyFactoryConcept<F, ResponseBody>
         static auto SendAsAndParse(Request<Method, RequestBody> request, F&& bodyFactory, ClientOptions opts = {}) -> ExpResponse<Method, ResponseBody>;
 
+        //! @brief Downloads `url` into `path` fetching `segments` byte ranges concurrently.
+        //! @details
+        //! A `HEAD` request (or a `Range: bytes=0-0` one when `HEAD` is refused) finds the length and whether
+        //! the server accepts byte ranges. The file is then preallocated and split into chunks (see
+        //! @ref DownloadState), each fetched with `Range` and `If-Range` over pooled connections and written
+        //! in place at its offset.
+        //!
+        //! **Resuming:** the progress is kept in `<path>.thoth-part` while the download runs. If the call fails
+        //! the file stays behind, and calling it again only fetches the missing chunks, as long as the server
+        //! still reports the same length and validator (strong `ETag` or `Last-Modified`).
+        //!
+        //! Falls back to a plain `GET` when ranges aren't supported or the length is unknown.
+        //!
+        //! @note Content decoding and `ClientOptions::cache` are disabled, the offsets refer to the bytes as sent.
+        //! @param url Resource to download.
+        //! @param path Destination file, created along with its directories.
+        //! @param segments Maximum number of concurrent transfers.
+        //! @param opts Connection options, shared by every transfer.
+        //! @return The number of bytes of the file.
+        static std::expected<uint64_t, ThothError> Download(
+            const Url& url, const std::filesystem::path& path, size_t segments = 4, ClientOptions opts = {});
+
         //! @hof{Send}
         static constexpr auto H_Send(ClientOptions opts = {});
 
@@ -120,7 +144,8 @@ namespace Thoth::Http {
         template<MethodConcept Method, WritableBodyConcept ResponseBody, class F>
             requires ResponseBodyFactoryConcept<F, ResponseBody>
         static std::expected<std::pair<SocketPtr, Response<Method, ResponseBody>>, ThothError> ParseHttp1_(
-            SocketPtr infoPtr, F&& bodyFactory, std::optional<ClientConnection::Deadline> deadline);
+            SocketPtr infoPtr, F&& bodyFactory, std::optional<ClientConnection::Deadline> deadline, bool decodeContent,
+            RequestTimings* timings);
 
         // template<MethodConcept Method, WritableBodyConcept ResponseBody>
         // static std::expected<std::pair<SocketPtr, Response<Method, ResponseBody>>, ThothError> request();
@@ -6,6 +6,7 @@
 #include <string_view>
 
 #include <Thoth/Http/Client/ClientJanitor.hpp>
+#include <Thoth/Http/Client/HttpCache.hpp>
 
 #pragma region Macros
 #pragma push_macro("ASSERT_OR_RET_ERROR")
@@ -75,9 +76,74 @@ namespace Thoth::Http {
             }, auth->host)
         };
 
+#pragma region cache lookup
+
+        static constexpr bool k_cacheable{ Method::MethodName() == "GET" && SizedReadableBodyConcept<ResponseBody> };
+
+        HttpCache* const cache{ opts.cache };
+        const auto requestTime{ std::chrono::utc_clock::now() };
+
+        std::string cacheKey;
+        std::optional<HttpCache::Entry> cached;
+        std::optional<RequestHeaders> cacheRequestHeaders;
+        bool revalidating{};
+
+        const auto responseFromCache{ [&](ResponseHead head, const HttpCache::Entry* entry) -> ExpResponse<Method, ResponseBody> {
+            auto body{ std::invoke(bodyFactory, std::as_const(head)) };
+            ASSERT_OR_RET_ERROR(body, body.error());
+
+            if (entry)
+                HttpCache::CopyBody(*entry, *body);
+
+            return Response<Method, ResponseBody>{ std::move(head), std::move(*body) };
+        } };
+
+        if constexpr (k_cacheable)
+            if (cache) {
+                cacheKey = HttpCache::Key(Method::MethodName(), request.url);
+                cached   = cache->Find(cacheKey);
+
+                if (cached && !HttpCache::VaryMatches(*cached, request.headers))
+                    cached.reset();
+
+                if (cached && HttpCache::IsFresh(*cached, request.headers, requestTime)) {
+                    ResponseHead head{ cached->head };
+                    head.headers.Set("age", std::to_string(HttpCache::CurrentAge(*cached, requestTime).count()));
+                    return responseFromCache(std::move(head), &*cached);
+                }
+
+                // RFC 9111 §5.2.1.7
+                static const NHeaders::CacheControl k_onlyIfCached{ NHeaders::NCacheControl::OnlyIfCached{} };
+
+                if (const auto directives{ request.headers.CacheControl().GetAsOpt() };
+                    directives && std::ranges::contains(*directives, k_onlyIfCached))
+                    return responseFromCache(ResponseHead{
+                        .status = StatusCodeEnum::GatewayTimeout, .statusMessage = "Gateway Timeout", .headers = {}
+                    }, nullptr);
+
+                cacheRequestHeaders.emplace(request.headers);
+                if (cached)
+                    revalidating = HttpCache::AddValidators(*cached, request.headers);
+            }
+
+#pragma endregion
+
+        using TimingsClock = RequestTimings::Clock;
+
+        // Only points to `timingsStorage` when someone listens, every phase below tests it.
+        RequestTimings timingsStorage;
+        RequestTimings* const timings{ opts.observer ? &timingsStorage : nullptr };
+
+        if (timings) [[unlikely]] {
+            timings->start  = TimingsClock::now();
+            timings->secure = scheme == "https";
+        }
+
         ClientJanitor& janitor{ ClientJanitor::Instance() };
 
         const auto establishConnection{ [&](Hermes::IpEndpoint&& endpoint) {
+            if (timings) [[unlikely]] timings->resolved = TimingsClock::now();
+
             const ClientConnectionKey key{ endpoint, std::string{ scheme }, hostname };
 #pragma region create socket
 
@@ -89,6 +155,11 @@ namespace Thoth::Http {
                 if (connContainerIt == janitor.connectionPool.end() || connContainerIt->second.empty())
                     return std::nullopt;
 
+                if (timings) [[unlikely]] {
+                    timings->reused   = true;
+                    timings->poolSize = connContainerIt->second.size();
+                }
+
                 auto infoPtr{ std::move(connContainerIt->second.back()) };
                 connContainerIt->second.pop_back();
 
@@ -143,6 +214,9 @@ namespace Thoth::Http {
 
             auto infoPtr{ getSocketFromPool().or_else(createNewSocket).value_or(nullptr) };
 
+            const uint64_t sentBefore{ infoPtr ? infoPtr->bytesSent : 0 };
+            if (timings && infoPtr) [[unlikely]] timings->connected = TimingsClock::now();
+
             const std::optional requestDeadline{
                 opts.requestTimeout == std::chrono::milliseconds::max()
                     ? std::nullopt
@@ -162,7 +236,31 @@ namespace Thoth::Http {
             const auto sendRequest{ [&](std::monostate) -> std::expected<SocketPtr, ThothError> {
                 request.headers.Add("host", hostname);
 
-                details_::Http1::PrepareBodyHeaders(request.headers, request.body);
+                if (opts.decodeContent) {
+                    static const std::vector k_identityOnly{ NHeaders::AcceptEncoding{ NHeaders::AcceptEncodingEnum::Identity } };
+
+                    const auto accepted{ request.headers.AcceptEncoding().GetAsOpt() };
+                    if (auto codings{ details_::ContentDecoder::AcceptedCodings() };
+                        !codings.empty() && (!accepted || *accepted == k_identityOnly))
+                        request.headers.AcceptEncoding().Set(codings);
+                }
+
+                const auto hasBody{ [&] {
+                    if constexpr (SizedReadableBodyConcept<RequestBody>)
+                        return std::ranges::size(request.body) != 0;
+                    else
+                        return true;
+                } };
+
+                std::optional<details_::ContentEncoder> encoder;
+                if (opts.requestEncoding && hasBody()) {
+                    auto encoderRes{ details_::ContentEncoder::Create(*opts.requestEncoding) };
+                    ASSERT_OR_RET_ERROR(encoderRes, encoderRes.error());
+
+                    encoder.emplace(std::move(*encoderRes));
+                    details_::Http1::PrepareEncodedBodyHeaders(request.headers, *opts.requestEncoding);
+                } else
+                    details_::Http1::PrepareBodyHeaders(request.headers, request.body);
 
                 const ClientConnection::SendOptions transferOptions{ .deadline = requestDeadline };
 
@@ -171,9 +269,16 @@ namespace Thoth::Http {
                 };
                 ASSERT_OR_RET_ERROR(headRes, headRes.error());
 
-                auto bodyRes{ details_::Http1::SendBody(*infoPtr, request.body, transferOptions) };
+                auto bodyRes{ encoder
+                    ? details_::Http1::SendBody(*infoPtr, request.body, *encoder, transferOptions)
+                    : details_::Http1::SendBody(*infoPtr, request.body, transferOptions) };
                 ASSERT_OR_RET_ERROR(bodyRes, bodyRes.error());
 
+                if (timings) [[unlikely]] {
+                    timings->requestSent = TimingsClock::now();
+                    timings->bytesSent   = infoPtr->bytesSent - sentBefore;
+                }
+
                 return std::move(infoPtr);
             } };
 
@@ -185,14 +290,57 @@ namespace Thoth::Http {
                     .and_then(std::bind_back(
                         ParseHttp1_<Method, ResponseBody, F>,
                         std::forward<F>(bodyFactory),
-                        requestDeadline))
+                        requestDeadline,
+                        opts.decodeContent,
+                        timings))
                     .transform(cleanupSocket);
         } };
 
 
-        return Hermes::IpEndpoint::TryResolve(hostname, std::to_string(*port))
+        auto response{
+            Hermes::IpEndpoint::TryResolve(hostname, std::to_string(*port))
                 .transform_error(toThothError)
-                .and_then(establishConnection);
+                .and_then(establishConnection)
+        };
+
+        if (timings) [[unlikely]] {
+            timings->end       = TimingsClock::now();
+            timings->succeeded = response.has_value();
+            opts.observer->OnTimings(*timings);
+        }
+
+#pragma region cache update
+
+        if (!cache || !response)
+            return response;
+
+        if constexpr (k_cacheable) {
+            const auto responseTime{ std::chrono::utc_clock::now() };
+
+            if (revalidating && response->status == StatusCodeEnum::NotModified) {
+                HttpCache::Freshen(*cached, response->headers, requestTime, responseTime);
+
+                static_cast<ResponseHead&>(*response) = cached->head;
+                HttpCache::CopyBody(*cached, response->body);
+
+                cache->Store(std::move(cacheKey), std::move(*cached));
+            } else if (HttpCache::IsStorable(*cacheRequestHeaders, *response))
+                cache->Store(
+                    std::move(cacheKey),
+                    HttpCache::MakeEntry(*cacheRequestHeaders, *response, response->body, requestTime, responseTime)
+                );
+            else if (response->status != StatusCodeEnum::NotModified)
+                cache->Erase(cacheKey);
+        } else if constexpr (!Method::IsSafe()) {
+            // RFC 9111 §4.4
+            if (const auto type{ GetStatusType(response->status) };
+                type == StatusTypeEnum::SUCCESSFUL || type == StatusTypeEnum::REDIRECTION)
+                cache->Erase(HttpCache::Key(GetMethod::MethodName(), request.url));
+        }
+
+#pragma endregion
+
+        return response;
     }
 
     constexpr auto Client::H_Send(ClientOptions opts) {
@@ -228,20 +376,36 @@ namespace Thoth::Http {
     template<MethodConcept Method, WritableBodyConcept ResponseBody, class F>
         requires ResponseBodyFactoryConcept<F, ResponseBody>
     std::expected<std::pair<Client::SocketPtr, Response<Method, ResponseBody>>, ThothError> Client::ParseHttp1_(
-        SocketPtr infoPtr, F&& bodyFactory, std::optional<ClientConnection::Deadline> deadline) {
+        SocketPtr infoPtr, F&& bodyFactory, std::optional<ClientConnection::Deadline> deadline, const bool decodeContent,
+        RequestTimings* timings) {
 
         const auto forwardBoth{ [&infoPtr](Response<Method, ResponseBody>&& response) {
             return std::pair<SocketPtr, Response<Method, ResponseBody>>{ std::move(infoPtr), std::move(response) };
         } };
 
-        auto createResponse{[bFactory = std::forward<F>(bodyFactory), deadline]<typename T>(T&& sock) mutable {
+        auto createResponse{[bFactory = std::forward<F>(bodyFactory), deadline, decodeContent, timings]<typename T>(T&& sock) mutable {
             using Socket = std::remove_cvref_t<T>;
             typename Socket::RecvOptions recvOptions{};
             recvOptions.deadline = deadline;
 
+            // Metering wraps every byte read, so it gets its own instantiation instead of a test per byte.
+            if (timings) [[unlikely]] {
+                const auto timedFactory{ [&](const ResponseHead& head) {
+                    timings->headersReceived = RequestTimings::Clock::now();
+                    return std::invoke(std::forward<F>(bFactory), head);
+                } };
+
+                return details_::Http1::BuildResponse<Method, ResponseBody>(
+                    details_::MeteredStream{ sock.template RecvStream<char>(recvOptions), *timings },
+                    timedFactory,
+                    decodeContent
+                );
+            }
+
             return details_::Http1::BuildResponse<Method, ResponseBody>(
                 sock.template RecvStream<char>(recvOptions),
-                std::forward<F>(bFactory)
+                std::forward<F>(bFactory),
+                decodeContent
             );
         } };
 
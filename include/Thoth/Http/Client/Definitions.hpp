@@ -1,11 +1,15 @@
 #pragma once
 #include <Hermes/Endpoint/IpEndpoint/IpAddress.hpp>
+#include <Thoth/Http/Client/RequestTimings.hpp>
 
 namespace Thoth::Http {
         template<MethodConcept Method, WritableBodyConcept ResponseBody>
     struct Response;
 
 
+    struct HttpCache;
+
+
     template<class F, class Body>
     concept ResponseBodyFactoryConcept = BodyFactoryConcept<F, Body, ResponseHead>;
 
@@ -54,6 +58,41 @@ namespace Thoth::Http {
         //! Has no effect on plain HTTP connections.
         //! Ignored when a pooled connection is reused.
         bool requestMutualAuth{};
+
+        //! @brief If `true`, compressed response bodies are transparently decoded.
+        //!
+        //! When the request keeps the default `Accept-Encoding: identity`, it is replaced by every
+        //! coding this build can decode (see `THOTH_WITH_ZLIB`, `THOTH_WITH_ZSTD` and `THOTH_WITH_BROTLI`).
+        //! The decoded response has its `Content-Encoding` and `Content-Length` headers removed.
+        bool decodeContent{ true };
+
+        //! @brief Coding used to compress non-empty request bodies, none by default.
+        //!
+        //! The body is encoded while it is sent, as `Transfer-Encoding: chunked`, and the coding is
+        //! appended to `Content-Encoding`. Only `Gzip`, `Deflate` and `Zstd` can be produced; any other
+        //! value fails the request with `MessageParseErrorEnum::UnsupportedContentEncoding`.
+        //!
+        //! @note Make sure the server accepts encoded request bodies, most don't unless told so.
+        std::optional<NHeaders::ContentEncodingEnum> requestEncoding{};
+
+        //! @brief Private HTTP cache used by the exchange, none by default.
+        //!
+        //! `GET` responses are stored and served following RFC 9111 (see @ref HttpCache); stale entries are
+        //! revalidated with `If-None-Match` / `If-Modified-Since` and a `304` is answered with the stored body.
+        //! Successful unsafe requests invalidate the entry of their URL.
+        //!
+        //! @note Not owned, the cache must outlive every request using it. It can be shared between threads.
+        HttpCache* cache{};
+
+        //! @brief Receives the phase timestamps of every exchange, none by default.
+        //!
+        //! Notified on failures too, with `RequestTimings::succeeded` unset; not notified for responses served
+        //! by `cache` without contacting the server. Left null, nothing is measured, the only cost is a test of
+        //! this pointer.
+        //!
+        //! @note Not owned, it must outlive every request using it. It's called from the thread performing
+        //! the request, before the response is returned.
+        RequestObserver* observer{};
     };
 
 
@@ -82,6 +121,9 @@ namespace Thoth::Http {
         //! idle connections.
         std::chrono::steady_clock::time_point lastUsed;
 
+        //! Bytes written since the connection was opened, @ref RequestTimings takes the difference.
+        uint64_t bytesSent{};
+
 
         template<class T>
         auto Send(const T& data);
@@ -12,7 +12,12 @@ namespace Thoth::Http {
             using Socket = std::remove_cvref_t<decltype(sock)>;
             typename Socket::SendOptions socketOptions{};
             socketOptions.deadline = options.deadline;
-            return sock.Send(data, socketOptions);
+            auto res{ sock.Send(data, socketOptions) };
+
+            const auto& [sent, status]{ res };
+            bytesSent += sent;
+
+            return res;
         }, socket);
     }
     inline void ClientConnection::Close() {
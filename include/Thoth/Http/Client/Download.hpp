@@ -0,0 +1,58 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <Thoth/Http/NHeaders/Request/Headers/Range.hpp>
+
+namespace Thoth::Http {
+    //! @brief Progress of a segmented download (see @ref Client::Download), kept next to the file so an
+    //! interrupted download resumes where it stopped.
+    //!
+    //! The file is split into `chunkSize` pieces, `done` marks the ones already written. The state is only
+    //! resumed when the server still reports the same length and validator (`ETag` or `Last-Modified`),
+    //! otherwise the download starts over.
+    //!
+    //! @par Example
+    //! @code{.cpp}
+    //! auto state{ DownloadState::Plan(100 << 20, "\"v1\"", 4) };
+    //! for (size_t i{}; i < state.Chunks(); ++i)
+    //!     request.headers.Range().Set(std::vector<NHeaders::Range>{ state.ChunkRange(i) });
+    //! @endcode
+    struct DownloadState {
+        static constexpr uint64_t k_minChunkSize{ 1 << 20 };
+        static constexpr uint64_t k_maxChunkSize{ 64 << 20 };
+        //! Chunks per segment, more than one so a fast connection picks up the work of a slow one.
+        static constexpr uint64_t k_chunksPerSegment{ 4 };
+
+        uint64_t length;
+        uint64_t chunkSize;
+        //! The raw `ETag` (strong only) or `Last-Modified` value, sent back as `If-Range`. Empty if none.
+        std::string validator;
+        std::vector<bool> done;
+
+        //! @brief Splits `length` bytes into chunks for `segments` concurrent transfers.
+        static DownloadState Plan(uint64_t length, std::string validator, size_t segments);
+
+        //! @brief The sidecar file holding the state of a download to `file`, `<file>.thoth-part`.
+        static std::filesystem::path StatePath(const std::filesystem::path& file);
+
+        //! @brief Reads a state saved by @ref Save, nullopt if absent or malformed.
+        static std::optional<DownloadState> Load(const std::filesystem::path& statePath);
+
+        //! @brief Writes the state, replacing the previous one only once fully written.
+        [[nodiscard]] bool Save(const std::filesystem::path& statePath) const;
+
+        [[nodiscard]] size_t Chunks() const;
+        [[nodiscard]] size_t PendingChunks() const;
+
+        //! @brief The closed byte range of the chunk `idx`.
+        [[nodiscard]] NHeaders::PrefixedRange ChunkRange(size_t idx) const;
+
+        //! @brief Whether a saved state can continue a download of `length` bytes identified by `validator`.
+        [[nodiscard]] bool Matches(uint64_t length, std::string_view validator) const;
+    };
+}
@@ -0,0 +1,148 @@
+#pragma once
+#include <chrono>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <Thoth/Http/Request/RequestHead.hpp>
+#include <Thoth/Http/Response/Response.hpp>
+#include <Thoth/Http/Url/Url.hpp>
+#include <Thoth/Http/_base.hpp>
+
+namespace Thoth::Http {
+    //! @brief Private (single user) HTTP cache following <a href="https://datatracker.ietf.org/doc/html/rfc9111">
+    //! RFC 9111</a>, kept in memory as a size-bounded LRU.
+    //!
+    //! Entries are keyed by method + URL and store the response head and body bytes. The @ref Client uses it when
+    //! `ClientOptions::cache` points to an instance:
+    //! - A fresh entry is served without touching the network.
+    //! - A stale entry with validators (`ETag`, `Last-Modified`) turns the request into a conditional one
+    //!   (`If-None-Match`, `If-Modified-Since`); a `304 Not Modified` answer is served from the stored body
+    //!   and refreshes the stored headers.
+    //! - A successful unsafe request (POST, PUT, DELETE...) invalidates the entry of its URL.
+    //!
+    //! Only `GET` responses whose body satisfies `SizedReadableBodyConcept` are stored, since the bytes have to be
+    //! read back after the exchange. `s-maxage`, `proxy-revalidate` and `public` are ignored, they only matter to
+    //! shared caches.
+    //!
+    //! **Thread-safety:** every member function locks an internal mutex, so one instance can back many concurrent
+    //! requests. Bodies are shared between the cache and readers, a lookup doesn't copy them.
+    //!
+    //! @par Example
+    //! @code{.cpp}
+    //! HttpCache cache{ 32 << 20 };
+    //! const ClientOptions opts{ .cache = &cache };
+    //!
+    //! auto first { Client::Send(*GetRequest::FromUrl("https://example.com/feed"), opts) }; // from the network
+    //! auto second{ Client::Send(*GetRequest::FromUrl("https://example.com/feed"), opts) }; // fresh or 304, no body
+    //! @endcode
+    struct HttpCache {
+        using TimePoint = std::chrono::utc_clock::time_point;
+
+        static constexpr size_t k_defaultMaxBytes{ 64 << 20 };
+
+        //! @brief A stored response and what is needed to compute its age (RFC 9111 §4.2.3).
+        struct Entry {
+            ResponseHead head;
+            std::shared_ptr<const std::string> body;
+
+            //! When the request that produced the response was sent.
+            TimePoint requestTime;
+            //! When the response was received.
+            TimePoint responseTime;
+
+            //! The request headers nominated by `Vary` (lowercase) and their values, absent when not sent.
+            std::vector<std::pair<std::string, std::optional<std::string>>> varyValues{};
+        };
+
+
+        explicit HttpCache(size_t maxBytes = k_defaultMaxBytes);
+
+        HttpCache(const HttpCache&)            = delete;
+        HttpCache& operator=(const HttpCache&) = delete;
+
+
+        //! @brief Builds the key of a request, `"<method> <url>"`.
+        static std::string Key(std::string_view method, const Url& url);
+
+        //! @brief Copies the entry stored under `key` and marks it as the most recently used.
+        std::optional<Entry> Find(std::string_view key);
+
+        //! @brief Stores `entry`, replacing the previous one and evicting the least recently used until it fits.
+        //! @return false if the entry alone is bigger than the cache.
+        bool Store(std::string key, Entry entry);
+
+        //! @brief Removes the entry stored under `key`.
+        bool Erase(std::string_view key);
+
+        //! @brief Removes every entry.
+        void Clear();
+
+        [[nodiscard]] size_t Size() const;
+        //! @brief The approximate memory used by the entries (body, headers and key).
+        [[nodiscard]] size_t Bytes() const;
+        [[nodiscard]] size_t MaxBytes() const;
+
+
+#pragma region Policy
+        //! @brief Whether a response may be stored at all (RFC 9111 §3).
+        //!
+        //! Requires a status this cache understands, no `no-store` on either side, no `Vary: *` and either an
+        //! explicit freshness (`max-age`, `Expires`) or a validator to revalidate it later.
+        static bool IsStorable(const RequestHeaders& request, const ResponseHead& response);
+
+        //! @brief How long the response stays fresh (RFC 9111 §4.2.1), zero when it must always be revalidated.
+        static std::chrono::seconds FreshnessLifetime(const Entry& entry);
+
+        //! @brief The age of the stored response at `now` (RFC 9111 §4.2.3).
+        static std::chrono::seconds CurrentAge(const Entry& entry, TimePoint now);
+
+        //! @brief Whether the stored response can answer `request` without contacting the origin, considering both
+        //! sides' `Cache-Control` directives (RFC 9111 §4.2 and §5.2.1).
+        static bool IsFresh(const Entry& entry, const RequestHeaders& request, TimePoint now);
+
+        //! @brief Whether `request` selects the same representation as the one that produced the entry (RFC 9111 §4.1).
+        static bool VaryMatches(const Entry& entry, const RequestHeaders& request);
+
+        //! @brief Turns `request` into a conditional one using the entry validators (RFC 9111 §4.3.1).
+        //! @return false if there's no validator or the request is already conditional.
+        static bool AddValidators(const Entry& entry, RequestHeaders& request);
+
+        //! @brief Updates the stored headers with the ones of a `304 Not Modified` (RFC 9111 §4.3.4).
+        static void Freshen(Entry& entry, const ResponseHeaders& notModified, TimePoint requestTime, TimePoint responseTime);
+#pragma endregion
+
+        //! @brief Builds an entry copying the body bytes.
+        template<SizedReadableBodyConcept Body>
+        static Entry MakeEntry(const RequestHeaders& request, ResponseHead head, const Body& body,
+            TimePoint requestTime, TimePoint responseTime);
+
+        //! @brief Appends the stored body bytes to `body`.
+        template<WritableBodyConcept Body>
+        static void CopyBody(const Entry& entry, Body& body);
+
+    private:
+        struct Node {
+            std::string key;
+            Entry entry;
+            size_t bytes;
+        };
+
+        static size_t EntryBytes_(std::string_view key, const Entry& entry);
+        void EvictUntil_(size_t maxBytes);
+
+        mutable std::mutex m_mutex;
+        std::list<Node> m_lru; // most recently used first
+        std::map<std::string, std::list<Node>::iterator, std::less<>> m_index;
+
+        size_t m_maxBytes;
+        size_t m_bytes{};
+    };
+}
+
+#include <Thoth/Http/Client/HttpCache.tpp>
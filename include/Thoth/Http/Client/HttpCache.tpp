@@ -0,0 +1,46 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <ranges>
+
+namespace Thoth::Http {
+    template<SizedReadableBodyConcept Body>
+    auto HttpCache::MakeEntry(const RequestHeaders& request, ResponseHead head, const Body& body,
+        const TimePoint requestTime, const TimePoint responseTime) -> Entry {
+        namespace rg = std::ranges;
+        namespace vs = std::views;
+
+        std::string bytes;
+        bytes.reserve(rg::size(body));
+        rg::copy(body | vs::transform([](const auto c) { return std::bit_cast<char>(c); }), std::back_inserter(bytes));
+
+        Entry entry{
+            .head         = std::move(head),
+            .body         = std::make_shared<const std::string>(std::move(bytes)),
+            .requestTime  = requestTime,
+            .responseTime = responseTime
+        };
+
+        for (const auto& name : entry.head.headers.Vary().GetAsOpt().value_or(std::vector<std::string>{})) {
+            std::string key{ name | vs::transform([](const unsigned char c) { return String::ToLower(c); })
+                                  | rg::to<std::string>() };
+            auto value{ request.Get(key).transform([](const auto* val) { return std::string{ *val }; }) };
+
+            entry.varyValues.emplace_back(std::move(key), std::move(value));
+        }
+
+        return entry;
+    }
+
+    template<WritableBodyConcept Body>
+    void HttpCache::CopyBody(const Entry& entry, Body& body) {
+        using ValueType = typename Body::value_type;
+
+        if (!entry.body) return;
+
+        std::ranges::copy(
+            *entry.body | std::views::transform([](const char c) { return std::bit_cast<ValueType>(c); }),
+            GetInserterIterator(body)
+        );
+    }
+}
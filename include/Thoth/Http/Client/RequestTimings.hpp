@@ -0,0 +1,141 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+
+namespace Thoth::Http {
+    //! @brief What happened during one exchange of @ref Client, reported to `ClientOptions::observer`.
+    //! @details
+    //! The timestamps follow the phases in order, all from `std::chrono::steady_clock`. A phase that wasn't
+    //! reached (the request failed before it) keeps a default constructed `TimePoint`, its durations are zero.
+    //! A pooled socket still sets `connected`, `Connect()` is then close to zero and `reused` is set.
+    //!
+    //! @par Example
+    //! @code{.cpp}
+    //! struct Logger : RequestObserver {
+    //!     void OnTimings(const RequestTimings& t) override {
+    //!         std::println("dns {} connect {} ttfb {} reused {}", t.Dns(), t.Connect(), t.Wait(), t.reused);
+    //!     }
+    //! } logger;
+    //!
+    //! auto res{ Client::Send(request, { .observer = &logger }) };
+    //! @endcode
+    struct RequestTimings {
+        using Clock     = std::chrono::steady_clock;
+        using TimePoint = Clock::time_point;
+        using Duration  = Clock::duration;
+
+        //! Send was called (after the cache lookup).
+        TimePoint start{};
+        //! The host name was resolved.
+        TimePoint resolved{};
+        //! A socket was taken from the pool or connected. For `https` this includes the TLS handshake,
+        //! Hermes performs both in the same call.
+        TimePoint connected{};
+        //! The request head and body were written.
+        TimePoint requestSent{};
+        //! The first byte of the response was read.
+        TimePoint firstByte{};
+        //! The status line and headers were parsed.
+        TimePoint headersReceived{};
+        //! The exchange ended, successfully or not.
+        TimePoint end{};
+
+        //! Bytes written to the socket: head, framing and (encoded) body.
+        uint64_t bytesSent{};
+        //! Bytes read from the socket for this response: head, framing and (encoded) body.
+        uint64_t bytesReceived{};
+
+        //! The socket came from the connection pool.
+        bool reused{};
+        //! The connection uses TLS.
+        bool secure{};
+        //! Idle connections pooled for the same endpoint when the socket was acquired, this one included.
+        size_t poolSize{};
+
+        //! @brief Whether the exchange got a whole response.
+        bool succeeded{};
+
+
+        [[nodiscard]] Duration Dns()      const { return Span_(start, resolved); }
+        [[nodiscard]] Duration Connect()  const { return Span_(resolved, connected); }
+        [[nodiscard]] Duration Send()     const { return Span_(connected, requestSent); }
+        //! @brief Time to first byte, counted from the end of the request.
+        [[nodiscard]] Duration Wait()     const { return Span_(requestSent, firstByte); }
+        [[nodiscard]] Duration Download() const { return Span_(firstByte, end); }
+        [[nodiscard]] Duration Total()    const { return Span_(start, end); }
+
+    private:
+        static Duration Span_(const TimePoint from, const TimePoint to) {
+            return from == TimePoint{} || to == TimePoint{} ? Duration::zero() : to - from;
+        }
+    };
+
+
+    //! @brief Hook notified by @ref Client at the end of each exchange, see `ClientOptions::observer`.
+    struct RequestObserver {
+        virtual ~RequestObserver() = default;
+
+        //! @brief Must be thread safe when the options are shared between threads.
+        virtual void OnTimings(const RequestTimings& timings) = 0;
+    };
+
+
+    namespace details_ {
+        //! @brief Input stream that fills the receive side of a @ref RequestTimings while it's read.
+        //! @details Only used when timings are requested, so unmetered exchanges read the socket stream directly.
+        template<std::ranges::input_range Stream>
+        struct MeteredStream {
+            struct Iterator {
+                using difference_type = std::ptrdiff_t;
+                using value_type      = std::ranges::range_value_t<Stream>;
+
+                MeteredStream* view{};
+
+                [[nodiscard]] value_type operator*() const {
+                    const value_type val{ *view->m_stream.begin() };
+                    view->MarkFirstByte_();
+                    return val;
+                }
+
+                Iterator& operator++() {
+                    ++view->m_stream.begin();
+                    ++view->m_timings->bytesReceived;
+                    return *this;
+                }
+
+                Iterator operator++(int) {
+                    auto tmp{ *this };
+                    ++*this;
+                    return tmp;
+                }
+
+                [[nodiscard]] bool operator==(std::default_sentinel_t) const {
+                    const bool ended{ view->m_stream.begin() == view->m_stream.end() };
+                    view->MarkFirstByte_();
+                    return ended;
+                }
+            };
+
+            MeteredStream(Stream&& stream, RequestTimings& timings)
+                : m_stream{ std::move(stream) }, m_timings{ &timings } {}
+
+            Iterator begin() { return { this }; }
+            static std::default_sentinel_t end() { return {}; }
+
+            auto Error() requires requires(Stream& s) { s.Error(); } {
+                return m_stream.Error();
+            }
+
+        private:
+            void MarkFirstByte_() const {
+                if (m_timings->firstByte == RequestTimings::TimePoint{}) [[unlikely]]
+                    m_timings->firstByte = RequestTimings::Clock::now();
+            }
+
+            Stream m_stream;
+            RequestTimings* m_timings;
+        };
+    }
+}
@@ -20,7 +20,9 @@ namespace Thoth::Http {
         InvalidVersion,
         InvalidHeaders,
         HeadersTooLarge,
-        VersionNeedsContentLength
+        VersionNeedsContentLength,
+        UnsupportedContentEncoding,
+        InvalidContentEncoding
     };
 }
 
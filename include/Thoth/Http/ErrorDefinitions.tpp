@@ -28,7 +28,10 @@ struct std::formatter<Thoth::Http::MessageParseErrorEnum> {
             "InvalidStartLine: unknown error, probably a invalid character",
             "InvalidVersion: uses 1.0 or 1.1 (2.0 and 3.0 in the future)",
             "InvalidHeaders: error while parsing headers, maybe invalid values for defined headers or invalid chars",
-            "VersionNeedsContentLength: HTTP 1.0 needs the use of content-length"
+            "HeadersTooLarge: the header section exceeds the maximum allowed size",
+            "VersionNeedsContentLength: HTTP 1.0 needs the use of content-length",
+            "UnsupportedContentEncoding: the body uses a content-coding this build can't decode",
+            "InvalidContentEncoding: the body is corrupt or truncated for its content-coding"
         };
 
         return std::format_to(ctx.out(), "{}", desc[to_underlying(err)]);
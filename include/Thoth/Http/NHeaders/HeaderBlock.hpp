@@ -0,0 +1,76 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <expected>
+#include <string_view>
+#include <variant>
+
+#include <Thoth/Http/ErrorDefinitions.hpp>
+#include <Thoth/Http/NHeaders/HeaderId.hpp>
+#include <Thoth/String/Simd.hpp>
+
+namespace Thoth::Http::NHeaders::details_ {
+    inline constexpr auto k_tcharTable{ [] {
+        std::array<bool, 256> res{};
+
+        for (char ch{'0'}; ch <= '9'; ch++) res[static_cast<unsigned char>(ch)] = true;
+        for (char ch{'a'}; ch <= 'z'; ch++) res[static_cast<unsigned char>(ch)] = true;
+        for (char ch{'A'}; ch <= 'Z'; ch++) res[static_cast<unsigned char>(ch)] = true;
+
+        for (const char ch : std::string_view{ "!#$%&\'*+-.^_`|~" })
+            res[static_cast<unsigned char>(ch)] = true;
+
+        return res;
+    }() };
+
+    //! @brief Splits a header block (fields separated by CRLF, without the final empty line) in place.
+    //! @details
+    //! Calls `onField(id, name, value)` for every field, `name` as written and `value` without the surrounding
+    //! whitespace, both viewing `block`. Line ends and colons are found 16 bytes at a time. A bare CR or LF, a
+    //! name that isn't a token (so no whitespace before the colon) and a repeated single-value field are
+    //! refused.
+    template<class F>
+    constexpr std::expected<std::monostate, MessageParseErrorEnum> ScanHeaderBlock(std::string_view block, F&& onField) {
+        constexpr auto isWhitespace{ [](const char c) { return c == ' ' || c == '\t'; } };
+        const auto invalid{ std::unexpected{ MessageParseErrorEnum::InvalidHeaders } };
+
+        uint64_t seenSingle{};
+
+        while (!block.empty()) {
+            const auto colon{ String::FindFirstOf<':', '\r', '\n'>(block) };
+            if (colon == std::string_view::npos || block[colon] != ':' || colon == 0)
+                return invalid;
+
+            const auto name{ block.substr(0, colon) };
+            for (const char c : name)
+                if (!k_tcharTable[static_cast<unsigned char>(c)])
+                    return invalid;
+
+            const auto lineEnd{ String::FindFirstOf<'\r', '\n'>(block, colon + 1) };
+            auto value{ block.substr(colon + 1, lineEnd == std::string_view::npos ? std::string_view::npos : lineEnd - colon - 1) };
+
+            if (lineEnd == std::string_view::npos)
+                block = {};
+            else if (block.substr(lineEnd, 2) == "\r\n")
+                block.remove_prefix(lineEnd + 2);
+            else
+                return invalid;
+
+            while (!value.empty() && isWhitespace(value.front())) value.remove_prefix(1);
+            while (!value.empty() && isWhitespace(value.back()))  value.remove_suffix(1);
+
+            const auto id{ HeaderIdOf(name) };
+            if (HeaderInfoOf(id).singleValue) {
+                const auto bit{ uint64_t{ 1 } << static_cast<size_t>(id) };
+                if (seenSingle & bit)
+                    return invalid;
+
+                seenSingle |= bit;
+            }
+
+            onField(id, name, value);
+        }
+
+        return std::monostate{};
+    }
+}
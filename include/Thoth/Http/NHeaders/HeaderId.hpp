@@ -0,0 +1,213 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace Thoth::Http::NHeaders {
+    //! @brief Header names known at compile time, resolved once to a small integer.
+    //!
+    //! `Headers` keeps the ID of every field beside its name, lookups of these names compare IDs instead of
+    //! strings. Any other name is `Unknown` and falls back to a case-insensitive comparison.
+    enum class HeaderIdEnum : uint8_t {
+        Unknown,
+        Accept,
+        AcceptEncoding,
+        AcceptLanguage,
+        AcceptPatch,
+        AcceptPost,
+        AcceptRanges,
+        Age,
+        Allow,
+        Authorization,
+        CacheControl,
+        Connection,
+        ContentDisposition,
+        ContentEncoding,
+        ContentLanguage,
+        ContentLength,
+        ContentLocation,
+        ContentRange,
+        ContentType,
+        Cookie,
+        Date,
+        ETag,
+        Expect,
+        Expires,
+        From,
+        Host,
+        IfMatch,
+        IfModifiedSince,
+        IfNoneMatch,
+        IfRange,
+        IfUnmodifiedSince,
+        KeepAlive,
+        LastModified,
+        Link,
+        Location,
+        MaxForwards,
+        Origin,
+        Pragma,
+        Prefer,
+        ProxyAuthenticate,
+        ProxyAuthorization,
+        Range,
+        Referer,
+        Refresh,
+        RetryAfter,
+        Server,
+        SetCookie,
+        Te,
+        Trailer,
+        TransferEncoding,
+        Upgrade,
+        UserAgent,
+        Vary,
+        Via,
+        WwwAuthenticate
+    };
+
+    //! @brief How `Headers` stores a field with a given ID.
+    struct HeaderInfo {
+        //! @brief Lower-case name, empty for `Unknown`.
+        std::string_view name;
+        //! @brief At most one field may be present, `Add` replaces and the parser rejects a repetition.
+        bool singleValue{};
+        //! @brief Repeated fields are folded into one, false when the value syntax forbids it (`set-cookie`).
+        bool mergeable{ true };
+        //! @brief Folded values are separated by `"; "` instead of `", "`.
+        bool semicolon{};
+    };
+
+    namespace details_ {
+        inline constexpr std::array<HeaderInfo, 55> k_headerInfos{ {
+            { },
+            { "accept" },
+            { "accept-encoding" },
+            { "accept-language" },
+            { "accept-patch" },
+            { "accept-post" },
+            { "accept-ranges" },
+            { "age", true },
+            { "allow" },
+            { "authorization", true },
+            { "cache-control" },
+            { "connection" },
+            { "content-disposition" },
+            { "content-encoding" },
+            { "content-language" },
+            { "content-length", true },
+            { "content-location", true },
+            { "content-range" },
+            { "content-type", true },
+            { "cookie", false, true, true },
+            { "date", true },
+            { "etag", true },
+            { "expect" },
+            { "expires", true },
+            { "from", true },
+            { "host", true },
+            { "if-match" },
+            { "if-modified-since", true },
+            { "if-none-match" },
+            { "if-range", true },
+            { "if-unmodified-since", true },
+            { "keep-alive" },
+            { "last-modified", true },
+            { "link" },
+            { "location", true },
+            { "max-forwards", true },
+            { "origin", true },
+            { "pragma" },
+            { "prefer" },
+            { "proxy-authenticate", false, false },
+            { "proxy-authorization", true },
+            { "range" },
+            { "referer" },
+            { "refresh", true },
+            { "retry-after", true },
+            { "server", true },
+            { "set-cookie", false, false },
+            { "te" },
+            { "trailer" },
+            { "transfer-encoding" },
+            { "upgrade" },
+            { "user-agent" },
+            { "vary" },
+            { "via" },
+            { "www-authenticate", false, false },
+        } };
+        static_assert(k_headerInfos.size() == static_cast<size_t>(HeaderIdEnum::WwwAuthenticate) + 1);
+
+        constexpr uint32_t LowerByte_(const char c) {
+            return static_cast<unsigned char>('A' <= c && c <= 'Z' ? c - 'A' + 'a' : c);
+        }
+
+        //! The length and three characters (first, middle, last) tell every known name apart, multiplied by a
+        //! seed searched at compile time so each one lands in its own slot.
+        constexpr uint32_t HeaderHash_(const std::string_view key, const uint32_t seed) {
+            const uint32_t mix{ static_cast<uint32_t>(key.size())
+                + (LowerByte_(key.front()) << 8)
+                + (LowerByte_(key[key.size() / 2]) << 16)
+                + (LowerByte_(key.back()) << 24) };
+
+            return (mix ^ (mix >> 13)) * seed >> 24;
+        }
+
+        struct HeaderIdTable {
+            uint32_t seed{};
+            std::array<HeaderIdEnum, 256> slots{};
+        };
+
+        consteval HeaderIdTable MakeHeaderIdTable_() {
+            for (uint32_t seed{ 0x9E3779B1 };; seed += 2) {
+                HeaderIdTable table{ seed };
+
+                bool collides{};
+                for (size_t id{ 1 }; id < k_headerInfos.size() && !collides; ++id) {
+                    auto& slot{ table.slots[HeaderHash_(k_headerInfos[id].name, seed)] };
+
+                    collides = slot != HeaderIdEnum::Unknown;
+                    slot = static_cast<HeaderIdEnum>(id);
+                }
+
+                if (!collides)
+                    return table;
+            }
+        }
+
+        inline constexpr HeaderIdTable k_headerIdTable{ MakeHeaderIdTable_() };
+    }
+
+    //! @brief Resolves a header name, in any case, to its ID.
+    //! @return `HeaderIdEnum::Unknown` when `key` isn't a well-known name.
+    //! @par Example
+    //! @code{.cpp}
+    //! static_assert(NHeaders::HeaderIdOf("Content-Length") == NHeaders::HeaderIdEnum::ContentLength);
+    //! @endcode
+    constexpr HeaderIdEnum HeaderIdOf(const std::string_view key) {
+        if (key.empty())
+            return HeaderIdEnum::Unknown;
+
+        const auto id{ details_::k_headerIdTable.slots[details_::HeaderHash_(key, details_::k_headerIdTable.seed)] };
+        const auto name{ details_::k_headerInfos[static_cast<size_t>(id)].name };
+
+        if (name.size() != key.size())
+            return HeaderIdEnum::Unknown;
+
+        for (size_t i{}; i < key.size(); ++i)
+            if (details_::LowerByte_(key[i]) != static_cast<unsigned char>(name[i]))
+                return HeaderIdEnum::Unknown;
+
+        return id;
+    }
+
+    //! @return How fields named `id` are stored.
+    constexpr const HeaderInfo& HeaderInfoOf(const HeaderIdEnum id) {
+        return details_::k_headerInfos[static_cast<size_t>(id)];
+    }
+
+    //! @return The lower-case name of `id`, empty for `Unknown`.
+    constexpr std::string_view HeaderName(const HeaderIdEnum id) {
+        return HeaderInfoOf(id).name;
+    }
+}
@@ -10,6 +10,8 @@
 
 #include <Thoth/Http/Url/Url.hpp>
 #include <Thoth/Http/NHeaders/_base.hpp>
+#include <Thoth/Http/NHeaders/HeaderId.hpp>
+#include <Thoth/Http/NHeaders/ParsedCache.hpp>
 
 #include <Thoth/Http/NHeaders/Headers/_pch.hpp>
 #include <Thoth/Http/NHeaders/Proxy/_base.hpp>
@@ -38,6 +40,13 @@ namespace Thoth::Http {
 
     //! @brief Stores the common header fields of an HTTP message.
     //!
+    //! Every field keeps its @ref NHeaders::HeaderIdEnum "HeaderIdEnum" beside the name, looking up a well-known
+    //! name (by ID or by string) is an ID comparison, other names are compared case-insensitively.
+    //!
+    //! The typed accessors keep what they parse, repeated reads of an unchanged field are not parsed again. Once a
+    //! mutable reference to a field was handed out (mutable `Get`, `GetAll`, `operator[]` or iterators), reads of
+    //! that name parse every time, until its last field is removed or the headers are cleared.
+    //!
     //! Its typed accessors expose concrete models from `NHeaders`, including `MimeType`, `AcceptEncoding`,
     //! `ContentEncodingEnum`, `TransferEncodingEnum`, `Upgrade` and `Link`.
     //!
@@ -106,6 +115,11 @@ namespace Thoth::Http {
         //! @return True if the key-value pair exists, false otherwise.
         [[nodiscard]] bool Exists(HeaderKeyRef key, HeaderValueRef val) const;
 
+        //! @brief check if a well-known header exists, without touching its name.
+        //! @param id The header to be checked.
+        //! @return True if the header exists, false otherwise.
+        [[nodiscard]] bool Exists(NHeaders::HeaderIdEnum id) const;
+
         //! @brief Add a value with the specified key. Append if already exists.
         //! @param p A pair with the key and the value to be added.
         void Add(HeaderPairRef p);
@@ -125,6 +139,11 @@ namespace Thoth::Http {
         //! @param k A The key to be removed.
         bool Remove(HeaderKeyRef k);
 
+        //! @brief Remove the first field of a well-known header.
+        //! @param id The header to be removed.
+        //! @return True if the header existed, false otherwise.
+        bool Remove(NHeaders::HeaderIdEnum id);
+
         //! @brief Remove a value with the specified key.
         //! @param p A pair with the key and the value to be removed.
         //! @return True if the key exists, false otherwise.
@@ -152,6 +171,14 @@ namespace Thoth::Http {
         //! @return const HeaderValue* if the key exists, std::nullopt otherwise.
         [[nodiscard]] std::optional<const HeaderValue*> Get(HeaderKeyRef key) const;
 
+        //! @brief Get the reference of a well-known header.
+        //! @param id The header.
+        //! @return HeaderValue* if the header exists, std::nullopt otherwise.
+        std::optional<HeaderValue*> Get(NHeaders::HeaderIdEnum id);
+
+        //! @copydoc Get(NHeaders::HeaderIdEnum)
+        [[nodiscard]] std::optional<const HeaderValue*> Get(NHeaders::HeaderIdEnum id) const;
+
         //! @brief Get all the references associated with a key.
         //! @param key The key.
         //! @return HeaderRef for every matching header.
@@ -304,6 +331,8 @@ namespace Thoth::Http {
 
 
 
+        //! @note Keys must not be renamed through the iterators, the ID kept beside each one would go stale. The
+        //! mutable iterators drop the parsed values of every field.
         IterType begin();
         IterType end();
         [[nodiscard]] CIterType begin() const;
@@ -335,6 +364,26 @@ namespace Thoth::Http {
         bool operator==(const Headers& other) const;
     protected:
         MapType m_headers;
+        //! @brief The ID of each entry of `m_headers`, at the same index.
+        std::vector<NHeaders::HeaderIdEnum> m_ids;
+        //! @brief Bit `n` is set while a field with the ID `n` is present, absent lookups end here.
+        uint64_t m_present{};
+        //! @brief Values parsed by the typed proxies, dropped by every change to their field.
+        mutable NHeaders::details_::ParsedCache m_parsed;
+
+    private:
+        [[nodiscard]] std::optional<size_t> Find_(NHeaders::HeaderIdEnum id, HeaderKeyRef key) const;
+        void Add_(NHeaders::HeaderIdEnum id, HeaderKeyRef key, HeaderValueRef val);
+        void Set_(NHeaders::HeaderIdEnum id, HeaderKeyRef key, HeaderValueRef val);
+        void Emplace_(NHeaders::HeaderIdEnum id, HeaderKeyRef key, HeaderValueRef val);
+        void Erase_(size_t idx);
+
+        template<bool IsConst, Utils::Serializable ...T>
+        friend struct NHeaders::ValueProxy;
+        template<bool IsConst, Utils::Serializable ...T>
+        friend struct NHeaders::ListProxy;
+        template<bool IsConst, Utils::Serializable ...T>
+        friend struct NHeaders::MultiValueProxy;
 
         friend struct std::formatter<Headers>;
         friend struct std::formatter<RequestHeaders>;
@@ -1,12 +1,10 @@
 #pragma once
 #include <algorithm>
-#include <bitset>
 #include <functional>
 #include <limits>
 #include <ranges>
 
-#include <Hermes/Utils/UntilMatch.hpp>
-
+#include <Thoth/Http/NHeaders/HeaderBlock.hpp>
 #include <Thoth/Http/NHeaders/Proxy/ValueProxy.hpp>
 #include <Thoth/Http/NHeaders/Proxy/ListProxy.hpp>
 
@@ -21,30 +19,6 @@ namespace Thoth::Http {
         using std::string;
 
 
-        constexpr auto toLower{ [](const unsigned char c) -> char {
-            if ('A' <= c && c <= 'Z')
-                return c - 'A' + 'a';
-            return c;
-        } };
-        constexpr auto isCharAllowed{ [](const unsigned char c) -> bool {
-            constexpr auto allowedChars{ std::invoke([] {
-                std::bitset<256> res{};
-
-                for (char ch{'0'}; ch <= '9'; ch++) res.set(ch);
-                for (char ch{'a'}; ch <= 'z'; ch++) res.set(ch);
-                for (char ch{'A'}; ch <= 'Z'; ch++) res.set(ch);
-
-                for (const char ch : "!#$%&\'*+-.^_`|~")
-                    res.set(ch);
-
-                return res;
-            }) };
-
-            return allowedChars[c];
-        } };
-
-        constexpr string_view delimiter { "\r\n" };
-
         string materializedHeaders;
         string_view headersView;
 
@@ -72,40 +46,15 @@ namespace Thoth::Http {
         }
 
         Headers res;
+        res.m_headers.reserve(8);
+        res.m_ids.reserve(8);
 
-        while (!headersView.empty()) {
-            auto headerRaw{ headersView | Hermes::Utils::ExclusiveUntilMatch(delimiter) };
-            string headerLine{ headerRaw | rg::to<string>() };
-            const auto colon{ headerLine.find(':') };
-
-            if (colon == string::npos)
-                return std::unexpected{ MessageParseErrorEnum::InvalidHeaders };
-
-            string headerKey{ headerLine.substr(0, colon) };
-            string headerVal{ headerLine.substr(colon + 1) };
-
-            auto consumedHeader{
-                headersView | Hermes::Utils::InclusiveUntilMatch(delimiter)
-            };
-            headersView.remove_prefix(rg::distance(consumedHeader));
-
-            if (headerKey.empty() || headerKey.back() == ' ' || headerKey.back() == '\t'
-                || !rg::all_of(headerKey, isCharAllowed))
-                return std::unexpected{ MessageParseErrorEnum::InvalidHeaders };
-
-            while (!headerVal.empty() && (headerVal.front() == ' ' || headerVal.front() == '\t'))
-                headerVal.erase(headerVal.begin());
-
-            while (!headerVal.empty() && (headerVal.back() == ' ' || headerVal.back() == '\t'))
-                headerVal.pop_back();
-
-            rg::transform(headerKey, headerKey.begin(), toLower);
-
-            if (IsSingleValue(headerKey) && res.Exists(headerKey))
-                return std::unexpected{ MessageParseErrorEnum::InvalidHeaders };
-
-            res.Add(headerKey, headerVal);
-        }
+        const auto scanRes{ NHeaders::details_::ScanHeaderBlock(headersView,
+            [&](const NHeaders::HeaderIdEnum id, const string_view key, const string_view val) {
+                res.Add_(id, key, val);
+            }) };
+        if (!scanRes)
+            return std::unexpected{ scanRes.error() };
 
         return res;
     }
@@ -23,7 +23,8 @@ struct Thoth::Utils::Scanner<Thoth::Http::NHeaders::AcceptEncodingEnum> {
         if (std::ranges::equal(value, std::string_view{ "zstd"     })) return AcceptEncodingEnum::Zstd;
         if (std::ranges::equal(value, std::string_view{ "dcb"      })) return AcceptEncodingEnum::Dcb;
         if (std::ranges::equal(value, std::string_view{ "dcz"      })) return AcceptEncodingEnum::Dcz;
-        if (std::ranges::equal(value, std::string_view{ "*"        })) return AcceptEncodingEnum::Identity;
+        if (std::ranges::equal(value, std::string_view{ "identity" })) return AcceptEncodingEnum::Identity;
+        if (std::ranges::equal(value, std::string_view{ "*"        })) return AcceptEncodingEnum::Wildcard;
 
         return std::nullopt;
     }
@@ -0,0 +1,23 @@
+#pragma once
+#include <string>
+
+namespace Thoth::Http::NHeaders {
+    //! @brief RFC 7617 — The 'Basic' HTTP Authentication Scheme.
+    //!
+    //! Sent as `Basic base64(username ":" password)`. The username cannot hold a ':', the password can.
+    //!
+    //! @par Example
+    //! @code{.cpp}
+    //! BasicCredentials credentials{ "Aladdin", "open sesame" }; // formats as Basic QWxhZGRpbjpvcGVuIHNlc2FtZQ==
+    //! @endcode
+    struct BasicCredentials {
+        std::string username;
+        std::string password;
+
+        bool operator==(const BasicCredentials&) const = default;
+    };
+}
+
+#include <Thoth/Http/NHeaders/Headers/Auth/Basic.tpp>
+
+static_assert(Thoth::Utils::Serializable<Thoth::Http::NHeaders::BasicCredentials>);
@@ -0,0 +1,61 @@
+#pragma once
+#include <Thoth/Http/NHeaders/Proxy/_base.hpp>
+#include <algorithm>
+#include <optional>
+#include <format>
+
+#include <Thoth/String/Base64Viewer.hpp>
+#include <Thoth/String/Utils.hpp>
+
+
+
+template<>
+struct Thoth::Utils::Scanner<Thoth::Http::NHeaders::BasicCredentials> {
+    using BasicCredentials = Http::NHeaders::BasicCredentials;
+
+    static bool Parse(const std::string_view str) {
+        return str.empty();
+    }
+
+    std::optional<BasicCredentials> Scan(std::string_view input) {
+        static constexpr std::string_view scheme{ "basic" };
+
+        String::Trim(input);
+
+        // auth-scheme is case-insensitive (RFC 9110 §11.1)
+        if (input.size() <= scheme.size()
+                || !std::ranges::equal(input.substr(0, scheme.size()), scheme, String::CaseInsensitiveCompare)
+                || !String::CharSequences::k_linearWhitespace.contains(input[scheme.size()]))
+            return std::nullopt;
+
+        input.remove_prefix(scheme.size());
+        String::LeftTrim(input, String::CharSequences::k_linearWhitespace);
+
+        auto decoded{ String::Base64View::TryDecode(input) };
+        if (!decoded)
+            return std::nullopt;
+
+        const auto colon{ decoded->find(':') };
+        if (colon == std::string::npos)
+            return std::nullopt;
+
+        return BasicCredentials{ decoded->substr(0, colon), decoded->substr(colon + 1) };
+    }
+};
+
+template<>
+struct std::formatter<Thoth::Http::NHeaders::BasicCredentials> {
+    static constexpr auto parse(auto &ctx) { return ctx.begin(); }
+
+    template<class FormatContext>
+    auto format(const Thoth::Http::NHeaders::BasicCredentials& credentials, FormatContext& ctx) const {
+        std::string userPass;
+        userPass.reserve(credentials.username.size() + 1 + credentials.password.size());
+        userPass.append(credentials.username).append(1, ':').append(credentials.password);
+
+        std::string encoded{ "Basic " };
+        Thoth::String::Base64View::AppendEncoded(encoded, userPass);
+
+        return std::ranges::copy(encoded, ctx.out()).out;
+    }
+};
@@ -2,33 +2,69 @@
 #include <variant>
 #include <chrono>
 #include <numeric>
+#include <optional>
+#include <string>
 
 
-// namespace Thoth::Http::NHeaders {
-//     //! @brief RFC 9111 - HTTP Caching
-//
-//     namespace NCacheControl {
-//         // Request
-//         struct MaxAge{ std::chrono::seconds seconds; };
-//         struct MaxStale{ std::chrono::seconds seconds{ (std::numeric_limits<uint32_t>::max)() }; };
-//         struct MinFresh{ std::chrono::seconds seconds; };
-//         struct NoCache{};
-//         struct NoStore{};
-//         struct NoTransform{};
-//         struct OnlyIfCached{};
-//
-//         // Response
-//         struct MustRevalidate {};
-//         struct Public {};
-//         struct Private {};
-//         struct ProxyRevalidate {};
-//         struct SMaxage { std::chrono::seconds seconds; };
-//         // Also NoCache, NoStore, NoTransform and MaxAge.
-//
-//         // Extended
-//
-//
-//     }
-//
-//     using CacheControl = std::variant<>;
-// }
+namespace Thoth::Http::NHeaders {
+    //! @brief RFC 9111 - HTTP Caching
+    //!
+    //! One struct per `Cache-Control` directive (RFC 9111 §5.2). Directives with an argument store it in `seconds`;
+    //! unknown directives are kept verbatim as `Extension` so they survive a round trip.
+    //!
+    //! @note The field-name list of the qualified `no-cache="..."` and `private="..."` forms is dropped, they are
+    //! treated as the unqualified directives (which is what a private cache must do anyway).
+    namespace NCacheControl {
+        // Request
+        struct MaxAge{ std::chrono::seconds seconds; bool operator==(const MaxAge&) const = default; };
+        struct MaxStale{
+            std::chrono::seconds seconds{ (std::numeric_limits<uint32_t>::max)() };
+            bool operator==(const MaxStale&) const = default;
+        };
+        struct MinFresh{ std::chrono::seconds seconds; bool operator==(const MinFresh&) const = default; };
+        struct NoCache{ bool operator==(const NoCache&) const = default; };
+        struct NoStore{ bool operator==(const NoStore&) const = default; };
+        struct NoTransform{ bool operator==(const NoTransform&) const = default; };
+        struct OnlyIfCached{ bool operator==(const OnlyIfCached&) const = default; };
+
+        // Response
+        struct MustRevalidate { bool operator==(const MustRevalidate&) const = default; };
+        struct Public { bool operator==(const Public&) const = default; };
+        struct Private { bool operator==(const Private&) const = default; };
+        struct ProxyRevalidate { bool operator==(const ProxyRevalidate&) const = default; };
+        struct SMaxage { std::chrono::seconds seconds; bool operator==(const SMaxage&) const = default; };
+        // Also NoCache, NoStore, NoTransform and MaxAge.
+
+        // Extended
+        struct Immutable { bool operator==(const Immutable&) const = default; };
+        struct StaleWhileRevalidate { std::chrono::seconds seconds; bool operator==(const StaleWhileRevalidate&) const = default; };
+        struct StaleIfError { std::chrono::seconds seconds; bool operator==(const StaleIfError&) const = default; };
+
+        //! Any directive not listed above, such as `community="UCI"`.
+        struct Extension {
+            std::string name;
+            std::optional<std::string> value{};
+
+            bool operator==(const Extension&) const = default;
+        };
+    }
+
+    //! @brief A single `Cache-Control` directive.
+    //! @par Example
+    //! @code{.cpp}
+    //! headers.CacheControl().Set(std::vector<NHeaders::CacheControl>{
+    //!     NHeaders::NCacheControl::Private{}, NHeaders::NCacheControl::MaxAge{ std::chrono::seconds{ 60 } } });
+    //! @endcode
+    using CacheControl = std::variant<
+        NCacheControl::MaxAge,         NCacheControl::MaxStale,        NCacheControl::MinFresh,
+        NCacheControl::NoCache,        NCacheControl::NoStore,         NCacheControl::NoTransform,
+        NCacheControl::OnlyIfCached,   NCacheControl::MustRevalidate,  NCacheControl::Public,
+        NCacheControl::Private,        NCacheControl::ProxyRevalidate, NCacheControl::SMaxage,
+        NCacheControl::Immutable,      NCacheControl::StaleWhileRevalidate,
+        NCacheControl::StaleIfError,   NCacheControl::Extension
+    >;
+}
+
+#include <Thoth/Http/NHeaders/Headers/CacheControl.tpp>
+
+static_assert(Thoth::Utils::Serializable<Thoth::Http::NHeaders::CacheControl>);
@@ -1,9 +1,141 @@
 #pragma once
-#include <variant>
-#include <chrono>
-#include <numeric>
+#include <Thoth/Http/NHeaders/Proxy/_base.hpp>
+#include <algorithm>
+#include <format>
+#include <functional>
+#include <optional>
+#include <utility>
 
+#include <Thoth/String/Utils.hpp>
 
-namespace Thoth::Http::NHeaders {
 
+namespace Thoth::Http::NHeaders::Details_ {
+    template<class T>
+    constexpr std::string_view k_cacheDirectiveName{};
+
+    template<> constexpr std::string_view k_cacheDirectiveName<NCacheControl::MaxAge>              { "max-age" };
+    template<> constexpr std::string_view k_cacheDirectiveName<NCacheControl::MaxStale>            { "max-stale" };
+    template<> constexpr std::string_view k_cacheDirectiveName<NCacheControl::MinFresh>            { "min-fresh" };
+    template<> constexpr std::string_view k_cacheDirectiveName<NCacheControl::NoCache>             { "no-cache" };
+    template<> constexpr std::string_view k_cacheDirectiveName<NCacheControl::NoStore>             { "no-store" };
+    template<> constexpr std::string_view k_cacheDirectiveName<NCacheControl::NoTransform>         { "no-transform" };
+    template<> constexpr std::string_view k_cacheDirectiveName<NCacheControl::OnlyIfCached>        { "only-if-cached" };
+    template<> constexpr std::string_view k_cacheDirectiveName<NCacheControl::MustRevalidate>      { "must-revalidate" };
+    template<> constexpr std::string_view k_cacheDirectiveName<NCacheControl::Public>              { "public" };
+    template<> constexpr std::string_view k_cacheDirectiveName<NCacheControl::Private>             { "private" };
+    template<> constexpr std::string_view k_cacheDirectiveName<NCacheControl::ProxyRevalidate>     { "proxy-revalidate" };
+    template<> constexpr std::string_view k_cacheDirectiveName<NCacheControl::SMaxage>             { "s-maxage" };
+    template<> constexpr std::string_view k_cacheDirectiveName<NCacheControl::Immutable>           { "immutable" };
+    template<> constexpr std::string_view k_cacheDirectiveName<NCacheControl::StaleWhileRevalidate>{ "stale-while-revalidate" };
+    template<> constexpr std::string_view k_cacheDirectiveName<NCacheControl::StaleIfError>        { "stale-if-error" };
+
+    template<class T>
+    concept CacheDirectiveWithSeconds = requires(T t) { { t.seconds } -> std::same_as<std::chrono::seconds&>; };
+
+    // RFC 9111 §1.2.2: delta-seconds bigger than 2^31 must be read as 2^31.
+    inline std::optional<std::chrono::seconds> ScanDeltaSeconds(std::string_view input) {
+        if (input.empty() || !std::ranges::all_of(input, [](char c) { return '0' <= c && c <= '9'; }))
+            return std::nullopt;
+
+        constexpr int64_t k_maxDelta{ int64_t{ 1 } << 31 };
+        if (input.size() > 10) return std::chrono::seconds{ k_maxDelta };
+
+        const auto value{ Utils::Scan<int64_t>(input) };
+        if (!value) return std::nullopt;
+
+        return std::chrono::seconds{ std::min(*value, k_maxDelta) };
+    }
+
+    template<class T>
+    std::optional<CacheControl> ScanCacheDirective(std::optional<std::string_view> arg) {
+        if constexpr (CacheDirectiveWithSeconds<T>) {
+            if (!arg) {
+                if constexpr (std::same_as<T, NCacheControl::MaxStale>)
+                    return T{};
+                return std::nullopt;
+            }
+
+            const auto seconds{ ScanDeltaSeconds(*arg) };
+            if (!seconds) return std::nullopt;
+
+            return T{ *seconds };
+        } else
+            return T{};
+    }
 }
+
+template<>
+struct Thoth::Utils::Scanner<Thoth::Http::NHeaders::CacheControl> {
+    using CacheControl = Http::NHeaders::CacheControl;
+
+    static bool Parse(const std::string_view str) {
+        return str.empty();
+    }
+
+    std::optional<CacheControl> Scan(std::string_view input) {
+        using namespace Thoth::Http::NHeaders;
+
+        String::Trim(input);
+        if (input.empty()) return std::nullopt;
+
+        const auto eq{ input.find('=') };
+        const std::string_view name{ String::Trimmed(input.substr(0, eq)) };
+        if (name.empty()) return std::nullopt;
+
+        std::optional<std::string_view> arg;
+        if (eq != std::string_view::npos) {
+            std::string_view value{ String::Trimmed(input.substr(eq + 1)) };
+            if (value.size() >= 2 && value.front() == '"' && value.back() == '"')
+                value = value.substr(1, value.size() - 2);
+            arg = value;
+        }
+
+        const bool isKnown{ std::invoke([&]<size_t ...I>(std::index_sequence<I...>) {
+            return (std::invoke([&] {
+                using Directive = std::variant_alternative_t<I, CacheControl>;
+
+                if (!std::ranges::equal(name, Details_::k_cacheDirectiveName<Directive>, String::CaseInsensitiveCompare))
+                    return false;
+
+                m_result = Details_::ScanCacheDirective<Directive>(arg);
+                return true;
+            }) || ...);
+        }, std::make_index_sequence<std::variant_size_v<CacheControl> - 1>{}) };
+
+        if (isKnown)
+            return std::exchange(m_result, std::nullopt);
+
+        return NCacheControl::Extension{
+            String::TrimmedStr(name),
+            arg.transform([](std::string_view val) { return std::string{ val }; })
+        };
+    }
+
+private:
+    std::optional<CacheControl> m_result{};
+};
+
+template<>
+struct std::formatter<Thoth::Http::NHeaders::CacheControl> {
+    static constexpr auto parse(auto &ctx) { return ctx.begin(); }
+
+    template<class FormatContext>
+    auto format(const Thoth::Http::NHeaders::CacheControl& directive, FormatContext& ctx) const {
+        using namespace Thoth::Http::NHeaders;
+
+        return std::visit([&]<class T>(const T& value) {
+            if constexpr (std::same_as<T, NCacheControl::Extension>) {
+                if (!value.value)
+                    return std::format_to(ctx.out(), "{}", value.name);
+                return std::format_to(ctx.out(), "{}=\"{}\"", value.name, *value.value);
+            } else if constexpr (std::same_as<T, NCacheControl::MaxStale>) {
+                if (value == NCacheControl::MaxStale{})
+                    return std::format_to(ctx.out(), "{}", Details_::k_cacheDirectiveName<T>);
+                return std::format_to(ctx.out(), "{}={}", Details_::k_cacheDirectiveName<T>, value.seconds.count());
+            } else if constexpr (Details_::CacheDirectiveWithSeconds<T>)
+                return std::format_to(ctx.out(), "{}={}", Details_::k_cacheDirectiveName<T>, value.seconds.count());
+            else
+                return std::format_to(ctx.out(), "{}", Details_::k_cacheDirectiveName<T>);
+        }, directive);
+    }
+};
@@ -19,7 +19,9 @@ namespace Thoth::Http::NHeaders {
         //! Dictionary-compressed Brotli coding (`dcb`).
         Dcb,
         //! Dictionary-compressed Zstandard coding (`dcz`).
-        Dcz
+        Dcz,
+        //! No coding at all (`identity`), only meaningful in `Content-Encoding` from older servers.
+        Identity
     };
 }
 
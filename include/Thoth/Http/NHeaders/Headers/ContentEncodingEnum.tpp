@@ -23,6 +23,7 @@ struct Thoth::Utils::Scanner<Thoth::Http::NHeaders::ContentEncodingEnum> {
         if (std::ranges::equal(value, std::string_view{ "zstd"     })) return ContentEncodingEnum::Zstd;
         if (std::ranges::equal(value, std::string_view{ "dcb"      })) return ContentEncodingEnum::Dcb;
         if (std::ranges::equal(value, std::string_view{ "dcz"      })) return ContentEncodingEnum::Dcz;
+        if (std::ranges::equal(value, std::string_view{ "identity" })) return ContentEncodingEnum::Identity;
 
         return std::nullopt;
     }
@@ -43,6 +44,7 @@ struct std::formatter<Thoth::Http::NHeaders::ContentEncodingEnum> {
         if (contentEncoding == ContentEncodingEnum::Zstd    ) std::format_to(ctx.out(), "zstd"    );
         if (contentEncoding == ContentEncodingEnum::Dcb     ) std::format_to(ctx.out(), "dcb"     );
         if (contentEncoding == ContentEncodingEnum::Dcz     ) std::format_to(ctx.out(), "dcz"     );
+        if (contentEncoding == ContentEncodingEnum::Identity) std::format_to(ctx.out(), "identity");
 
         return ctx.out();
     }
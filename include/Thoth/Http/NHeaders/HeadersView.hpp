@@ -0,0 +1,101 @@
+#pragma once
+#include <cstdint>
+#include <expected>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <Thoth/Http/NHeaders/Headers.hpp>
+
+namespace Thoth::Http {
+    //! @brief A read-only header block, parsed in place.
+    //!
+    //! The raw block is kept in one buffer and every field is a pair of offsets into it, parsing allocates nothing
+    //! beyond the field index. Names are lower-cased in the buffer. Repeated fields stay separate (`Get` returns
+    //! the first, `GetAll` every one), they are only folded by @ref ToHeaders, the copy to take when the headers
+    //! have to be modified.
+    //!
+    //! @par Example
+    //! @code{.cpp}
+    //! auto view{ HeadersView::Parse(std::move(rawBlock)) };
+    //! if (view && view->Exists(NHeaders::HeaderIdEnum::TransferEncoding)) { ... }
+    //!
+    //! for (const auto& [name, value, id] : view->Fields())
+    //!     std::println("{}: {}", name, value);
+    //!
+    //! Headers editable{ view->ToHeaders() };
+    //! @endcode
+    struct HeadersView {
+        using HeaderKeyRef = NHeaders::HeaderKeyRef;
+
+        //! @brief One field, viewing the block.
+        struct Field {
+            std::string_view name;
+            std::string_view value;
+            NHeaders::HeaderIdEnum id;
+        };
+
+
+        HeadersView() = default;
+
+        //! @brief Parses `block`, the fields separated by `"\r\n"`, taking ownership of it.
+        //! @param block The raw header block, with or without the final `"\r\n"`.
+        //! @param maxHeadersLength the max length that the headers can achieve.
+        //! @return The view, `InvalidHeaders` when a field is malformed or a single-value one repeats and
+        //! `HeadersTooLarge` when the block is too long.
+        static std::expected<HeadersView, MessageParseErrorEnum> Parse(std::string block, size_t maxHeadersLength = 1<<16);
+
+
+        //! @brief check if a key exists.
+        [[nodiscard]] bool Exists(HeaderKeyRef key) const;
+
+        //! @brief check if a well-known header exists.
+        [[nodiscard]] bool Exists(NHeaders::HeaderIdEnum id) const;
+
+        //! @return The value of the first field named `key`, std::nullopt if there is none.
+        [[nodiscard]] std::optional<std::string_view> Get(HeaderKeyRef key) const;
+
+        //! @return The value of the first field with the ID `id`, std::nullopt if there is none.
+        [[nodiscard]] std::optional<std::string_view> Get(NHeaders::HeaderIdEnum id) const;
+
+        //! @return The values of every field named `key`, in order.
+        [[nodiscard]] std::vector<std::string_view> GetAll(HeaderKeyRef key) const;
+
+        //! @return The fields in order, as @ref Field.
+        [[nodiscard]] auto Fields() const;
+
+        //! @return The field at `idx`.
+        [[nodiscard]] Field operator[](size_t idx) const;
+
+        //! @return The count of fields.
+        [[nodiscard]] size_t Size() const;
+
+        //! @return True if Size() is 0.
+        [[nodiscard]] bool Empty() const;
+
+        //! @return The whole block, names lower-cased.
+        [[nodiscard]] std::string_view Block() const;
+
+        //! @brief Copies the fields into an editable Headers, folding the repeated ones as Headers::Add does.
+        [[nodiscard]] Headers ToHeaders() const;
+
+    private:
+        struct Entry_ {
+            uint32_t nameOffset;
+            uint32_t valueOffset;
+            uint32_t valueSize;
+            uint16_t nameSize;
+            NHeaders::HeaderIdEnum id;
+        };
+
+        [[nodiscard]] std::optional<size_t> Find_(NHeaders::HeaderIdEnum id, HeaderKeyRef key) const;
+        [[nodiscard]] Field Field_(const Entry_& entry) const;
+
+        std::string m_block;
+        std::vector<Entry_> m_fields;
+        uint64_t m_present{};
+    };
+}
+
+#include <Thoth/Http/NHeaders/HeadersView.tpp>
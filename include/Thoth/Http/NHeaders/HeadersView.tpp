@@ -0,0 +1,8 @@
+#pragma once
+#include <ranges>
+
+namespace Thoth::Http {
+    inline auto HeadersView::Fields() const {
+        return m_fields | std::views::transform([this](const Entry_& entry) { return Field_(entry); });
+    }
+}
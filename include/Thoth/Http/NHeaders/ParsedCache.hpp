@@ -0,0 +1,96 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+#include <Thoth/Http/NHeaders/HeaderId.hpp>
+
+namespace Thoth::Http::NHeaders::details_ {
+    //! @brief The values parsed by the typed proxies of one `Headers`, so repeated reads skip the `Scanner`.
+    //! @details
+    //! A value is keyed by the header ID, the parsed type and the address of the scan pattern: the accessors of
+    //! `Headers` pass string literals, or empty patterns. `Headers` drops the values of an ID whenever its fields
+    //! change (`Set`, `Add`, `Remove`, ...). Names outside the well-known table are never cached.
+    //!
+    //! The values sit in a few slots inside the cache, the oldest one reused when they are all taken. A small
+    //! trivially copyable value (`std::optional<uint64_t>`, a date...) is stored in the slot itself: reading a
+    //! header once, as the framing checks do, costs the parse and a copy, no allocation.
+    //!
+    //! A mutable reference to a field (a mutable `Get`, `GetAll`, `operator[]` or iterator) can change it at any
+    //! later time, so its ID is exposed: never cached again until no field of that ID is left.
+    //!
+    //! Reads of a const `Headers` may run on several threads: the cache is only used by whoever gets its flag,
+    //! the others parse as if it were empty. Copies start empty.
+    struct ParsedCache {
+        ParsedCache() = default;
+        ParsedCache(const ParsedCache&) noexcept;
+        ParsedCache(ParsedCache&& other) noexcept;
+        ParsedCache& operator=(const ParsedCache&) noexcept;
+        ParsedCache& operator=(ParsedCache&& other) noexcept;
+        ~ParsedCache() = default;
+
+        //! @brief The cached `T` for `id` and `pattern`, `parse()` stored as it on a miss.
+        //! @param pattern Compared by address, it must outlive the `Headers` as the literals of its accessors do.
+        template<class T, class F>
+        T GetOrParse(HeaderIdEnum id, std::span<const std::string_view> pattern, F&& parse) const;
+
+        //! @brief Drops every value parsed from `id`.
+        void Invalidate(HeaderIdEnum id) noexcept;
+
+        //! @brief Drops the values of `id` and stops caching it, a mutable reference to one of its fields escaped.
+        void Expose(HeaderIdEnum id) noexcept;
+
+        //! @brief @ref Expose for every ID.
+        void ExposeAll() noexcept;
+
+        //! @brief Drops the values of `id`, and its exposure when its last field is gone.
+        void Erase(HeaderIdEnum id, bool lastOfId) noexcept;
+
+        //! @brief Drops every value and every exposure, no field is left.
+        void Clear() noexcept;
+
+    private:
+        static constexpr size_t k_slots{ 4 };
+        //! Patterns with more parts, none in `Headers`, are never cached.
+        static constexpr size_t k_patternParts{ 2 };
+        static constexpr size_t k_inlineSize{ 16 };
+
+        //! Stored in the slot itself rather than behind a `std::shared_ptr`.
+        template<class T>
+        static constexpr bool k_inline{
+            std::is_trivially_copyable_v<T> && sizeof(T) <= k_inlineSize && alignof(T) <= alignof(uint64_t)
+        };
+
+        struct Slot {
+            //! `Unknown` while the slot is free.
+            HeaderIdEnum id{ HeaderIdEnum::Unknown };
+            uint8_t patternSize{};
+            const void* type{};
+            std::array<std::string_view, k_patternParts> pattern{};
+            alignas(uint64_t) std::byte inlineValue[k_inlineSize]{};
+            std::shared_ptr<const void> value;
+
+            [[nodiscard]] bool Matches(HeaderIdEnum id, const void* type, std::span<const std::string_view> pattern) const;
+            void Reset() noexcept;
+        };
+
+        template<class T>
+        static constexpr char k_typeTag{};
+
+        [[nodiscard]] static constexpr uint64_t Bit_(HeaderIdEnum id) noexcept;
+
+        mutable std::array<Slot, k_slots> m_slots{};
+        //! The slot taken by the next value, in turn.
+        mutable uint8_t m_next{};
+        //! @brief Bit `n` is set while the ID `n` is exposed, only changed through a mutable `Headers`.
+        uint64_t m_exposed{};
+        mutable std::atomic_flag m_busy;
+    };
+}
+
+#include <Thoth/Http/NHeaders/ParsedCache.tpp>
@@ -0,0 +1,51 @@
+#pragma once
+#include <algorithm>
+#include <new>
+#include <utility>
+
+namespace Thoth::Http::NHeaders::details_ {
+    constexpr uint64_t ParsedCache::Bit_(const HeaderIdEnum id) noexcept {
+        return uint64_t{ 1 } << static_cast<size_t>(id);
+    }
+
+    template<class T, class F>
+    T ParsedCache::GetOrParse(const HeaderIdEnum id, const std::span<const std::string_view> pattern, F&& parse) const {
+        if (id == HeaderIdEnum::Unknown || pattern.size() > k_patternParts || (m_exposed & Bit_(id))
+                || m_busy.test_and_set(std::memory_order_acquire))
+            return std::forward<F>(parse)();
+
+        struct Release {
+            std::atomic_flag& busy;
+            ~Release() { busy.clear(std::memory_order_release); }
+        } release{ m_busy };
+
+        for (const auto& slot : m_slots) {
+            if (!slot.Matches(id, &k_typeTag<T>, pattern))
+                continue;
+
+            if constexpr (k_inline<T>)
+                return *std::launder(reinterpret_cast<const T*>(slot.inlineValue));
+            else
+                return *static_cast<const T*>(slot.value.get());
+        }
+
+        // Parsed before the slot is touched, a throwing parse leaves it as it was.
+        T value{ std::forward<F>(parse)() };
+
+        auto& slot{ m_slots[m_next] };
+        m_next = static_cast<uint8_t>((m_next + 1) % k_slots);
+
+        slot.Reset();
+        if constexpr (k_inline<T>)
+            new (slot.inlineValue) T{ value };
+        else
+            slot.value = std::make_shared<const T>(value);
+
+        slot.id          = id;
+        slot.type        = &k_typeTag<T>;
+        slot.patternSize = static_cast<uint8_t>(pattern.size());
+        std::ranges::copy(pattern, slot.pattern.begin());
+
+        return value;
+    }
+}
@@ -1,5 +1,6 @@
 #pragma once
 #include <expected>
+#include <span>
 #include <Thoth/Http/NHeaders/_base.hpp>
 #include <Thoth/Http/NHeaders/Headers.hpp>
 #include <Thoth/Http/NHeaders/Proxy/_base.hpp>
@@ -12,7 +13,8 @@ namespace Thoth::Http::NHeaders {
 
     //! @brief Typed proxy for a comma-separated header value.
     //!
-    //! A `ListProxy` adapts one header field to a typed list. The proxy itself is a short-lived accessor.
+    //! A `ListProxy` adapts one header field to a typed list. The proxy itself is a short-lived accessor, the
+    //! parsed list is kept by `Headers` until the field changes.
     //!
     //! @note Given that it can't be stored in any sense, it is intentionally not a `std::ranges::range`. Call `Get()`
     //! or `GetAsOpt()` to materialize the parsed `std::vector`.
@@ -84,6 +86,11 @@ namespace Thoth::Http::NHeaders {
         static std::optional<std::vector<U>> ParseList(const HeaderValue* val, std::string_view pattern);
 
     private:
+        //! @brief Parses `raw` as a list of each type in turn, the first complete match wins.
+        std::optional<Type> Parse_(const HeaderValue& raw) const;
+        //! @brief Parse_, through the parsed values kept by `Headers`.
+        std::optional<Type> Parsed_(const HeaderValue& raw) const;
+
         const PatternType m_inPattern;
         const std::string_view m_key;
         HeaderType& m_headers;
@@ -1,5 +1,6 @@
 #pragma once
 #include <print>
+#include <utility>
 #include <Thoth/Http/NHeaders/Headers.hpp>
 #include <Thoth/Utils/Functional.hpp>
 
@@ -11,74 +12,34 @@ namespace Thoth::Http::NHeaders {
 
     template<bool IsConst, Utils::Serializable ...Ts>
     auto ListProxy<IsConst, Ts...>::GetAsOpt() && -> std::optional<Type> {
-        auto val{ m_headers.Get(m_key) };
+        const auto val{ std::as_const(m_headers).Get(m_key) };
 
         if (!val || (*val)->empty()) return std::nullopt;
 
-        if constexpr (k_single) {
-            return ParseList<Ts...[0]>(*val, m_inPattern);
-        } else {
-            std::optional<Type> result;
-            std::size_t i{};
-            (std::invoke([&] {
-                if (auto parsed{ ParseList<Ts>(*val, m_inPattern[i++]) }; parsed) {
-                    result = Type{ std::in_place_type<std::vector<Ts>>, std::move(*parsed) };
-                    return true;
-                }
-                return false;
-            }) || ...);
-            if (result) return result;
-        }
-        return std::nullopt;
+        return Parsed_(**val);
     }
 
     template<bool IsConst, Utils::Serializable ...Ts>
     auto ListProxy<IsConst, Ts...>::Get() && -> std::expected<Type, HeaderErrorEnum> {
-        auto val{ m_headers.Get(m_key) };
+        const auto val{ std::as_const(m_headers).Get(m_key) };
 
         if (!val)            return std::unexpected{ HeaderErrorEnum::NotFound };
         if ((*val)->empty()) return std::unexpected{ HeaderErrorEnum::EmptyValue };
 
-        if constexpr (k_single) {
-            if (auto parsed{ ParseList<Ts...[0]>(*val, m_inPattern) }; parsed)
-                return std::move(*parsed);
-        } else {
-            std::optional<Type> result;
-            std::size_t i{};
-            (std::invoke([&] {
-                if (auto parsed{ ParseList<Ts>(*val, m_inPattern[i++]) }; parsed) {
-                    result = Type{ std::in_place_type<std::vector<Ts>>, std::move(*parsed) };
-                    return true;
-                }
-                return false;
-            }) || ...);
-            if (result) return std::move(*result);
-        }
+        if (auto parsed{ Parsed_(**val) }; parsed)
+            return *std::move(parsed);
 
         return std::unexpected{ HeaderErrorEnum::InvalidFormat };
     }
 
     template<bool IsConst, Utils::Serializable ...Ts>
     auto ListProxy<IsConst, Ts...>::GetWithDefault(Type defaultValue) && -> std::expected<Type, InvalidHeaderFormat> {
-        auto val{ m_headers.Get(m_key) };
+        const auto val{ std::as_const(m_headers).Get(m_key) };
 
         if (!val || (*val)->empty()) return defaultValue;
 
-        if constexpr (k_single) {
-            if (auto parsed{ ParseList<Ts...[0]>(*val, m_inPattern) }; parsed)
-                return std::move(*parsed);
-        } else {
-            std::optional<Type> result;
-            std::size_t i{};
-            (std::invoke([&] {
-                if (auto parsed{ ParseList<Ts>(*val, m_inPattern[i++]) }; parsed) {
-                    result = Type{ std::in_place_type<std::vector<Ts>>, std::move(*parsed) };
-                    return true;
-                }
-                return false;
-            }) || ...);
-            if (result) return std::move(*result);
-        }
+        if (auto parsed{ Parsed_(**val) }; parsed)
+            return *std::move(parsed);
 
         return std::unexpected{ InvalidHeaderFormat{} };
     }
@@ -143,6 +104,39 @@ namespace Thoth::Http::NHeaders {
     }
 
 
+    template<bool IsConst, Utils::Serializable ...Ts>
+    auto ListProxy<IsConst, Ts...>::Parse_(const HeaderValue& raw) const -> std::optional<Type> {
+        const auto* val{ &raw };
+
+        if constexpr (k_single) {
+            return ParseList<Ts...[0]>(val, m_inPattern);
+        } else {
+            std::optional<Type> result;
+            std::size_t i{};
+            (std::invoke([&] {
+                if (auto parsed{ ParseList<Ts>(val, m_inPattern[i++]) }; parsed) {
+                    result = Type{ std::in_place_type<std::vector<Ts>>, std::move(*parsed) };
+                    return true;
+                }
+                return false;
+            }) || ...);
+            if (result) return result;
+        }
+        return std::nullopt;
+    }
+
+    template<bool IsConst, Utils::Serializable ...Ts>
+    auto ListProxy<IsConst, Ts...>::Parsed_(const HeaderValue& raw) const -> std::optional<Type> {
+        std::span<const std::string_view> patterns;
+        if constexpr (k_single)
+            patterns = { &m_inPattern, 1 };
+        else
+            patterns = m_inPattern;
+
+        return m_headers.m_parsed.template GetOrParse<std::optional<Type>>(
+            HeaderIdOf(m_key), patterns, [&] { return Parse_(raw); });
+    }
+
     template<bool IsConst, Utils::Serializable ...Ts>
     template<class U>
     auto ListProxy<IsConst, Ts...>::ParseList(const HeaderValue* val, std::string_view pattern) -> std::optional<std::vector<U>> {
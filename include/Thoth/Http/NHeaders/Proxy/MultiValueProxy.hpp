@@ -1,5 +1,6 @@
 #pragma once
 #include <expected>
+#include <span>
 #include <Thoth/Http/NHeaders/_base.hpp>
 #include <Thoth/Http/NHeaders/Headers.hpp>
 #include <Thoth/Http/NHeaders/Proxy/_base.hpp>
@@ -12,7 +13,8 @@ namespace Thoth::Http::NHeaders {
 
     //! @brief Typed proxy for multiple header values.
     //!
-    //! A `MultiValueProxy` adapts one header field to a typed vector. The proxy itself is a short-lived accessor.
+    //! A `MultiValueProxy` adapts one header field to a typed vector. The proxy itself is a short-lived accessor,
+    //! the parsed values are kept by `Headers` until the field changes.
     //!
     //! @note Given that it can't be stored in any sense, it is intentionally not a `std::ranges::range`. Call `Get()`
     //! or `GetAsOpt()` to materialize the parsed `std::vector`.
@@ -37,7 +39,7 @@ namespace Thoth::Http::NHeaders {
 #endif
 
         using Type         = std::vector<ElemType>;
-        using ValueType    = std::conditional_t<IsConst, const HeaderPair*, HeaderPair*>;
+        using ValueType    = const HeaderPair*;
         using ValuesType   = std::vector<ValueType>;
 
         MultiValueProxy(MultiValueProxy&&) = delete;
@@ -82,6 +84,10 @@ namespace Thoth::Http::NHeaders {
 
     private:
         [[nodiscard]] ValuesType GetValues() const;
+        //! @brief Parses every value, failing on the first empty or invalid one.
+        std::expected<Type, HeaderErrorEnum> Parse_() const;
+        //! @brief Parse_, through the parsed values kept by `Headers`.
+        std::expected<Type, HeaderErrorEnum> Parsed_() const;
 
         const PatternType m_inPattern;
         const std::string_view m_key;
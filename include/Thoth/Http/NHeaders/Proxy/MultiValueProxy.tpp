@@ -1,4 +1,5 @@
 #pragma once
+#include <utility>
 #include <Thoth/Utils/Functional.hpp>
 
 namespace Thoth::Http::NHeaders {
@@ -10,106 +11,25 @@ namespace Thoth::Http::NHeaders {
 
     template<bool IsConst, Utils::Serializable ...Ts>
     auto MultiValueProxy<IsConst, Ts...>::GetAsOpt() && -> std::optional<Type> {
-        const auto values{ GetValues() };
-        if (values.empty()) return std::nullopt;
-
-        Type result;
-        for (const auto val : values) {
-            if (val->second.empty()) return std::nullopt;
-
-            if constexpr (k_single) {
-                if (auto parsed{ Utils::Scan<ElemType>(val->second, m_inPattern) }; parsed)
-                    result.push_back(*parsed);
-                else
-                    return std::nullopt;
-            } else {
-                std::optional<ElemType> parsedValue;
-                std::size_t i{};
-                (std::invoke([&] {
-                    if (auto parsed{ Utils::Scan<Ts>(val->second, m_inPattern[i++]) }; parsed) {
-                        parsedValue = *parsed;
-                        return true;
-                    }
-                    return false;
-                }) || ...);
-
-                if (!parsedValue) return std::nullopt;
-                result.push_back(*parsedValue);
-            }
-        }
+        auto parsed{ Parsed_() };
+        if (!parsed) return std::nullopt;
 
-        return result;
+        return *std::move(parsed);
     }
 
     template<bool IsConst, Utils::Serializable ...Ts>
     auto MultiValueProxy<IsConst, Ts...>::Get() && -> std::expected<Type, HeaderErrorEnum> {
-        const auto values{ GetValues() };
-        if (values.empty()) return std::unexpected{ HeaderErrorEnum::NotFound };
-
-        Type result;
-        for (const auto val : values) {
-            if (val->second.empty()) return std::unexpected{ HeaderErrorEnum::EmptyValue };
-
-            if constexpr (k_single) {
-                if (auto parsed{ Utils::Scan<ElemType>(val->second, m_inPattern) }; parsed)
-                    result.push_back(*parsed);
-                else
-                    return std::unexpected{ HeaderErrorEnum::InvalidFormat };
-            } else {
-                std::optional<ElemType> parsedValue;
-                std::size_t i{};
-                (std::invoke([&] {
-                    if (auto parsed{ Utils::Scan<Ts>(val->second, m_inPattern[i++]) }; parsed) {
-                        parsedValue = *parsed;
-                        return true;
-                    }
-                    return false;
-                }) || ...);
-
-                if (!parsedValue)
-                    return std::unexpected{ HeaderErrorEnum::InvalidFormat };
-
-                result.push_back(*parsedValue);
-            }
-        }
-
-        return result;
+        return Parsed_();
     }
 
     template<bool IsConst, Utils::Serializable ...Ts>
     auto MultiValueProxy<IsConst, Ts...>::GetWithDefault(Type defaultValue) &&
             -> std::expected<Type, InvalidHeaderFormat> {
-        const auto values{ GetValues() };
-        if (values.empty()) return defaultValue;
-
-        Type result;
-        for (const auto val : values) {
-            if (val->second.empty()) return std::unexpected{ InvalidHeaderFormat{} };
+        auto parsed{ Parsed_() };
+        if (parsed) return *std::move(parsed);
 
-            if constexpr (k_single) {
-                if (auto parsed{ Utils::Scan<ElemType>(val->second, m_inPattern) }; parsed)
-                    result.push_back(*parsed);
-                else
-                    return std::unexpected{ InvalidHeaderFormat{} };
-            } else {
-                std::optional<ElemType> parsedValue;
-                std::size_t i{};
-                (std::invoke([&] {
-                    if (auto parsed{ Utils::Scan<Ts>(val->second, m_inPattern[i++]) }; parsed) {
-                        parsedValue = *parsed;
-                        return true;
-                    }
-                    return false;
-                }) || ...);
-
-                if (!parsedValue)
-                    return std::unexpected{ InvalidHeaderFormat{} };
-
-                result.push_back(*parsedValue);
-            }
-        }
-
-        return result;
+        if (parsed.error() == HeaderErrorEnum::NotFound) return defaultValue;
+        return std::unexpected{ InvalidHeaderFormat{} };
     }
 
 
@@ -169,6 +89,53 @@ namespace Thoth::Http::NHeaders {
 
     template<bool IsConst, Utils::Serializable ...Ts>
     auto MultiValueProxy<IsConst, Ts...>::GetValues() const -> ValuesType {
-        return m_headers.GetAll(m_key);
+        return std::as_const(m_headers).GetAll(m_key);
+    }
+
+    template<bool IsConst, Utils::Serializable ...Ts>
+    auto MultiValueProxy<IsConst, Ts...>::Parse_() const -> std::expected<Type, HeaderErrorEnum> {
+        const auto values{ GetValues() };
+        if (values.empty()) return std::unexpected{ HeaderErrorEnum::NotFound };
+
+        Type result;
+        for (const auto val : values) {
+            if (val->second.empty()) return std::unexpected{ HeaderErrorEnum::EmptyValue };
+
+            if constexpr (k_single) {
+                if (auto parsed{ Utils::Scan<ElemType>(val->second, m_inPattern) }; parsed)
+                    result.push_back(*parsed);
+                else
+                    return std::unexpected{ HeaderErrorEnum::InvalidFormat };
+            } else {
+                std::optional<ElemType> parsedValue;
+                std::size_t i{};
+                (std::invoke([&] {
+                    if (auto parsed{ Utils::Scan<Ts>(val->second, m_inPattern[i++]) }; parsed) {
+                        parsedValue = *parsed;
+                        return true;
+                    }
+                    return false;
+                }) || ...);
+
+                if (!parsedValue)
+                    return std::unexpected{ HeaderErrorEnum::InvalidFormat };
+
+                result.push_back(*parsedValue);
+            }
+        }
+
+        return result;
+    }
+
+    template<bool IsConst, Utils::Serializable ...Ts>
+    auto MultiValueProxy<IsConst, Ts...>::Parsed_() const -> std::expected<Type, HeaderErrorEnum> {
+        std::span<const std::string_view> patterns;
+        if constexpr (k_single)
+            patterns = { &m_inPattern, 1 };
+        else
+            patterns = m_inPattern;
+
+        return m_headers.m_parsed.template GetOrParse<std::expected<Type, HeaderErrorEnum>>(
+            HeaderIdOf(m_key), patterns, [&] { return Parse_(); });
     }
 }
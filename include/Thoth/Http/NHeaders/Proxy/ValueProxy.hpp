@@ -1,5 +1,6 @@
 #pragma once
 #include <expected>
+#include <span>
 #include <Thoth/Http/NHeaders/_base.hpp>
 #include <Thoth/Http/NHeaders/Headers.hpp>
 #include <Thoth/Http/NHeaders/Proxy/_base.hpp>
@@ -8,7 +9,8 @@ namespace Thoth::Http::NHeaders {
 
     //! @brief Typed proxy for a single header value.
     //!
-    //! A `ValueProxy` adapts one header field to a typed value. The proxy itself is a short-lived accessor.
+    //! A `ValueProxy` adapts one header field to a typed value. The proxy itself is a short-lived accessor, the
+    //! parsed value is kept by `Headers` until the field changes.
     //!
     //! @note The proxy is consumed by the `Get*` methods. Call `Get()`, `GetAsOpt()` or `GetWithDefault()` to
     //! materialize the parsed value.
@@ -79,6 +81,11 @@ namespace Thoth::Http::NHeaders {
         bool TrySet(std::string_view newValue) &&;
 
     private:
+        //! @brief Scans `raw` with the pattern of every type in turn, the first match wins.
+        std::optional<Type> Parse_(std::string_view raw) const;
+        //! @brief Parse_, through the parsed values kept by `Headers`.
+        std::optional<Type> Parsed_(std::string_view raw) const;
+
         // const PatternType      m_outPattern;
         const PatternType      m_inPattern;
         const std::string_view m_key;
@@ -1,4 +1,5 @@
 #pragma once
+#include <utility>
 
 namespace Thoth::Http::NHeaders {
 
@@ -9,79 +10,34 @@ namespace Thoth::Http::NHeaders {
 
     template<bool IsConst, Utils::Serializable ...Ts>
     auto ValueProxy<IsConst, Ts...>::GetAsOpt() && -> std::optional<Type> {
-        auto val{ m_headers.Get(m_key) };
+        const auto val{ std::as_const(m_headers).Get(m_key) };
 
         if (!val || (*val)->empty()) return std::nullopt;
 
-        if constexpr (k_single) {
-            if (auto parsed{ Utils::Scan<Type>(**val, m_inPattern) }; parsed)
-                return *parsed;
-        } else {
-            std::optional<Type> result;
-            std::size_t i{};
-            (std::invoke([&] {
-                if (auto parsed{ Utils::Scan<Ts>(**val, m_inPattern[i++]) }; parsed) {
-                    result = *parsed;
-                    return true;
-                }
-                return false;
-            }) || ...);
-
-            if (result) return result;
-        }
-
-        return std::nullopt;
+        return Parsed_(**val);
     }
 
     template<bool IsConst, Utils::Serializable ...Ts>
     auto ValueProxy<IsConst, Ts...>::Get() && -> std::expected<Type, HeaderErrorEnum> {
-        auto val{ m_headers.Get(m_key) };
+        const auto val{ std::as_const(m_headers).Get(m_key) };
 
         if (!val)            return std::unexpected{ HeaderErrorEnum::NotFound };
         if ((*val)->empty()) return std::unexpected{ HeaderErrorEnum::EmptyValue };
 
-        if constexpr (k_single) {
-            if (auto parsed{ Utils::Scan<Type>(**val, m_inPattern) }; parsed)
-                return *parsed;
-        } else {
-            std::optional<Type> result;
-            std::size_t i{};
-            (std::invoke([&] {
-                if (auto parsed{ Utils::Scan<Ts>(**val, m_inPattern[i++]) }; parsed) {
-                    result = *parsed;
-                    return true;
-                }
-                return false;
-            }) || ...);
-
-            if (result) return *result;
-        }
+        if (auto parsed{ Parsed_(**val) }; parsed)
+            return *std::move(parsed);
 
         return std::unexpected{ HeaderErrorEnum::InvalidFormat };
     }
 
     template<bool IsConst, Utils::Serializable ...Ts>
     auto ValueProxy<IsConst, Ts...>::GetWithDefault(Type defaultValue) && -> std::expected<Type, InvalidHeaderFormat> {
-        auto val{ m_headers.Get(m_key) };
+        const auto val{ std::as_const(m_headers).Get(m_key) };
 
         if (!val || (*val)->empty()) return defaultValue;
 
-        if constexpr (k_single) {
-            if (auto parsed{ Utils::Scan<Type>(**val, m_inPattern) }; parsed)
-                return *parsed;
-        } else {
-            std::optional<Type> result;
-            std::size_t i{};
-            (std::invoke([&] {
-                if (auto parsed{ Utils::Scan<Ts>(**val, m_inPattern[i++]) }; parsed) {
-                    result = *parsed;
-                    return true;
-                }
-                return false;
-            }) || ...);
-
-            if (result) return *result;
-        }
+        if (auto parsed{ Parsed_(**val) }; parsed)
+            return *std::move(parsed);
 
         return std::unexpected{ InvalidHeaderFormat{} };
     }
@@ -137,4 +93,39 @@ namespace Thoth::Http::NHeaders {
             return set;
         }
     }
-}
\ No newline at end of file
+
+
+    template<bool IsConst, Utils::Serializable ...Ts>
+    auto ValueProxy<IsConst, Ts...>::Parse_(const std::string_view raw) const -> std::optional<Type> {
+        if constexpr (k_single) {
+            if (auto parsed{ Utils::Scan<Type>(raw, m_inPattern) }; parsed)
+                return *parsed;
+        } else {
+            std::optional<Type> result;
+            std::size_t i{};
+            (std::invoke([&] {
+                if (auto parsed{ Utils::Scan<Ts>(raw, m_inPattern[i++]) }; parsed) {
+                    result = *parsed;
+                    return true;
+                }
+                return false;
+            }) || ...);
+
+            if (result) return result;
+        }
+
+        return std::nullopt;
+    }
+
+    template<bool IsConst, Utils::Serializable ...Ts>
+    auto ValueProxy<IsConst, Ts...>::Parsed_(const std::string_view raw) const -> std::optional<Type> {
+        std::span<const std::string_view> patterns;
+        if constexpr (k_single)
+            patterns = { &m_inPattern, 1 };
+        else
+            patterns = m_inPattern;
+
+        return m_headers.m_parsed.template GetOrParse<std::optional<Type>>(
+            HeaderIdOf(m_key), patterns, [&] { return Parse_(raw); });
+    }
+}
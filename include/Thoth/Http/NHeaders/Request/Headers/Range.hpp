@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 #include <optional>
 #include <variant>
 
@@ -14,9 +15,9 @@ namespace Thoth::Http::NHeaders {
     //! @endcode
     struct PrefixedRange {
         //! First requested byte offset.
-        unsigned int start;
+        uint64_t start;
         //! Optional inclusive last byte offset.
-        std::optional<unsigned int> end; // make start + count to eliminate invalid state?
+        std::optional<uint64_t> end; // make start + count to eliminate invalid state?
     };
 
     //! @brief A suffix byte range requesting the last `last` bytes (RFC 9110 §14.2).
@@ -28,7 +29,7 @@ namespace Thoth::Http::NHeaders {
     //! @endcode
     struct SuffixedRange {
         //! Number of bytes requested from the end of the representation.
-        unsigned int last;
+        uint64_t last;
     };
 
     //! @brief The supported byte-range forms of the HTTP `Range` header (RFC 9110 §14.2).
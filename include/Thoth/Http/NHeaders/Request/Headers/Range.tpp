@@ -36,7 +36,7 @@ struct Thoth::Utils::Scanner<Thoth::Http::NHeaders::Range> {
 
         if (input[0] == '-') {
             input.remove_prefix(1);
-            if (auto last{ Utils::Scan<unsigned int>( input ) }; last)
+            if (auto last{ Utils::Scan<uint64_t>( input ) }; last)
                 return SuffixedRange{ *last };
         } else {
             const auto idx{ input.find('-') };
@@ -45,11 +45,11 @@ struct Thoth::Utils::Scanner<Thoth::Http::NHeaders::Range> {
 
             if (idx == input.length() - 1) {
                 input.remove_suffix(1);
-                if (const auto start{ Utils::Scan<unsigned int>( input ) }; start)
+                if (const auto start{ Utils::Scan<uint64_t>( input ) }; start)
                     return PrefixedRange{ *start, {} };
             } else {
-                const auto start{ Utils::Scan<unsigned int>( input.substr(0, idx) ) };
-                const auto end{ Utils::Scan<unsigned int>( input.substr(idx + 1) ) };
+                const auto start{ Utils::Scan<uint64_t>( input.substr(0, idx) ) };
+                const auto end{ Utils::Scan<uint64_t>( input.substr(idx + 1) ) };
 
                 if (start && end)
                     return PrefixedRange{ *start, *end };
@@ -3,6 +3,7 @@
 
 #include <Thoth/Http/NHeaders/Request/Headers/_pch.hpp>
 #include <Thoth/Http/NHeaders/Headers/EntityTag.hpp>
+#include <Thoth/Http/NHeaders/Headers/Auth/Basic.hpp>
 
 namespace Thoth::Http {
     // based in Microslop's HttpRequestHeaders
@@ -53,6 +54,16 @@ namespace Thoth::Http {
         //! @copydoc Authorization
         [[nodiscard]] NHeaders::ValueProxy<true, std::string> Authorization() const;
 
+        //! @brief The Authorization header as Basic credentials, base64 decoded and split at the first ':'.
+        //! @par Example
+        //! @code{.cpp}
+        //! headers.BasicAuthorization().Set(NHeaders::BasicCredentials{ "Aladdin", "open sesame" });
+        //! auto user{ headers.BasicAuthorization().Get()->username }; // "Aladdin"
+        //! @endcode
+        NHeaders::ValueProxy<false, NHeaders::BasicCredentials> BasicAuthorization();
+        //! @copydoc BasicAuthorization
+        [[nodiscard]] NHeaders::ValueProxy<true, NHeaders::BasicCredentials> BasicAuthorization() const;
+
         //! @brief Gets the Host header. Essential for HTTP/1.1 and SNI.
         //!
         //! @note Can be a relative URL, resolves via @ref Url::Resolve using a proper URL.
@@ -130,10 +141,14 @@ namespace Thoth::Http {
         //! @copydoc Range
         [[nodiscard]] NHeaders::ListProxy<true, NHeaders::Range> Range() const;
 
-        // //! @brief The value of the Cache-Control header for the request.
-        // NHeaders::ValueProxy<false, std::string> CacheControl();
-        // //! @copydoc CacheControl
-        // [[nodiscard]] NHeaders::ValueProxy<true, std::string> CacheControl() const;
+        //! @brief The caching directives of the request (RFC 9111 §5.2.1).
+        //! @par Example
+        //! @code{.cpp}
+        //! headers.CacheControl().Add(NHeaders::NCacheControl::NoCache{});
+        //! @endcode
+        NHeaders::ListProxy<false, NHeaders::CacheControl> CacheControl();
+        //! @copydoc CacheControl
+        [[nodiscard]] NHeaders::ListProxy<true, NHeaders::CacheControl> CacheControl() const;
 
         //! @brief The value of the If-Modified-Since header.
         //! @par Example
@@ -0,0 +1,34 @@
+#pragma once
+#include <cstdint>
+#include <optional>
+
+namespace Thoth::Http::NHeaders {
+    //! @brief The part of the representation enclosed in a `206 Partial Content` response (RFC 9110 §14.4).
+    //!
+    //! `span` is absent in the unsatisfied form `bytes */1234` sent along a `416 Range Not Satisfiable`, and
+    //! `completeLength` is absent when the server doesn't know the full size (`bytes 0-99/*`). Both can't be absent.
+    //!
+    //! @par Example
+    //! @code{.cpp}
+    //! ContentRange range{ ContentRange::Span{ 0u, 499u }, 1234u }; // bytes 0-499/1234
+    //! @endcode
+    struct ContentRange {
+        struct Span {
+            //! First byte offset.
+            uint64_t first;
+            //! Inclusive last byte offset.
+            uint64_t last;
+
+            bool operator==(const Span&) const = default;
+        };
+
+        std::optional<Span> span;
+        std::optional<uint64_t> completeLength;
+
+        bool operator==(const ContentRange&) const = default;
+    };
+}
+
+#include <Thoth/Http/NHeaders/Response/Headers/ContentRange.tpp>
+
+static_assert(Thoth::Utils::Serializable<Thoth::Http::NHeaders::ContentRange>);
@@ -0,0 +1,75 @@
+#pragma once
+#include <Thoth/Http/NHeaders/Proxy/_base.hpp>
+#include <optional>
+#include <format>
+
+#include <Thoth/String/Utils.hpp>
+
+
+
+template<>
+struct Thoth::Utils::Scanner<Thoth::Http::NHeaders::ContentRange> {
+    using ContentRange = Http::NHeaders::ContentRange;
+
+    static bool Parse(const std::string_view str) {
+        return str.empty();
+    }
+
+    std::optional<ContentRange> Scan(std::string_view input) {
+        String::Trim(input);
+
+        static constexpr std::string_view k_prefix{ "bytes " };
+
+        if (!input.starts_with(k_prefix))
+            return std::nullopt;
+
+        input.remove_prefix(k_prefix.size());
+
+        const auto slash{ input.find('/') };
+        if (slash == std::string_view::npos) return std::nullopt;
+
+        const auto spanStr  { input.substr(0, slash) };
+        const auto lengthStr{ input.substr(slash + 1) };
+
+        ContentRange res{};
+
+        if (lengthStr != "*") {
+            res.completeLength = Utils::Scan<uint64_t>(lengthStr);
+            if (!res.completeLength) return std::nullopt;
+        }
+
+        // "bytes */*" says nothing.
+        if (spanStr == "*") {
+            if (!res.completeLength) return std::nullopt;
+            return res;
+        }
+
+        const auto dash{ spanStr.find('-') };
+        if (dash == std::string_view::npos) return std::nullopt;
+
+        const auto first{ Utils::Scan<uint64_t>(spanStr.substr(0, dash)) };
+        const auto last { Utils::Scan<uint64_t>(spanStr.substr(dash + 1)) };
+
+        if (!first || !last || *first > *last) return std::nullopt;
+        if (res.completeLength && *last >= *res.completeLength) return std::nullopt;
+
+        res.span = ContentRange::Span{ *first, *last };
+        return res;
+    }
+};
+
+template<>
+struct std::formatter<Thoth::Http::NHeaders::ContentRange> {
+    static constexpr auto parse(auto &ctx) { return ctx.begin(); }
+
+    template<class FormatContext>
+    auto format(const Thoth::Http::NHeaders::ContentRange& range, FormatContext& ctx) const {
+        if (range.span) std::format_to(ctx.out(), "bytes {}-{}/", range.span->first, range.span->last);
+        else            std::format_to(ctx.out(), "bytes */");
+
+        if (range.completeLength) std::format_to(ctx.out(), "{}", *range.completeLength);
+        else                      std::format_to(ctx.out(), "*");
+
+        return ctx.out();
+    }
+};
@@ -2,5 +2,6 @@
 
 #include <Thoth/Http/NHeaders/Response/Headers/ContentDisposition.hpp>
 #include <Thoth/Http/NHeaders/Response/Headers/AcceptRanges.hpp>
+#include <Thoth/Http/NHeaders/Response/Headers/ContentRange.hpp>
 #include <Thoth/Http/NHeaders/Response/Headers/Challenge.hpp>
 #include <Thoth/Http/NHeaders/Response/Headers/Cookie.hpp>
@@ -7,8 +7,8 @@ namespace Thoth::Http {
     // based in Microslop's HttpResponseHeaders
     //! @brief Represents the response-specific HTTP header fields.
     //!
-    //! The typed accessors use concrete models such as `Cookie`, `Challenge`, `ContentDisposition`, `AcceptRanges` and
-    //! `EntityTag`.
+    //! The typed accessors use concrete models such as `Cookie`, `Challenge`, `ContentDisposition`, `AcceptRanges`,
+    //! `ContentRange` and `EntityTag`.
     //!
     //! @par Example
     //! @code{.cpp}
@@ -104,6 +104,16 @@ namespace Thoth::Http {
         //! @copybrief AcceptRanges
         [[nodiscard]] NHeaders::ValueProxy<true, NHeaders::AcceptRanges> AcceptRanges() const;
 
+        //! @brief The part of the representation enclosed in a `206 Partial Content` response.
+        //! @par Example
+        //! @code{.cpp}
+        //! if (const auto range{ headers.ContentRange().GetAsOpt() }; range && range->span)
+        //!     file.seekp(range->span->first);
+        //! @endcode
+        NHeaders::ValueProxy<false, NHeaders::ContentRange> ContentRange();
+        //! @copybrief ContentRange
+        [[nodiscard]] NHeaders::ValueProxy<true, NHeaders::ContentRange> ContentRange() const;
+
         //! @brief Media types accepted for a PATCH request.
         //! @par Example
         //! @code{.cpp}
@@ -134,10 +144,15 @@ namespace Thoth::Http {
         //! @copybrief Age
         [[nodiscard]] NHeaders::ValueProxy<true, std::chrono::seconds> Age() const;
 
-        // //! @brief Gets or sets the value of the Cache-Control header for an HTTP response.
-        // NHeaders::ValueProxy<false, bool> CacheControl();
-        // //! @copybrief CacheControl
-        // [[nodiscard]] NHeaders::ValueProxy<true, bool> CacheControl() const;
+        //! @brief The caching directives of the response (RFC 9111 §5.2.2).
+        //! @par Example
+        //! @code{.cpp}
+        //! headers.CacheControl().Set(std::vector<NHeaders::CacheControl>{
+        //!     NHeaders::NCacheControl::Public{}, NHeaders::NCacheControl::MaxAge{ std::chrono::seconds{ 600 } } });
+        //! @endcode
+        NHeaders::ListProxy<false, NHeaders::CacheControl> CacheControl();
+        //! @copybrief CacheControl
+        [[nodiscard]] NHeaders::ListProxy<true, NHeaders::CacheControl> CacheControl() const;
 
         //! @brief The `ETag` validator of the selected representation.
         //! @par Example
@@ -148,6 +163,26 @@ namespace Thoth::Http {
         //! @copybrief EntityTag
         [[nodiscard]] NHeaders::ValueProxy<true, NHeaders::EntityTag> EntityTag() const;
 
+        //! @brief The date after which the response is considered stale.
+        //!
+        //! @note An invalid date, such as `0`, means the response is already expired (RFC 9111 §5.3).
+        //! @par Example
+        //! @code{.cpp}
+        //! auto expires{ headers.Expires().GetAsOpt() };
+        //! @endcode
+        NHeaders::ValueProxy<false, std::chrono::utc_clock::time_point> Expires();
+        //! @copybrief Expires
+        [[nodiscard]] NHeaders::ValueProxy<true, std::chrono::utc_clock::time_point> Expires() const;
+
+        //! @brief The date the origin believes the selected representation was last modified.
+        //! @par Example
+        //! @code{.cpp}
+        //! auto lastModified{ headers.LastModified().GetAsOpt() };
+        //! @endcode
+        NHeaders::ValueProxy<false, std::chrono::utc_clock::time_point> LastModified();
+        //! @copybrief LastModified
+        [[nodiscard]] NHeaders::ValueProxy<true, std::chrono::utc_clock::time_point> LastModified() const;
+
         //! @brief The URL to which this response points.
         //!
         //! @note Can be a relative URL, resolves via @ref Url::Resolve using a proper URL.
@@ -22,6 +22,12 @@ namespace Thoth::Http {
 	                || (std::same_as<Body, std::string> && std::formattable<T, char>)
 		static std::expected<Request, ThothError> FromUrl(
 			std::string_view url, T&& body = {}, Headers headers = Headers::DefaultHeaders());
+
+	    //! @brief Construct the Request from an already parsed URL (e.g. from a @ref UrlBuilder).
+		template<class T = std::string_view>
+			requires Hermes::ByteLike<std::ranges::range_value_t<T>>
+	                || (std::same_as<Body, std::string> && std::formattable<T, char>)
+		static Request FromUrl(Url url, T&& body = {}, Headers headers = Headers::DefaultHeaders());
 	};
 
 	using GetRequest  = Request<>;
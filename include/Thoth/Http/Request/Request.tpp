@@ -7,6 +7,17 @@ namespace Thoth::Http {
         requires Hermes::ByteLike<std::ranges::range_value_t<T>>
                 || (std::same_as<Body, std::string> && std::formattable<T, char>)
     std::expected<Request<Method, Body>, ThothError> Request<Method, Body>::FromUrl(const std::string_view url, T&& body, Headers headers) {
+        return Url::FromUrl(std::string{ url })
+                .transform([&](auto&& httpUrl) {
+                    return FromUrl(std::move(httpUrl), std::forward<T>(body), std::move(headers));
+                });
+    }
+
+    template<MethodConcept Method, ReadableBodyConcept Body>
+    template<class T>
+        requires Hermes::ByteLike<std::ranges::range_value_t<T>>
+                || (std::same_as<Body, std::string> && std::formattable<T, char>)
+    Request<Method, Body> Request<Method, Body>::FromUrl(Url url, T&& body, Headers headers) {
         static constexpr auto makeBody{ [](T&& body) {
             if constexpr (Hermes::ByteLike<std::ranges::range_value_t<T>>)
                 return std::forward<T>(body) | std::ranges::to<Body>();
@@ -14,10 +25,7 @@ namespace Thoth::Http {
                 return std::format("{}", std::forward<T>(body));
         } };
 
-        return Url::FromUrl(std::string{ url })
-                .transform([&](const auto& httpUrl) {
-                    return Request{ { .url = std::move(httpUrl), .headers = headers }, makeBody(std::forward<T>(body)), };
-                });
+        return Request{ { .url = std::move(url), .headers = std::move(headers) }, makeBody(std::forward<T>(body)), };
     }
 
     namespace details_ {
@@ -1,5 +1,6 @@
 #pragma once
 #include <expected>
+#include <string_view>
 
 
 namespace Thoth::Http {
@@ -102,6 +103,69 @@ namespace Thoth::Http {
     }
 
 
+    //! @brief The reason phrase suggested by RFC 9110 §15 for `code`, empty for unknown ones.
+    constexpr std::string_view GetReasonPhrase(const StatusCodeEnum code) {
+        using enum StatusCodeEnum;
+
+        switch (code) {
+            case Continue:                      return "Continue";
+            case SwitchingProtocols:            return "Switching Protocols";
+            case EarlyHints:                    return "Early Hints";
+
+            case Ok:                            return "OK";
+            case Created:                       return "Created";
+            case Accepted:                      return "Accepted";
+            case NonAuthoritativeInformation:   return "Non-Authoritative Information";
+            case NoContent:                     return "No Content";
+            case ResetContent:                  return "Reset Content";
+            case PartialContent:                return "Partial Content";
+
+            case MultipleChoices:               return "Multiple Choices";
+            case MovedPermanently:              return "Moved Permanently";
+            case Found:                         return "Found";
+            case SeeOther:                      return "See Other";
+            case NotModified:                   return "Not Modified";
+            case TemporaryRedirect:             return "Temporary Redirect";
+            case PermanentRedirect:             return "Permanent Redirect";
+
+            case BadRequest:                    return "Bad Request";
+            case Unauthorized:                  return "Unauthorized";
+            case PaymentRequired:               return "Payment Required";
+            case Forbidden:                     return "Forbidden";
+            case NotFound:                      return "Not Found";
+            case MethodNotAllowed:              return "Method Not Allowed";
+            case NotAcceptable:                 return "Not Acceptable";
+            case ProxyAuthenticationRequired:   return "Proxy Authentication Required";
+            case RequestTimeout:                return "Request Timeout";
+            case Conflict:                      return "Conflict";
+            case Gone:                          return "Gone";
+            case LengthRequired:                return "Length Required";
+            case PreconditionFailed:            return "Precondition Failed";
+            case ContentTooLarge:               return "Content Too Large";
+            case UriTooLong:                    return "URI Too Long";
+            case UnsupportedMediaType:          return "Unsupported Media Type";
+            case RangeNotSatisfiable:           return "Range Not Satisfiable";
+            case ExpectationFailed:             return "Expectation Failed";
+            case MisdirectedRequest:            return "Misdirected Request";
+            case UnprocessableContent:          return "Unprocessable Content";
+            case UpgradeRequired:               return "Upgrade Required";
+            case PreconditionRequired:          return "Precondition Required";
+            case TooManyRequests:               return "Too Many Requests";
+            case RequestHeaderFieldsTooLarge:   return "Request Header Fields Too Large";
+            case UnavailableForLegalReasons:    return "Unavailable For Legal Reasons";
+
+            case InternalServerError:           return "Internal Server Error";
+            case NotImplemented:                return "Not Implemented";
+            case BadGateway:                    return "Bad Gateway";
+            case ServiceUnavailable:            return "Service Unavailable";
+            case GatewayTimeout:                return "Gateway Timeout";
+            case HttpVersionNotSupported:       return "HTTP Version Not Supported";
+            case NetworkAuthenticationRequired: return "Network Authentication Required";
+
+            default:                            return {};
+        }
+    }
+
 
     template<class T>
     using WebResult = std::expected<T, StatusCodeEnum>;
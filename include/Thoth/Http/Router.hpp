@@ -0,0 +1,198 @@
+#pragma once
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <expected>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <variant>
+
+#include <Thoth/Http/Methods/_base/MethodConcept.hpp>
+#include <Thoth/Http/Response/StatusCodeEnum.hpp>
+#include <Thoth/Http/Server.hpp>
+
+namespace Thoth::Http {
+    //! @brief One entry of a route table: a method and a path pattern.
+    //! @details The pattern is matched against the raw (still percent-encoded) path. `{name}` captures one
+    //! whole segment, `{name...}` captures the rest of the path and must come last. The pattern is viewed, not
+    //! copied: it must outlive the table (string literals do).
+    struct Route {
+        std::string_view method;
+        std::string_view pattern;
+
+        //! @brief `Route::For<GetMethod>("/users/{id}")`.
+        template<MethodConcept Method>
+        static constexpr Route For(std::string_view pattern);
+    };
+
+    enum class RouteErrorEnum {
+        UnknownMethod,
+        InvalidPattern,
+        DuplicateRoute,
+        TooManyParams,
+        TableFull
+    };
+
+
+    //! @brief The path parameters captured by a match, views into the matched path.
+    struct RouteParams {
+        static constexpr size_t k_maxParams{ 8 };
+
+        std::span<const std::string_view> names;
+        std::array<std::string_view, k_maxParams> values{};
+        size_t count{};
+
+        //! @brief The value captured by `{name}`, nullopt if the route has no such parameter.
+        [[nodiscard]] constexpr std::optional<std::string_view> Get(std::string_view name) const;
+
+        [[nodiscard]] constexpr std::string_view operator[](size_t idx) const;
+        [[nodiscard]] constexpr size_t size() const;
+    };
+
+    struct RouteMatch {
+        //! @brief Index of the route in the table it was built from.
+        size_t route{};
+        RouteParams params;
+    };
+
+
+    //! @brief Radix tree over path patterns, stored in fixed size arrays.
+    //! @details
+    //! Nodes hold the longest common prefix of their static children, so a lookup walks the path once. At a
+    //! node, static children win over a `{param}`, which wins over a `{rest...}`; a branch without a route for
+    //! the method backtracks, so `DELETE /users/me` reaches `DELETE /users/{id}` next to `GET /users/me`.
+    //! `HEAD` falls back to the `GET` route. Matching never allocates.
+    //!
+    //! `NodeCount` bounds the tree, one node per pattern character (plus the root) is always enough. Built by
+    //! @ref MakeRouteTable at compile time, or with @ref Build for tables only known at run time.
+    //!
+    //! @par Example
+    //! @code{.cpp}
+    //! static constexpr std::array k_routes{
+    //!     Route::For<GetMethod>("/users/{id}"),
+    //!     Route::For<GetMethod>("/static/{path...}"),
+    //! };
+    //! static constexpr auto k_table{ MakeRouteTable<k_routes>() };
+    //!
+    //! auto match{ k_table.Match("GET", "/users/42") };   // route 0, params.Get("id") == "42"
+    //! @endcode
+    template<size_t RouteCount, size_t NodeCount>
+    struct RouteTable {
+        //! @brief Inserts every route, `routes[i]` is reported as `RouteMatch::route == i`.
+        constexpr std::expected<std::monostate, RouteErrorEnum> Build(std::span<const Route> routes);
+
+        //! @return The route matching `method` and `path`, `NotFound` when no pattern matches the path and
+        //! `MethodNotAllowed` when some do but not for this method.
+        [[nodiscard]] constexpr WebResult<RouteMatch> Match(std::string_view method, std::string_view path) const;
+
+        //! @brief The `allow` header value for `path`: the methods of the route it matches, comma separated.
+        [[nodiscard]] std::string AllowedMethods(std::string_view path) const;
+
+        //! @brief Nodes used, at most `NodeCount`.
+        [[nodiscard]] constexpr size_t NodesUsed() const;
+
+    private:
+        static constexpr uint32_t k_none{ UINT32_MAX };
+        static constexpr uint16_t k_noRoute{ UINT16_MAX };
+
+        static constexpr std::array<std::string_view, 9> k_methods{
+            "GET", "HEAD", "POST", "PUT", "DELETE", "CONNECT", "OPTIONS", "TRACE", "PATCH"
+        };
+        static constexpr size_t k_getId { 0 };
+        static constexpr size_t k_headId{ 1 };
+        //! Passed to Find_ instead of a method, accepts a node with a route for any method.
+        static constexpr size_t k_anyMethod{ k_methods.size() };
+
+        using Terminals = std::array<uint16_t, k_methods.size()>;
+
+        struct Node {
+            //! Static text consumed by this node, empty for a `{param}` node.
+            std::string_view prefix;
+
+            uint32_t firstChild { k_none };
+            uint32_t nextSibling{ k_none };
+            uint32_t paramChild { k_none };
+
+            //! Routes ending here, per method.
+            Terminals routes{ EmptyTerminals_() };
+            //! Routes ending here with a `{rest...}`, per method.
+            Terminals catchAll{ EmptyTerminals_() };
+        };
+
+        struct RouteInfo {
+            std::array<std::string_view, RouteParams::k_maxParams> names{};
+            size_t paramCount{};
+        };
+
+        struct Found {
+            uint32_t node;
+            bool catchAll;
+        };
+
+        static constexpr Terminals EmptyTerminals_();
+        static constexpr std::optional<size_t> MethodId_(std::string_view method);
+        //! Whether `terminals` has a route for `methodId` (`HEAD` falling back to `GET`), or for any method.
+        static constexpr bool Accepts_(const Terminals& terminals, size_t methodId);
+
+        constexpr std::expected<uint32_t, RouteErrorEnum> NewNode_();
+        constexpr std::expected<uint32_t, RouteErrorEnum> InsertStatic_(uint32_t node, std::string_view text);
+        constexpr std::optional<Found> Find_(uint32_t node, std::string_view path, size_t methodId, RouteParams& params) const;
+
+        std::array<Node, NodeCount> m_nodes{};
+        std::array<RouteInfo, RouteCount> m_routes{};
+        uint32_t m_used{ 1 };
+    };
+
+    //! @brief Builds the table of `Routes` (a static `std::array<Route, N>`) at compile time, an invalid pattern
+    //! doesn't compile.
+    template<const auto& Routes>
+    consteval auto MakeRouteTable();
+
+
+    //! @brief A @ref ServerHandler dispatching to one typed handler per route.
+    //! @details Each handler is called as `handler(request, response, params)`. The dispatch is a jump table
+    //! indexed by the matched route: no `std::function` and no allocation per request. Unmatched requests get
+    //! `404` or `405`.
+    //!
+    //! @par Example
+    //! @code{.cpp}
+    //! static constexpr std::array k_routes{
+    //!     Route::For<GetMethod>("/users/{id}"),
+    //!     Route::For<PostMethod>("/users"),
+    //! };
+    //!
+    //! auto server{ Server::Listen(MakeRouter<k_routes>(
+    //!     [](const ServerRequest&, ServerResponse& res, const RouteParams& params) { res.body = *params.Get("id"); },
+    //!     [](const ServerRequest& req, ServerResponse& res, const RouteParams&) { res.status = StatusCodeEnum::Created; }
+    //! )) };
+    //! @endcode
+    template<const auto& Routes, class... Handlers>
+        requires (sizeof...(Handlers) == std::size(Routes))
+        && (std::invocable<const Handlers&, const ServerRequest&, ServerResponse&, const RouteParams&> && ...)
+    struct Router {
+        static constexpr auto k_table{ MakeRouteTable<Routes>() };
+
+        std::tuple<Handlers...> handlers;
+
+        void operator()(const ServerRequest& request, ServerResponse& response) const;
+
+    private:
+        using Dispatch_ = void(*)(const Router&, const ServerRequest&, ServerResponse&, const RouteParams&);
+
+        template<size_t Idx>
+        static void Call_(const Router& self, const ServerRequest& request, ServerResponse& response, const RouteParams& params);
+
+        static constexpr auto k_dispatch{ []<size_t... Idx>(std::index_sequence<Idx...>) {
+            return std::array<Dispatch_, sizeof...(Idx)>{ &Call_<Idx>... };
+        }(std::index_sequence_for<Handlers...>{}) };
+    };
+
+    template<const auto& Routes, class... Handlers>
+    Router<Routes, std::decay_t<Handlers>...> MakeRouter(Handlers&&... handlers);
+}
+
+#include <Thoth/Http/Router.tpp>
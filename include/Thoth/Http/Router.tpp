@@ -0,0 +1,357 @@
+#pragma once
+#include <algorithm>
+
+namespace Thoth::Http {
+    template<MethodConcept Method>
+    constexpr Route Route::For(const std::string_view pattern) {
+        return { Method::MethodName(), pattern };
+    }
+
+
+#pragma region RouteParams
+
+    constexpr std::optional<std::string_view> RouteParams::Get(const std::string_view name) const {
+        for (size_t i{}; i < count && i < names.size(); ++i)
+            if (names[i] == name)
+                return values[i];
+        return std::nullopt;
+    }
+
+    constexpr std::string_view RouteParams::operator[](const size_t idx) const {
+        return values[idx];
+    }
+
+    constexpr size_t RouteParams::size() const {
+        return count;
+    }
+
+#pragma endregion
+
+
+#pragma region RouteTable
+
+    template<size_t RouteCount, size_t NodeCount>
+    constexpr std::expected<std::monostate, RouteErrorEnum> RouteTable<RouteCount, NodeCount>::Build(
+            const std::span<const Route> routes) {
+        static_assert(RouteCount < k_noRoute, "RouteTable indexes routes with 16 bits");
+        static_assert(NodeCount > 0, "RouteTable needs at least its root");
+
+        if (routes.size() > RouteCount)
+            return std::unexpected{ RouteErrorEnum::TableFull };
+
+        for (size_t idx{}; idx < routes.size(); ++idx) {
+            const auto [method, pattern]{ routes[idx] };
+
+            const auto methodId{ MethodId_(method) };
+            if (!methodId)
+                return std::unexpected{ RouteErrorEnum::UnknownMethod };
+            if (!pattern.starts_with('/'))
+                return std::unexpected{ RouteErrorEnum::InvalidPattern };
+
+            auto& info{ m_routes[idx] };
+            uint32_t node{};
+            bool catchAll{};
+
+            for (size_t pos{}; pos < pattern.size();) {
+                const auto open{ std::min(pattern.find('{', pos), pattern.size()) };
+
+                if (open > pos) {
+                    const auto text{ pattern.substr(pos, open - pos) };
+                    if (text.contains('}'))
+                        return std::unexpected{ RouteErrorEnum::InvalidPattern };
+
+                    auto res{ InsertStatic_(node, text) };
+                    if (!res)
+                        return std::unexpected{ res.error() };
+
+                    node = *res;
+                    pos  = open;
+                    continue;
+                }
+
+                // A capture is a whole segment: `/{name}/` or `/{name}` at the end.
+                const auto close{ pattern.find('}', pos) };
+                if (pattern[pos - 1] != '/' || close == std::string_view::npos
+                        || (close + 1 != pattern.size() && pattern[close + 1] != '/'))
+                    return std::unexpected{ RouteErrorEnum::InvalidPattern };
+
+                auto name{ pattern.substr(pos + 1, close - pos - 1) };
+                if (name.ends_with("...")) {
+                    if (close + 1 != pattern.size())
+                        return std::unexpected{ RouteErrorEnum::InvalidPattern };
+
+                    name.remove_suffix(3);
+                    catchAll = true;
+                }
+
+                if (name.empty() || name.contains('{') || name.contains('/'))
+                    return std::unexpected{ RouteErrorEnum::InvalidPattern };
+                if (info.paramCount == RouteParams::k_maxParams)
+                    return std::unexpected{ RouteErrorEnum::TooManyParams };
+
+                info.names[info.paramCount++] = name;
+
+                if (!catchAll) {
+                    if (m_nodes[node].paramChild == k_none) {
+                        auto child{ NewNode_() };
+                        if (!child)
+                            return std::unexpected{ child.error() };
+
+                        m_nodes[node].paramChild = *child;
+                    }
+                    node = m_nodes[node].paramChild;
+                }
+
+                pos = close + 1;
+            }
+
+            auto& terminal{ (catchAll ? m_nodes[node].catchAll : m_nodes[node].routes)[*methodId] };
+            if (terminal != k_noRoute)
+                return std::unexpected{ RouteErrorEnum::DuplicateRoute };
+
+            terminal = static_cast<uint16_t>(idx);
+        }
+
+        return {};
+    }
+
+    template<size_t RouteCount, size_t NodeCount>
+    constexpr WebResult<RouteMatch> RouteTable<RouteCount, NodeCount>::Match(
+            const std::string_view method, const std::string_view path) const {
+        RouteMatch match;
+
+        // Only the nodes with a route for this method are accepted, the others are backtracked from.
+        const auto methodId{ MethodId_(method) };
+        const auto found{ methodId ? Find_(0, path, *methodId, match.params) : std::nullopt };
+
+        if (!found) {
+            RouteParams params;
+            if (Find_(0, path, k_anyMethod, params))
+                return std::unexpected{ StatusCodeEnum::MethodNotAllowed };
+
+            return std::unexpected{ StatusCodeEnum::NotFound };
+        }
+
+        const auto& terminals{ found->catchAll ? m_nodes[found->node].catchAll : m_nodes[found->node].routes };
+
+        auto route{ terminals[*methodId] };
+        if (route == k_noRoute && *methodId == k_headId)
+            route = terminals[k_getId];
+
+        const auto& info{ m_routes[route] };
+        match.route        = route;
+        match.params.names = std::span{ info.names.data(), info.paramCount };
+
+        return match;
+    }
+
+    template<size_t RouteCount, size_t NodeCount>
+    std::string RouteTable<RouteCount, NodeCount>::AllowedMethods(const std::string_view path) const {
+        // Each method may be routed to a different pattern, so each is looked up on its own.
+        std::string allowed;
+        for (size_t id{}; id < k_methods.size(); ++id) {
+            RouteParams params;
+            if (!Find_(0, path, id, params))
+                continue;
+
+            if (!allowed.empty())
+                allowed += ", ";
+            allowed += k_methods[id];
+        }
+
+        return allowed;
+    }
+
+    template<size_t RouteCount, size_t NodeCount>
+    constexpr size_t RouteTable<RouteCount, NodeCount>::NodesUsed() const {
+        return m_used;
+    }
+
+    template<size_t RouteCount, size_t NodeCount>
+    constexpr auto RouteTable<RouteCount, NodeCount>::EmptyTerminals_() -> Terminals {
+        Terminals terminals;
+        terminals.fill(k_noRoute);
+
+        return terminals;
+    }
+
+    template<size_t RouteCount, size_t NodeCount>
+    constexpr std::optional<size_t> RouteTable<RouteCount, NodeCount>::MethodId_(const std::string_view method) {
+        const auto it{ std::ranges::find(k_methods, method) };
+        if (it == k_methods.end())
+            return std::nullopt;
+
+        return static_cast<size_t>(it - k_methods.begin());
+    }
+
+    template<size_t RouteCount, size_t NodeCount>
+    constexpr bool RouteTable<RouteCount, NodeCount>::Accepts_(const Terminals& terminals, const size_t methodId) {
+        if (methodId == k_anyMethod)
+            return std::ranges::any_of(terminals, [](const uint16_t route) { return route != k_noRoute; });
+
+        return terminals[methodId] != k_noRoute || (methodId == k_headId && terminals[k_getId] != k_noRoute);
+    }
+
+    template<size_t RouteCount, size_t NodeCount>
+    constexpr std::expected<uint32_t, RouteErrorEnum> RouteTable<RouteCount, NodeCount>::NewNode_() {
+        if (m_used == NodeCount)
+            return std::unexpected{ RouteErrorEnum::TableFull };
+
+        return m_used++;
+    }
+
+    template<size_t RouteCount, size_t NodeCount>
+    constexpr std::expected<uint32_t, RouteErrorEnum> RouteTable<RouteCount, NodeCount>::InsertStatic_(
+            uint32_t node, std::string_view text) {
+        while (!text.empty()) {
+            // Siblings are sorted by their first character, which no two of them share.
+            auto* link{ &m_nodes[node].firstChild };
+            while (*link != k_none && m_nodes[*link].prefix[0] < text[0])
+                link = &m_nodes[*link].nextSibling;
+
+            if (*link == k_none || m_nodes[*link].prefix[0] != text[0]) {
+                auto child{ NewNode_() };
+                if (!child)
+                    return child;
+
+                m_nodes[*child].prefix      = text;
+                m_nodes[*child].nextSibling = *link;
+                *link = *child;
+
+                return *child;
+            }
+
+            const auto child{ *link };
+            const auto prefix{ m_nodes[child].prefix };
+            const auto common{ static_cast<size_t>(std::ranges::mismatch(prefix, text).in1 - prefix.begin()) };
+
+            if (common < prefix.size()) {
+                // Splits `child` in two: `mid` keeps the shared part and takes its place among the siblings.
+                auto mid{ NewNode_() };
+                if (!mid)
+                    return mid;
+
+                m_nodes[*mid].prefix      = prefix.substr(0, common);
+                m_nodes[*mid].firstChild  = child;
+                m_nodes[*mid].nextSibling = m_nodes[child].nextSibling;
+
+                m_nodes[child].prefix      = prefix.substr(common);
+                m_nodes[child].nextSibling = k_none;
+                *link = *mid;
+            }
+
+            node = *link;
+            text.remove_prefix(common);
+        }
+
+        return node;
+    }
+
+    template<size_t RouteCount, size_t NodeCount>
+    constexpr auto RouteTable<RouteCount, NodeCount>::Find_(
+            const uint32_t node, const std::string_view path, const size_t methodId, RouteParams& params) const
+            -> std::optional<Found> {
+        const auto& current{ m_nodes[node] };
+
+        if (path.empty() && Accepts_(current.routes, methodId))
+            return Found{ node, false };
+
+        if (!path.empty()) {
+            for (auto child{ current.firstChild }; child != k_none; child = m_nodes[child].nextSibling) {
+                const auto prefix{ m_nodes[child].prefix };
+                if (prefix[0] < path[0])
+                    continue;
+                if (prefix[0] > path[0] || !path.starts_with(prefix))
+                    break;
+
+                if (auto found{ Find_(child, path.substr(prefix.size()), methodId, params) })
+                    return found;
+                break;
+            }
+
+            if (current.paramChild != k_none && params.count < RouteParams::k_maxParams) {
+                const auto segment{ path.substr(0, path.find('/')) };
+
+                if (!segment.empty()) {
+                    params.values[params.count++] = segment;
+
+                    if (auto found{ Find_(current.paramChild, path.substr(segment.size()), methodId, params) })
+                        return found;
+
+                    --params.count;
+                }
+            }
+        }
+
+        if (Accepts_(current.catchAll, methodId) && params.count < RouteParams::k_maxParams) {
+            params.values[params.count++] = path;
+            return Found{ node, true };
+        }
+
+        return std::nullopt;
+    }
+
+    template<const auto& Routes>
+    consteval auto MakeRouteTable() {
+        constexpr size_t k_routeCount{ std::size(Routes) };
+
+        // First built with the worst case bound to learn how many nodes the tree really needs.
+        constexpr size_t k_nodeCount{ [] {
+            size_t bound{ 1 };
+            for (const auto& route : Routes)
+                bound += route.pattern.size();
+
+            return bound;
+        }() };
+
+        constexpr size_t k_used{ [] {
+            RouteTable<k_routeCount, k_nodeCount> table;
+            table.Build(Routes).value();
+
+            return table.NodesUsed();
+        }() };
+
+        RouteTable<k_routeCount, k_used> table;
+        table.Build(Routes).value();
+
+        return table;
+    }
+
+#pragma endregion
+
+
+#pragma region Router
+
+    template<const auto& Routes, class... Handlers>
+        requires (sizeof...(Handlers) == std::size(Routes))
+        && (std::invocable<const Handlers&, const ServerRequest&, ServerResponse&, const RouteParams&> && ...)
+    void Router<Routes, Handlers...>::operator()(const ServerRequest& request, ServerResponse& response) const {
+        const auto path{ request.url.GetPathOrSep() };
+
+        const auto match{ k_table.Match(request.method, path) };
+        if (!match) {
+            response.status = match.error();
+            if (match.error() == StatusCodeEnum::MethodNotAllowed)
+                response.headers.Set("allow", k_table.AllowedMethods(path));
+            return;
+        }
+
+        k_dispatch[match->route](*this, request, response, match->params);
+    }
+
+    template<const auto& Routes, class... Handlers>
+        requires (sizeof...(Handlers) == std::size(Routes))
+        && (std::invocable<const Handlers&, const ServerRequest&, ServerResponse&, const RouteParams&> && ...)
+    template<size_t Idx>
+    void Router<Routes, Handlers...>::Call_(const Router& self, const ServerRequest& request, ServerResponse& response,
+            const RouteParams& params) {
+        std::get<Idx>(self.handlers)(request, response, params);
+    }
+
+    template<const auto& Routes, class... Handlers>
+    Router<Routes, std::decay_t<Handlers>...> MakeRouter(Handlers&&... handlers) {
+        return { std::tuple<std::decay_t<Handlers>...>{ std::forward<Handlers>(handlers)... } };
+    }
+
+#pragma endregion
+}
@@ -1,35 +1,141 @@
 #pragma once
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
 #include <variant>
 
-#include <Hermes/Socket/Sync/ServerSocket.hpp>
-
 #include <Thoth/ThothError.hpp>
 #include <Thoth/Http/Request/Request.hpp>
-#include <Thoth/Http/Response/Response.hpp>
+#include <Thoth/Http/Request/RequestHead.hpp>
+#include <Thoth/Http/Response/ResponseHead.hpp>
 
 namespace Thoth::Http {
+    //! @brief A request received by @ref Server.
+    //! @details `url` is rebuilt from the request-target and the `Host` header, `body` is already de-chunked.
+    struct ServerRequest : RequestHead {
+        std::string method;
+        std::string body;
+    };
+
+    //! @brief A descriptor opened for reading, closed with its last reference.
+    struct ServerFile {
+        explicit ServerFile(int fd) noexcept : fd{ fd } {}
+
+        ServerFile(const ServerFile&) = delete;
+        ServerFile& operator=(const ServerFile&) = delete;
+
+        ~ServerFile();
+
+        const int fd;
+    };
 
-    struct ServerConnection{
-        using SocketType = std::variant<Hermes::RawTcpServer, Hermes::RawTlsServer>;
-        SocketType socket;
+    //! @brief `length` bytes of `file` from `offset`, sent as a response body.
+    struct ServerFileBody {
+        std::shared_ptr<const ServerFile> file;
+        uint64_t offset{};
+        uint64_t length{};
+    };
 
-        template<class T>
-        auto Send(const T& data);
-        void Close();
-        void Abort();
+    //! @brief What a handler answers. Starts as `200` without headers nor body.
+    //! @details `content-length` and `connection` are set by the server. An empty `statusMessage` is replaced by
+    //! the standard reason phrase.
+    struct ServerResponse : ResponseHead {
+        std::string body;
+        //! @brief Sent instead of `body`, the kernel copies it from the file to the socket (`sendfile`) so the
+        //! bytes never reach user space. The file must not shrink until the response is written.
+        std::optional<ServerFileBody> file;
     };
 
+    //! @brief Called once per request, from one of the workers. Must be thread safe, an exception answers `500`.
+    using ServerHandler = std::function<void(const ServerRequest&, ServerResponse&)>;
+
+    //! @brief A @ref ServerHandler receiving the request as the typed `Request<Method, BodyType>` of its method.
+    //! @details The typed surface the former `Server::Receive<BodyType, RequestTypes...>` offered, now over
+    //! @ref Server::Listen. The request is converted to the first of `RequestTypes` with its method name, any
+    //! other method is answered with `405` and an `allow` header listing them.
+    //!
+    //! @par Example
+    //! @code{.cpp}
+    //! auto server{ Server::Listen(MakeTypedHandler<std::string, GetMethod, PostMethod>(
+    //!     [](const std::variant<GetRequest, PostRequest>& req, ServerResponse& res) {
+    //!         res.body = std::holds_alternative<PostRequest>(req) ? "posted" : "got";
+    //!     })) };
+    //! @endcode
+    template<class BodyType, MethodConcept... RequestTypes, class Handler>
+        requires (sizeof...(RequestTypes) > 0)
+        && std::invocable<const Handler&, const std::variant<Request<RequestTypes, BodyType>...>&, ServerResponse&>
+    ServerHandler MakeTypedHandler(Handler&& handler);
+
+
+    //! @brief Configuration of a @ref Server.
+    struct ServerOptions {
+        //! @brief IPv4 or IPv6 address to bind, the default only accepts local connections.
+        std::string address{ "127.0.0.1" };
+        //! @brief `0` picks a free port, see @ref Server::Port.
+        uint16_t port{};
+
+        //! @brief Accepting threads, each with its own `SO_REUSEPORT` socket and event loop.
+        //! `0` uses one per core.
+        size_t acceptors{};
+        //! @brief Threads running the handler. `0` uses one per core.
+        size_t workers{};
 
+        //! @brief Longest request line plus headers, a longer head is answered with `431`.
+        size_t maxHeadLength{ 1 << 16 };
+        //! @brief Longest request body (as sent, framing included), a longer one is answered with `413`.
+        size_t maxBodyLength{ 1 << 24 };
+
+        //! @brief Idle keep-alive connections are closed after this long.
+        std::chrono::milliseconds keepAliveTimeout{ std::chrono::seconds{ 5 } };
+    };
+
+
+    namespace details_ {
+        struct ServerState;
+    }
+
+    //! @brief Multi-threaded HTTP/1.1 server.
+    //! @details
+    //! Every acceptor binds the same address with `SO_REUSEPORT`, so the kernel spreads the connections between
+    //! them, and drives its non-blocking sockets with `epoll`. Complete requests go to the worker pool, the
+    //! answers come back to the owning acceptor which writes them. Connections are kept alive unless the client
+    //! (or the handler, with `connection: close`) asks otherwise, and pipelined requests are answered in order.
+    //!
+    //! The requests of one connection are handled one at a time: the next one is only handed to a worker once the
+    //! answer to the previous one is written, so a slow handler holds up the requests pipelined behind it (never
+    //! those of other connections). Spread concurrent requests over several connections.
+    //!
+    //! Only available on Linux, @ref Listen fails elsewhere.
+    //!
+    //! @par Example
+    //! @code{.cpp}
+    //! auto server{ Server::Listen([](const ServerRequest& req, ServerResponse& res) {
+    //!     res.headers.Set("content-type", "text/plain");
+    //!     res.body = std::format("hello from {}", req.url.GetPathOrSep());
+    //! }, { .port = 8080 }) };
+    //! @endcode
     struct Server {
-        template<class BodyType, MethodConcept... RequestTypes>
-            requires (sizeof...(RequestTypes) > 0)
-        ThothResult<std::variant<Request<RequestTypes, BodyType>...>> Receive(ServerConnection& conn);
+        //! @brief Binds the address and starts serving until @ref Stop or destruction.
+        static std::expected<Server, ThothError> Listen(ServerHandler handler, ServerOptions opts = {});
+
+        Server(Server&& other) noexcept;
+        Server& operator=(Server&& other) noexcept;
+        ~Server();
 
+        //! @brief The bound port, the chosen one when `ServerOptions::port` is `0`.
+        [[nodiscard]] uint16_t Port() const;
+
+        //! @brief Closes every socket and waits for the running handlers. Idempotent.
+        void Stop();
+
+    private:
+        explicit Server(std::unique_ptr<details_::ServerState> state);
+
+        std::unique_ptr<details_::ServerState> m_state;
     };
 }
 
 #include <Thoth/Http/Server.tpp>
-
-namespace Thoth::Http {
-    static_assert(ConnectionConcept<ServerConnection>);
-}
\ No newline at end of file
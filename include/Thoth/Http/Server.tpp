@@ -1,44 +1,52 @@
-#pragma once 
-#include <Thoth/Http/_base/Http1.hpp>
+#pragma once
+#include <bit>
+#include <functional>
+#include <ranges>
+#include <utility>
 
 namespace Thoth::Http {
-
-    template<class T>
-    auto ServerConnection::Send(const T& data) {
-        return std::visit([&](auto& sock) { return sock.Send(data); }, socket);
-    }
-
-    inline void ServerConnection::Close() {
-        std::visit([](auto& sock) { sock.Close(); }, socket);
+    namespace details_ {
+        template<class BodyType>
+        BodyType ToServerBody(const std::string& body) {
+            if constexpr (std::constructible_from<BodyType, const std::string&>)
+                return BodyType(body);
+            else {
+                using ValueType = std::ranges::range_value_t<BodyType>;
+
+                auto values{ body | std::views::transform([](const char c) { return std::bit_cast<ValueType>(c); }) };
+                return BodyType(values.begin(), values.end());
+            }
+        }
     }
 
-    inline void ServerConnection::Abort() {
-        std::visit([](auto& sock) { sock.Abort(); }, socket);
-    }
-
-
-
-
-    template<class BodyType, MethodConcept... RequestTypes>
+    template<class BodyType, MethodConcept... RequestTypes, class Handler>
         requires (sizeof...(RequestTypes) > 0)
-    ThothResult<std::variant<Request<RequestTypes, BodyType>...>> Server::Receive(ServerConnection& conn) {
-        ThothResult<std::variant<Request<RequestTypes, BodyType>...>> result;
-
-        static constexpr auto createHead{ [](auto&& socket) {
-            return details_::Http1::ParseResponseLine(std::move(socket));
-        } };
-
-        auto lineRes{ std::visit(createHead, conn) };
-        if (!lineRes) return std::unexpected{ lineRes.error() };
-
-        const auto& [method, stage]{ *lineRes };
-
-        (std::invoke([&] {
-            if (!result && RequestTypes::MethodName() == method)
-                result.emplace(Request<RequestTypes, BodyType>{});
-        }), ...);
-
-        return result;
+        && std::invocable<const Handler&, const std::variant<Request<RequestTypes, BodyType>...>&, ServerResponse&>
+    ServerHandler MakeTypedHandler(Handler&& handler) {
+        std::string allow;
+        ((allow += allow.empty() ? "" : ", ", allow += RequestTypes::MethodName()), ...);
+
+        return [handler = std::forward<Handler>(handler), allow = std::move(allow)](
+                const ServerRequest& req, ServerResponse& res) {
+            std::optional<std::variant<Request<RequestTypes, BodyType>...>> typed;
+
+            const auto tryAs{ [&]<class Method>(std::type_identity<Method>) {
+                if (typed || req.method != Method::MethodName())
+                    return;
+
+                typed.emplace(std::in_place_type<Request<Method, BodyType>>, Request<Method, BodyType>{
+                    { static_cast<const RequestHead&>(req) }, details_::ToServerBody<BodyType>(req.body)
+                });
+            } };
+            (tryAs(std::type_identity<RequestTypes>{}), ...);
+
+            if (!typed) {
+                res.status = StatusCodeEnum::MethodNotAllowed;
+                res.headers.Set("allow", allow);
+                return;
+            }
+
+            std::invoke(handler, *typed, res);
+        };
     }
 }
-
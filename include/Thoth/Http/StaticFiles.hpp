@@ -0,0 +1,61 @@
+#pragma once
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <string_view>
+
+#include <Thoth/Http/Server.hpp>
+
+namespace Thoth::Http {
+    //! @brief Configuration of @ref StaticFiles.
+    struct StaticFilesOptions {
+        //! @brief Descriptors kept open for the most recently served files.
+        size_t maxOpenFiles{ 256 };
+        //! @brief How long a cached descriptor is trusted before the file is checked again (one `stat`), a
+        //! replaced file is reopened.
+        std::chrono::milliseconds revalidateAfter{ std::chrono::seconds{ 1 } };
+    };
+
+
+    namespace details_ {
+        struct StaticFilesCache;
+    }
+
+    //! @brief A @ref ServerHandler serving the regular files below a directory.
+    //! @details
+    //! Answers `GET` and `HEAD` with `content-type` (from the extension), `etag`, `last-modified` and
+    //! `accept-ranges`, honors `if-none-match` and `if-modified-since` with `304`, and a single byte `range`
+    //! (guarded by `if-range`) with `206` or `416`. A request for several ranges gets the whole file.
+    //!
+    //! The body is a @ref ServerFileBody: the server hands the descriptor to `sendfile`, file bytes never pass
+    //! through user space. Descriptors of hot files stay open in a small LRU cache shared by every copy of the
+    //! handler.
+    //!
+    //! `..` segments are refused, and so is any symbolic link resolving outside of the directory (`openat2`
+    //! with `RESOLVE_BENEATH`); those inside it are followed. Kernels without `openat2` (before 5.6) refuse
+    //! every symbolic link instead. Only available on Linux, elsewhere every request is answered `501`.
+    //!
+    //! @par Example
+    //! @code{.cpp}
+    //! auto server{ Server::Listen(StaticFiles{ "/srv/www" }, { .port = 8080 }) };
+    //!
+    //! // Or below a route, from a `{path...}` capture.
+    //! static constexpr std::array k_routes{ Route::For<GetMethod>("/assets/{path...}") };
+    //! auto router{ MakeRouter<k_routes>([files = StaticFiles{ "/srv/assets" }](
+    //!         const ServerRequest& req, ServerResponse& res, const RouteParams& params) {
+    //!     files.Serve(req, res, params[0]);
+    //! }) };
+    //! @endcode
+    struct StaticFiles {
+        explicit StaticFiles(const std::filesystem::path& root, StaticFilesOptions opts = {});
+
+        //! @brief Serves the file at the request path.
+        void operator()(const ServerRequest& request, ServerResponse& response) const;
+
+        //! @brief Serves `path`, relative to the root and still percent-encoded.
+        void Serve(const ServerRequest& request, ServerResponse& response, std::string_view path) const;
+
+    private:
+        std::shared_ptr<details_::StaticFilesCache> m_cache;
+    };
+}
@@ -30,9 +30,12 @@ namespace Thoth::Http {
 
     std::optional<std::uint16_t> GetDefaultPort(std::string_view scheme) noexcept;
 
+    struct UrlView;
+
     //! @brief A subset of URL as defined in <a href="https://datatracker.ietf.org/doc/html/rfc3986">RFC 3986</a>.
     //!
     //! @note Url is an immutable record: once parsed via @ref FromUrl, its components  cannot be mutated in place.
+    //! Build it with @ref UrlBuilder instead, and use @ref UrlView to read a URL without owning it.
     //!
     //! @warning Views returned by this class are only valid for the lifetime of *this* Url instance, and are
     //! invalidated by move (the moved-from Url no longer owns the buffer). Do not store an @ref AuthorityView
@@ -105,11 +108,20 @@ namespace Thoth::Http {
         //! @param str the given text.
         //! @return The string encoded.
         static std::string Encode(std::string_view str);
+        //! @brief @ref Encode, appending to `out` instead of returning a new string.
+        //! @details Runs of unreserved characters are found a vector at a time and copied as a whole.
+        static void AppendEncoded(std::string& out, std::string_view str);
         //! @brief Tries to decode the text with <a href="https://datatracker.ietf.org/doc/html/rfc3986#section-2.1">
         //! Percent-Encoding</a>.
         //! @param str the given text.
         //! @return The string decoded if it succeeded, std::nullopt if it fails.
         static std::expected<std::string, ThothError> TryDecode(std::string_view str);
+        //! @brief @ref TryDecode, appending to `out` instead of returning a new string.
+        //! @note On failure `out` keeps what was decoded before the ill-formed sequence.
+        static ThothResultOper AppendDecoded(std::string& out, std::string_view str);
+        //! @brief @ref TryDecode, overwriting `str` with the decoded text, no allocation.
+        //! @note On failure the content of `str` is unspecified.
+        static ThothResultOper DecodeInPlace(std::string& str);
 
         bool operator==(const Url& other) const noexcept;
     private:
@@ -120,13 +132,16 @@ namespace Thoth::Http {
         };
 
         friend struct UrlBuilder;
+        friend struct UrlView;
         friend struct std::formatter<Url>;
         friend struct std::hash<Url>;
 
         explicit Url() = default;
 
         [[nodiscard]] std::string_view View(RangeIdx range) const noexcept;
-        [[nodiscard]] static RangeIdx MakeRange(const std::string& source, std::string_view view) noexcept;
+        //! @brief Takes the components of `view`, a parse of the same text as `m_rawUrl`.
+        //! @return false if the IP host of `view` couldn't be built, its text is kept instead.
+        bool SetRanges_(const UrlView& view);
 
         std::string m_rawUrl{};
 
@@ -0,0 +1,53 @@
+#pragma once
+#include <string_view>
+
+#include <Thoth/Http/Url/Url.hpp>
+#include <Thoth/Http/Url/UrlView.hpp>
+
+namespace Thoth::Http {
+    //! @brief Builds a @ref Url from a base, appending path segments and query params in one buffer.
+    //!
+    //! The base is parsed once. Every append percent-encodes straight into the buffer and extends the component
+    //! ranges, so @ref Build hands the buffer over to the Url without parsing it again.
+    //!
+    //! @par Example
+    //! @code{.cpp}
+    //! static const Url k_api{ Url::FromUrl("https://api.example.com/v1").value() };
+    //!
+    //! const auto url{ UrlBuilder{ k_api, 64 }
+    //!     .AppendPath("users")
+    //!     .AppendPath(userId)
+    //!     .AppendQuery("page", "2")
+    //!     .Build() }; // https://api.example.com/v1/users/42?page=2
+    //! @endcode
+    //!
+    //! @note The query and fragment of the base are dropped. Segments appended after a query param are still
+    //! placed in the path, at the cost of moving the query.
+    struct UrlBuilder {
+        //! @brief Starts from the scheme, authority and path of `base`.
+        //! @param base the URL to start from.
+        //! @param capacity the length to reserve for the whole URL.
+        explicit UrlBuilder(const Url& base, size_t capacity = 0);
+
+        //! @copydoc UrlBuilder(const Url&, size_t)
+        explicit UrlBuilder(const UrlView& base, size_t capacity = 0);
+
+        //! @brief Appends "/" and `segment` percent-encoded (a "/" inside it included).
+        UrlBuilder& AppendPath(std::string_view segment);
+
+        //! @brief Appends "key=value", both percent-encoded, after "?" or "&".
+        UrlBuilder& AppendQuery(std::string_view key, std::string_view value);
+
+        //! @brief The URL built so far.
+        [[nodiscard]] std::string_view View() const noexcept;
+
+        //! @brief Hands the buffer over to the Url.
+        [[nodiscard]] Url Build() &&;
+
+        //! @brief Copies the URL built so far, the builder can keep appending.
+        [[nodiscard]] Url Build() const&;
+
+    private:
+        Url m_url;
+    };
+}
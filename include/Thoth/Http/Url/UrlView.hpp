@@ -0,0 +1,99 @@
+#pragma once
+#include <cstdint>
+#include <expected>
+#include <optional>
+#include <string_view>
+
+#include <Thoth/Http/Url/Url.hpp>
+
+namespace Thoth::Http {
+    //! @brief A non-owning @ref Url: the same grammar and accessors, viewing a string kept by the caller.
+    //!
+    //! Parsing only splits and validates the text, it allocates nothing and runs at compile time. The host address
+    //! (IPv4/IPv6) is only built when @ref GetAuthority is called, @ref GetHost returns its text as written.
+    //!
+    //! @par Example
+    //! @code{.cpp}
+    //! constexpr auto k_api{ UrlView::FromUrl("https://api.example.com/v1").value() }; // fails to compile if invalid
+    //! static_assert(k_api.GetPath() == "/v1");
+    //!
+    //! const auto view{ UrlView::FromUrl(line.target) };
+    //! if (view && view->GetHost() == "localhost") { ... }
+    //! @endcode
+    //!
+    //! @warning Every view returned, and the UrlView itself, is only valid while the parsed string is alive.
+    //! Use @ref ToUrl to keep it.
+    struct UrlView {
+        using AuthorityViewOpt = Url::AuthorityViewOpt;
+
+        enum class HostKindEnum : uint8_t {
+            RegName,
+            Ipv4,
+            Ipv6
+        };
+
+
+        constexpr UrlView() = default;
+
+        //! @brief Tries to view the given string as a URL, with the rules of @ref Url::FromUrl.
+        //! @param rawUrl the given URL, it must outlive the view.
+        //! @return The view if succeeded, the reason otherwise.
+        static constexpr std::expected<UrlView, UrlParseErrorEnum> FromUrl(std::string_view rawUrl);
+
+
+        //! @brief returns the URL Scheme.
+        [[nodiscard]] constexpr std::string_view GetScheme()   const noexcept;
+        //! @brief returns the URL Authority, building the host address when it is an IP.
+        [[nodiscard]] AuthorityViewOpt           GetAuthority() const;
+        //! @brief returns the userinfo of the Authority.
+        [[nodiscard]] constexpr std::string_view GetUserinfo() const noexcept;
+        //! @brief returns the host as written (an IPv6 keeps its brackets).
+        [[nodiscard]] constexpr std::string_view GetHost()     const noexcept;
+        //! @brief returns what the host is, without building the address.
+        [[nodiscard]] constexpr HostKindEnum     GetHostKind() const noexcept;
+        //! @brief returns the port, if the URL has one.
+        [[nodiscard]] constexpr std::optional<std::uint16_t> GetPort() const noexcept;
+        //! @brief returns the URL Path.
+        [[nodiscard]] constexpr std::string_view GetPath()     const noexcept;
+        //! @brief returns the URL Query.
+        [[nodiscard]] constexpr std::string_view GetQuery()    const noexcept;
+        //! @brief returns the URL Fragment.
+        [[nodiscard]] constexpr std::string_view GetFragment() const noexcept;
+
+        //! @brief true if the URL has a "?", even with an empty query.
+        [[nodiscard]] constexpr bool HasQuery()    const noexcept;
+        //! @brief true if the URL has a "#", even with an empty fragment.
+        [[nodiscard]] constexpr bool HasFragment() const noexcept;
+
+        //! @brief return the "/{path}" (always shows "/").
+        [[nodiscard]] constexpr std::string_view GetPathOrSep()          const noexcept;
+        //! @brief return the URL without fragment.
+        [[nodiscard]] constexpr std::string_view GetUrlWithoutFragment() const noexcept;
+        //! @brief return the whole URL.
+        [[nodiscard]] constexpr std::string_view GetUrl()                const noexcept;
+        //! @brief Parses the query as QueryParams.
+        [[nodiscard]] QueryParams GetQueryParams() const;
+
+        //! @brief Copies the URL into an owning @ref Url, without parsing it again.
+        [[nodiscard]] Url ToUrl() const;
+
+        constexpr bool operator==(const UrlView& other) const noexcept;
+    private:
+        std::string_view m_rawUrl{};
+
+        std::string_view m_scheme{};
+        std::string_view m_userinfo{};
+        std::string_view m_host{};
+        std::string_view m_path{};
+        std::string_view m_query{};
+        std::string_view m_fragment{};
+
+        std::optional<std::uint16_t> m_port{};
+        HostKindEnum m_hostKind{};
+        bool m_hasQuery{};
+        bool m_hasFragment{};
+    };
+}
+
+
+#include <Thoth/Http/Url/UrlView.tpp>
@@ -0,0 +1,280 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <format>
+#include <limits>
+
+#include <Thoth/String/Simd.hpp>
+#include <Thoth/String/Utils.hpp>
+
+namespace Thoth::Http::details_ {
+    inline constexpr auto k_regNameTable{ [] {
+        std::array<bool, 256> res{};
+
+        for (const char ch : String::CharSequences::Http::k_url)
+            res[static_cast<unsigned char>(ch)] = true;
+
+        return res;
+    }() };
+
+    constexpr bool IsUrlAlpha(const char c) {
+        return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z');
+    }
+
+    constexpr bool IsUrlDigit(const char c) {
+        return '0' <= c && c <= '9';
+    }
+
+    constexpr bool IsUrlHex(const char c) {
+        return IsUrlDigit(c) || ('a' <= c && c <= 'f') || ('A' <= c && c <= 'F');
+    }
+
+    // scheme      = ALPHA *( ALPHA / DIGIT / "+" / "-" / "." )
+    constexpr bool IsSchemeChar(const char c) {
+        return IsUrlAlpha(c) || IsUrlDigit(c) || c == '+' || c == '-' || c == '.';
+    }
+
+    // dec-octet "." dec-octet "." dec-octet "." dec-octet, without leading zeros
+    constexpr bool IsIpv4(std::string_view str) {
+        for (int i{}; i < 4; ++i) {
+            size_t len{};
+            unsigned val{};
+            while (len < str.size() && len < 4 && IsUrlDigit(str[len]))
+                val = val * 10 + static_cast<unsigned>(str[len++] - '0');
+
+            if (len == 0 || len > 3 || val > 255 || (len > 1 && str[0] == '0'))
+                return false;
+
+            str.remove_prefix(len);
+
+            if (i == 3)
+                return str.empty();
+            if (!str.starts_with('.'))
+                return false;
+
+            str.remove_prefix(1);
+        }
+
+        return false;
+    }
+
+    // IPv6address as in RFC 3986 §3.2.2: 8 h16, "::" standing for one or more of them, an IPv4 for the last two.
+    constexpr bool IsIpv6(std::string_view str) {
+        int groups{};
+        bool compressed{};
+
+        if (str.starts_with("::")) {
+            compressed = true;
+            str.remove_prefix(2);
+        } else if (str.starts_with(':'))
+            return false;
+
+        while (!str.empty()) {
+            if (str.find(':') == std::string_view::npos && str.find('.') != std::string_view::npos) {
+                if (!IsIpv4(str))
+                    return false;
+
+                groups += 2;
+                break;
+            }
+
+            size_t len{};
+            while (len < str.size() && IsUrlHex(str[len]))
+                ++len;
+
+            if (len == 0 || len > 4)
+                return false;
+
+            ++groups;
+            str.remove_prefix(len);
+
+            if (str.empty())
+                break;
+            if (str[0] != ':')
+                return false;
+
+            str.remove_prefix(1);
+
+            if (str.starts_with(':')) {
+                if (compressed)
+                    return false;
+
+                compressed = true;
+                str.remove_prefix(1);
+            } else if (str.empty())
+                return false;
+        }
+
+        return compressed ? groups < 8 : groups == 8;
+    }
+
+    // reg-name    = *( unreserved / pct-encoded / sub-delims )
+    constexpr bool IsRegName(const std::string_view str) {
+        for (size_t i{}; i < str.size(); ++i) {
+            if (k_regNameTable[static_cast<unsigned char>(str[i])])
+                continue;
+
+            if (str[i] != '%' || i + 2 >= str.size() || !IsUrlHex(str[i + 1]) || !IsUrlHex(str[i + 2]))
+                return false;
+
+            i += 2;
+        }
+
+        return true;
+    }
+}
+
+
+namespace Thoth::Http {
+    // URI         = scheme ":" "//" authority path-abempty [ "?" query ] [ "#" fragment ]
+    // authority   = [ userinfo "@" ] host [ ":" port ]
+    constexpr std::expected<UrlView, UrlParseErrorEnum> UrlView::FromUrl(const std::string_view rawUrl) {
+        using enum UrlParseErrorEnum;
+        constexpr auto npos{ std::string_view::npos };
+
+        if (rawUrl.empty() || !details_::IsUrlAlpha(rawUrl.front()))
+            return std::unexpected{ EmptyUrl };
+
+        UrlView res;
+        res.m_rawUrl = rawUrl;
+
+        const auto schemeIdx{ rawUrl.find(':') };
+        if (schemeIdx == npos)
+            return std::unexpected{ InvalidScheme };
+
+        res.m_scheme = rawUrl.substr(0, schemeIdx);
+        if (!std::ranges::all_of(res.m_scheme, details_::IsSchemeChar))
+            return std::unexpected{ InvalidScheme };
+
+        const auto rest{ rawUrl.substr(schemeIdx + 1) };
+        const auto hierPartIdx{ String::FindFirstOf<'?', '#'>(rest) };
+        auto hierPart{ rest.substr(0, hierPartIdx) };
+
+        if (hierPartIdx != npos) {
+            const auto tail{ rest.substr(hierPartIdx + 1) };
+
+            if (rest[hierPartIdx] == '#') {
+                res.m_fragment    = tail;
+                res.m_hasFragment = true;
+            } else {
+                const auto fragIdx{ tail.find('#') };
+
+                res.m_query    = tail.substr(0, fragIdx);
+                res.m_hasQuery = true;
+
+                if (fragIdx != npos) {
+                    res.m_fragment    = tail.substr(fragIdx + 1);
+                    res.m_hasFragment = true;
+                }
+            }
+        }
+
+        if (!hierPart.starts_with("//"))
+            return std::unexpected{ IllFormed }; // in HTTP, {"//" authority path-abempty} is mandatory
+
+        hierPart.remove_prefix(2);
+
+        const auto pathIdx{ std::min(hierPart.find('/'), hierPart.size()) };
+        if (pathIdx == 0 && !hierPart.empty())
+            return std::unexpected{ IllFormed }; // authority is empty
+
+        res.m_path = hierPart.substr(pathIdx);
+        auto authority{ hierPart.substr(0, pathIdx) };
+
+        if (const auto userinfoIdx{ authority.find('@') }; userinfoIdx != npos) {
+            res.m_userinfo = authority.substr(0, userinfoIdx);
+            authority.remove_prefix(userinfoIdx + 1);
+        } else
+            res.m_userinfo = authority.substr(0, 0);
+
+        size_t portIdx;
+        if (authority.starts_with('[')) {
+            const auto closeBracket{ authority.find(']') };
+            if (closeBracket == npos)
+                return std::unexpected{ IllFormed };
+
+            portIdx = authority.find(':', closeBracket + 1);
+        } else
+            portIdx = authority.find(':');
+
+        res.m_host = authority.substr(0, portIdx);
+
+        if (portIdx != npos) {
+            const auto port{ authority.substr(portIdx + 1) };
+            uint32_t val{};
+
+            if (port.empty())
+                return std::unexpected{ InvalidPort };
+
+            for (const char c : port) {
+                if (!details_::IsUrlDigit(c))
+                    return std::unexpected{ InvalidPort };
+
+                val = val * 10 + static_cast<uint32_t>(c - '0');
+                if (val > std::numeric_limits<std::uint16_t>::max())
+                    return std::unexpected{ InvalidPort };
+            }
+
+            res.m_port = static_cast<std::uint16_t>(val);
+        }
+
+        const auto host{ res.m_host };
+        if (host.empty())
+            return std::unexpected{ IllFormed }; // in auth host is mandatory
+
+        if (host.size() > 2 && host.starts_with('[') && host.ends_with(']') && details_::IsIpv6(host.substr(1, host.size() - 2)))
+            res.m_hostKind = HostKindEnum::Ipv6;
+        else if (details_::IsIpv4(host))
+            res.m_hostKind = HostKindEnum::Ipv4;
+        else if (details_::IsRegName(host))
+            res.m_hostKind = HostKindEnum::RegName;
+        else
+            return std::unexpected{ HostIsRequired };
+
+        return res;
+    }
+
+
+    constexpr std::string_view UrlView::GetScheme() const noexcept { return m_scheme; }
+
+    constexpr std::string_view UrlView::GetUserinfo() const noexcept { return m_userinfo; }
+
+    constexpr std::string_view UrlView::GetHost() const noexcept { return m_host; }
+
+    constexpr UrlView::HostKindEnum UrlView::GetHostKind() const noexcept { return m_hostKind; }
+
+    constexpr std::optional<std::uint16_t> UrlView::GetPort() const noexcept { return m_port; }
+
+    constexpr std::string_view UrlView::GetPath() const noexcept { return m_path; }
+
+    constexpr std::string_view UrlView::GetQuery() const noexcept { return m_query; }
+
+    constexpr std::string_view UrlView::GetFragment() const noexcept { return m_fragment; }
+
+    constexpr bool UrlView::HasQuery() const noexcept { return m_hasQuery; }
+
+    constexpr bool UrlView::HasFragment() const noexcept { return m_hasFragment; }
+
+    constexpr std::string_view UrlView::GetPathOrSep() const noexcept { return m_path.empty() ? "/" : m_path; }
+
+    constexpr std::string_view UrlView::GetUrlWithoutFragment() const noexcept {
+        return m_hasFragment
+            ? m_rawUrl.substr(0, static_cast<size_t>(m_fragment.data() - m_rawUrl.data()) - 1)
+            : m_rawUrl;
+    }
+
+    constexpr std::string_view UrlView::GetUrl() const noexcept { return m_rawUrl; }
+
+    constexpr bool UrlView::operator==(const UrlView& other) const noexcept {
+        return m_rawUrl == other.m_rawUrl;
+    }
+}
+
+
+template<>
+struct std::formatter<Thoth::Http::UrlView> : std::formatter<std::string_view> {
+    template<class FormatContext>
+    auto format(const Thoth::Http::UrlView& url, FormatContext& ctx) const {
+        return std::formatter<std::string_view>::format(url.GetUrl(), ctx);
+    }
+};
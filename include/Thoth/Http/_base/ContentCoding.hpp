@@ -0,0 +1,105 @@
+#pragma once
+#include <expected>
+#include <limits>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+#include <Thoth/ThothError.hpp>
+#include <Thoth/Http/NHeaders/Headers/AcceptEncoding.hpp>
+#include <Thoth/Http/NHeaders/Headers/ContentEncodingEnum.hpp>
+
+namespace Thoth::Http::details_ {
+    //! @brief Streaming decoder for the codings listed in a `Content-Encoding` header (RFC 9110 §8.4).
+    //!
+    //! Sits between the message framing (content-length/chunked) and the body sink: the framing layer feeds the
+    //! encoded bytes block by block and the decoder appends the plain representation to an output buffer, so the
+    //! whole compressed payload is never materialized.
+    //!
+    //! Which codings are available depends on how Thoth was built (`THOTH_WITH_ZLIB`, `THOTH_WITH_ZSTD` and
+    //! `THOTH_WITH_BROTLI`); `AcceptedCodings` reports them in the form used to negotiate via `Accept-Encoding`.
+    //!
+    //! @par Example
+    //! @code{.cpp}
+    //! auto decoder{ ContentDecoder::Create(std::array{ NHeaders::ContentEncodingEnum::Gzip }) };
+    //! std::string plain;
+    //! decoder->Feed(compressedBlock, plain);
+    //! decoder->Finish();
+    //! @endcode
+    struct ContentDecoder {
+        ContentDecoder(ContentDecoder&&) noexcept;
+        ContentDecoder& operator=(ContentDecoder&&) noexcept;
+        ~ContentDecoder();
+
+        //! @brief Creates a decoder that undoes `codings`, given in the order they were applied.
+        //! @return The decoder, or `MessageParseErrorEnum::UnsupportedContentEncoding` if any coding is unavailable.
+        static std::expected<ContentDecoder, ThothError> Create(std::span<const NHeaders::ContentEncodingEnum> codings);
+
+        //! @brief Whether this build can decode `coding`.
+        static bool IsSupported(NHeaders::ContentEncodingEnum coding);
+
+        //! @brief The codings this build can decode, ready to be written to `Accept-Encoding`.
+        //! @return An empty list when no compression library was enabled.
+        static std::vector<NHeaders::AcceptEncoding> AcceptedCodings();
+
+        //! @brief Decodes one block of encoded data, appending the result to `output`.
+        //! @param maxOutput The most bytes the block may append. Checked while decoding, so a decompression bomb
+        //! fails after at most one step of the codec past it rather than after expanding the whole block.
+        //! @return `MessageParseErrorEnum::InvalidContentEncoding` if the data is corrupt or decodes to more than
+        //! `maxOutput`.
+        std::expected<std::monostate, ThothError> Feed(
+            std::string_view input, std::string& output, size_t maxOutput = std::numeric_limits<size_t>::max());
+
+        //! @brief Ensures every coded stream was terminated. An empty payload is always accepted.
+        //! @return `MessageParseErrorEnum::InvalidContentEncoding` if the payload was truncated.
+        [[nodiscard]] std::expected<std::monostate, ThothError> Finish() const;
+
+        struct Stage;
+    private:
+        ContentDecoder() = default;
+
+        std::vector<std::unique_ptr<Stage>> m_stages;
+        std::vector<std::string> m_buffers;
+    };
+
+    //! @brief Streaming encoder for one `Content-Encoding` coding, used to compress outgoing bodies.
+    //!
+    //! The body is fed block by block and the encoded bytes are appended to an output buffer that the caller drains,
+    //! so neither the plain nor the compressed body has to be held in memory at once. Only `gzip`, `deflate` (needs
+    //! `THOTH_WITH_ZLIB`) and `zstd` (needs `THOTH_WITH_ZSTD`) can be produced.
+    //!
+    //! @par Example
+    //! @code{.cpp}
+    //! auto encoder{ ContentEncoder::Create(NHeaders::ContentEncodingEnum::Gzip) };
+    //! std::string out;
+    //! encoder->Feed(block, out);
+    //! encoder->Finish(out);
+    //! @endcode
+    struct ContentEncoder {
+        ContentEncoder(ContentEncoder&&) noexcept;
+        ContentEncoder& operator=(ContentEncoder&&) noexcept;
+        ~ContentEncoder();
+
+        //! @brief Creates an encoder for `coding`.
+        //! @return The encoder, or `MessageParseErrorEnum::UnsupportedContentEncoding` if the coding is unavailable.
+        static std::expected<ContentEncoder, ThothError> Create(NHeaders::ContentEncodingEnum coding);
+
+        //! @brief Whether this build can encode `coding`.
+        static bool IsSupported(NHeaders::ContentEncodingEnum coding);
+
+        //! @brief Encodes one block of data, appending whatever the codec already emitted to `output`.
+        std::expected<std::monostate, ThothError> Feed(std::string_view input, std::string& output);
+
+        //! @brief Terminates the coded stream, appending the remaining bytes to `output`.
+        std::expected<std::monostate, ThothError> Finish(std::string& output);
+
+        struct Stage;
+    private:
+        ContentEncoder() = default;
+
+        std::unique_ptr<Stage> m_stage;
+    };
+}
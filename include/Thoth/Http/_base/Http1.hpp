@@ -3,6 +3,8 @@
 #include <Thoth/Http/_base.hpp>
 #include <Thoth/ThothError.hpp>
 #include <Thoth/Http/NHeaders/Headers.hpp>
+#include <Hermes/Utils/UntilMatch.hpp>
+#include <Thoth/Http/_base/ContentCoding.hpp>
 #include <charconv>
 #include <expected>
 #include <variant>
@@ -13,17 +15,30 @@ namespace Thoth::Http::details_ {
     //! Plain Http/1.0 uses the same machinery, but Http/2 and Http/3 have different
     //! semantics and require their own structs.
     struct Http1 {
+        //! @brief Parses a whole response from `stream`.
+        //! @param decodeContent undo the `Content-Encoding` of the body while reading it.
         template<class Method, WritableBodyConcept ResponseBody, class F, class Stream>
             requires ResponseBodyFactoryConcept<F, ResponseBody>
-        static std::expected<Response<Method, ResponseBody>, ThothError> BuildResponse(Stream&& stream, F&& bodyFactory);
+        static std::expected<Response<Method, ResponseBody>, ThothError> BuildResponse(
+            Stream&& stream, F&& bodyFactory, bool decodeContent = false);
 
         //! @brief Parses the Http response line (version, status code and reason).
         template<class Stream>
         static std::expected<ResponseParseStage<Stream>, ThothError> ParseResponseLine(ResponseParseStage<Stream> stage);
 
-        //! @brief Parses the Http Request line.
+        //! @brief The parts of a request line that don't fit in a @ref RequestHead.
+        struct RequestLine {
+            std::string method;
+            //! @brief As sent: origin-form (`/path?query`), absolute-form, authority-form or `*`.
+            std::string target;
+        };
+
+        //! @brief Parses the Http request line (method, request-target and version).
+        //! @details Only the version is stored in the stage, the target becomes an @ref Url once the `Host` header
+        //! is known, see RFC 9112 §3.3.
         template<class Stream>
-        static std::expected<std::pair<std::string, RequestParseStage<Stream>>, ThothError> ParseRequestLine(RequestParseStage<Stream> stage); // TODO: IMPLEMENT
+        static std::expected<std::pair<RequestLine, RequestParseStage<Stream>>, ThothError> ParseRequestLine(
+            RequestParseStage<Stream> stage);
 
         //! @brief Parses the Http headers extracted from a stream.
         template<class Stream, class Head>
@@ -33,9 +48,12 @@ namespace Thoth::Http::details_ {
 
 
         //! @brief Parses the Http message body.
+        //! @details When `decodeContent` is set, the framed bytes go through a ContentDecoder before reaching the
+        //! body, and `content-encoding`/`content-length` are dropped from the headers since they no longer
+        //! describe it.
         template<class Stream, WritableBodyConcept Body, class Head>
         static std::expected<ParseCompleteStage<Stream, Head, Body>, ThothError> ParseBody(
-            ParseCompleteStage<Stream, Head, Body> stage);
+            ParseCompleteStage<Stream, Head, Body> stage, bool decodeContent = false);
 
         //! @brief Sets "content-length" or "transfer-encoding: chunked" on headers
         //! depending on the body type.
@@ -43,6 +61,10 @@ namespace Thoth::Http::details_ {
         template<ReadableBodyConcept Body>
         static void PrepareBodyHeaders(Headers& headers, const Body& body);
 
+        //! @brief Sets "transfer-encoding: chunked" and appends `coding` to "content-encoding", for a body that
+        //! will be sent through a ContentEncoder.
+        static void PrepareEncodedBodyHeaders(Headers& headers, NHeaders::ContentEncodingEnum coding);
+
         //! @brief Sends the request/response line and headers over the wire.
         template<MethodConcept Method, class Head, ConnectionConcept Socket>
             requires (std::same_as<Head, RequestHead> || std::same_as<Head, ResponseHead>)
@@ -54,6 +76,15 @@ namespace Thoth::Http::details_ {
         template<ConnectionConcept Socket, ReadableBodyConcept Body>
         static std::expected<size_t, ThothError> SendBody(
             Socket& socket, const Body& body, typename Socket::SendOptions options = {});
+
+        //! @brief Sends the body through `encoder`, framed as chunked.
+        //! @details Each chunk is emitted as soon as the encoder produced enough output, so neither the plain nor
+        //! the encoded body is ever held in memory as a whole.
+        //! @return The amount of encoded bytes sent.
+        //! @see PrepareEncodedBodyHeaders
+        template<ConnectionConcept Socket, ReadableBodyConcept Body>
+        static std::expected<size_t, ThothError> SendBody(
+            Socket& socket, const Body& body, ContentEncoder& encoder, typename Socket::SendOptions options = {});
     };
 }
 
@@ -34,7 +34,8 @@ namespace Thoth::Http::details_ {
 
     template<class Method, WritableBodyConcept ResponseBody, class F, class Stream>
         requires ResponseBodyFactoryConcept<F, ResponseBody>
-    std::expected<Response<Method, ResponseBody>, ThothError> Http1::BuildResponse(Stream&& stream, F&& bodyFactory) {
+    std::expected<Response<Method, ResponseBody>, ThothError> Http1::BuildResponse(
+        Stream&& stream, F&& bodyFactory, const bool decodeContent) {
         using HeadStage     = ResponseParseStage<Stream>;
         using CompleteStage = ResponseParseCompleteStage<Stream, ResponseBody>;
 
@@ -49,6 +50,18 @@ namespace Thoth::Http::details_ {
             return CompleteStage{ { std::move(stage.data), std::move(stage.stream) }, std::move(*bodyExp) };
         } };
 
+        // RFC 9112 §6.3, these responses end after the head whatever their framing headers say.
+        const auto parseBody{ [decodeContent](CompleteStage stage) -> std::expected<CompleteStage, ThothError> {
+            using enum StatusCodeEnum;
+            const auto status{ stage.data.status };
+
+            if (Method::MethodName() == "HEAD" || GetStatusType(status) == StatusTypeEnum::INFORMATIONAL
+                    || status == NoContent || status == NotModified)
+                return std::move(stage);
+
+            return Http1::ParseBody(std::move(stage), decodeContent);
+        } };
+
         const auto createResponse{ [](CompleteStage&& stage) {
             return Response<Method, ResponseBody>{ stage.data, std::move(stage.body) };
         } };
@@ -57,7 +70,7 @@ namespace Thoth::Http::details_ {
                 .and_then(HTTP11_FORWARD(ParseResponseLine))
                 .and_then(HTTP11_FORWARD(ParseHeaders))
                 .and_then(initializeBody)
-                .and_then(HTTP11_FORWARD(ParseBody))
+                .and_then(parseBody)
                 .transform(createResponse);
     }
 
@@ -100,11 +113,67 @@ namespace Thoth::Http::details_ {
         return std::move(stage);
     }
 
+    template<class Stream>
+    std::expected<std::pair<Http1::RequestLine, RequestParseStage<Stream>>, ThothError> Http1::ParseRequestLine(
+        RequestParseStage<Stream> stage) {
+        namespace rg = std::ranges;
+        namespace vs = std::views;
+        using namespace std::literals;
+
+        static constexpr auto k_maxMethodSize{ 32 };
+        static constexpr auto k_maxTargetSize{ 8 * 1024 };
+
+        // RFC 9110 §5.6.2, a method is a token.
+        static constexpr auto isTokenChar{ [](const unsigned char c) {
+            return std::isalnum(c) || "!#$%&'*+-.^_`|~"sv.contains(static_cast<char>(c));
+        } };
+
+        const auto readUntilSpace{ [&](const size_t maxSize) -> std::optional<std::string> {
+            auto part{ stage.stream
+                    | vs::take(maxSize + 1)
+                    | Hermes::Utils::UntilMatch<true>(" "sv)
+                    | rg::to<std::string>() };
+
+            if (part.size() < 2 || !part.ends_with(' ')) return std::nullopt;
+
+            part.pop_back();
+            return part;
+        } };
+
+        RequestLine line;
+
+        auto method{ readUntilSpace(k_maxMethodSize) };
+        VALID_STREAM(stage.stream);
+        ASSERT_OR_RET_ERROR(method && rg::all_of(*method, isTokenChar), MessageParseErrorEnum::InvalidStartLine);
+        line.method = std::move(*method);
+
+        auto target{ readUntilSpace(k_maxTargetSize) };
+        VALID_STREAM(stage.stream);
+        ASSERT_OR_RET_ERROR(target && !target->contains(' '), MessageParseErrorEnum::InvalidStartLine);
+        line.target = std::move(*target);
+
+        ASSERT_OR_RET_ERROR(rg::starts_with(stage.stream, "HTTP/1."sv), MessageParseErrorEnum::InvalidStartLine);
+
+        switch (*stage.stream.begin()) {
+            case '0': stage.data.version = VersionEnum::HTTP1_0; break;
+            case '1': stage.data.version = VersionEnum::HTTP1_1; break;
+            default: return ThothUnex{ MessageParseErrorEnum::InvalidVersion };
+        }
+        ++stage.stream.begin();
+
+        ASSERT_OR_RET_ERROR(rg::starts_with(stage.stream, k_crlf), MessageParseErrorEnum::InvalidStartLine);
+        VALID_STREAM(stage.stream);
+
+        return std::pair{ std::move(line), std::move(stage) };
+    }
+
     inline std::expected<std::monostate, ThothError> Http1::ValidateFraming(const Headers& headers) {
-        if (headers.Exists("content-length") && headers.Exists("transfer-encoding"))
+        using enum NHeaders::HeaderIdEnum;
+
+        if (headers.Exists(ContentLength) && headers.Exists(TransferEncoding))
             return ThothUnex{ MessageParseErrorEnum::InvalidHeaders };;
 
-        if (headers.Exists("transfer-encoding")) {
+        if (headers.Exists(TransferEncoding)) {
             const auto transferEncoding{ headers.TransferEncoding().Get() };
             if (!transferEncoding || transferEncoding->size() != 1
                 || transferEncoding->front() != NHeaders::TransferEncodingEnum::Chunked)
@@ -124,7 +193,7 @@ namespace Thoth::Http::details_ {
         VALID_STREAM(stage.stream);
 
         // headersParseRes.error() is a StatusCodeEnum (BadRequest / ContentTooLarge) - requires
-        // Http::StatusCodeEnum to be a ThothErrorBase alternative (see ThothError.hpp) to compile.
+        // Http::StatusCodeEnum to be a ThothError alternative (see ThothError.hpp) to compile.
         ASSERT_OR_RET_ERROR(headersParseRes, headersParseRes.error());
         ASSERT_OR_RET_ERROR(ValidateFraming(*headersParseRes), MessageParseErrorEnum::InvalidHeaders);
 
@@ -138,8 +207,8 @@ namespace Thoth::Http::details_ {
 
     template<ReadableBodyConcept Body>
     void Http1::PrepareBodyHeaders(Headers& headers, const Body& body) {
-        headers.Remove("transfer-encoding");
-        headers.Remove("content-length");
+        headers.Remove(NHeaders::HeaderIdEnum::TransferEncoding);
+        headers.Remove(NHeaders::HeaderIdEnum::ContentLength);
 
         if constexpr (SizedReadableBodyConcept<Body>) {
             headers.ContentLength().Set(std::ranges::size(body));
@@ -148,9 +217,17 @@ namespace Thoth::Http::details_ {
         }
     }
 
+    inline void Http1::PrepareEncodedBodyHeaders(Headers& headers, const NHeaders::ContentEncodingEnum coding) {
+        headers.Remove(NHeaders::HeaderIdEnum::TransferEncoding);
+        headers.Remove(NHeaders::HeaderIdEnum::ContentLength);
+
+        headers.TransferEncoding().Add(NHeaders::TransferEncodingEnum::Chunked);
+        headers.ContentEncoding().Add(coding);
+    }
+
 template<class Stream, WritableBodyConcept Body, class Head>
     std::expected<ParseCompleteStage<Stream, Head, Body>, ThothError> Http1::ParseBody(
-        ParseCompleteStage<Stream, Head, Body> stage)
+        ParseCompleteStage<Stream, Head, Body> stage, const bool decodeContent)
     {
         namespace rg = std::ranges;
         namespace vs = std::views;
@@ -163,11 +240,60 @@ template<class Stream, WritableBodyConcept Body, class Head>
 
         static constexpr auto k_maxBodyLength{ 0x14000000 }; // TODO: Make it configurable.
         static constexpr auto k_maxChunkLineLength{ 64 };
+        static constexpr size_t k_decodeBlockSize{ 16 * 1024 };
 
         static constexpr auto cvt{ [](const char c) {
             return std::bit_cast<ValueType>(c);
         } };
 
+        std::optional<ContentDecoder> decoder;
+        if (decodeContent && stage.data.headers.Exists(NHeaders::HeaderIdEnum::ContentEncoding)) {
+            const auto codings{ stage.data.headers.ContentEncoding().Get() };
+            ASSERT_OR_RET_ERROR(codings, ParseErrEnum::UnsupportedContentEncoding);
+
+            auto decoderRes{ ContentDecoder::Create(*codings) };
+            ASSERT_OR_RET_ERROR(decoderRes, decoderRes.error());
+
+            decoder.emplace(std::move(*decoderRes));
+        }
+
+        std::string decoded;
+        size_t decodedSize{};
+
+        // Moves `count` framed bytes from the stream to the body, decoding them on the way when needed.
+        const auto transferBytes{ [&](const size_t count) -> std::expected<std::monostate, ThothError> {
+            if (!decoder) {
+                rg::copy(
+                    stage.stream | vs::take(count) | vs::transform(cvt),
+                    GetInserterIterator(stage.body)
+                );
+                VALID_STREAM(stage.stream);
+                return std::monostate{};
+            }
+
+            std::array<char, k_decodeBlockSize> block;
+            for (size_t remaining{ count }; remaining != 0;) {
+                const auto blockEnd{ rg::copy(stage.stream | vs::take(std::min(remaining, block.size())), block.begin()).out };
+                VALID_STREAM(stage.stream);
+
+                const auto blockSize{ static_cast<size_t>(blockEnd - block.begin()) };
+                if (blockSize == 0) break;
+                remaining -= blockSize;
+
+                // The limit applies to the decoded size as well, otherwise a tiny payload could inflate unbounded. The
+                // decoder stops as soon as the block goes past what is left of it.
+                decoded.clear();
+                const auto feedRes{ decoder->Feed({ block.data(), blockSize }, decoded, size_t{ k_maxBodyLength } - decodedSize) };
+                ASSERT_OR_RET_ERROR(feedRes, feedRes.error());
+
+                decodedSize += decoded.size();
+
+                rg::copy(decoded | vs::transform(cvt), GetInserterIterator(stage.body));
+            }
+
+            return std::monostate{};
+        } };
+
         using TransferValue = std::variant<std::monostate, size_t>;
         using State1 = std::expected<TransferValue, HeaderErrEnum>;
         using State2 = std::expected<TransferValue, ThothError>;
@@ -194,13 +320,7 @@ template<class Stream, WritableBodyConcept Body, class Head>
                 if constexpr (requires (Body b){ { b.reserve(0) }; })
                     stage.body.reserve(contentSize);
 
-                rg::copy(
-                    stage.stream | vs::take(contentSize) | vs::transform(cvt),
-                    GetInserterIterator(stage.body)
-                );
-
-                VALID_STREAM(stage.stream);
-                return std::monostate{};
+                return transferBytes(contentSize);
             } };
 
             const auto readChunked{ [&](std::monostate) -> std::expected<std::monostate, ThothError> {
@@ -229,11 +349,8 @@ template<class Stream, WritableBodyConcept Body, class Head>
                     ASSERT_OR_RET_ERROR(totalBodySize + *chunkLength <= k_maxBodyLength, ParseErrEnum::InvalidHeaders);
                     totalBodySize += *chunkLength;
 
-                    rg::copy(
-                        stage.stream | vs::take(*chunkLength) | vs::transform(cvt),
-                        GetInserterIterator(stage.body)
-                    );
-                    VALID_STREAM(stage.stream);
+                    const auto chunkRes{ transferBytes(*chunkLength) };
+                    ASSERT_OR_RET_ERROR(chunkRes, chunkRes.error());
 
                     ASSERT_OR_RET_ERROR(rg::starts_with(stage.stream, k_crlf), ParseErrEnum::InvalidStartLine);
                 } while (chunkLength != 0);
@@ -251,6 +368,14 @@ template<class Stream, WritableBodyConcept Body, class Head>
 
         if (!readRes) return std::unexpected{ readRes.error() };
 
+        if (decoder) {
+            const auto finishRes{ decoder->Finish() };
+            ASSERT_OR_RET_ERROR(finishRes, finishRes.error());
+
+            stage.data.headers.Remove("content-encoding");
+            stage.data.headers.Remove("content-length");
+        }
+
         return std::move(stage);
     }
 
@@ -294,6 +419,69 @@ template<class Stream, WritableBodyConcept Body, class Head>
 
         return totalBytes;
     }
+
+    template<ConnectionConcept Socket, ReadableBodyConcept Body>
+    std::expected<size_t, ThothError> Http1::SendBody(
+        Socket& socket, const Body& body, ContentEncoder& encoder, typename Socket::SendOptions options) {
+        namespace rg = std::ranges;
+
+        // Encoded output is buffered up to this size before becoming a chunk, so the codec's tiny flushes
+        // don't turn into tiny chunks.
+        static constexpr size_t k_chunkSize{ 16 * 1024 };
+        static constexpr size_t k_feedBlockSize{ 64 * 1024 };
+
+        std::string encoded;
+        size_t totalBytes{};
+
+        const auto sendChunk{ [&](const size_t minSize) -> std::expected<std::monostate, ThothError> {
+            if (encoded.empty() || encoded.size() < minSize) return std::monostate{};
+
+            std::string header{ std::format("{:x}{}", encoded.size(), k_crlf) };
+
+            SEND_OR_RET_ERROR(hRes, header);
+            SEND_OR_RET_ERROR(dRes, encoded);
+            SEND_OR_RET_ERROR(cRes, k_crlf);
+
+            totalBytes += encoded.size();
+            encoded.clear();
+            return std::monostate{};
+        } };
+
+        const auto feed{ [&](const std::string_view data) -> std::expected<std::monostate, ThothError> {
+            for (size_t offset{}; offset < data.size(); offset += k_feedBlockSize) {
+                const auto feedRes{ encoder.Feed(data.substr(offset, k_feedBlockSize), encoded) };
+                ASSERT_OR_RET_ERROR(feedRes, feedRes.error());
+
+                const auto sendRes{ sendChunk(k_chunkSize) };
+                ASSERT_OR_RET_ERROR(sendRes, sendRes.error());
+            }
+            return std::monostate{};
+        } };
+
+        const auto asView{ [](const auto& range) {
+            return std::string_view{ reinterpret_cast<const char*>(rg::data(range)), rg::size(range) };
+        } };
+
+        if constexpr (SizedReadableBodyConcept<Body>) {
+            const auto feedRes{ feed(asView(body)) };
+            ASSERT_OR_RET_ERROR(feedRes, feedRes.error());
+        } else {
+            for (const auto& chunk : body) {
+                const auto feedRes{ feed(asView(chunk)) };
+                ASSERT_OR_RET_ERROR(feedRes, feedRes.error());
+            }
+        }
+
+        const auto finishRes{ encoder.Finish(encoded) };
+        ASSERT_OR_RET_ERROR(finishRes, finishRes.error());
+
+        const auto lastRes{ sendChunk(0) };
+        ASSERT_OR_RET_ERROR(lastRes, lastRes.error());
+
+        SEND_OR_RET_ERROR(endRes, k_lastChunk);
+
+        return totalBytes;
+    }
 }
 
 #pragma pop_macro("VALID_STREAM")
@@ -8,8 +8,7 @@
 #include <concepts>
 #include <span>
 
-#include <Thoth/Dsa/Cow.hpp>
-#include <Thoth/NJson/StringRef.hpp>
+#include <Thoth/NJson/JsonString.hpp>
 #include <Thoth/NJson/Number.hpp>
 
 
@@ -23,7 +22,7 @@ namespace Thoth::NJson {
 
 
     using Null   = std::monostate;                   // null
-    using String = Dsa::Cow<StringRef, std::string>; // string
+    using String = JsonString;                       // string
     using Number = Number;                           // number
     using Bool   = bool;                             // bool
     using Object = std::unique_ptr<JsonObject>;      // {Object}
@@ -33,10 +32,12 @@ namespace Thoth::NJson {
         struct BufferInfo {
             std::string_view bufferView;
             std::shared_ptr<std::string> buffer;
+            bool lazyNumbers{};
+            bool lazyUnescape{};
         };
 
         static bool ReadString(std::string_view& input, auto& val, const BufferInfo& info);
-        static bool ReadNumber(std::string_view& input, auto& val);
+        static bool ReadNumber(std::string_view& input, auto& val, const BufferInfo& info);
         static bool ReadObject(std::string_view& input, auto& val, const BufferInfo& info);
         static bool ReadBool  (std::string_view& input, auto& val);
         static bool ReadNull  (std::string_view& input, auto& val);
@@ -71,4 +72,12 @@ namespace Thoth::NJson {
 
     using Key  = std::variant<int, JsonObjKey>;
     using Keys = std::span<const Key>;
+
+    //! @brief How the Parallel functions of @ref Json split the children between threads.
+    struct ParallelOptions {
+        //! The threads to run on, the calling one included. std::thread::hardware_concurrency() if 0.
+        size_t threads{};
+        //! The fewest children worth a thread: fewer than twice as many are all read on the calling thread.
+        size_t grain{ 2048 };
+    };
 }
\ No newline at end of file
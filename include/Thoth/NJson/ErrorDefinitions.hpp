@@ -5,16 +5,23 @@ namespace Thoth::NJson {
     struct JsonParseError {
         size_t idx;
         char c;
+
+        bool operator==(const JsonParseError&) const = default;
     };
 
     struct JsonGetError {
         Key key;
+
+        bool operator==(const JsonGetError&) const = default;
     };
     struct JsonFindError {
         Key key;
         std::vector<Key> currentPath;
+
+        bool operator==(const JsonFindError&) const = default;
     };
     struct JsonSearchError {
+        bool operator==(const JsonSearchError&) const = default;
     };
 
     struct JsonWrongTypeError {
@@ -23,6 +30,8 @@ namespace Thoth::NJson {
 
         size_t idxExpected{};
         size_t idxGot{};
+
+        bool operator==(const JsonWrongTypeError&) const = default;
     };
 
     // TODO: FUTURE: high obscure, change to some fancy way in the future, but that will do
@@ -9,6 +9,7 @@
 #include <span>
 
 #include <Thoth/NJson/Definitions.hpp>
+#include <Thoth/String/Base64Viewer.hpp>
 #include <Thoth/ThothError.hpp>
 
 namespace Thoth::NJson {
@@ -114,8 +115,28 @@ namespace Thoth::NJson {
         template<class T>
         [[nodiscard]] std::expected<const T*, ThothError> EnsureRefOrError() const&;
 
+        //! @brief A string holding `bytes` Base64 encoded, the usual way to embed a binary blob.
+        //! @par Example
+        //! @code{.cpp}
+        //! obj["thumbnail"] = Json::FromBytes(png); // "iVBORw0KGgo..."
+        //! @endcode
+        template<Thoth::String::Base64AlphabetEnum Alphabet = Thoth::String::Base64AlphabetEnum::Standard>
+        [[nodiscard]] static Json FromBytes(std::string_view bytes);
+
+        //! @brief Decodes a Base64 string back into its bytes.
+        //! @return The bytes, std::nullopt if this is not a string or not valid Base64.
+        template<Thoth::String::Base64AlphabetEnum Alphabet = Thoth::String::Base64AlphabetEnum::Standard>
+        [[nodiscard]] std::optional<std::string> EnsureBytes() const;
+
         [[nodiscard]] bool operator==(const Json& other) const;
 
+        //! @brief A structural hash, equal documents hash the same: without formatting, whatever the order of the
+        //! keys, the storage of the strings or the type of the numbers (`1`, `1.0` and a lazy `1.00` are equal).
+        //!
+        //! The values are mixed as XXH64 does, the members of an object summed so their order does not matter.
+        //! It walks the whole tree: to hash a document more than once, see @ref HashedJson.
+        [[nodiscard]] size_t Hash() const;
+
         //! @brief Tries to parse the Json from a string.
         //! @details Requires only one parameter so it's convenient to monads. Calls ParseText with default parameters.
         //! @param input the text to parse.
@@ -123,12 +144,33 @@ namespace Thoth::NJson {
         static std::expected<Json, ThothError> Parse(std::string_view input);
 
 
+        //! @brief How @ref ParseText reads the text.
+        struct ParseOptions {
+            //! Copy the input to an internal buffer if true, keeps a reference otherwise.
+            bool copyData{ true };
+            //! Ensure that there is only space chars after the end of the json.
+            bool checkFinal{ true };
+            //! Keep the short number literals as written, converted when read (see Number::FromToken).
+            bool lazyNumbers{};
+            //! Keep the strings with escapes as written, decoded when first read (see JsonString::FromEscaped).
+            bool lazyUnescape{};
+        };
+
         //! @copybrief Parse
         //! @param input the text to parse.
         //! @param copyData copy the input to an internal buffer if true, keeps a reference otherwise.
         //! @param checkFinal ensure that there is only space chars after the end of the json.
+        //! @param lazyNumbers keep the short number literals as written, converted when read (see Number::FromToken).
         //! @return A Json if the parse success, std::nullopt otherwise.
-        static std::expected<Json, ThothError> ParseText(std::string_view input, bool copyData = true, bool checkFinal = true);
+        static std::expected<Json, ThothError> ParseText(
+            std::string_view input, bool copyData = true, bool checkFinal = true, bool lazyNumbers = false);
+
+        //! @copybrief Parse
+        //! @par Example
+        //! @code{.cpp}
+        //! auto json{ Json::ParseText(html, { .lazyUnescape = true }) };
+        //! @endcode
+        static std::expected<Json, ThothError> ParseText(std::string_view input, const ParseOptions& options);
 
 
 #pragma region Get Functions
@@ -240,6 +282,43 @@ namespace Thoth::NJson {
         //! @}
 #pragma endregion
 
+#pragma region Parallel Functions
+        //! @{
+        //! @name Parallel Functions
+        //! Same as the Search Functions, the children split in contiguous chunks read on different threads.
+        //! The callable is called concurrently, each child by a single thread, so it must be safe to call so.
+        //! The results are as the sequential ones, in the order of the children; the first exception thrown is
+        //! rethrown once every thread is done.
+        //!
+        //! @par Example
+        //! @code{.cpp}
+        //! auto isActive{ [](const Json& user) { return user.GetCopyOrNull("active") == Json{ true }; } };
+        //!
+        //! auto active{ users.ParallelFilter(isActive) };
+        //! auto firstActive{ users.ParallelSearch(isActive, { .threads = 4 }) };
+        //! @endcode
+
+        //! @brief Same as Search: the first child in order that matches the predicate, or std::nullopt if no matches.
+        template<class Pred = PredicatePointer> requires std::predicate<Pred, Json>
+        OptRefValWrapper ParallelSearch(Pred&& pred, const ParallelOptions& options = {});
+        //! @copybrief ParallelSearch
+        template<class Pred = PredicatePointer> requires std::predicate<Pred, Json>
+        [[nodiscard]] OptCRefValWrapper ParallelSearch(Pred&& pred, const ParallelOptions& options = {}) const;
+
+        //! @brief An Array with copies of the childs that match the predicate, in order, or std::nullopt if this
+        //! isn't an Object or Array.
+        template<class Pred = PredicatePointer> requires std::predicate<Pred, Json>
+        [[nodiscard]] OptValWrapper ParallelFilter(Pred&& pred, const ParallelOptions& options = {}) const;
+
+        //! @brief An Array with the result of the callable on every child, in order, or std::nullopt if this isn't
+        //! an Object or Array.
+        template<class Fn>
+            requires std::invocable<Fn&, const Json&> && std::constructible_from<Json, std::invoke_result_t<Fn&, const Json&>>
+        [[nodiscard]] OptValWrapper ParallelTransform(Fn&& fn, const ParallelOptions& options = {}) const;
+
+        //! @}
+#pragma endregion
+
 
         //! @brief convenient call to std::visit() on m_value.
         template<class Callable>
@@ -254,6 +333,29 @@ namespace Thoth::NJson {
 
     inline static constexpr Null NullV{};
     inline static Json NullJ{};
+
+
+    //! @brief A document that can't be changed and its @ref Json::Hash, computed once: a key of a cache.
+    //!
+    //! Compared by their hashes first, the trees only walked when they match.
+    //!
+    //! @par Example
+    //! @code{.cpp}
+    //! std::unordered_map<HashedJson, Response> cache;
+    //! auto [it, inserted]{ cache.try_emplace(HashedJson{ *Json::Parse(body) }) };
+    //! @endcode
+    struct HashedJson {
+        explicit HashedJson(Json json);
+
+        [[nodiscard]] const Json& AsJson() const noexcept;
+        [[nodiscard]] size_t Hash() const noexcept;
+
+        [[nodiscard]] bool operator==(const HashedJson& other) const;
+
+    private:
+        Json m_json;
+        size_t m_hash;
+    };
 }
 
 
@@ -1,6 +1,16 @@
 #pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <charconv>
+#include <cmath>
+#include <exception>
 #include <format>
+#include <functional>
 #include <ranges>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include <Thoth/ThothError.hpp>
 #include <Thoth/Utils/LastMatchVariant.hpp>
@@ -166,6 +176,21 @@ namespace Thoth::NJson {
 
 
 
+    template<Thoth::String::Base64AlphabetEnum Alphabet>
+    Json Json::FromBytes(const std::string_view bytes) {
+        return Json{ Thoth::String::Base64Viewer<Alphabet>::Encode(bytes) };
+    }
+
+    template<Thoth::String::Base64AlphabetEnum Alphabet>
+    std::optional<std::string> Json::EnsureBytes() const {
+        const auto str{ EnsureRef<String>() };
+        if (!str)
+            return std::nullopt;
+
+        return Thoth::String::Base64Viewer<Alphabet>::TryDecode((*str)->AsView());
+    }
+
+
     template<class Callable>
     constexpr decltype(auto) Json::Visit(Callable&& callable) {
         return std::visit(std::forward<Callable>(callable), m_value);
@@ -187,7 +212,7 @@ namespace Thoth::NJson {
                 return expr;                                   \
     }                                                          \
     if (IsOf<Object>()) {                                      \
-        for (declaration : *As<Object>() | std::views::values) \
+        for (declaration : As<Object>()->Values())             \
             if (std::invoke(pred, obj))                        \
                 return expr;                                   \
     }                                                          \
@@ -252,6 +277,158 @@ namespace Thoth::NJson {
 #pragma pop_macro("RETURN_IF_MATCH")
 #pragma endregion
 
+
+#pragma region Parallel Functions
+
+    namespace details_ {
+        //! The chunks to split `count` children into, 1 to read them all on the calling thread.
+        size_t ParallelChunkCount(size_t count, const ParallelOptions& options);
+
+        //! Calls `fn(chunk, begin, end)` on the `chunks` contiguous ranges of [0, count), the first one on the
+        //! calling thread, and rethrows the first exception once all are done.
+        template<class Fn>
+        void ForEachChunk(const size_t count, const size_t chunks, Fn&& fn) {
+            if (chunks <= 1) {
+                fn(size_t{}, size_t{}, count);
+                return;
+            }
+
+            std::vector<std::exception_ptr> errors(chunks);
+            const auto run{ [&](const size_t chunk) {
+                try {
+                    fn(chunk, count * chunk / chunks, count * (chunk + 1) / chunks);
+                } catch (...) {
+                    errors[chunk] = std::current_exception();
+                }
+            } };
+
+            {
+                std::vector<std::jthread> workers;
+                workers.reserve(chunks - 1);
+                for (size_t chunk{ 1 }; chunk < chunks; ++chunk)
+                    workers.emplace_back(run, chunk);
+
+                run(0);
+            }
+
+            for (const auto& error : errors)
+                if (error)
+                    std::rethrow_exception(error);
+        }
+
+        //! The index of the first child that matches, or the count of children if none.
+        template<class Children, class Pred>
+        size_t ParallelFindFirst(Children&& children, Pred& pred, const ParallelOptions& options) {
+            const size_t count{ std::ranges::size(children) };
+            std::atomic<size_t> first{ count };
+
+            // A chunk stops once an earlier one matched, the lowest match always wins.
+            ForEachChunk(count, ParallelChunkCount(count, options), [&](size_t, const size_t begin, const size_t end) {
+                for (size_t i{ begin }; i < end && i < first.load(std::memory_order_relaxed); ++i) {
+                    if (!std::invoke(pred, std::as_const(children[i])))
+                        continue;
+
+                    size_t current{ first.load(std::memory_order_relaxed) };
+                    while (i < current && !first.compare_exchange_weak(current, i, std::memory_order_relaxed)) {}
+                    return;
+                }
+            });
+
+            return first.load();
+        }
+
+        template<class Children, class Pred>
+        Array ParallelFilter(Children&& children, Pred& pred, const ParallelOptions& options) {
+            const size_t count{ std::ranges::size(children) };
+            const size_t chunks{ ParallelChunkCount(count, options) };
+
+            std::vector<Array> parts(chunks);
+            ForEachChunk(count, chunks, [&](const size_t chunk, const size_t begin, const size_t end) {
+                for (size_t i{ begin }; i < end; ++i)
+                    if (std::invoke(pred, std::as_const(children[i])))
+                        parts[chunk].push_back(children[i]);
+            });
+
+            if (chunks == 1)
+                return std::move(parts.front());
+
+            size_t size{};
+            for (const auto& part : parts)
+                size += part.size();
+
+            Array res;
+            res.reserve(size);
+            for (auto& part : parts)
+                res.insert(res.end(), std::make_move_iterator(part.begin()), std::make_move_iterator(part.end()));
+
+            return res;
+        }
+
+        template<class Children, class Fn>
+        Array ParallelTransform(Children&& children, Fn& fn, const ParallelOptions& options) {
+            const size_t count{ std::ranges::size(children) };
+
+            Array res(count);
+            ForEachChunk(count, ParallelChunkCount(count, options), [&](size_t, const size_t begin, const size_t end) {
+                for (size_t i{ begin }; i < end; ++i)
+                    res[i] = Json{ std::invoke(fn, std::as_const(children[i])) };
+            });
+
+            return res;
+        }
+    }
+
+
+    template<class Pred> requires std::predicate<Pred, Json>
+    OptRefValWrapper Json::ParallelSearch(Pred&& pred, const ParallelOptions& options) {
+        if (IsOf<Array>()) {
+            auto& arr{ As<Array>() };
+            if (const auto i{ details_::ParallelFindFirst(arr, pred, options) }; i < arr.size())
+                return &arr[i];
+        }
+        if (IsOf<Object>()) {
+            const auto values{ As<Object>()->Values() };
+            if (const auto i{ details_::ParallelFindFirst(values, pred, options) }; i < values.size())
+                return &values[i];
+        }
+        return std::nullopt;
+    }
+    template<class Pred> requires std::predicate<Pred, Json>
+    OptCRefValWrapper Json::ParallelSearch(Pred&& pred, const ParallelOptions& options) const {
+        if (IsOf<Array>()) {
+            const auto& arr{ As<Array>() };
+            if (const auto i{ details_::ParallelFindFirst(arr, pred, options) }; i < arr.size())
+                return &arr[i];
+        }
+        if (IsOf<Object>()) {
+            const auto values{ std::as_const(*As<Object>()).Values() };
+            if (const auto i{ details_::ParallelFindFirst(values, pred, options) }; i < values.size())
+                return &values[i];
+        }
+        return std::nullopt;
+    }
+
+    template<class Pred> requires std::predicate<Pred, Json>
+    OptValWrapper Json::ParallelFilter(Pred&& pred, const ParallelOptions& options) const {
+        if (IsOf<Array>())
+            return Json{ details_::ParallelFilter(As<Array>(), pred, options) };
+        if (IsOf<Object>())
+            return Json{ details_::ParallelFilter(std::as_const(*As<Object>()).Values(), pred, options) };
+        return std::nullopt;
+    }
+
+    template<class Fn>
+        requires std::invocable<Fn&, const Json&> && std::constructible_from<Json, std::invoke_result_t<Fn&, const Json&>>
+    OptValWrapper Json::ParallelTransform(Fn&& fn, const ParallelOptions& options) const {
+        if (IsOf<Array>())
+            return Json{ details_::ParallelTransform(As<Array>(), fn, options) };
+        if (IsOf<Object>())
+            return Json{ details_::ParallelTransform(std::as_const(*As<Object>()).Values(), fn, options) };
+        return std::nullopt;
+    }
+
+#pragma endregion
+
     namespace detail {
         using OutIt =  std::format_context::iterator;
 
@@ -286,6 +463,7 @@ namespace Thoth::NJson {
 
                         if (d < 32) {
                             UPDATE(i);
+                            lastIndex = static_cast<int>(i) + 1;
                             static constexpr auto& k_hex{ Thoth::String::CharSequences::k_hexLower };
 
                             *it++ = '\\';
@@ -388,11 +566,18 @@ namespace Thoth::NJson {
             static constexpr std::string_view k_falseStr{ "false" };
             static constexpr std::string_view k_trueStr{ "true" };
 
-            const auto formatNumber{ [&](const Number num) {
+            const auto formatNumber{ [&](const Number& num) {
                 std::array<char, 330> buf;
 
+                // A literal kept by a lazy parse is written back as it was.
+                if (const auto* token{ std::get_if<NumberToken>(&num) }) {
+                    it = std::ranges::copy(token->Literal().View(), it).out;
+                    return;
+                }
+
                 const auto [ptr, ec]{ std::visit(
                     Hermes::Utils::Overloaded{
+                        [](const NumberToken&) { return std::to_chars_result{}; },
                         [&buf](const double val) {
                             if (!std::isfinite(val))
                                 return std::to_chars_result{ buf.data(), std::errc::result_out_of_range };
@@ -410,17 +595,13 @@ namespace Thoth::NJson {
             } };
 
             const auto formatString{ [&](const String& str) {
-                str.Visit(Hermes::Utils::Overloaded{
-                    // ReSharper disable once CppPassValueParameterByConstReference
-                    [&](const String::RefType ref) {
-                        *it++ = '"';
-                        it = std::ranges::copy(ref.str, it).out; // TODO: StringRef must be a range
-                        *it++ = '"';
-                    },
-                    [&](const String::OwnType& own) {
-                        EscapeJsonString(own, it);
-                    }
-                });
+                // A reference or a string not decoded yet is the text as written in the document, already escaped.
+                if (str.IsRef() || str.IsEscaped()) {
+                    *it++ = '"';
+                    it = std::ranges::copy(str.SourceView(), it).out;
+                    *it++ = '"';
+                } else
+                    EscapeJsonString(str.AsView(), it);
             } };
 
 
@@ -433,17 +614,167 @@ namespace Thoth::NJson {
                 [&](const Null&      ){ it = std::ranges::copy(k_nullStr, it).out; }
             }, static_cast<const Json::Value&>(val));
         }
+
+
+        // RFC 8785 orders the keys by their UTF-16 code units, the map by their UTF-8 bytes. They only disagree on
+        // the chars above U+FFFF (lead bytes 0xF0 to 0xF4): surrogates in UTF-16, before U+E000 (0xEE and 0xEF).
+        // Those lead bytes keep their order, moved between 0xED and 0xEE.
+        inline bool CanonicalKeyLess(const std::string_view lhs, const std::string_view rhs) {
+            const auto [l, r]{ std::ranges::mismatch(lhs, rhs) };
+            if (r == rhs.end()) return false;
+            if (l == lhs.end()) return true;
+
+            constexpr auto rank{ [](const char c) {
+                const auto byte{ static_cast<unsigned char>(c) };
+                return byte >= 0xF0 ? 0xED * 8 + 1 + (byte - 0xF0) : byte * 8;
+            } };
+            return rank(*l) < rank(*r);
+        }
+
+        // As ECMAScript's Number.prototype.toString, as RFC 8785 requires, but the integers are written whole
+        // instead of rounded to a double.
+        template<class OutIt>
+        void FormatCanonicalNumber(const Number& number, OutIt& it) {
+            std::array<char, 32> buf;
+            const auto num{ number.Materialized() };
+
+            if (const auto* val{ std::get_if<int64_t>(&num) }) {
+                it = std::ranges::copy(buf.data(), std::to_chars(buf.data(), buf.data() + buf.size(), *val).ptr, it).out;
+                return;
+            }
+            if (const auto* val{ std::get_if<uint64_t>(&num) }) {
+                it = std::ranges::copy(buf.data(), std::to_chars(buf.data(), buf.data() + buf.size(), *val).ptr, it).out;
+                return;
+            }
+
+            const auto val{ std::get<double>(num) };
+            if (!std::isfinite(val)) {
+                it = std::ranges::copy(std::string_view{ "null" }, it).out;
+                return;
+            }
+            if (val == 0) { // -0 included
+                *it++ = '0';
+                return;
+            }
+
+            // The shortest digits that read back as `val`, then placed where ECMAScript puts them.
+            const auto [end, _]{ std::to_chars(buf.data(), buf.data() + buf.size(), val, std::chars_format::scientific) };
+            std::string_view scientific{ buf.data(), end };
+            if (scientific.starts_with('-')) {
+                *it++ = '-';
+                scientific.remove_prefix(1);
+            }
+
+            const auto ePos{ scientific.find('e') };
+            std::array<char, 24> digitsBuf;
+            size_t count{};
+            for (const char c : scientific.substr(0, ePos))
+                if (c != '.')
+                    digitsBuf[count++] = c;
+
+            auto expText{ scientific.substr(ePos + 1) };
+            if (expText.starts_with('+'))
+                expText.remove_prefix(1);
+            int exp{};
+            std::from_chars(expText.data(), expText.data() + expText.size(), exp);
+
+            const std::string_view digits{ digitsBuf.data(), count };
+            const auto k{ static_cast<int>(count) };
+            const int n{ exp + 1 };
+
+            if (k <= n && n <= 21) {
+                it = std::ranges::copy(digits, it).out;
+                it = std::ranges::fill_n(it, n - k, '0');
+            } else if (0 < n && n <= 21) {
+                it = std::ranges::copy(digits.substr(0, static_cast<size_t>(n)), it).out;
+                *it++ = '.';
+                it = std::ranges::copy(digits.substr(static_cast<size_t>(n)), it).out;
+            } else if (-6 < n && n <= 0) {
+                *it++ = '0';
+                *it++ = '.';
+                it = std::ranges::fill_n(it, -n, '0');
+                it = std::ranges::copy(digits, it).out;
+            } else {
+                *it++ = digits[0];
+                if (k > 1) {
+                    *it++ = '.';
+                    it = std::ranges::copy(digits.substr(1), it).out;
+                }
+                *it++ = 'e';
+                *it++ = n - 1 < 0 ? '-' : '+';
+                it = std::ranges::copy(buf.data(), std::to_chars(buf.data(), buf.data() + buf.size(), std::abs(n - 1)).ptr, it).out;
+            }
+        }
+
+        template<class OutIt>
+        void FormatCanonicalVal(const Json& val, OutIt& it) {
+            using Member = std::pair<std::string_view, const Json*>;
+
+            const auto formatMember{ [&](const Member& member, const bool first) {
+                if (!first) *it++ = ',';
+
+                EscapeJsonString(member.first, it);
+                *it++ = ':';
+                FormatCanonicalVal(*member.second, it);
+            } };
+
+            const auto formatObject{ [&](const JsonObject& obj) {
+                const auto keyLess{ [](const auto& a, const auto& b) { return CanonicalKeyLess(a.first, b.first); } };
+                *it++ = '{';
+
+                if (std::is_sorted(obj.begin(), obj.end(), keyLess)) {
+                    for (bool first{ true }; const auto& [key, value] : obj)
+                        formatMember({ key, &value }, std::exchange(first, false));
+                } else {
+                    std::vector<Member> members;
+                    members.reserve(obj.Size());
+                    for (const auto& [key, value] : obj)
+                        members.emplace_back(key, &value);
+
+                    std::ranges::sort(members, keyLess);
+                    for (bool first{ true }; const auto& member : members)
+                        formatMember(member, std::exchange(first, false));
+                }
+
+                *it++ = '}';
+            } };
+
+            std::visit(Hermes::Utils::Overloaded{
+                // Always decoded: the source may have escaped what RFC 8785 writes as is.
+                [&](const String& str){ EscapeJsonString(str.AsView(), it); },
+                [&](const Number& num){ FormatCanonicalNumber(num, it); },
+                [&](const Bool    bln){ it = std::ranges::copy(std::string_view{ bln ? "true" : "false" }, it).out; },
+                [&](const Object& obj){ formatObject(*obj); },
+                [&](const Array&  arr){
+                    *it++ = '[';
+                    for (bool first{ true }; const auto& elem : arr) {
+                        if (!std::exchange(first, false)) *it++ = ',';
+                        FormatCanonicalVal(elem, it);
+                    }
+                    *it++ = ']';
+                },
+                [&](const Null&      ){ it = std::ranges::copy(std::string_view{ "null" }, it).out; }
+            }, static_cast<const Json::Value&>(val));
+        }
     }
 }
 
 
+//! `{}` writes the document compact, `{:N}` pretty with an indent of N spaces and `{:c}` in the canonical form of
+//! RFC 8785: no spaces, the keys sorted by their UTF-16 code units, the strings escaped as little as possible and
+//! the numbers as ECMAScript writes them (the integers whole).
 template<>
 struct std::formatter<Thoth::NJson::Json> {
     bool pretty{};
+    bool canonical{};
     size_t indentLevel{};
 
     constexpr auto parse(std::format_parse_context& ctx) {
         auto it{ ctx.begin() };
+        if (it != ctx.end() && *it == 'c') {
+            canonical = true;
+            return ++it;
+        }
         if (it != ctx.end() && *it != '}') {
             ++it;
             pretty = true;
@@ -463,7 +794,24 @@ struct std::formatter<Thoth::NJson::Json> {
     auto format(const Thoth::NJson::Json& val, FormatContext& ctx) const {
         auto it{ ctx.out() };
 
-        Thoth::NJson::detail::FormatJsonVal(val, pretty, std::string(indentLevel, ' '), 0, it);
+        if (canonical)
+            Thoth::NJson::detail::FormatCanonicalVal(val, it);
+        else
+            Thoth::NJson::detail::FormatJsonVal(val, pretty, std::string(indentLevel, ' '), 0, it);
         return it;
     }
 };
+
+template<>
+struct std::hash<Thoth::NJson::Json> {
+    size_t operator()(const Thoth::NJson::Json& json) const {
+        return json.Hash();
+    }
+};
+
+template<>
+struct std::hash<Thoth::NJson::HashedJson> {
+    size_t operator()(const Thoth::NJson::HashedJson& json) const noexcept {
+        return json.Hash();
+    }
+};
@@ -0,0 +1,115 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <span>
+#include <string_view>
+
+#include <Thoth/NJson/Json.hpp>
+#include <Thoth/NJson/ErrorDefinitions.hpp>
+
+namespace Thoth::NJson {
+    namespace details_ {
+        //! @brief A string literal as a template argument.
+        template<size_t N>
+        struct FixedString {
+            char chars[N]{};
+
+            // NOLINTNEXTLINE(*-explicit-constructor)
+            consteval FixedString(const char (&str)[N]);
+
+            [[nodiscard]] constexpr std::string_view View() const noexcept;
+        };
+
+        enum class LiteralTokenEnum : uint8_t {
+            Null,
+            True,
+            False,
+            Signed,
+            Unsigned,
+            Float,
+            FloatText, // a double not exactly computed at compile time, converted from its text
+            String,
+            Array,
+            Object
+        };
+
+        //! @brief A value of a @ref JsonLiteral.
+        //!
+        //! In the order of the text: an Array or Object is followed by its `size` children, each member of an
+        //! Object as its String key then its value.
+        struct LiteralToken {
+            LiteralTokenEnum kind{};
+            uint32_t size{};  // String, FloatText: the chars in the text. Array, Object: the children.
+            uint64_t value{}; // Signed, Unsigned, Float: the bits of the number. String, FloatText: the offset in the text.
+        };
+
+        template<size_t TokenCapacity, size_t TextCapacity>
+        struct LiteralTokens {
+            std::array<LiteralToken, TokenCapacity> tokens{};
+            std::array<char, TextCapacity> text{};
+            size_t tokenCount{};
+            size_t textSize{};
+        };
+
+        //! @brief Validates `input` as @ref Json::Parse does and tokenizes it, the strings decoded and the
+        //! numbers converted.
+        template<size_t TokenCapacity, size_t TextCapacity>
+        constexpr std::expected<LiteralTokens<TokenCapacity, TextCapacity>, JsonParseError>
+            TokenizeJson(std::string_view input);
+
+        Json BuildJson(std::span<const LiteralToken> tokens, std::string_view text);
+    }
+
+    //! @brief A JSON document validated and tokenized at compile time, made by @ref operator""_json.
+    //!
+    //! The text is not parsed at all at run time: converting it to @ref Json only builds the nodes, each array
+    //! and object allocated once at its final size. The strings are already decoded and the longer ones are
+    //! referenced, not copied; the numbers are already converted.
+    //!
+    //! It lives in static storage, as its strings are referenced by the documents built from it, so it can't be
+    //! copied.
+    //!
+    //! @par Example
+    //! @code{.cpp}
+    //! using namespace Thoth::NJson::Literals;
+    //!
+    //! Json config{ R"({"retries": 3, "hosts": ["a.example", "b.example"]})"_json };
+    //! Json broken{ R"({"retries": 3,})"_json }; // doesn't compile
+    //! @endcode
+    template<size_t TokenCount, size_t TextSize>
+    struct JsonLiteral {
+        template<size_t TokenCapacity, size_t TextCapacity>
+        explicit consteval JsonLiteral(const details_::LiteralTokens<TokenCapacity, TextCapacity>& tokens);
+
+        JsonLiteral(const JsonLiteral&) = delete;
+        JsonLiteral& operator=(const JsonLiteral&) = delete;
+
+        //! @brief Builds the document, a new one each call.
+        [[nodiscard]] Json ToJson() const;
+
+        // NOLINTNEXTLINE(*-explicit-constructor)
+        operator Json() const;
+
+    private:
+        std::array<details_::LiteralToken, TokenCount> m_tokens{};
+        std::array<char, TextSize> m_text{};
+    };
+
+    namespace details_ {
+        template<FixedString Text>
+        consteval auto MakeJsonLiteral();
+
+        template<FixedString Text>
+        inline constexpr auto k_jsonLiteral{ MakeJsonLiteral<Text>() };
+    }
+
+    inline namespace Literals {
+        //! @brief The @ref JsonLiteral of the text, a malformed one doesn't compile.
+        template<details_::FixedString Text>
+        consteval const auto& operator""_json();
+    }
+}
+
+#include <Thoth/NJson/JsonLiteral.tpp>
@@ -0,0 +1,322 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include <Thoth/String/UnicodeViewer.hpp>
+
+namespace Thoth::NJson {
+#pragma region FixedString
+
+    template<size_t N>
+    consteval details_::FixedString<N>::FixedString(const char (&str)[N]) {
+        std::ranges::copy(str, chars);
+    }
+
+    template<size_t N>
+    constexpr std::string_view details_::FixedString<N>::View() const noexcept {
+        return { chars, N - 1 };
+    }
+
+#pragma endregion
+
+
+#pragma region Tokenizer
+
+    namespace details_ {
+        template<size_t TokenCapacity, size_t TextCapacity>
+        struct LiteralParser_ {
+            std::string_view input;
+            size_t pos{};
+            LiteralTokens<TokenCapacity, TextCapacity> out{};
+
+            [[nodiscard]] constexpr JsonParseError Error() const {
+                return { pos, pos < input.size() ? input[pos] : '\0' };
+            }
+
+            constexpr void SkipSpaces() {
+                while (pos < input.size() && (input[pos] == ' ' || input[pos] == '\t' || input[pos] == '\n' || input[pos] == '\r'))
+                    ++pos;
+            }
+
+            constexpr bool Consume(const char c) {
+                if (pos >= input.size() || input[pos] != c)
+                    return false;
+
+                ++pos;
+                return true;
+            }
+
+            constexpr bool Push(const LiteralToken& token) {
+                if (out.tokenCount == TokenCapacity)
+                    return false;
+
+                out.tokens[out.tokenCount++] = token;
+                return true;
+            }
+
+            constexpr bool ParseValue() {
+                if (pos >= input.size())
+                    return false;
+
+                switch (input[pos]) {
+                    case '"': return ParseString();
+                    case '[': return ParseContainer(']', false);
+                    case '{': return ParseContainer('}', true);
+                    case 't': return ParseWord("true",  LiteralTokenEnum::True);
+                    case 'f': return ParseWord("false", LiteralTokenEnum::False);
+                    case 'n': return ParseWord("null",  LiteralTokenEnum::Null);
+                    default:  return ParseNumber();
+                }
+            }
+
+            constexpr bool ParseWord(const std::string_view word, const LiteralTokenEnum kind) {
+                if (!input.substr(pos).starts_with(word))
+                    return false;
+
+                pos += word.size();
+                return Push({ .kind = kind });
+            }
+
+            constexpr bool ParseContainer(const char close, const bool isObject) {
+                const size_t self{ out.tokenCount };
+                if (!Push({ .kind = isObject ? LiteralTokenEnum::Object : LiteralTokenEnum::Array }))
+                    return false;
+
+                ++pos;
+                SkipSpaces();
+
+                uint32_t count{};
+                if (!Consume(close)) {
+                    do {
+                        SkipSpaces();
+
+                        if (isObject) {
+                            if (pos >= input.size() || input[pos] != '"' || !ParseString())
+                                return false;
+
+                            SkipSpaces();
+                            if (!Consume(':'))
+                                return false;
+                            SkipSpaces();
+                        }
+
+                        if (!ParseValue())
+                            return false;
+
+                        ++count;
+                        SkipSpaces();
+                    } while (Consume(','));
+
+                    if (!Consume(close))
+                        return false;
+                }
+
+                out.tokens[self].size = count;
+                return true;
+            }
+
+            constexpr bool ParseString() {
+                const size_t start{ ++pos };
+                while (pos < input.size() && input[pos] != '"')
+                    pos += input[pos] == '\\' ? 2 : 1;
+
+                if (pos >= input.size()) {
+                    pos = input.size();
+                    return false;
+                }
+
+                const auto escaped{ input.substr(start, pos - start) };
+
+                std::u8string utf8;
+                for (const char c : escaped)
+                    utf8.push_back(static_cast<char8_t>(c));
+
+                BufferSink sink{ out.text.data() + out.textSize };
+                if (out.textSize + escaped.size() > TextCapacity
+                    || !Thoth::String::Utf8View::IsValid(utf8)
+                    || !UnescapeJsonString(escaped, sink)) {
+                    pos = start;
+                    return false;
+                }
+                ++pos;
+
+                const auto offset{ out.textSize };
+                out.textSize += sink.size;
+                return Push({ .kind = LiteralTokenEnum::String, .size = static_cast<uint32_t>(sink.size), .value = offset });
+            }
+
+            constexpr bool ParseNumber() {
+                const size_t start{ pos };
+                while (pos < input.size() && ((input[pos] >= '0' && input[pos] <= '9') || std::string_view{ "+-.eE" }.contains(input[pos])))
+                    ++pos;
+
+                const auto text{ input.substr(start, pos - start) };
+                if (!IsNumberLiteral(text)) {
+                    pos = start;
+                    return false;
+                }
+
+                // As Number::TryParse: a '.' or an exponent makes a double, a '-' an int64_t, an uint64_t otherwise.
+                const bool isFloat{ text.find_first_of(".eE") != std::string_view::npos };
+                const bool negative{ text.starts_with('-') };
+
+                if (isFloat) {
+                    if (const auto val{ ExactDouble(text) })
+                        return Push({ .kind = LiteralTokenEnum::Float, .value = std::bit_cast<uint64_t>(*val) });
+
+                    // Converted at run time from its text, kept with a '\0' after it.
+                    if (out.textSize + text.size() + 1 > TextCapacity)
+                        return false;
+
+                    const auto offset{ out.textSize };
+                    std::ranges::copy(text, out.text.begin() + static_cast<ptrdiff_t>(offset));
+                    out.text[offset + text.size()] = '\0';
+                    out.textSize += text.size() + 1;
+
+                    return Push({ .kind = LiteralTokenEnum::FloatText, .size = static_cast<uint32_t>(text.size()), .value = offset });
+                }
+
+                constexpr uint64_t k_max{ std::numeric_limits<uint64_t>::max() };
+                constexpr uint64_t k_minMagnitude{ uint64_t{ 1 } << 63 };
+
+                uint64_t magnitude{};
+                for (const char c : text.substr(negative ? 1 : 0)) {
+                    const auto digit{ static_cast<uint64_t>(c - '0') };
+                    if (magnitude > (k_max - digit) / 10) {
+                        pos = start;
+                        return false;
+                    }
+                    magnitude = magnitude * 10 + digit;
+                }
+
+                if (!negative)
+                    return Push({ .kind = LiteralTokenEnum::Unsigned, .value = magnitude });
+
+                if (magnitude > k_minMagnitude) {
+                    pos = start;
+                    return false;
+                }
+                // The two's complement of the magnitude, read back as int64_t.
+                return Push({ .kind = LiteralTokenEnum::Signed, .value = 0 - magnitude });
+            }
+
+            // The double of `text` when the digits fit in its mantissa and the power of ten is exact: a single
+            // multiplication or division, correctly rounded as std::from_chars would.
+            static constexpr std::optional<double> ExactDouble(std::string_view text) {
+                constexpr uint64_t k_maxMantissa{ uint64_t{ 1 } << 53 };
+                constexpr int k_maxPow{ 22 };
+
+                const bool negative{ text.starts_with('-') };
+                if (negative)
+                    text.remove_prefix(1);
+
+                uint64_t mantissa{};
+                int exponent{};
+                bool fraction{};
+                for (; !text.empty() && text.front() != 'e' && text.front() != 'E'; text.remove_prefix(1)) {
+                    if (text.front() == '.') {
+                        fraction = true;
+                        continue;
+                    }
+
+                    const auto digit{ static_cast<uint64_t>(text.front() - '0') };
+                    if (mantissa > (k_maxMantissa - digit) / 10)
+                        return std::nullopt;
+
+                    mantissa = mantissa * 10 + digit;
+                    exponent -= fraction;
+                }
+
+                if (!text.empty()) {
+                    text.remove_prefix(1);
+                    const bool negativeExp{ text.starts_with('-') };
+                    if (text.starts_with('-') || text.starts_with('+'))
+                        text.remove_prefix(1);
+
+                    int written{};
+                    for (const char c : text) {
+                        if (written > k_maxPow * 10)
+                            return std::nullopt;
+                        written = written * 10 + (c - '0');
+                    }
+                    exponent += negativeExp ? -written : written;
+                }
+
+                if (exponent < -k_maxPow || exponent > k_maxPow)
+                    return std::nullopt;
+
+                double pow{ 1 };
+                for (int i{}; i < (exponent < 0 ? -exponent : exponent); ++i)
+                    pow *= 10;
+
+                auto val{ static_cast<double>(mantissa) };
+                val = exponent < 0 ? val / pow : val * pow;
+                return negative ? -val : val;
+            }
+        };
+
+        template<size_t TokenCapacity, size_t TextCapacity>
+        constexpr std::expected<LiteralTokens<TokenCapacity, TextCapacity>, JsonParseError>
+            TokenizeJson(const std::string_view input) {
+            LiteralParser_<TokenCapacity, TextCapacity> parser{ input };
+
+            parser.SkipSpaces();
+            if (!parser.ParseValue())
+                return std::unexpected{ parser.Error() };
+
+            parser.SkipSpaces();
+            if (parser.pos != input.size())
+                return std::unexpected{ parser.Error() };
+
+            return parser.out;
+        }
+    }
+
+#pragma endregion
+
+
+#pragma region JsonLiteral
+
+    template<size_t TokenCount, size_t TextSize>
+    template<size_t TokenCapacity, size_t TextCapacity>
+    consteval JsonLiteral<TokenCount, TextSize>::JsonLiteral(const details_::LiteralTokens<TokenCapacity, TextCapacity>& tokens) {
+        std::ranges::copy_n(tokens.tokens.begin(), TokenCount, m_tokens.begin());
+        std::ranges::copy_n(tokens.text.begin(), TextSize, m_text.begin());
+    }
+
+    template<size_t TokenCount, size_t TextSize>
+    Json JsonLiteral<TokenCount, TextSize>::ToJson() const {
+        return details_::BuildJson(m_tokens, std::string_view{ m_text.data(), m_text.size() });
+    }
+
+    template<size_t TokenCount, size_t TextSize>
+    JsonLiteral<TokenCount, TextSize>::operator Json() const {
+        return ToJson();
+    }
+
+    template<details_::FixedString Text>
+    consteval auto details_::MakeJsonLiteral() {
+        // No more tokens nor decoded text than chars in the literal (its '\0' included).
+        constexpr size_t k_bound{ sizeof(Text.chars) };
+
+        // First tokenized with the worst case bounds to learn the sizes, as MakeRouteTable does.
+        constexpr auto k_sizes{ [] {
+            const auto tokens{ TokenizeJson<k_bound, k_bound>(Text.View()).value() };
+
+            return std::pair{ tokens.tokenCount, tokens.textSize };
+        }() };
+
+        return JsonLiteral<k_sizes.first, k_sizes.second>{ TokenizeJson<k_bound, k_bound>(Text.View()).value() };
+    }
+
+    template<details_::FixedString Text>
+    consteval const auto& Literals::operator""_json() {
+        return details_::k_jsonLiteral<Text>;
+    }
+
+#pragma endregion
+}
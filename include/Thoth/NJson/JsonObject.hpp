@@ -1,22 +1,27 @@
 #pragma once
 #include <optional>
 #include <format>
+#include <span>
 #include <string>
 #include <vector>
 
-#include <Thoth/Dsa/LinearMap.hpp>
+#include <Thoth/Dsa/SoaLinearMap.hpp>
 
 
 namespace Thoth::NJson {
     using JsonObjKey    = std::string;
     using JsonObjKeyRef = std::string_view;
 
+    //! @brief The members of a JSON object, sorted by key.
+    //! @details The keys and the values are stored apart (@ref Dsa::SoaLinearMap), a lookup only walks the keys.
+    //! Iterating yields `std::pair<const JsonObjKey&, Json&>` by value: bind it as `const auto& [key, val]` or
+    //! `auto [key, val]`, not `auto&`.
     struct JsonObject {
         using JsonValRef = Json&;
 
         using JsonPair    = std::pair<JsonObjKey, Json>;
         using JsonPairRef = std::pair<JsonObjKeyRef, JsonValRef>;
-        using MapType     = Dsa::LinearMap<JsonObjKey, Json>;
+        using MapType     = Dsa::SoaLinearMap<JsonObjKey, Json>;
 
         using IterType   = decltype(MapType{}.begin());
         using CIterType  = decltype(MapType{}.cbegin());
@@ -106,6 +111,11 @@ namespace Thoth::NJson {
         [[nodiscard]] CIterType begin() const { return m_pairs.cbegin(); }
         [[nodiscard]] CIterType end() const   { return m_pairs.cend(); }
 
+        //! @return The values, in the order of their keys.
+        std::span<Json> Values();
+        //! @copydoc Values()
+        [[nodiscard]] std::span<const Json> Values() const;
+
 
 
         //! @brief Clear all keys.
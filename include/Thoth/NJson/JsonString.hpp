@@ -0,0 +1,180 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <Thoth/NJson/StringRef.hpp>
+
+namespace Thoth::NJson {
+    //! @brief The string of a @ref Json, with the interface of `Dsa::Cow<StringRef, std::string>` in 24 bytes.
+    //!
+    //! It is one of:
+    //! - A reference to the parsed text, when the string had no escapes: no copy, the buffer kept alive.
+    //! - Escaped, a reference to parsed text with escapes, decoded once when first read (see @ref FromEscaped).
+    //! - Inline, up to @ref k_inlineCapacity bytes in the node itself, short escaped strings included.
+    //! - Owned, a `std::string` on the heap for longer text given or edited by the user.
+    //!
+    //! A `Cow` holding `StringRef` and `std::string` side by side takes 40 bytes, which made every `Json` 48. Now
+    //! it is 32, and short strings never allocate.
+    //!
+    //! @par Example
+    //! @code{.cpp}
+    //! auto str{ JsonString::FromOwned("short") };  // inline
+    //! str.AsOwned() += " and now long enough";     // moved to the heap
+    //! std::string_view view{ str.AsView() };
+    //! @endcode
+    struct JsonString {
+        using RefType = StringRef;
+        using OwnType = std::string;
+
+        //! The longest string stored in the node itself.
+        static constexpr size_t k_inlineCapacity{ 22 };
+
+        // NOLINTBEGIN(*)
+        JsonString() noexcept;
+        JsonString(const StringRef& ref);
+        //! @brief A copy of `text`, inline if it fits.
+        explicit JsonString(std::string_view text);
+        JsonString(JsonString&& other) noexcept;
+        JsonString(const JsonString& other);
+        // NOLINTEND(*)
+
+        ~JsonString();
+
+        JsonString& operator=(JsonString&& other) noexcept;
+        JsonString& operator=(const JsonString& other);
+
+
+        //! @brief Constructs a JsonString referencing `ref`, sharing its buffer.
+        //!
+        //! Text up to @ref k_inlineCapacity is copied inline instead.
+        static JsonString FromRef(const StringRef& ref);
+        //! @brief Sets the value to a new reference, short text copied inline.
+        JsonString& SetRef(const StringRef& ref);
+
+        //! @brief Constructs a JsonString referencing text still escaped as in a JSON document.
+        //!
+        //! The escapes are only validated: the text is decoded the first time it is read (@ref AsView,
+        //! @ref Visit...), once for the string and all its copies, and a `Json` holding it is formatted without
+        //! decoding at all. Text up to @ref k_inlineCapacity is decoded inline right away.
+        //!
+        //! A const read leaves the string escaped, so it can be read from several threads: the first to finish
+        //! decoding publishes the text, the others use it. Only @ref AsOwned, or the mutable @ref Visit, turn it into
+        //! an owned string and release the parsed buffer.
+        //! @param escaped The text between the quotes, without them.
+        //! @return The string, std::nullopt if an escape is invalid.
+        static std::optional<JsonString> FromEscaped(const StringRef& escaped);
+
+
+        //! @brief Check if the value references a buffer.
+        [[nodiscard]] static bool IsRefType(const JsonString& str) noexcept;
+        //! @brief Check if the value references a buffer.
+        [[nodiscard]] bool IsRef() const noexcept;
+        //! @brief Check if the value is stored in the node itself.
+        [[nodiscard]] bool IsInline() const noexcept;
+        //! @brief Check if the value is still escaped, as given to @ref FromEscaped.
+        [[nodiscard]] bool IsEscaped() const noexcept;
+
+
+        //! @brief Create an owned value, inline if it fits.
+        static JsonString FromOwned(const std::string& own);
+        //! @brief Create an owned value, inline if it fits.
+        static JsonString FromOwned(std::string&& own);
+        //! @brief Set value to an owned copy of `own`, inline if it fits.
+        JsonString& SetOwned(const std::string& own);
+        //! @brief Set value to `own`, inline if it fits.
+        JsonString& SetOwned(std::string&& own);
+
+        //! @brief Moves the value to a heap `std::string` that can be edited.
+        std::string& AsOwned();
+        //! @brief Returns a copy of the value as std::string without modifying it.
+        [[nodiscard]] std::string AsCopy() const;
+
+        //! @brief Returns a reference of the value as StringRef without modifying it.
+        //!
+        //! Only a referenced value keeps its buffer alive through it, the others are only valid as long as this.
+        [[nodiscard]] StringRef AsRef() const;
+        //! @brief The text, whatever the storage, decoding it if needed.
+        [[nodiscard]] std::string_view AsView() const;
+        //! @brief The text as written in the JSON document, escapes included.
+        //! @pre @ref IsRef or @ref IsEscaped.
+        [[nodiscard]] std::string_view SourceView() const noexcept;
+
+        //! @brief Calls `callable` with a StringRef, the inline text as `std::string_view` or the owned `std::string&`.
+        template<class Callable>
+        decltype(auto) Visit(Callable&& callable);
+
+        //! @brief Calls `callable` with a StringRef, the inline text as `std::string_view` or the owned `std::string`.
+        template<class Callable>
+        [[nodiscard]] decltype(auto) Visit(Callable&& callable) const;
+
+        bool operator==(const JsonString& other) const;
+
+    private:
+        enum class KindEnum : uint8_t {
+            Inline,
+            Ref,
+            Owned,
+            Escaped
+        };
+
+        using RefData = std::shared_ptr<const char>;
+
+        //! The parsed text of an Escaped string, shared by its copies, and its decoded text once read.
+        struct EscapedText_ {
+            RefData source;
+            //! Set once by the first read to finish decoding, never changed after.
+            mutable std::atomic<const std::string*> decoded{};
+
+            explicit EscapedText_(RefData source) noexcept;
+            ~EscapedText_();
+        };
+
+        // Inline:  the chars, then their size in the last byte.
+        // Ref:     a `RefData` aliasing the first char, then the size as `uint32_t`.
+        // Escaped: a `RefData` aliasing its `EscapedText_`, then the size as `uint32_t`.
+        // Owned:   a `std::string*`.
+        alignas(RefData) std::byte m_storage[k_inlineCapacity + 1];
+        KindEnum m_kind{ KindEnum::Inline };
+
+        [[nodiscard]] RefData& RefData_() noexcept;
+        [[nodiscard]] const RefData& RefData_() const noexcept;
+        [[nodiscard]] uint32_t RefSize_() const noexcept;
+        [[nodiscard]] std::string* Owned_() const noexcept;
+        [[nodiscard]] const EscapedText_& Escaped_() const noexcept;
+
+        [[nodiscard]] bool IsShared_() const noexcept;
+
+        void SetRef_(RefData data, uint32_t size, KindEnum kind = KindEnum::Ref) noexcept;
+        void SetOwned_(std::string* own) noexcept;
+        void CopySmall_(const char* src, size_t size) noexcept;
+        void SetText_(std::string_view str);
+        void Steal_(JsonString& other) noexcept;
+        void Reset_() noexcept;
+        [[nodiscard]] const std::string& Decoded_() const;
+    };
+
+    namespace details_ {
+        //! @brief Writes chars to a buffer known to be large enough, the decoded text is never longer than the
+        //! escaped one.
+        struct BufferSink {
+            char*  data;
+            size_t size{};
+
+            constexpr void push_back(char c);
+            constexpr void append(std::string_view str);
+        };
+
+        //! @brief Decodes the escapes of a JSON string, appending the text to `out`.
+        //! @param out A `std::string`, a @ref BufferSink or anything with their `push_back` and `append`.
+        //! @return false if an escape is invalid, `out` then holds part of the text.
+        template<class Out>
+        constexpr bool UnescapeJsonString(std::string_view escaped, Out& out);
+    }
+}
+
+#include <Thoth/NJson/JsonString.tpp>
@@ -0,0 +1,353 @@
+#pragma once
+#include <algorithm>
+#include <cstring>
+#include <format>
+#include <limits>
+#include <new>
+#include <utility>
+
+// The members run for every string node parsed, moved or destroyed are defined here to be inlined.
+
+namespace Thoth::NJson {
+    inline JsonString::JsonString() noexcept {
+        m_storage[k_inlineCapacity] = std::byte{};
+    }
+
+    inline JsonString::JsonString(const StringRef& ref) : JsonString{} {
+        SetRef(ref);
+    }
+
+    inline JsonString::JsonString(const std::string_view text) : JsonString{} {
+        SetText_(text);
+    }
+
+    inline JsonString::JsonString(JsonString&& other) noexcept {
+        Steal_(other);
+    }
+
+    inline JsonString::~JsonString() {
+        Reset_();
+    }
+
+    inline JsonString& JsonString::operator=(JsonString&& other) noexcept {
+        if (this != &other) {
+            Reset_();
+            Steal_(other);
+        }
+
+        return *this;
+    }
+
+
+    inline JsonString JsonString::FromRef(const StringRef& ref) {
+        JsonString res;
+        res.SetRef(ref);
+
+        return res;
+    }
+
+    inline JsonString& JsonString::SetRef(const StringRef& ref) {
+        // Copying a few bytes costs less than sharing the buffer, an atomic increment, and reads without going
+        // through a pointer. A reference keeps at most 4 GiB, the size has to fit beside the pointer.
+        if (ref.str.size() <= k_inlineCapacity || ref.str.size() > std::numeric_limits<uint32_t>::max()) {
+            SetText_(ref.str);
+            return *this;
+        }
+
+        Reset_();
+        SetRef_(RefData{ ref.m_data, ref.str.data() }, static_cast<uint32_t>(ref.str.size()));
+        return *this;
+    }
+
+    inline bool JsonString::IsRefType(const JsonString& str) noexcept { return str.IsRef(); }
+
+    inline bool JsonString::IsRef() const noexcept { return m_kind == KindEnum::Ref; }
+
+    inline bool JsonString::IsInline() const noexcept { return m_kind == KindEnum::Inline; }
+
+    inline bool JsonString::IsEscaped() const noexcept { return m_kind == KindEnum::Escaped; }
+
+    inline JsonString JsonString::FromOwned(std::string&& own) {
+        JsonString res;
+        res.SetOwned(std::move(own));
+
+        return res;
+    }
+
+    inline JsonString& JsonString::SetOwned(std::string&& own) {
+        if (own.size() <= k_inlineCapacity)
+            SetText_(own);
+        else if (m_kind == KindEnum::Owned)
+            *Owned_() = std::move(own);
+        else {
+            auto* heap{ new std::string{ std::move(own) } };
+            Reset_();
+            SetOwned_(heap);
+        }
+
+        return *this;
+    }
+
+    inline std::string_view JsonString::AsView() const {
+        switch (m_kind) {
+            case KindEnum::Inline:
+                return { reinterpret_cast<const char*>(m_storage), static_cast<size_t>(m_storage[k_inlineCapacity]) };
+            case KindEnum::Ref:
+                return SourceView();
+            case KindEnum::Escaped:
+                return Decoded_();
+            default:
+                return *Owned_();
+        }
+    }
+
+    inline std::string_view JsonString::SourceView() const noexcept {
+        if (m_kind == KindEnum::Escaped)
+            return { Escaped_().source.get(), RefSize_() };
+
+        return { RefData_().get(), RefSize_() };
+    }
+
+    template<class Callable>
+    decltype(auto) JsonString::Visit(Callable&& callable) {
+        // The callable may edit the text, it needs one of its own.
+        if (m_kind == KindEnum::Escaped)
+            SetText_(Decoded_());
+
+        switch (m_kind) {
+            case KindEnum::Inline: return std::forward<Callable>(callable)(AsView());
+            case KindEnum::Ref:    return std::forward<Callable>(callable)(AsRef());
+            default:               return std::forward<Callable>(callable)(*Owned_());
+        }
+    }
+
+    template<class Callable>
+    decltype(auto) JsonString::Visit(Callable&& callable) const {
+        switch (m_kind) {
+            case KindEnum::Inline:  return std::forward<Callable>(callable)(AsView());
+            case KindEnum::Ref:     return std::forward<Callable>(callable)(AsRef());
+            case KindEnum::Escaped: return std::forward<Callable>(callable)(Decoded_());
+            default:                return std::forward<Callable>(callable)(std::as_const(*Owned_()));
+        }
+    }
+
+
+    inline JsonString::RefData& JsonString::RefData_() noexcept {
+        return *std::launder(reinterpret_cast<RefData*>(m_storage));
+    }
+
+    inline const JsonString::RefData& JsonString::RefData_() const noexcept {
+        return *std::launder(reinterpret_cast<const RefData*>(m_storage));
+    }
+
+    inline uint32_t JsonString::RefSize_() const noexcept {
+        uint32_t res;
+        std::memcpy(&res, m_storage + sizeof(RefData), sizeof(res));
+
+        return res;
+    }
+
+    inline std::string* JsonString::Owned_() const noexcept {
+        std::string* res;
+        std::memcpy(&res, m_storage, sizeof(res));
+
+        return res;
+    }
+
+    inline const JsonString::EscapedText_& JsonString::Escaped_() const noexcept {
+        return *reinterpret_cast<const EscapedText_*>(RefData_().get());
+    }
+
+    inline bool JsonString::IsShared_() const noexcept {
+        return m_kind == KindEnum::Ref || m_kind == KindEnum::Escaped;
+    }
+
+    inline void JsonString::SetRef_(RefData data, const uint32_t size, const KindEnum kind) noexcept {
+        new (m_storage) RefData{ std::move(data) };
+        std::memcpy(m_storage + sizeof(RefData), &size, sizeof(size));
+        m_kind = kind;
+    }
+
+    inline void JsonString::SetOwned_(std::string* own) noexcept {
+        std::memcpy(m_storage, &own, sizeof(own));
+        m_kind = KindEnum::Owned;
+    }
+
+    inline void JsonString::CopySmall_(const char* src, const size_t size) noexcept {
+        // Two fixed size copies overlapping in the middle instead of a call to memmove for any size.
+        const auto copy{ [&]<size_t Size> {
+            char head[Size], tail[Size];
+            std::memcpy(head, src, Size);
+            std::memcpy(tail, src + size - Size, Size);
+            std::memcpy(m_storage, head, Size);
+            std::memcpy(m_storage + size - Size, tail, Size);
+        } };
+
+        if (size >= 16)
+            copy.template operator()<16>();
+        else if (size >= 8)
+            copy.template operator()<8>();
+        else if (size >= 4)
+            copy.template operator()<4>();
+        else if (size > 0) {
+            const char first{ src[0] }, middle{ src[size / 2] }, last{ src[size - 1] };
+            m_storage[0]        = static_cast<std::byte>(first);
+            m_storage[size / 2] = static_cast<std::byte>(middle);
+            m_storage[size - 1] = static_cast<std::byte>(last);
+        }
+    }
+
+    inline void JsonString::SetText_(const std::string_view str) {
+        if (str.size() <= k_inlineCapacity) {
+            // `str` may be in this very string, only an inline one survives `Reset_`.
+            char copy[k_inlineCapacity];
+            const auto* src{ str.data() };
+            if (m_kind != KindEnum::Inline) {
+                std::ranges::copy(str, copy);
+                src = copy;
+                Reset_();
+            }
+
+            CopySmall_(src, str.size());
+            m_storage[k_inlineCapacity] = static_cast<std::byte>(str.size());
+        } else if (m_kind == KindEnum::Owned)
+            Owned_()->assign(str);
+        else {
+            auto* heap{ new std::string{ str } };
+            Reset_();
+            SetOwned_(heap);
+        }
+    }
+
+    inline void JsonString::Steal_(JsonString& other) noexcept {
+        if (other.IsShared_()) {
+            SetRef_(std::move(other.RefData_()), other.RefSize_(), other.m_kind);
+            other.RefData_().~RefData();
+        } else {
+            // Inline chars and the Owned pointer alike are plain bytes.
+            std::memcpy(m_storage, other.m_storage, sizeof(m_storage));
+            m_kind = other.m_kind;
+        }
+
+        other.m_kind = KindEnum::Inline;
+        other.m_storage[k_inlineCapacity] = std::byte{};
+    }
+
+    inline void JsonString::Reset_() noexcept {
+        if (IsShared_())
+            RefData_().~RefData();
+        else if (m_kind == KindEnum::Owned)
+            delete Owned_();
+
+        m_kind = KindEnum::Inline;
+        m_storage[k_inlineCapacity] = std::byte{};
+    }
+
+
+    namespace details_ {
+        constexpr void BufferSink::push_back(const char c) {
+            data[size++] = c;
+        }
+
+        constexpr void BufferSink::append(const std::string_view str) {
+            std::ranges::copy(str, data + size);
+            size += str.size();
+        }
+
+        // Decodes `uXXXX`, or the pair of them of a surrogate, to UTF-8.
+        template<class Out>
+        constexpr bool DecodeUtf16_(std::string_view& s, Out& out) {
+            constexpr auto hex = [](const char c) -> int {
+                if (c >= '0' && c <= '9') return c - '0';
+                if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+                if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+                return -1;
+            };
+
+            auto readU = [&](uint32_t& v) -> bool {
+                if (s.size() < 5 || s[0] != 'u') return false;
+                uint32_t x{};
+                for (int i = 1; i < 5; i++) {
+                    const int h{ hex(s[i]) };
+                    if (h < 0) return false;
+                    x = (x << 4) | static_cast<uint32_t>(h);
+                }
+                v = x;
+                s.remove_prefix(5);
+                return true;
+            };
+
+            uint32_t code;
+            if (!readU(code)) return false;
+
+            // surrogate?
+            if (0xD800 <= code && code <= 0xDBFF) {
+                if (s.empty() || s[0] != '\\') return false;
+                s.remove_prefix(1);
+
+                uint32_t l;
+                if (!readU(l)) return false;
+                if (l < 0xDC00 || l > 0xDFFF) return false;
+                code = 0x10000 + (((code - 0xD800) << 10) | (l - 0xDC00));
+            }
+
+            constexpr auto byte = [](const uint32_t b) { return static_cast<char>(b); };
+            if (code < 0x80) {
+                out.push_back(byte(code));
+            } else if (code < 0x800) {
+                out.push_back(byte(0xC0 | (code >> 6)));
+                out.push_back(byte(0x80 | (code & 63)));
+            } else if (code < 0x10000) {
+                out.push_back(byte(0xE0 | (code >> 12)));
+                out.push_back(byte(0x80 | ((code >> 6) & 63)));
+                out.push_back(byte(0x80 | (code & 63)));
+            } else {
+                out.push_back(byte(0xF0 | (code >> 18)));
+                out.push_back(byte(0x80 | ((code >> 12) & 63)));
+                out.push_back(byte(0x80 | ((code >> 6) & 63)));
+                out.push_back(byte(0x80 | (code & 63)));
+            }
+
+            return true;
+        }
+
+        template<class Out>
+        constexpr bool UnescapeJsonString(std::string_view escaped, Out& out) {
+            while (true) {
+                const size_t pos{ escaped.find('\\') };
+
+                if (pos == std::string_view::npos)
+                    break;
+
+                out.append(escaped.substr(0, pos));
+                escaped.remove_prefix(pos + 1);
+
+                if (escaped.empty())
+                    return false;
+
+                switch (escaped.front()) {
+                    case 'u' : if (!DecodeUtf16_(escaped, out)) return false; break;
+                    case '\\': out.push_back('\\'); escaped.remove_prefix(1);  break;
+                    case '"' : out.push_back('\"'); escaped.remove_prefix(1);  break;
+                    case 'n' : out.push_back('\n'); escaped.remove_prefix(1);  break;
+                    case 'r' : out.push_back('\r'); escaped.remove_prefix(1);  break;
+                    case 't' : out.push_back('\t'); escaped.remove_prefix(1);  break;
+
+                    default: return false;
+                }
+            }
+            out.append(escaped);
+
+            return true;
+        }
+    }
+}
+
+
+template<>
+struct std::formatter<Thoth::NJson::JsonString> : std::formatter<std::string_view> {
+    template<class FormatContext>
+    auto format(const Thoth::NJson::JsonString& str, FormatContext& ctx) const {
+        return std::formatter<std::string_view>::format(str.AsView(), ctx);
+    }
+};
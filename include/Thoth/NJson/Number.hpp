@@ -1,6 +1,9 @@
 #pragma once
+#include <array>
+#include <atomic>
 #include <charconv>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <format>
 #include <limits>
@@ -9,6 +12,59 @@
 #include <variant>
 
 namespace Thoth::NJson {
+    struct Number;
+
+    //! @brief A number literal kept as written, converted when first read.
+    //!
+    //! Small enough to be stored in the @ref Number itself, so it neither allocates nor references the document:
+    //! a literal only uses 15 distinct chars, they are packed two per byte. The first read to finish converting it
+    //! caches the value, through a const reference as well: the cache is published atomically, the token can be
+    //! read from several threads.
+    struct NumberToken {
+        //! The longest literal kept, the longer ones are converted during the parse.
+        static constexpr size_t k_capacity{ 14 };
+
+        //! @brief The literal unpacked to chars.
+        struct Text {
+            std::array<char, k_capacity> chars;
+            uint8_t size;
+
+            [[nodiscard]] constexpr std::string_view View() const noexcept { return { chars.data(), size }; }
+        };
+
+        //! @pre `literal` is a number literal of at most @ref k_capacity chars.
+        explicit NumberToken(std::string_view literal) noexcept;
+        //! @brief Copies the literal, and the value if it was converted.
+        NumberToken(const NumberToken& other) noexcept;
+        NumberToken& operator=(const NumberToken& other) noexcept;
+
+        //! @brief The literal as written.
+        [[nodiscard]] Text Literal() const noexcept;
+
+        //! Compares the literals as written.
+        bool operator==(const NumberToken& other) const noexcept;
+
+    private:
+        friend struct Number;
+
+        enum class CacheEnum : uint8_t {
+            Empty,
+            Writing,
+            I64,
+            UI64,
+            Float
+        };
+
+        // 16 bytes, without alignment: a larger alternative would grow every Number, and Json, by 8.
+        //! The chars as indices in `details_::k_numberChars`, two per byte, padded with 0xF.
+        std::array<uint8_t, k_capacity / 2> m_packed;
+        mutable std::atomic<CacheEnum> m_cache{};
+        //! The value once @ref m_cache is one of the alternatives.
+        mutable std::array<std::byte, sizeof(uint64_t)> m_value{};
+
+        [[nodiscard]] std::optional<Number> Cached_() const noexcept;
+        void Cache_(const Number& value) const noexcept;
+    };
 
     //! @brief JSON number type — holds @c int64_t, @c uint64_t, or @c double.
     //!
@@ -17,9 +73,12 @@ namespace Thoth::NJson {
     //! - A literal with a leading @c '-' → @c int64_t.
     //! - Any other literal → @c uint64_t (preserves the full [0, 2⁶⁴) range).
     //!
+    //! Or, when parsed lazily (see @ref FromToken), a @ref NumberToken converted by the first of the `As*` and
+    //! `Is*` functions to need it, and written back verbatim.
+    //!
     //! Cross-alternative equality (@c int64_t{1} vs @c uint64_t{1} vs @c double{1.0})
     //! is @e not performed — @ref operator== reflects the variant's active alternative.
-    struct Number : std::variant<int64_t, uint64_t, double> {
+    struct Number : std::variant<int64_t, uint64_t, double, NumberToken> {
         using variant::variant;
 
         //! @brief Parses a JSON number literal.
@@ -27,6 +86,24 @@ namespace Thoth::NJson {
         //! @return The parsed @ref Number, or @c std::nullopt on malformed input.
         [[nodiscard]] static std::optional<Number> TryParse(std::string_view str) noexcept;
 
+        //! @brief Validates a JSON number literal and keeps its text, to be converted when read.
+        //!
+        //! For fields only forwarded or compared (ids, timestamps, prices) the conversion is never paid, and
+        //! formatting writes the literal as it was, precision included. A literal longer than
+        //! @ref NumberToken::k_capacity is converted right away, as @ref TryParse.
+        //! @param str Raw number token — no surrounding whitespace.
+        //! @return The @ref Number, or @c std::nullopt on malformed input.
+        [[nodiscard]] static std::optional<Number> FromToken(std::string_view str) noexcept;
+
+        //! @return @c true if the value is a literal not converted yet.
+        [[nodiscard]] bool IsToken() const noexcept;
+
+        //! @brief The value converted to one of the arithmetic alternatives.
+        //!
+        //! A token is converted once, then its value is cached. A literal out of the range of @c double, accepted
+        //! by @ref FromToken, rounds to infinity or zero.
+        [[nodiscard]] Number Materialized() const noexcept;
+
         //! @brief Returns the value as @c int64_t if losslessly representable.
         //!
         //! Succeeds for @c int64_t (exact), @c uint64_t ≤ @c INT64_MAX, and finite
@@ -54,6 +131,15 @@ namespace Thoth::NJson {
 
         friend struct std::formatter<Number>;
     };
+
+    namespace details_ {
+        //! The chars of a number literal, the index of each is how a @ref NumberToken stores it.
+        inline constexpr std::string_view k_numberChars{ "0123456789.-+eE" };
+
+        //! @brief What @ref Number::TryParse accepts: an optional '-', digits with at most one '.', then an
+        //! optional exponent.
+        constexpr bool IsNumberLiteral(std::string_view str) noexcept;
+    }
 }
 
 #include <Thoth/NJson/Number.tpp>
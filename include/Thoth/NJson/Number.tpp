@@ -1,18 +1,53 @@
 #pragma once
+#include <algorithm>
+
+
+namespace Thoth::NJson::details_ {
+    constexpr bool IsNumberLiteral(std::string_view str) noexcept {
+        const auto skipDigits{ [&str] {
+            const auto count{ std::ranges::find_if_not(str, [](const char c) { return c >= '0' && c <= '9'; }) - str.begin() };
+            str.remove_prefix(static_cast<size_t>(count));
+            return count;
+        } };
+
+        if (str.starts_with('-'))
+            str.remove_prefix(1);
+
+        auto digits{ skipDigits() };
+        if (str.starts_with('.')) {
+            str.remove_prefix(1);
+            digits += skipDigits();
+        }
+        if (digits == 0)
+            return false;
+
+        if (str.starts_with('e') || str.starts_with('E')) {
+            str.remove_prefix(1);
+            if (str.starts_with('-') || str.starts_with('+'))
+                str.remove_prefix(1);
+            if (skipDigits() == 0)
+                return false;
+        }
+
+        return str.empty();
+    }
+}
 
 
 template<>
 struct std::formatter<Thoth::NJson::Number> {
     constexpr auto parse(std::format_parse_context& ctx) { return ctx.begin(); }
 
-    //! Outputs the value in its natural format.
+    //! Outputs the value in its natural format, a @ref Thoth::NJson::NumberToken as written.
     //! @note @c double values with no fractional part are written with a trailing
     //! @c ".0" (e.g. @c 1.0 → @c "1.0") to preserve round-trip fidelity through JSON.
     template<class FormatContext>
     auto format(const Thoth::NJson::Number& n, FormatContext& ctx) const{
         auto out{ ctx.out() };
-        std::visit([&]<class T>(const T val) {
-            if constexpr (std::same_as<T, double>) {
+        std::visit([&]<class T>(const T& val) {
+            if constexpr (std::same_as<T, Thoth::NJson::NumberToken>) {
+                out = std::ranges::copy(val.Literal().View(), out).out;
+            } else if constexpr (std::same_as<T, double>) {
                 const auto s{ std::format("{}", val) };
                 out = std::ranges::copy(s, out).out;
                 // Doubles with no fractional part (e.g. "1") must be written as "1.0"
@@ -22,7 +57,7 @@ struct std::formatter<Thoth::NJson::Number> {
             } else {
                 out = std::format_to(out, "{}", val);
             }
-        }, static_cast<const std::variant<int64_t, uint64_t, double>&>(n));
+        }, static_cast<const Thoth::NJson::Number::variant&>(n));
         return out;
     }
 };
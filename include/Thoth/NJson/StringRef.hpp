@@ -24,10 +24,13 @@ namespace Thoth::NJson {
         bool operator==(const StringRef&) const;
 
     private:
-        std::shared_ptr<std::string> m_data;
-        // it will keep the buffer alive despite everything.
+        friend struct JsonString;
+
+        StringRef(std::string_view other, std::shared_ptr<const char> data) noexcept;
+
+        // Aliases the first char of `str`, it will keep the buffer alive despite everything.
         // TODO: FUTURE: `std::shared_ptr<std::string>` causes double allocation, change it later.
-        // ? change to std::pair<std::string_view, const std::shared_ptr<std::string>>?
+        std::shared_ptr<const char> m_data;
     };
 }
 
@@ -1,6 +1,456 @@
 #pragma once
+#include <algorithm>
+#include <array>
+
+#if defined(THOTH_SIMD_SSSE3)
+#include <tmmintrin.h>
+#endif
+
+namespace Thoth::String::details_ {
+    template<Base64AlphabetEnum Alphabet>
+    inline constexpr auto k_base64DecodeTable{ [] {
+        std::array<uint8_t, 256> res{};
+        res.fill(0xFF);
+
+        for (size_t i{}; i < Base64Viewer<Alphabet>::k_alphabet.size(); ++i)
+            res[static_cast<unsigned char>(Base64Viewer<Alphabet>::k_alphabet[i])] = static_cast<uint8_t>(i);
+
+        return res;
+    }() };
+
+    //! Drops the "=" of a padded text, a length that is not a multiple of 4 keeps them and fails later.
+    constexpr std::string_view StripBase64Padding(std::string_view text) noexcept {
+        if (text.size() % 4 == 0)
+            for (int i{}; i < 2 && text.ends_with('='); ++i)
+                text.remove_suffix(1);
+
+        return text;
+    }
+
+    //! Decodes 2 to 4 chars into `out`, false if one is not in the alphabet.
+    template<Base64AlphabetEnum Alphabet>
+    constexpr bool DecodeBase64Group(const std::string_view group, char* out) noexcept {
+        const auto& table{ k_base64DecodeTable<Alphabet> };
+
+        uint32_t acc{};
+        for (size_t i{}; i < 4; ++i) {
+            uint8_t sextet{};
+            if (i < group.size()) {
+                sextet = table[static_cast<unsigned char>(group[i])];
+                if (sextet == 0xFF)
+                    return false;
+            }
+            acc = acc << 6 | sextet;
+        }
+
+        out[0] = static_cast<char>(acc >> 16);
+        if (group.size() > 2) out[1] = static_cast<char>(acc >> 8);
+        if (group.size() > 3) out[2] = static_cast<char>(acc);
+
+        return true;
+    }
+
+#if defined(THOTH_SIMD_SSSE3)
+    // Wojciech Muła, "Base64 encoding with SIMD instructions" and "Base64 decoding with SIMD instructions".
+    // The 6-bit indices are unpacked with two multiplications, then a pshufb picks the offset to the ASCII of each.
+
+    template<Base64AlphabetEnum Alphabet>
+    inline __m128i Base64Offsets128() noexcept {
+        constexpr char c62{ Base64Viewer<Alphabet>::k_alphabet[62] };
+        constexpr char c63{ Base64Viewer<Alphabet>::k_alphabet[63] };
+
+        return _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                             '0' - 52, '0' - 52, '0' - 52, c62 - 62, c63 - 63, 'A', 0, 0);
+    }
+
+    //! 12 bytes, in the low lanes of `in`, into 16 chars.
+    template<Base64AlphabetEnum Alphabet>
+    inline __m128i EncodeBase64Chunk(__m128i in) noexcept {
+        in = _mm_shuffle_epi8(in, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+
+        const auto hi{ _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040)) };
+        const auto lo{ _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010)) };
+        const auto indices{ _mm_or_si128(hi, lo) };
+
+        // 0..25 -> 13, 26..51 -> 0, 52..63 -> 1..12
+        auto reduced{ _mm_subs_epu8(indices, _mm_set1_epi8(51)) };
+        reduced = _mm_or_si128(reduced, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indices), _mm_set1_epi8(13)));
+
+        return _mm_add_epi8(indices, _mm_shuffle_epi8(Base64Offsets128<Alphabet>(), reduced));
+    }
+
+    inline __m128i Base64DecodeLutLo128() noexcept {
+        return _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    }
+    inline __m128i Base64DecodeLutHi128() noexcept {
+        return _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    }
+    inline __m128i Base64DecodeRoll128() noexcept {
+        return _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    }
+
+    //! 16 chars into 12 bytes, in the low lanes of the result. False if one is not in the alphabet.
+    template<Base64AlphabetEnum Alphabet>
+    inline bool DecodeBase64Chunk(__m128i in, __m128i& out) noexcept {
+        if constexpr (Alphabet == Base64AlphabetEnum::Url) {
+            // The tables are built for "+/": those are refused, then "-_" take their place.
+            const auto eqDash{ _mm_cmpeq_epi8(in, _mm_set1_epi8('-')) };
+            const auto eqLow { _mm_cmpeq_epi8(in, _mm_set1_epi8('_')) };
+            const auto taken { _mm_or_si128(_mm_cmpeq_epi8(in, _mm_set1_epi8('+')), _mm_cmpeq_epi8(in, _mm_set1_epi8('/'))) };
+            if (_mm_movemask_epi8(taken) != 0)
+                return false;
+
+            in = _mm_add_epi8(in, _mm_or_si128(_mm_and_si128(eqDash, _mm_set1_epi8('+' - '-')),
+                                               _mm_and_si128(eqLow,  _mm_set1_epi8('/' - '_'))));
+        }
+
+        const auto hiNibbles{ _mm_and_si128(_mm_srli_epi32(in, 4), _mm_set1_epi8(0x0F)) };
+        const auto loNibbles{ _mm_and_si128(in, _mm_set1_epi8(0x0F)) };
+
+        const auto lo{ _mm_shuffle_epi8(Base64DecodeLutLo128(), loNibbles) };
+        const auto hi{ _mm_shuffle_epi8(Base64DecodeLutHi128(), hiNibbles) };
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128())) != 0xFFFF)
+            return false;
+
+        const auto eqSlash{ _mm_cmpeq_epi8(in, _mm_set1_epi8('/')) };
+        const auto values { _mm_add_epi8(in, _mm_shuffle_epi8(Base64DecodeRoll128(), _mm_add_epi8(eqSlash, hiNibbles))) };
+
+        const auto pairs  { _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140)) };
+        const auto packed { _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000)) };
+
+        out = _mm_shuffle_epi8(packed, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+        return true;
+    }
+#endif
+
+#if defined(THOTH_SIMD_AVX2)
+    //! Two @ref EncodeBase64Chunk, 24 bytes into 32 chars.
+    template<Base64AlphabetEnum Alphabet>
+    inline __m256i EncodeBase64Chunk(__m256i in) noexcept {
+        const auto shuffle{ _mm256_broadcastsi128_si256(_mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10)) };
+        in = _mm256_shuffle_epi8(in, shuffle);
+
+        const auto hi{ _mm256_mulhi_epu16(_mm256_and_si256(in, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040)) };
+        const auto lo{ _mm256_mullo_epi16(_mm256_and_si256(in, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010)) };
+        const auto indices{ _mm256_or_si256(hi, lo) };
+
+        auto reduced{ _mm256_subs_epu8(indices, _mm256_set1_epi8(51)) };
+        reduced = _mm256_or_si256(reduced, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices), _mm256_set1_epi8(13)));
+
+        const auto offsets{ _mm256_broadcastsi128_si256(Base64Offsets128<Alphabet>()) };
+        return _mm256_add_epi8(indices, _mm256_shuffle_epi8(offsets, reduced));
+    }
+
+    //! Two @ref DecodeBase64Chunk, 32 chars into 24 contiguous bytes.
+    template<Base64AlphabetEnum Alphabet>
+    inline bool DecodeBase64Chunk(__m256i in, __m256i& out) noexcept {
+        if constexpr (Alphabet == Base64AlphabetEnum::Url) {
+            const auto eqDash{ _mm256_cmpeq_epi8(in, _mm256_set1_epi8('-')) };
+            const auto eqLow { _mm256_cmpeq_epi8(in, _mm256_set1_epi8('_')) };
+            const auto taken { _mm256_or_si256(_mm256_cmpeq_epi8(in, _mm256_set1_epi8('+')), _mm256_cmpeq_epi8(in, _mm256_set1_epi8('/'))) };
+            if (!_mm256_testz_si256(taken, taken))
+                return false;
+
+            in = _mm256_add_epi8(in, _mm256_or_si256(_mm256_and_si256(eqDash, _mm256_set1_epi8('+' - '-')),
+                                                     _mm256_and_si256(eqLow,  _mm256_set1_epi8('/' - '_'))));
+        }
+
+        const auto hiNibbles{ _mm256_and_si256(_mm256_srli_epi32(in, 4), _mm256_set1_epi8(0x0F)) };
+        const auto loNibbles{ _mm256_and_si256(in, _mm256_set1_epi8(0x0F)) };
+
+        const auto lo{ _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(Base64DecodeLutLo128()), loNibbles) };
+        const auto hi{ _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(Base64DecodeLutHi128()), hiNibbles) };
+        if (!_mm256_testz_si256(lo, hi))
+            return false;
+
+        const auto eqSlash{ _mm256_cmpeq_epi8(in, _mm256_set1_epi8('/')) };
+        const auto roll   { _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(Base64DecodeRoll128()), _mm256_add_epi8(eqSlash, hiNibbles)) };
+        const auto values { _mm256_add_epi8(in, roll) };
+
+        const auto pairs  { _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140)) };
+        const auto packed { _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000)) };
+
+        const auto shuffle{ _mm256_broadcastsi128_si256(_mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1)) };
+        out = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(packed, shuffle), _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+        return true;
+    }
+#endif
+}
 
 
 namespace Thoth::String {
+#pragma region Iterators
+    template<Base64AlphabetEnum Alphabet>
+    constexpr Base64Viewer<Alphabet>::Base64Viewer(const std::string_view text) noexcept : m_ref{ text } { }
+
+    template<Base64AlphabetEnum Alphabet>
+    constexpr Base64Viewer<Alphabet>::Iterator::Iterator(const std::string_view text) noexcept
+            : m_rest{ details_::StripBase64Padding(text) } {
+        Fill_();
+    }
+
+    template<Base64AlphabetEnum Alphabet>
+    constexpr void Base64Viewer<Alphabet>::Iterator::Fill_() noexcept {
+        const auto group{ m_rest.substr(0, 4) };
+        m_rest.remove_prefix(group.size());
+        m_idx = 0;
+
+        if (group.size() < 2 || !details_::DecodeBase64Group<Alphabet>(group, m_group)) {
+            m_rest = {};
+            m_size = 0;
+            return;
+        }
+
+        m_size = static_cast<uint8_t>(group.size() - 1);
+    }
+
+    template<Base64AlphabetEnum Alphabet>
+    constexpr char Base64Viewer<Alphabet>::Iterator::operator*() const noexcept {
+        return m_group[m_idx];
+    }
+
+    template<Base64AlphabetEnum Alphabet>
+    constexpr bool Base64Viewer<Alphabet>::Iterator::operator==(std::default_sentinel_t) const noexcept {
+        return m_idx == m_size;
+    }
+
+    template<Base64AlphabetEnum Alphabet>
+    constexpr Base64Viewer<Alphabet>::Iterator& Base64Viewer<Alphabet>::Iterator::operator++() noexcept {
+        if (++m_idx == m_size)
+            Fill_();
+
+        return *this;
+    }
+
+    template<Base64AlphabetEnum Alphabet>
+    constexpr Base64Viewer<Alphabet>::Iterator Base64Viewer<Alphabet>::Iterator::operator++(int) noexcept {
+        auto copy{ *this };
+        ++*this;
+        return copy;
+    }
+
+
+    template<Base64AlphabetEnum Alphabet>
+    constexpr Base64Viewer<Alphabet>::EncodeView::Iterator::Iterator(const std::string_view bytes) noexcept
+            : m_rest{ bytes } { }
+
+    template<Base64AlphabetEnum Alphabet>
+    constexpr char Base64Viewer<Alphabet>::EncodeView::Iterator::operator*() const noexcept {
+        const auto at{ [&](const size_t i) -> uint32_t {
+            return i < m_rest.size() ? static_cast<unsigned char>(m_rest[i]) : 0u;
+        } };
+
+        if (m_slot > m_rest.size())
+            return '=';
+
+        const uint32_t group{ at(0) << 16 | at(1) << 8 | at(2) };
+        return k_alphabet[group >> (18 - 6 * m_slot) & 0x3F];
+    }
+
+    template<Base64AlphabetEnum Alphabet>
+    constexpr bool Base64Viewer<Alphabet>::EncodeView::Iterator::operator==(std::default_sentinel_t) const noexcept {
+        return m_rest.empty();
+    }
+
+    template<Base64AlphabetEnum Alphabet>
+    constexpr Base64Viewer<Alphabet>::EncodeView::Iterator&
+    Base64Viewer<Alphabet>::EncodeView::Iterator::operator++() noexcept {
+        ++m_slot;
+
+        // A group of n < 3 bytes has n + 1 chars, then the padding if any.
+        if (m_slot == 4 || (!k_padded && m_slot > m_rest.size())) {
+            m_rest.remove_prefix(std::min<size_t>(3, m_rest.size()));
+            m_slot = 0;
+        }
+
+        return *this;
+    }
+
+    template<Base64AlphabetEnum Alphabet>
+    constexpr Base64Viewer<Alphabet>::EncodeView::Iterator
+    Base64Viewer<Alphabet>::EncodeView::Iterator::operator++(int) noexcept {
+        auto copy{ *this };
+        ++*this;
+        return copy;
+    }
+#pragma endregion
+
+
+    template<Base64AlphabetEnum Alphabet>
+    constexpr Base64Viewer<Alphabet>::EncodeView Base64Viewer<Alphabet>::Encoded(const std::string_view bytes) noexcept {
+        return EncodeView{ bytes };
+    }
+
+    template<Base64AlphabetEnum Alphabet>
+    constexpr size_t Base64Viewer<Alphabet>::EncodedSize(const size_t size) noexcept {
+        if constexpr (k_padded)
+            return (size + 2) / 3 * 4;
+        else
+            return size / 3 * 4 + (size % 3 == 0 ? 0 : size % 3 + 1);
+    }
+
+    template<Base64AlphabetEnum Alphabet>
+    constexpr size_t Base64Viewer<Alphabet>::MaxDecodedSize(const size_t size) noexcept {
+        return (size + 3) / 4 * 3;
+    }
+
+    template<Base64AlphabetEnum Alphabet>
+    constexpr bool Base64Viewer<Alphabet>::IsValid(const std::string_view text) noexcept {
+        const auto stripped{ details_::StripBase64Padding(text) };
+        if (stripped.size() % 4 == 1)
+            return false;
+
+        return std::ranges::none_of(stripped, [](const char c) {
+            return details_::k_base64DecodeTable<Alphabet>[static_cast<unsigned char>(c)] == 0xFF;
+        });
+    }
+
+    template<Base64AlphabetEnum Alphabet>
+    constexpr std::optional<size_t> Base64Viewer<Alphabet>::Encode(const std::string_view bytes, const std::span<char> out) noexcept {
+        const auto size{ EncodedSize(bytes.size()) };
+        if (out.size() < size)
+            return std::nullopt;
+
+        const auto* in{ bytes.data() };
+        auto* dst{ out.data() };
+        size_t i{};
+
+        if !consteval {
+            // Every load reads 4 bytes past the ones consumed, every store writes past the chars produced: both
+            // stay inside as there are more groups left.
+#if defined(THOTH_SIMD_AVX2)
+            for (; i + 32 <= bytes.size(); i += 24, dst += 32) {
+                const auto chunk{ _mm256_inserti128_si256(
+                    _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i))),
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i + 12)), 1) };
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), details_::EncodeBase64Chunk<Alphabet>(chunk));
+            }
+#endif
+#if defined(THOTH_SIMD_SSSE3)
+            for (; i + 16 <= bytes.size(); i += 12, dst += 16) {
+                const auto chunk{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i)) };
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), details_::EncodeBase64Chunk<Alphabet>(chunk));
+            }
+#endif
+        }
+
+        for (; i + 3 <= bytes.size(); i += 3) {
+            const uint32_t group{ static_cast<uint32_t>(static_cast<unsigned char>(in[i])) << 16
+                                | static_cast<uint32_t>(static_cast<unsigned char>(in[i + 1])) << 8
+                                | static_cast<unsigned char>(in[i + 2]) };
+
+            *dst++ = k_alphabet[group >> 18 & 0x3F];
+            *dst++ = k_alphabet[group >> 12 & 0x3F];
+            *dst++ = k_alphabet[group >>  6 & 0x3F];
+            *dst++ = k_alphabet[group       & 0x3F];
+        }
+
+        if (const auto left{ bytes.size() - i }; left != 0) {
+            const uint32_t group{ static_cast<uint32_t>(static_cast<unsigned char>(in[i])) << 16
+                                | (left == 2 ? static_cast<uint32_t>(static_cast<unsigned char>(in[i + 1])) << 8 : 0u) };
+
+            *dst++ = k_alphabet[group >> 18 & 0x3F];
+            *dst++ = k_alphabet[group >> 12 & 0x3F];
+
+            if (left == 2)
+                *dst++ = k_alphabet[group >> 6 & 0x3F];
+            else if constexpr (k_padded)
+                *dst++ = '=';
+
+            if constexpr (k_padded)
+                *dst++ = '=';
+        }
+
+        return size;
+    }
+
+    template<Base64AlphabetEnum Alphabet>
+    constexpr std::optional<size_t> Base64Viewer<Alphabet>::Decode(const std::string_view text, const std::span<char> out) noexcept {
+        const auto stripped{ details_::StripBase64Padding(text) };
+        const auto left{ stripped.size() % 4 };
+        if (left == 1)
+            return std::nullopt;
+
+        const auto size{ stripped.size() / 4 * 3 + (left == 0 ? 0 : left - 1) };
+        if (out.size() < size)
+            return std::nullopt;
+
+        auto* dst{ out.data() };
+        size_t i{};
+
+        if !consteval {
+            // Every store writes 4 or 8 bytes past the ones produced, inside as more groups are left.
+#if defined(THOTH_SIMD_AVX2)
+            for (; i + 48 <= stripped.size(); i += 32, dst += 24) {
+                const auto chunk{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(stripped.data() + i)) };
+                __m256i decoded;
+                if (!details_::DecodeBase64Chunk<Alphabet>(chunk, decoded))
+                    return std::nullopt;
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), decoded);
+            }
+#endif
+#if defined(THOTH_SIMD_SSSE3)
+            for (; i + 24 <= stripped.size(); i += 16, dst += 12) {
+                const auto chunk{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(stripped.data() + i)) };
+                __m128i decoded;
+                if (!details_::DecodeBase64Chunk<Alphabet>(chunk, decoded))
+                    return std::nullopt;
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), decoded);
+            }
+#endif
+        }
+
+        for (; i + 4 <= stripped.size(); i += 4, dst += 3)
+            if (!details_::DecodeBase64Group<Alphabet>(stripped.substr(i, 4), dst))
+                return std::nullopt;
+
+        if (left != 0 && !details_::DecodeBase64Group<Alphabet>(stripped.substr(i), dst))
+            return std::nullopt;
+
+        return size;
+    }
+
+
+    template<Base64AlphabetEnum Alphabet>
+    void Base64Viewer<Alphabet>::AppendEncoded(std::string& out, const std::string_view bytes) {
+        const auto before{ out.size() };
+        out.resize_and_overwrite(before + EncodedSize(bytes.size()), [&](char* data, const size_t size) {
+            return before + *Encode(bytes, std::span{ data + before, size - before });
+        });
+    }
+
+    template<Base64AlphabetEnum Alphabet>
+    bool Base64Viewer<Alphabet>::AppendDecoded(std::string& out, const std::string_view text) {
+        const auto before{ out.size() };
+        bool valid{};
+
+        out.resize_and_overwrite(before + MaxDecodedSize(text.size()), [&](char* data, const size_t size) {
+            const auto written{ Decode(text, std::span{ data + before, size - before }) };
+            valid = written.has_value();
+
+            return before + written.value_or(0);
+        });
+
+        return valid;
+    }
+
+    template<Base64AlphabetEnum Alphabet>
+    std::string Base64Viewer<Alphabet>::Encode(const std::string_view bytes) {
+        std::string res;
+        AppendEncoded(res, bytes);
+
+        return res;
+    }
+
+    template<Base64AlphabetEnum Alphabet>
+    std::optional<std::string> Base64Viewer<Alphabet>::TryDecode(const std::string_view text) {
+        std::string res;
+        if (!AppendDecoded(res, text))
+            return std::nullopt;
 
-}
\ No newline at end of file
+        return res;
+    }
+}
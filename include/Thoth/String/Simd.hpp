@@ -0,0 +1,60 @@
+#pragma once
+#include <cstddef>
+#include <string_view>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define THOTH_SIMD_SSE2 1
+#if defined(__AVX2__)
+#define THOTH_SIMD_AVX2 1
+#endif
+#if defined(__SSSE3__) || defined(__AVX2__)
+#define THOTH_SIMD_SSSE3 1
+#endif
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define THOTH_SIMD_NEON 1
+#endif
+
+namespace Thoth::String {
+    //! @brief Finds the first of a few bytes known at compile time, 16 bytes per step.
+    //! @details
+    //! Uses SSE2 on x86-64 and NEON on AArch64 (both always available there), a byte loop elsewhere and during
+    //! constant evaluation.
+    //! @tparam Cs The bytes searched.
+    //! @return The index of the first byte of `str` at or after `pos` equal to one of `Cs`, `npos` if none.
+    //!
+    //! @par Example
+    //! @code{.cpp}
+    //! const auto lineEnd{ String::FindFirstOf<'\r', '\n'>(block) };
+    //! @endcode
+    template<char... Cs>
+    constexpr size_t FindFirstOf(std::string_view str, size_t pos = 0) noexcept;
+
+    //! @brief Finds the first byte that is not <a href="https://datatracker.ietf.org/doc/html/rfc3986#section-2.3">
+    //! unreserved</a> (ALPHA, DIGIT, "-", ".", "_" or "~"), the end of a run that percent-encoding copies as is.
+    //! @details
+    //! Classifies 32 bytes per step with AVX2 when the target has it, 16 with SSE2 or NEON, and falls back to a
+    //! table lookup per byte elsewhere and during constant evaluation.
+    //! @return The index of the first byte of `str` at or after `pos` that must be encoded, `npos` if none.
+    //!
+    //! @par Example
+    //! @code{.cpp}
+    //! const auto safe{ String::FindFirstNotUnreserved(segment) };
+    //! out.append(segment.substr(0, safe));
+    //! @endcode
+    constexpr size_t FindFirstNotUnreserved(std::string_view str, size_t pos = 0) noexcept;
+
+    //! @brief Finds the first byte with the high bit set, the end of an ASCII run.
+    //! @details
+    //! Tests 32 bytes per step with AVX2 when the target has it, 16 with SSE2 or NEON, and one byte at a time
+    //! elsewhere and during constant evaluation.
+    //! @return The index of the first byte of `str` at or after `pos` above 0x7F, `npos` if none.
+    //!
+    //! @par Example
+    //! @code{.cpp}
+    //! if (String::FindFirstNonAscii(body) == std::string_view::npos)
+    //!     return body; // nothing to transcode
+    //! @endcode
+    constexpr size_t FindFirstNonAscii(std::string_view str, size_t pos = 0) noexcept;
+}
+
+#include <Thoth/String/Simd.tpp>
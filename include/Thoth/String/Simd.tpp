@@ -0,0 +1,183 @@
+#pragma once
+#include <array>
+#include <bit>
+#include <cstdint>
+
+#if defined(THOTH_SIMD_AVX2)
+#include <immintrin.h>
+#elif defined(THOTH_SIMD_SSE2)
+#include <emmintrin.h>
+#elif defined(THOTH_SIMD_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace Thoth::String::details_ {
+    inline constexpr auto k_unreservedTable{ [] {
+        std::array<bool, 256> res{};
+
+        for (int c{ 'a' }; c <= 'z'; ++c) res[c] = true;
+        for (int c{ 'A' }; c <= 'Z'; ++c) res[c] = true;
+        for (int c{ '0' }; c <= '9'; ++c) res[c] = true;
+        for (const unsigned char c : std::string_view{ "-._~" }) res[c] = true;
+
+        return res;
+    }() };
+
+#if defined(THOTH_SIMD_SSE2)
+    // Signed compares are fine: bytes >= 0x80 are negative, below every range.
+    inline __m128i UnreservedMask(const __m128i chunk) noexcept {
+        const auto lower{ _mm_or_si128(chunk, _mm_set1_epi8(0x20)) };
+        const auto alpha{ _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+                                        _mm_cmplt_epi8(lower, _mm_set1_epi8('z' + 1))) };
+        const auto digit{ _mm_and_si128(_mm_cmpgt_epi8(chunk, _mm_set1_epi8('0' - 1)),
+                                        _mm_cmplt_epi8(chunk, _mm_set1_epi8('9' + 1))) };
+        const auto mark { _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('-')),
+                                                    _mm_cmpeq_epi8(chunk, _mm_set1_epi8('.'))),
+                                       _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('_')),
+                                                    _mm_cmpeq_epi8(chunk, _mm_set1_epi8('~')))) };
+
+        return _mm_or_si128(_mm_or_si128(alpha, digit), mark);
+    }
+#endif
+#if defined(THOTH_SIMD_AVX2)
+    inline __m256i UnreservedMask(const __m256i chunk) noexcept {
+        const auto lower{ _mm256_or_si256(chunk, _mm256_set1_epi8(0x20)) };
+        const auto alpha{ _mm256_and_si256(_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)),
+                                           _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), lower)) };
+        const auto digit{ _mm256_and_si256(_mm256_cmpgt_epi8(chunk, _mm256_set1_epi8('0' - 1)),
+                                           _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), chunk)) };
+        const auto mark { _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('-')),
+                                                          _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('.'))),
+                                          _mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('_')),
+                                                          _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('~')))) };
+
+        return _mm256_or_si256(_mm256_or_si256(alpha, digit), mark);
+    }
+#endif
+}
+
+
+namespace Thoth::String {
+    template<char... Cs>
+    constexpr size_t FindFirstOf(const std::string_view str, size_t pos) noexcept {
+        static_assert(sizeof...(Cs) >= 1, "At least 1 byte must be searched.");
+
+        if !consteval {
+            const auto* data{ str.data() };
+#if defined(THOTH_SIMD_SSE2)
+            for (; pos + 16 <= str.size(); pos += 16) {
+                const auto chunk{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos)) };
+
+                auto hits{ _mm_setzero_si128() };
+                ((hits = _mm_or_si128(hits, _mm_cmpeq_epi8(chunk, _mm_set1_epi8(Cs)))), ...);
+
+                if (const auto mask{ static_cast<uint32_t>(_mm_movemask_epi8(hits)) }; mask != 0)
+                    return pos + static_cast<size_t>(std::countr_zero(mask));
+            }
+#elif defined(THOTH_SIMD_NEON)
+            for (; pos + 16 <= str.size(); pos += 16) {
+                const auto chunk{ vld1q_u8(reinterpret_cast<const uint8_t*>(data + pos)) };
+
+                auto hits{ vdupq_n_u8(0) };
+                ((hits = vorrq_u8(hits, vceqq_u8(chunk, vdupq_n_u8(static_cast<uint8_t>(Cs))))), ...);
+
+                // Narrowing by 4 leaves one nibble per byte in a 64-bit mask.
+                const auto mask{ vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(hits), 4)), 0) };
+                if (mask != 0)
+                    return pos + static_cast<size_t>(std::countr_zero(mask)) / 4;
+            }
+#endif
+        }
+
+        for (; pos < str.size(); ++pos)
+            if (((str[pos] == Cs) || ...))
+                return pos;
+
+        return std::string_view::npos;
+    }
+
+    constexpr size_t FindFirstNotUnreserved(const std::string_view str, size_t pos) noexcept {
+        if !consteval {
+            const auto* data{ str.data() };
+#if defined(THOTH_SIMD_AVX2)
+            for (; pos + 32 <= str.size(); pos += 32) {
+                const auto chunk{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos)) };
+                const auto mask { ~static_cast<uint32_t>(_mm256_movemask_epi8(details_::UnreservedMask(chunk))) };
+
+                if (mask != 0)
+                    return pos + static_cast<size_t>(std::countr_zero(mask));
+            }
+#endif
+#if defined(THOTH_SIMD_SSE2)
+            for (; pos + 16 <= str.size(); pos += 16) {
+                const auto chunk{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos)) };
+                const auto mask { ~static_cast<uint32_t>(_mm_movemask_epi8(details_::UnreservedMask(chunk))) & 0xFFFFu };
+
+                if (mask != 0)
+                    return pos + static_cast<size_t>(std::countr_zero(mask));
+            }
+#elif defined(THOTH_SIMD_NEON)
+            for (; pos + 16 <= str.size(); pos += 16) {
+                const auto chunk{ vld1q_u8(reinterpret_cast<const uint8_t*>(data + pos)) };
+                const auto lower{ vorrq_u8(chunk, vdupq_n_u8(0x20)) };
+
+                const auto alpha{ vandq_u8(vcgeq_u8(lower, vdupq_n_u8('a')), vcleq_u8(lower, vdupq_n_u8('z'))) };
+                const auto digit{ vandq_u8(vcgeq_u8(chunk, vdupq_n_u8('0')), vcleq_u8(chunk, vdupq_n_u8('9'))) };
+                const auto mark { vorrq_u8(vorrq_u8(vceqq_u8(chunk, vdupq_n_u8('-')), vceqq_u8(chunk, vdupq_n_u8('.'))),
+                                           vorrq_u8(vceqq_u8(chunk, vdupq_n_u8('_')), vceqq_u8(chunk, vdupq_n_u8('~')))) };
+                const auto miss { vmvnq_u8(vorrq_u8(vorrq_u8(alpha, digit), mark)) };
+
+                const auto mask{ vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(miss), 4)), 0) };
+                if (mask != 0)
+                    return pos + static_cast<size_t>(std::countr_zero(mask)) / 4;
+            }
+#endif
+        }
+
+        for (; pos < str.size(); ++pos)
+            if (!details_::k_unreservedTable[static_cast<unsigned char>(str[pos])])
+                return pos;
+
+        return std::string_view::npos;
+    }
+
+    constexpr size_t FindFirstNonAscii(const std::string_view str, size_t pos) noexcept {
+        if !consteval {
+            const auto* data{ str.data() };
+#if defined(THOTH_SIMD_AVX2)
+            for (; pos + 32 <= str.size(); pos += 32) {
+                const auto chunk{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos)) };
+                const auto mask { static_cast<uint32_t>(_mm256_movemask_epi8(chunk)) };
+
+                if (mask != 0)
+                    return pos + static_cast<size_t>(std::countr_zero(mask));
+            }
+#endif
+#if defined(THOTH_SIMD_SSE2)
+            for (; pos + 16 <= str.size(); pos += 16) {
+                const auto chunk{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos)) };
+                const auto mask { static_cast<uint32_t>(_mm_movemask_epi8(chunk)) };
+
+                if (mask != 0)
+                    return pos + static_cast<size_t>(std::countr_zero(mask));
+            }
+#elif defined(THOTH_SIMD_NEON)
+            for (; pos + 16 <= str.size(); pos += 16) {
+                const auto chunk{ vld1q_u8(reinterpret_cast<const uint8_t*>(data + pos)) };
+                if (vmaxvq_u8(chunk) < 0x80)
+                    continue;
+
+                const auto high{ vreinterpretq_u8_s8(vshrq_n_s8(vreinterpretq_s8_u8(chunk), 7)) };
+                const auto mask{ vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(high), 4)), 0) };
+                return pos + static_cast<size_t>(std::countr_zero(mask)) / 4;
+            }
+#endif
+        }
+
+        for (; pos < str.size(); ++pos)
+            if (static_cast<unsigned char>(str[pos]) >= 0x80)
+                return pos;
+
+        return std::string_view::npos;
+    }
+}
@@ -43,13 +43,32 @@ namespace Thoth::String {
         [[nodiscard]] constexpr std::default_sentinel_t end() noexcept{        return std::default_sentinel_t{}; }
         [[nodiscard]] constexpr std::default_sentinel_t cend() const noexcept{ return std::default_sentinel_t{}; }
 
-        //! @brief Check if a string does not has invalid chars.
+        //! @brief Check if a string does not has invalid chars, the ones the iterator replaces by UnknownChar.
+        //!
+        //! A U+FFFD written as such is valid.
+        //!
+        //! It does not go through the iterator: UTF-8 skips ASCII runs 32 or 16 bytes at a time (see
+        //! @ref FindFirstNonAscii), then each sequence is decoded with a table and no branch on its length.
         [[nodiscard]] static constexpr bool IsValid(StringViewType str);
 
         //! @brief Converts from one Unicode Encoding to another.
+        //!
+        //! The result is allocated once, sized by counting code units, then decoded and checked in a single pass.
+        //! ASCII runs of UTF-8 are widened 16 bytes at a time. An invalid `str` is converted rune by rune instead,
+        //! with every UnknownChar the iterator yields.
         template<UnicodeCharConcept NewCharT>
         static constexpr std::basic_string<NewCharT> ConvertTo(StringViewType str);
     private:
+        //! @return The length of `str` in `NewCharT` counted per code unit, never less than @ref Transcode_ writes.
+        //! Exact unless `str` holds overlong sequences.
+        template<UnicodeCharConcept NewCharT>
+        static constexpr size_t ConvertedSize_(StringViewType str) noexcept;
+
+        //! @brief Writes `str` to `out`, which holds its @ref ConvertedSize_ plus 3 units of slack.
+        //! @return The end of what was written, nullptr if `str` is invalid.
+        template<UnicodeCharConcept NewCharT>
+        static constexpr NewCharT* Transcode_(StringViewType str, NewCharT* out) noexcept;
+
         StringViewType m_ref{};
     };
 
@@ -1,6 +1,226 @@
 #pragma once
 #include <intrin.h>
+#include <algorithm>
+#include <array>
 #include <bit>
+#include <cstdint>
+
+#include <Thoth/String/Simd.hpp>
+
+namespace Thoth::String::details_ {
+    // The runes the iterator does not replace by UnknownChar. Bitwise ands and unsigned ranges keep it branchless.
+    constexpr bool IsValidRune(const Rune rune) noexcept {
+        return (rune <= 0x10FFFF)
+             & (rune - 0xD800 > 0xDFFF - 0xD800)  // isolated surrogates
+             & (rune - 0xFDD0 > 0xFDEF - 0xFDD0)  // reserved noncharacters
+             & ((rune & 0xFFFE) != 0xFFFE);       // U+xFFFE and U+xFFFF
+    }
+
+    template<UnicodeCharConcept CharT>
+    constexpr size_t RuneLength(const Rune rune) noexcept {
+        if constexpr (std::same_as<CharT, char8_t>)
+            return 1 + (rune > 0x7F) + (rune > 0x7FF) + (rune > 0xFFFF);
+        else if constexpr (std::same_as<CharT, char16_t>)
+            return 1 + (rune > 0xFFFF);
+        else
+            return 1;
+    }
+
+    template<UnicodeCharConcept CharT>
+    constexpr CharT* EncodeRune(const Rune rune, CharT* out) noexcept {
+        if constexpr (std::same_as<CharT, char32_t>)
+            *out++ = rune;
+        else if constexpr (std::same_as<CharT, char16_t>) {
+            if (rune > 0xFFFF) {
+                *out++ = static_cast<char16_t>(0xD7C0u + (rune >> 10u));
+                *out++ = static_cast<char16_t>(0xDC00u + (rune & 0x3FFu));
+            } else
+                *out++ = static_cast<char16_t>(rune);
+        } else {
+            constexpr char8_t k_seqMask{ 0b00111111 };
+            constexpr char8_t k_seqMark{ 0b10000000 };
+
+            const int type{ (rune > 0x7F) + (rune > 0x7FF) + (rune > 0xFFFF) };
+
+            if (type == 0) {
+                *out++ = static_cast<char8_t>(rune);
+                return out;
+            }
+
+            *out++ = static_cast<char8_t>((0b11110'000 << (3 - type)) | (rune >> (6 * type)));
+
+            for (int i{ type - 1 }; i >= 0; --i)
+                *out++ = static_cast<char8_t>(k_seqMark | ((rune >> (6 * i)) & k_seqMask));
+        }
+
+        return out;
+    }
+
+    struct DecodedRune {
+        Rune     rune;
+        uint32_t size;   // code units read, at least 1
+        bool     valid;  // false where the iterator yields UnknownChar
+    };
+
+    inline constexpr auto k_utf8Size{ [] {
+        std::array<uint8_t, 256> res{};  // continuation bytes and 0xF8.. stay 0
+
+        for (int b{};     b < 0x80; ++b) res[b] = 1;
+        for (int b{ 0xC0 }; b < 0xE0; ++b) res[b] = 2;
+        for (int b{ 0xE0 }; b < 0xF0; ++b) res[b] = 3;
+        for (int b{ 0xF0 }; b < 0xF8; ++b) res[b] = 4;
+
+        return res;
+    }() };
+
+    // Decodes the UTF-8 sequence at `in`, 4 bytes readable. The length comes from a table and every byte is read, so
+    // that there is no branch on it to mispredict in mixed text.
+    constexpr DecodedRune DecodeRune(const char8_t* in) noexcept {
+        const uint32_t size{ k_utf8Size[in[0]] };
+
+        const uint32_t bits{ static_cast<uint32_t>(in[0] & 0xFF >> size) << 18
+                           | static_cast<uint32_t>(in[1] & 0x3F) << 12
+                           | static_cast<uint32_t>(in[2] & 0x3F) << 6
+                           | static_cast<uint32_t>(in[3] & 0x3F) };
+        const uint32_t notContinuation{ static_cast<uint32_t>(in[1] >> 6 ^ 0b10)
+                                      | static_cast<uint32_t>(in[2] >> 6 ^ 0b10) << 2
+                                      | static_cast<uint32_t>(in[3] >> 6 ^ 0b10) << 4 };
+        const uint32_t checked{ ((1u << 2 * size) >> 2) - 1 };  // 2 bits per continuation byte
+        const Rune     rune{ bits >> (24 - 6 * size) };
+
+        const bool     valid{ static_cast<bool>((size != 0) & ((notContinuation & checked) == 0) & IsValidRune(rune)) };
+
+        return { rune, size + (size == 0), valid };
+    }
+
+    // The same, near the end of `str`: the missing bytes read as 0, which is no continuation byte.
+    constexpr DecodedRune DecodeRune(const std::u8string_view str, const size_t pos) noexcept {
+        if (pos + 4 <= str.size())
+            return DecodeRune(str.data() + pos);
+
+        char8_t padded[4]{};
+        std::ranges::copy(str.substr(pos), padded);
+        return DecodeRune(padded);
+    }
+
+    constexpr DecodedRune DecodeRune(const std::u16string_view str, const size_t pos) noexcept {
+        const Rune first{ str[pos] };
+        if (first - 0xD800 > 0xDBFF - 0xD800) // a lone low surrogate is caught by IsValidRune
+            return { first, 1, IsValidRune(first) };
+
+        //* missing low surrogate
+        if (pos + 1 == str.size() || static_cast<Rune>(str[pos + 1]) - 0xDC00 > 0xDFFF - 0xDC00)
+            return { UnknownChar, 1, false };
+
+        const Rune rune{ 0x10000 + ((first - 0xD800) << 10) + (str[pos + 1] - 0xDC00u) };
+        return { rune, 2, IsValidRune(rune) };
+    }
+
+    constexpr DecodedRune DecodeRune(const std::u32string_view str, const size_t pos) noexcept {
+        return { str[pos], 1, IsValidRune(str[pos]) };
+    }
+
+    constexpr size_t k_asciiBlock{ 16 };
+
+    // The units written past the end by the transcoding of a last rune taking a single one.
+    constexpr size_t k_transcodeSlack{ 3 };
+
+    // The lead and continuation marks of the bytes of 2, 3 and 4 bytes sequences, first byte lowest.
+    constexpr uint32_t k_utf8Marks[]{ 0, 0x80C0, 0x8080E0, 0x808080F0 };
+
+    // The end of the ASCII run at `pos` if the block there is all ASCII, `pos` otherwise. Mixed text is then decoded
+    // a block at a time: a failed check costs once per block, not once per char.
+    inline size_t SkipAscii(const std::u8string_view str, const size_t pos) noexcept {
+        const std::string_view bytes{ reinterpret_cast<const char*>(str.data()), str.size() };
+
+        if (pos + k_asciiBlock > bytes.size()
+                || FindFirstNonAscii(bytes.substr(0, pos + k_asciiBlock), pos) != std::string_view::npos)
+            return pos;
+
+        return std::min(FindFirstNonAscii(bytes, pos + k_asciiBlock), bytes.size());
+    }
+
+    // Zero extends the 16 bytes at `in` into `out` if they are all ASCII.
+    template<class CharT>
+    inline bool WidenAscii(const char8_t* in, CharT* out) noexcept {
+#if defined(THOTH_SIMD_SSE2)
+        const auto chunk{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(in)) };
+        if (_mm_movemask_epi8(chunk) != 0)
+            return false;
+
+        const auto zero{ _mm_setzero_si128() };
+        const auto low { _mm_unpacklo_epi8(chunk, zero) };
+        const auto high{ _mm_unpackhi_epi8(chunk, zero) };
+        auto* dst{ reinterpret_cast<__m128i*>(out) };
+
+        if constexpr (std::same_as<CharT, char16_t>) {
+            _mm_storeu_si128(dst,     low);
+            _mm_storeu_si128(dst + 1, high);
+        } else {
+            _mm_storeu_si128(dst,     _mm_unpacklo_epi16(low, zero));
+            _mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(low, zero));
+            _mm_storeu_si128(dst + 2, _mm_unpacklo_epi16(high, zero));
+            _mm_storeu_si128(dst + 3, _mm_unpackhi_epi16(high, zero));
+        }
+        return true;
+#elif defined(THOTH_SIMD_NEON)
+        const auto chunk{ vld1q_u8(reinterpret_cast<const uint8_t*>(in)) };
+        if (vmaxvq_u8(chunk) >= 0x80)
+            return false;
+
+        const auto low { vmovl_u8(vget_low_u8(chunk)) };
+        const auto high{ vmovl_u8(vget_high_u8(chunk)) };
+
+        if constexpr (std::same_as<CharT, char16_t>) {
+            vst1q_u16(reinterpret_cast<uint16_t*>(out),     low);
+            vst1q_u16(reinterpret_cast<uint16_t*>(out + 8), high);
+        } else {
+            auto* dst{ reinterpret_cast<uint32_t*>(out) };
+            vst1q_u32(dst,      vmovl_u16(vget_low_u16(low)));
+            vst1q_u32(dst + 4,  vmovl_u16(vget_high_u16(low)));
+            vst1q_u32(dst + 8,  vmovl_u16(vget_low_u16(high)));
+            vst1q_u32(dst + 12, vmovl_u16(vget_high_u16(high)));
+        }
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    // Whether the 16 units at `in` are all ASCII.
+    inline bool IsAsciiBlock(const char16_t* in) noexcept {
+#if defined(THOTH_SIMD_SSE2)
+        const auto both{ _mm_or_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in)),
+                                      _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 8))) };
+        const auto high{ _mm_and_si128(both, _mm_set1_epi16(static_cast<short>(0xFF80))) };
+
+        return _mm_movemask_epi8(_mm_cmpeq_epi16(high, _mm_setzero_si128())) == 0xFFFF;
+#elif defined(THOTH_SIMD_NEON)
+        const auto* units{ reinterpret_cast<const uint16_t*>(in) };
+        return vmaxvq_u16(vorrq_u16(vld1q_u16(units), vld1q_u16(units + 8))) < 0x80;
+#else
+        return false;
+#endif
+    }
+
+    // Narrows the 16 units at `in` into `out` if they are all ASCII.
+    inline bool NarrowAscii(const char16_t* in, char8_t* out) noexcept {
+        if (!IsAsciiBlock(in))
+            return false;
+
+#if defined(THOTH_SIMD_SSE2)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out),
+                         _mm_packus_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in)),
+                                          _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 8))));
+#elif defined(THOTH_SIMD_NEON)
+        const auto* units{ reinterpret_cast<const uint16_t*>(in) };
+        vst1q_u8(reinterpret_cast<uint8_t*>(out),
+                 vcombine_u8(vmovn_u16(vld1q_u16(units)), vmovn_u16(vld1q_u16(units + 8))));
+#endif
+        return true;
+    }
+}
+
 
 namespace Thoth::String {
     template<UnicodeCharConcept CharT>
@@ -151,9 +371,25 @@ namespace Thoth::String {
 
     template<UnicodeCharConcept CharT>
     constexpr bool UnicodeViewer<CharT>::IsValid(StringViewType str) {
-        for (const auto& rune : UnicodeViewer{ str })
-            if (rune == UnknownChar)
-                return false;
+        for (size_t i{}; i < str.size();) {
+            if constexpr (std::same_as<CharT, char8_t>) {
+                if !consteval {
+                    if (const auto end{ details_::SkipAscii(str, i) }; end != i) {
+                        i = end;
+                        continue;
+                    }
+                }
+            }
+
+            for (const auto stop{ std::min(i + details_::k_asciiBlock, str.size()) }; i < stop;) {
+                const auto decoded{ details_::DecodeRune(str, i) };
+                if (!decoded.valid)
+                    return false;
+
+                i += decoded.size;
+            }
+        }
+
         return true;
     }
 
@@ -162,43 +398,133 @@ namespace Thoth::String {
     constexpr std::basic_string<NewCharT> UnicodeViewer<CharT>::ConvertTo(StringViewType str) {
         if constexpr (std::same_as<CharT, NewCharT>)
             return { str.data(), str.size() };
-        if constexpr (std::same_as<NewCharT, char32_t>) {
-            std::u32string res;
-            for (auto c : UnicodeViewer{ str })
-                res += c;
+        else {
+            std::basic_string<NewCharT> res;
+            const auto size{ ConvertedSize_<NewCharT>(str) };
+            bool valid{};
+
+            res.resize_and_overwrite(size + details_::k_transcodeSlack, [&](NewCharT* data, const size_t) -> size_t {
+                const auto* end{ Transcode_(str, data) };
+                valid = end != nullptr;
+                return valid ? static_cast<size_t>(end - data) : 0;
+            });
+
+            if (valid)
+                return res;
+
+            for (const auto rune : UnicodeViewer{ str }) {
+                NewCharT units[4];
+                res.append(units, details_::EncodeRune(rune, units));
+            }
+
             return res;
         }
+    }
 
-        std::basic_string<NewCharT> res;
-        UnicodeViewer view{ str };
+    template<UnicodeCharConcept CharT>
+    template<UnicodeCharConcept NewCharT>
+    constexpr size_t UnicodeViewer<CharT>::ConvertedSize_(StringViewType str) noexcept {
+        size_t size{};
 
-        for (auto rune : view) {
-            if constexpr (std::same_as<NewCharT, char16_t>) {
-                if (rune > 0xFFFF) {
-                    res.push_back(static_cast<NewCharT>(0xD7C0u + (rune >> 10u)));
-                    res.push_back(static_cast<NewCharT>(0xDC00u + (rune & 0x3FFu)));
-                } else {
-                    res.push_back(static_cast<NewCharT>(rune));
+        if constexpr (std::same_as<CharT, char32_t>) {
+            for (const Rune rune : str)
+                size += details_::RuneLength<NewCharT>(rune);
+        } else if constexpr (std::same_as<CharT, char16_t>) {
+            for (size_t i{}; i < str.size();) {
+                if constexpr (std::same_as<NewCharT, char8_t>) {
+                    if !consteval {
+                        if (i + details_::k_asciiBlock <= str.size() && details_::IsAsciiBlock(str.data() + i)) {
+                            size += details_::k_asciiBlock;
+                            i    += details_::k_asciiBlock;
+                            continue;
+                        }
+                    }
                 }
-            } else if constexpr (std::same_as<NewCharT, char8_t>) {
-                constexpr char8_t k_seqMask{ 0b00111111 };
-                constexpr char8_t k_seqMark{ 0b10000000 };
 
-                const int type{ (rune > 0x7F) + (rune > 0x7FF) + (rune > 0xFFFF) };
+                for (const auto stop{ std::min(i + details_::k_asciiBlock, str.size()) }; i < stop; ++i) {
+                    const Rune unit{ str[i] };
+                    const bool surrogate{ unit - 0xD800 <= 0xDFFF - 0xD800 };
 
-                if (type == 0) {
-                    res.push_back(static_cast<char8_t>(rune));
-                    continue;
+                    if constexpr (std::same_as<NewCharT, char8_t>) // 2 bytes per surrogate, 4 per pair
+                        size += details_::RuneLength<char8_t>(unit) - surrogate;
+                    else                                           // a rune per pair
+                        size += unit - 0xDC00 > 0xDFFF - 0xDC00;
+                }
+            }
+        } else {
+            for (size_t i{}; i < str.size();) {
+                if !consteval {
+                    if (const auto end{ details_::SkipAscii(str, i) }; end != i) {
+                        size += end - i;
+                        i = end;
+                        continue;
+                    }
+                }
+
+                // a rune per byte but the continuation ones, a pair per 4 bytes sequence
+                for (const auto stop{ std::min(i + details_::k_asciiBlock, str.size()) }; i < stop; ++i) {
+                    size += (str[i] & 0xC0) != 0x80;
+                    if constexpr (std::same_as<NewCharT, char16_t>)
+                        size += str[i] >= 0xF0;
                 }
+            }
+        }
 
-                res.push_back(static_cast<char8_t>(((0b11110'000 << (3 - type)) | (rune >> (6 * type)))));
+        return size;
+    }
 
+    template<UnicodeCharConcept CharT>
+    template<UnicodeCharConcept NewCharT>
+    constexpr NewCharT* UnicodeViewer<CharT>::Transcode_(StringViewType str, NewCharT* out) noexcept {
+        for (size_t i{}; i < str.size();) {
+            if !consteval {
+                bool ascii{};
+
+                if constexpr (std::same_as<CharT, char8_t>)
+                    ascii = i + details_::k_asciiBlock <= str.size() && details_::WidenAscii(str.data() + i, out);
+                else if constexpr (std::same_as<CharT, char16_t> && std::same_as<NewCharT, char8_t>)
+                    ascii = i + details_::k_asciiBlock <= str.size() && details_::NarrowAscii(str.data() + i, out);
+
+                if (ascii) {
+                    i   += details_::k_asciiBlock;
+                    out += details_::k_asciiBlock;
+                    continue;
+                }
+            }
 
-                for (int i{ type - 1 }; i >= 0; --i)
-                    res.push_back(static_cast<char8_t>(k_seqMark | ((rune >> (6 * i)) & k_seqMask)));
+            for (const auto stop{ std::min(i + details_::k_asciiBlock, str.size()) }; i < stop;) {
+                const auto decoded{ details_::DecodeRune(str, i) };
+                if (!decoded.valid)
+                    return nullptr;
+
+                // Every unit a rune may take is written and only the needed ones kept, there is no branch on the rune
+                // size. The extra ones land at most on the slack ConvertTo adds.
+                const Rune rune{ decoded.rune };
+
+                if constexpr (std::same_as<NewCharT, char8_t>) {
+                    const auto type{ static_cast<uint32_t>(details_::RuneLength<char8_t>(rune)) - 1 };
+                    const uint32_t groups{ rune >> 18 | (rune >> 12 & 0x3F) << 8
+                                         | (rune >> 6 & 0x3F) << 16 | (rune & 0x3F) << 24 };
+                    const uint32_t bytes{ type == 0 ? rune : groups >> 8 * (3 - type) | details_::k_utf8Marks[type] };
+
+                    out[0] = static_cast<char8_t>(bytes);
+                    out[1] = static_cast<char8_t>(bytes >> 8);
+                    out[2] = static_cast<char8_t>(bytes >> 16);
+                    out[3] = static_cast<char8_t>(bytes >> 24);
+                    out += type + 1;
+                } else if constexpr (std::same_as<NewCharT, char16_t>) {
+                    const bool pair{ rune > 0xFFFF };
+
+                    out[0] = static_cast<char16_t>(pair ? 0xD7C0u + (rune >> 10u) : rune);
+                    out[1] = static_cast<char16_t>(0xDC00u + (rune & 0x3FFu));
+                    out += 1 + pair;
+                } else
+                    *out++ = rune;
+
+                i += decoded.size;
             }
         }
 
-        return res;
+        return out;
     }
 }
@@ -1,27 +1,60 @@
 #pragma once
+#include <cstdint>
+#include <optional>
+#include <variant>
+
 #include <Thoth/NJson/ErrorDefinitions.hpp>
 #include <Thoth/Http/ErrorDefinitions.hpp>
 
 namespace Thoth {
     struct GenericError {
         std::string error{};
+
+        bool operator==(const GenericError&) const = default;
     };
 
-    using ThothErrorBase = std::variant<
-        NJson::JsonParseError,
-        NJson::JsonGetError,
-        NJson::JsonFindError,
-        NJson::JsonSearchError,
-        NJson::JsonWrongTypeError,
-        Http::UrlParseErrorEnum,
-        Http::ConnectionErrorEnum,
-        Http::MessageParseErrorEnum,
-        GenericError
-    >;
+    //! @brief One of the errors a @ref ThothError can hold.
+    template<class T>
+    concept ThothErrorAlternativeConcept =
+        std::same_as<T, NJson::JsonParseError>
+        || std::same_as<T, NJson::JsonGetError>
+        || std::same_as<T, NJson::JsonFindError>
+        || std::same_as<T, NJson::JsonSearchError>
+        || std::same_as<T, NJson::JsonWrongTypeError>
+        || std::same_as<T, Http::UrlParseErrorEnum>
+        || std::same_as<T, Http::ConnectionErrorEnum>
+        || std::same_as<T, Http::MessageParseErrorEnum>
+        || std::same_as<T, GenericError>;
+
+    //! @brief The error of every Thoth operation, one of the @ref ThothErrorAlternativeConcept types.
+    //!
+    //! It is returned inside `std::expected` through long `and_then` chains, so it is kept at 16 bytes: a tag and
+    //! the value of the cheap errors (the enums, @ref NJson::JsonParseError, @ref NJson::JsonWrongTypeError) inline,
+    //! the ones holding strings or vectors (@ref NJson::JsonGetError, @ref NJson::JsonFindError,
+    //! @ref GenericError) behind an owned pointer. A `std::variant` of them all took 72 bytes.
+    //!
+    //! @par Example
+    //! @code{.cpp}
+    //! ThothError err{ Http::UrlParseErrorEnum::InvalidPort };
+    //! if (err.Is<Http::UrlParseErrorEnum>())
+    //!     std::println("{}", err);
+    //! @endcode
+    struct ThothError {
+        //! @brief An empty @ref NJson::JsonParseError, as the `std::variant` it replaces.
+        constexpr ThothError() noexcept;
+
+        template<class T>
+            requires ThothErrorAlternativeConcept<std::remove_cvref_t<T>>
+        // NOLINTNEXTLINE(*-explicit-constructor)
+        constexpr ThothError(T&& error);
+
+        constexpr ThothError(const ThothError& other);
+        constexpr ThothError(ThothError&& other) noexcept;
+
+        constexpr ~ThothError();
 
-    struct ThothError : ThothErrorBase {
-        using ThothErrorBase::variant;
-        using ThothErrorBase::operator=;
+        constexpr ThothError& operator=(const ThothError& other);
+        constexpr ThothError& operator=(ThothError&& other) noexcept;
 
 
         constexpr static auto FromError();
@@ -33,13 +66,46 @@ namespace Thoth {
         constexpr T As() const;
 
         template<class T>
-        std::optional<T> Ensure() const;
+        constexpr std::optional<T> Ensure() const;
 
+        //! @brief Calls `callable` with the error held, as its own type.
+        template<class Callable>
+        constexpr decltype(auto) Visit(Callable&& callable) const;
 
-        template <class T>
+
+        template <ThothErrorAlternativeConcept T>
         constexpr bool operator==(const T& rhs) const;
 
-        constexpr bool operator==(const ThothError&) const = default;
+        constexpr bool operator==(const ThothError& other) const;
+
+    private:
+        // In the order of the `std::variant` this replaced.
+        enum class KindEnum : uint8_t {
+            JsonParse,
+            JsonGet,
+            JsonFind,
+            JsonSearch,
+            JsonWrongType,
+            UrlParse,
+            Connection,
+            MessageParse,
+            Generic
+        };
+
+        using Payload = std::variant<NJson::JsonGetError, NJson::JsonFindError, GenericError>;
+
+        KindEnum m_kind{ KindEnum::JsonParse };
+        char     m_char{}; // JsonParseError::c
+        union {
+            uint64_t m_code{}; // the enum value, JsonParseError::idx or both JsonWrongTypeError indexes
+            Payload* m_payload;
+        };
+
+        template<class T>
+        static constexpr KindEnum KindOf_();
+
+        [[nodiscard]] constexpr bool HasPayload_() const noexcept;
+        constexpr void Reset_() noexcept;
     };
 
     template<class T>
@@ -49,4 +115,4 @@ namespace Thoth {
     using ThothUnex = std::unexpected<ThothError>;
 }
 
-#include <Thoth/ThothError.tpp>
\ No newline at end of file
+#include <Thoth/ThothError.tpp>
@@ -1,7 +1,67 @@
 #pragma once
 #include <ranges>
+#include <utility>
 
 namespace Thoth {
+    constexpr ThothError::ThothError() noexcept = default;
+
+    template<class T>
+        requires ThothErrorAlternativeConcept<std::remove_cvref_t<T>>
+    constexpr ThothError::ThothError(T&& error) : m_kind{ KindOf_<std::remove_cvref_t<T>>() } {
+        using Type = std::remove_cvref_t<T>;
+
+        if constexpr (std::is_enum_v<Type>)
+            m_code = static_cast<uint64_t>(std::to_underlying(error));
+        else if constexpr (std::same_as<Type, NJson::JsonParseError>) {
+            m_code = error.idx;
+            m_char = error.c;
+        }
+        else if constexpr (std::same_as<Type, NJson::JsonWrongTypeError>)
+            m_code = static_cast<uint64_t>(error.idxExpected) << 32 | static_cast<uint32_t>(error.idxGot);
+        else if constexpr (!std::same_as<Type, NJson::JsonSearchError>)
+            m_payload = new Payload{ std::in_place_type<Type>, std::forward<T>(error) };
+    }
+
+    constexpr ThothError::ThothError(const ThothError& other) : m_kind{ other.m_kind }, m_char{ other.m_char } {
+        if (other.HasPayload_())
+            m_payload = new Payload{ *other.m_payload };
+        else
+            m_code = other.m_code;
+    }
+
+    constexpr ThothError::ThothError(ThothError&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    constexpr ThothError::~ThothError() {
+        Reset_();
+    }
+
+    constexpr ThothError& ThothError::operator=(const ThothError& other) {
+        if (this != &other)
+            *this = ThothError{ other };
+
+        return *this;
+    }
+
+    constexpr ThothError& ThothError::operator=(ThothError&& other) noexcept {
+        if (this != &other) {
+            Reset_();
+            m_kind = other.m_kind;
+            m_char = other.m_char;
+
+            if (other.HasPayload_()) {
+                m_payload = std::exchange(other.m_payload, nullptr);
+                other.m_kind = KindEnum::JsonParse;
+                other.m_code = 0;
+            }
+            else
+                m_code = other.m_code;
+        }
+
+        return *this;
+    }
+
 
     constexpr auto ThothError::FromError() {
         return []<typename T>(T&& error) {
@@ -11,29 +71,97 @@ namespace Thoth {
 
     template<class T>
     constexpr bool ThothError::Is() const {
-        return std::holds_alternative<T>(static_cast<const ThothErrorBase&>(*this));
+        return m_kind == KindOf_<T>();
     }
 
     template <class T>
     constexpr T ThothError::As() const {
-        return std::get<T>(static_cast<const ThothErrorBase&>(*this));
+        if (!Is<T>())
+            throw std::bad_variant_access{};
+
+        if constexpr (std::is_enum_v<T>)
+            return static_cast<T>(static_cast<std::underlying_type_t<T>>(m_code));
+        else if constexpr (std::same_as<T, NJson::JsonParseError>)
+            return T{ static_cast<size_t>(m_code), m_char };
+        else if constexpr (std::same_as<T, NJson::JsonWrongTypeError>)
+            return T{ static_cast<size_t>(m_code >> 32), static_cast<size_t>(m_code & 0xFFFF'FFFF) };
+        else if constexpr (std::same_as<T, NJson::JsonSearchError>)
+            return T{};
+        else
+            return std::get<T>(*m_payload);
     }
 
     template <class T>
-    std::optional<T> ThothError::Ensure() const {
-        const auto* value{ std::get_if<T>(static_cast<const ThothErrorBase*>(this)) };
-
-        if (value != nullptr)
-            return *value;
+    constexpr std::optional<T> ThothError::Ensure() const {
+        if (Is<T>())
+            return As<T>();
 
         return std::nullopt;
     }
 
+    template<class Callable>
+    constexpr decltype(auto) ThothError::Visit(Callable&& callable) const {
+        switch (m_kind) {
+            case KindEnum::JsonParse:     return std::forward<Callable>(callable)(As<NJson::JsonParseError>());
+            case KindEnum::JsonSearch:    return std::forward<Callable>(callable)(As<NJson::JsonSearchError>());
+            case KindEnum::JsonWrongType: return std::forward<Callable>(callable)(As<NJson::JsonWrongTypeError>());
+            case KindEnum::UrlParse:      return std::forward<Callable>(callable)(As<Http::UrlParseErrorEnum>());
+            case KindEnum::Connection:    return std::forward<Callable>(callable)(As<Http::ConnectionErrorEnum>());
+            case KindEnum::MessageParse:  return std::forward<Callable>(callable)(As<Http::MessageParseErrorEnum>());
+            default:                      return std::visit(std::forward<Callable>(callable), *m_payload);
+        }
+    }
 
-    template<class T>
+
+    template<ThothErrorAlternativeConcept T>
     constexpr bool ThothError::operator==(const T& rhs) const  {
-        const T* ptr{ std::get_if<T>(this) };
-        return ptr != nullptr && *ptr == rhs;
+        if (!Is<T>())
+            return false;
+
+        if constexpr (std::is_enum_v<T> || std::same_as<T, NJson::JsonParseError> || std::same_as<T, NJson::JsonSearchError>
+                      || std::same_as<T, NJson::JsonWrongTypeError>)
+            return As<T>() == rhs;
+        else
+            return std::get<T>(*m_payload) == rhs;
+    }
+
+    constexpr bool ThothError::operator==(const ThothError& other) const {
+        if (m_kind != other.m_kind)
+            return false;
+
+        if (HasPayload_())
+            return *m_payload == *other.m_payload;
+
+        return m_code == other.m_code && m_char == other.m_char;
+    }
+
+
+    template<class T>
+    constexpr ThothError::KindEnum ThothError::KindOf_() {
+        if constexpr (std::same_as<T, NJson::JsonParseError>)          return KindEnum::JsonParse;
+        else if constexpr (std::same_as<T, NJson::JsonGetError>)       return KindEnum::JsonGet;
+        else if constexpr (std::same_as<T, NJson::JsonFindError>)      return KindEnum::JsonFind;
+        else if constexpr (std::same_as<T, NJson::JsonSearchError>)    return KindEnum::JsonSearch;
+        else if constexpr (std::same_as<T, NJson::JsonWrongTypeError>) return KindEnum::JsonWrongType;
+        else if constexpr (std::same_as<T, Http::UrlParseErrorEnum>)   return KindEnum::UrlParse;
+        else if constexpr (std::same_as<T, Http::ConnectionErrorEnum>) return KindEnum::Connection;
+        else if constexpr (std::same_as<T, Http::MessageParseErrorEnum>) return KindEnum::MessageParse;
+        else {
+            static_assert(std::same_as<T, GenericError>, "Not an error a ThothError can hold");
+            return KindEnum::Generic;
+        }
+    }
+
+    constexpr bool ThothError::HasPayload_() const noexcept {
+        return m_kind == KindEnum::JsonGet || m_kind == KindEnum::JsonFind || m_kind == KindEnum::Generic;
+    }
+
+    constexpr void ThothError::Reset_() noexcept {
+        if (HasPayload_())
+            delete m_payload;
+
+        m_kind = KindEnum::JsonParse;
+        m_code = 0;
     }
 }
 
@@ -68,8 +196,8 @@ struct std::formatter<Thoth::ThothError> {
         namespace rg = std::ranges;
         namespace vs = std::views;
 
-        return std::visit([&ctx](const auto& err) mutable {
+        return error.Visit([&ctx](const auto& err) mutable {
             return std::format_to(ctx.out(), "{}", err);
-        }, error);
+        });
     }
 };
\ No newline at end of file
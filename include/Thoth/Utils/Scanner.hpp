@@ -1,5 +1,6 @@
 #pragma once
 #include <chrono>
+#include <sstream>
 #include <variant>
 
 #include <Thoth/Utils/Monostate.hpp>
@@ -79,30 +80,44 @@ namespace Thoth::Utils {
 
     static_assert(Serializable<std::string>);
 
+    //! Defaults to the HTTP-date (RFC 9110 §5.6.7), also accepting its two obsolete forms. Any other
+    //! `std::chrono::from_stream` pattern can be given instead.
     template<>
     struct Scanner<std::chrono::utc_clock::time_point> {
-        std::string pattern{ "%a, %d %b %Y %H:%M:%S GMT" };
+        static constexpr std::string_view k_httpDate{ "%a, %d %b %Y %H:%M:%S GMT" };
 
-        static bool Parse(const std::string_view str) {
-            if (str.empty()) return true;
+        std::string pattern{ k_httpDate };
 
-            std::tm tm{};
-            std::istringstream ss{ std::string{ str } };
-            ss >> std::get_time(&tm, "%a, %d %b %Y %H:%M:%S GMT");
-            return !ss.fail();
+        bool Parse(const std::string_view str) {
+            if (!str.empty())
+                pattern = str;
+            return true;
         }
 
-        static std::optional<std::chrono::utc_clock::time_point> Scan(std::string_view input) {
+        std::optional<std::chrono::utc_clock::time_point> Scan(std::string_view input) {
             using TimePoint = std::chrono::utc_clock::time_point;
-            static constexpr char k_outputFormat[]{ "%Y-%m-%d %H:%M:%S %z" };
+            static constexpr std::string_view k_obsoleteDates[]{
+                "%A, %d-%b-%y %H:%M:%S GMT", // RFC 850
+                "%a %b %e %H:%M:%S %Y"       // asctime
+            };
 
+            String::Trim(input);
             if (input.empty()) return std::nullopt;
 
-            std::istringstream ss{ std::string{ input } };
+            const auto tryPattern{ [&](const std::string_view fmt) -> std::optional<TimePoint> {
+                std::istringstream ss{ std::string{ input } };
+
+                if (TimePoint clock; std::chrono::from_stream(ss, std::string{ fmt }.c_str(), clock)
+                        && ss.peek() == std::char_traits<char>::eof())
+                    return clock;
+                return std::nullopt;
+            } };
 
+            if (auto res{ tryPattern(pattern) }) return res;
+            if (pattern != k_httpDate) return std::nullopt;
 
-            if (TimePoint clock; std::chrono::from_stream(ss, k_outputFormat, clock))
-                return clock;
+            for (const auto fmt : k_obsoleteDates)
+                if (auto res{ tryPattern(fmt) }) return res;
 
             return std::nullopt;
         }
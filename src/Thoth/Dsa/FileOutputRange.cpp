@@ -0,0 +1,213 @@
+#include <Thoth/Dsa/FileOutputRange.hpp>
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <format>
+#include <ios>
+#include <new>
+#include <system_error>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#include <share.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+
+using namespace Thoth;
+using Thoth::Dsa::details_::FileWriter;
+
+
+FileWriter::FileWriter(const std::filesystem::path& path, const FileOutputOptions& options, const int defaultMode)
+    : m_buffer{ static_cast<char*>(::operator new[](k_bufferSize, std::align_val_t{ k_alignment })) },
+      m_start{ options.offset }, m_position{ options.offset } {
+    const int mode{ defaultMode | options.mode };
+
+    // Same rules as std::ofstream: `in` and `app` keep the content unless `trunc` is given. So does `keepContent`.
+    m_append = (mode & std::ios::app) != 0;
+    const bool truncate{
+        (mode & std::ios::trunc) != 0 || ((mode & (std::ios::in | std::ios::app)) == 0 && !options.keepContent)
+    };
+
+#ifdef _WIN32
+    int flags{ _O_WRONLY | _O_CREAT | ((mode & std::ios::binary) != 0 ? _O_BINARY : _O_TEXT) };
+    if (truncate) flags |= _O_TRUNC;
+    if (m_append) flags |= _O_APPEND;
+
+    if (_wsopen_s(&m_fd, path.c_str(), flags, _SH_DENYNO, _S_IREAD | _S_IWRITE) != 0) {
+        m_fd    = -1;
+        m_error = errno;
+        return;
+    }
+#else
+    int flags{ O_WRONLY | O_CREAT | O_CLOEXEC };
+    if (truncate) flags |= O_TRUNC;
+    if (m_append) flags |= O_APPEND;
+
+#ifdef O_DIRECT
+    // O_DIRECT needs aligned offsets, the buffer keeps them aligned as long as the first one is.
+    m_directIo = options.directIo && !m_append && options.offset % k_alignment == 0;
+    if (m_directIo) flags |= O_DIRECT;
+#endif
+
+    m_fd = ::open(path.c_str(), flags, 0644);
+
+#ifdef O_DIRECT
+    // Some file systems (tmpfs for instance) refuse O_DIRECT, the hint is dropped.
+    if (m_fd == -1 && m_directIo && errno == EINVAL) {
+        m_directIo = false;
+        m_fd       = ::open(path.c_str(), flags & ~O_DIRECT, 0644);
+    }
+#endif
+
+    if (m_fd == -1) {
+        m_error = errno;
+        return;
+    }
+
+#ifdef __linux__
+    // Reserves the blocks without growing the file: if fewer bytes come (a failed transfer, a decoded body), no
+    // zeros are left after them. Unsupported by the file system isn't an error, running out of space is.
+    if (options.preallocate && *options.preallocate != 0)
+        if (::fallocate(m_fd, FALLOC_FL_KEEP_SIZE, 0, static_cast<off_t>(*options.preallocate)) == -1 && errno == ENOSPC)
+            m_error = errno;
+#endif
+
+#ifdef POSIX_FADV_SEQUENTIAL
+    m_noReuse = options.noReuse && !m_directIo;
+    if (m_noReuse)
+        ::posix_fadvise(m_fd, static_cast<off_t>(m_start), 0, POSIX_FADV_SEQUENTIAL);
+#endif
+#endif
+}
+
+FileWriter::~FileWriter() {
+    if (m_fd == -1) return;
+
+    (void)Flush_();
+    DropCache_(m_start, m_position - m_start);
+
+#ifdef _WIN32
+    _close(m_fd);
+#else
+    ::close(m_fd);
+#endif
+}
+
+void FileWriter::Write(std::span<const char> data) {
+    while (!data.empty()) {
+        if (m_size == k_bufferSize)
+            (void)Flush_();
+
+        const size_t count{ std::min(data.size(), k_bufferSize - m_size) };
+        std::memcpy(m_buffer.get() + m_size, data.data(), count);
+
+        m_size += count;
+        data    = data.subspan(count);
+    }
+}
+
+ThothResultOper FileWriter::Flush() {
+    if (m_fd == -1)
+        return ThothUnex{{ GenericError{ "Unable to open the file" } }};
+
+    if (!Flush_())
+        return ThothUnex{{ GenericError{ std::format("Unable to write the file: {}", Error().message()) } }};
+
+    return {};
+}
+
+bool FileWriter::IsOpen() const {
+    return m_fd != -1;
+}
+
+std::error_code FileWriter::Error() const {
+    return { m_error, std::generic_category() };
+}
+
+uint64_t FileWriter::Written() const {
+    return m_position - m_start + m_size;
+}
+
+
+void FileWriter::AlignedDelete::operator()(char* ptr) const {
+    ::operator delete[](ptr, std::align_val_t{ k_alignment });
+}
+
+bool FileWriter::Flush_() {
+    // After an error the bytes are dropped, the error is already recorded.
+    if (m_fd == -1 || m_error != 0) {
+        m_size = 0;
+        return false;
+    }
+
+    if (m_size == 0) return true;
+
+#ifdef O_DIRECT
+    // Only the last flush can be partial, O_DIRECT is turned off to write the unaligned tail.
+    if (m_directIo && m_size % k_alignment != 0) {
+        ::fcntl(m_fd, F_SETFL, ::fcntl(m_fd, F_GETFL) & ~O_DIRECT);
+        m_directIo = false;
+    }
+#endif
+
+    const uint64_t blockStart{ m_position };
+
+    for (const char* data{ m_buffer.get() }; m_size != 0;) {
+        const auto written{ WriteAt_(data, m_size) };
+
+        if (written < 0) {
+            if (errno == EINTR) continue;
+
+            m_error = errno;
+            m_size  = 0;
+            return false;
+        }
+
+        data       += written;
+        m_size     -= static_cast<size_t>(written);
+        m_position += static_cast<uint64_t>(written);
+    }
+
+    if (m_noReuse) {
+#ifdef __linux__
+        // Starts the writeback now, dirty pages can't be dropped.
+        ::sync_file_range(m_fd, static_cast<off_t>(blockStart), static_cast<off_t>(m_position - blockStart),
+            SYNC_FILE_RANGE_WRITE);
+#endif
+        // The previous block had time to reach the disk, dropping it doesn't stall.
+        if (blockStart - m_start >= k_bufferSize)
+            DropCache_(blockStart - k_bufferSize, k_bufferSize);
+    }
+
+    return true;
+}
+
+std::ptrdiff_t FileWriter::WriteAt_(const char* data, const size_t size) const {
+#ifdef _WIN32
+    if (!m_append && _lseeki64(m_fd, static_cast<long long>(m_position), SEEK_SET) == -1)
+        return -1;
+
+    return _write(m_fd, data, static_cast<unsigned int>(std::min<size_t>(size, INT_MAX)));
+#else
+    // pwrite ignores the offset on an O_APPEND file on Linux, write says what it means.
+    if (m_append)
+        return ::write(m_fd, data, size);
+
+    return ::pwrite(m_fd, data, size, static_cast<off_t>(m_position));
+#endif
+}
+
+void FileWriter::DropCache_(const uint64_t offset, const uint64_t size) const {
+#ifdef POSIX_FADV_DONTNEED
+    if (m_noReuse && size != 0)
+        ::posix_fadvise(m_fd, static_cast<off_t>(offset), static_cast<off_t>(size), POSIX_FADV_DONTNEED);
+#else
+    (void)offset, (void)size;
+#endif
+}
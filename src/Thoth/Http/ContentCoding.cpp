@@ -0,0 +1,446 @@
+#include <Thoth/Http/_base/ContentCoding.hpp>
+#include <Thoth/Http/ErrorDefinitions.hpp>
+
+#include <cstdint>
+#include <limits>
+
+#ifdef THOTH_WITH_ZLIB
+#include <zlib.h>
+#endif
+#ifdef THOTH_WITH_ZSTD
+#include <zstd.h>
+#endif
+#ifdef THOTH_WITH_BROTLI
+#include <brotli/decode.h>
+#endif
+
+using namespace Thoth::Http;
+using namespace Thoth::Http::details_;
+using Thoth::ThothError;
+using Thoth::ThothUnex;
+
+namespace {
+    // Output grows in steps of this size; small enough to stay in cache, large enough to amortize the calls.
+    constexpr size_t k_outputStep{ 16 * 1024 };
+
+    //! Grows `output` by `k_outputStep` and returns a pointer to the new region.
+    uint8_t* GrowOutput(std::string& output) {
+        const size_t offset{ output.size() };
+        output.resize(offset + k_outputStep);
+        return reinterpret_cast<uint8_t*>(output.data() + offset);
+    }
+
+    //! Drops the part of the last `k_outputStep` growth that was not written.
+    void ShrinkOutput(std::string& output, const size_t unused) {
+        output.resize(output.size() - unused);
+    }
+}
+
+//! @brief One decoding step of a (possibly stacked) `Content-Encoding`.
+struct ContentDecoder::Stage {
+    virtual ~Stage() = default;
+
+    //! @return `false` if the data is corrupt or `output` grew past `maxSize`, checked after every step of the codec
+    //! so that a small input never inflates much further than it.
+    virtual bool Feed(std::string_view input, std::string& output, size_t maxSize) = 0;
+    //! @return `true` if the coded stream was properly terminated (or never started).
+    [[nodiscard]] virtual bool Finished() const = 0;
+};
+
+namespace {
+#ifdef THOTH_WITH_ZLIB
+    struct ZlibStage final : ContentDecoder::Stage {
+        explicit ZlibStage(const bool gzip) : m_gzip{ gzip } {
+            // 15 + 32 detects both zlib and gzip wrappers; the raw fallback for "deflate" is picked in Feed.
+            m_ok = inflateInit2(&m_stream, 15 + 32) == Z_OK;
+        }
+
+        ~ZlibStage() override { inflateEnd(&m_stream); }
+
+        bool Feed(std::string_view input, std::string& output, const size_t maxSize) override {
+            if (!m_ok) return false;
+            if (input.empty()) return true;
+
+            if (!m_started) {
+                m_started = true;
+                // RFC 9110 says "deflate" is zlib-wrapped, but some servers send raw DEFLATE. A zlib header has
+                // CM = 8 in the low nibble and the first two bytes are a multiple of 31.
+                if (!m_gzip && input.size() >= 2) {
+                    const auto cmf{ static_cast<uint8_t>(input[0]) };
+                    const auto flg{ static_cast<uint8_t>(input[1]) };
+
+                    if ((cmf & 0x0F) != 8 || (cmf * 256 + flg) % 31 != 0)
+                        m_ok = inflateReset2(&m_stream, -15) == Z_OK;
+                }
+            }
+
+            m_stream.next_in  = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+            m_stream.avail_in = static_cast<uInt>(input.size());
+
+            while (true) {
+                if (m_ended) {
+                    if (m_stream.avail_in == 0) return true;
+                    // Only gzip allows several members back to back, anything else after the end is garbage.
+                    if (!m_gzip || inflateReset(&m_stream) != Z_OK) return false;
+                    m_ended = false;
+                }
+
+                m_stream.next_out  = GrowOutput(output);
+                m_stream.avail_out = static_cast<uInt>(k_outputStep);
+
+                const int res{ inflate(&m_stream, Z_NO_FLUSH) };
+                ShrinkOutput(output, m_stream.avail_out);
+                if (output.size() > maxSize) return false;
+
+                if (res == Z_STREAM_END) {
+                    m_ended = true;
+                    continue;
+                }
+
+                if (res != Z_OK && res != Z_BUF_ERROR) return false;
+                if (m_stream.avail_out != 0) return m_stream.avail_in == 0;
+            }
+        }
+
+        [[nodiscard]] bool Finished() const override { return !m_started || m_ended; }
+
+    private:
+        z_stream m_stream{};
+        bool m_gzip{};
+        bool m_ok{};
+        bool m_started{};
+        bool m_ended{};
+    };
+#endif
+
+#ifdef THOTH_WITH_ZSTD
+    struct ZstdStage final : ContentDecoder::Stage {
+        ZstdStage() : m_stream{ ZSTD_createDStream() } {
+            if (m_stream) ZSTD_initDStream(m_stream);
+        }
+
+        ~ZstdStage() override { ZSTD_freeDStream(m_stream); }
+
+        bool Feed(std::string_view input, std::string& output, const size_t maxSize) override {
+            if (!m_stream) return false;
+            if (input.empty()) return true;
+            m_started = true;
+
+            ZSTD_inBuffer in{ input.data(), input.size(), 0 };
+
+            while (true) {
+                ZSTD_outBuffer out{ GrowOutput(output), k_outputStep, 0 };
+
+                const size_t res{ ZSTD_decompressStream(m_stream, &out, &in) };
+                ShrinkOutput(output, out.size - out.pos);
+                if (output.size() > maxSize) return false;
+
+                if (ZSTD_isError(res)) return false;
+                m_frameHint = res;
+
+                if (in.pos == in.size && out.pos < out.size) return true;
+            }
+        }
+
+        // ZSTD_decompressStream returns 0 exactly when a frame was completely decoded and flushed.
+        [[nodiscard]] bool Finished() const override { return !m_started || m_frameHint == 0; }
+
+    private:
+        ZSTD_DStream* m_stream{};
+        size_t m_frameHint{};
+        bool m_started{};
+    };
+#endif
+
+#ifdef THOTH_WITH_BROTLI
+    struct BrotliStage final : ContentDecoder::Stage {
+        BrotliStage() : m_state{ BrotliDecoderCreateInstance(nullptr, nullptr, nullptr) } {}
+
+        ~BrotliStage() override { BrotliDecoderDestroyInstance(m_state); }
+
+        bool Feed(std::string_view input, std::string& output, const size_t maxSize) override {
+            if (!m_state) return false;
+            if (input.empty()) return true;
+            m_started = true;
+
+            size_t availIn{ input.size() };
+            auto nextIn{ reinterpret_cast<const uint8_t*>(input.data()) };
+
+            while (true) {
+                size_t availOut{ k_outputStep };
+                uint8_t* nextOut{ GrowOutput(output) };
+
+                const auto res{ BrotliDecoderDecompressStream(m_state, &availIn, &nextIn, &availOut, &nextOut, nullptr) };
+                ShrinkOutput(output, availOut);
+                if (output.size() > maxSize) return false;
+
+                switch (res) {
+                    case BROTLI_DECODER_RESULT_NEEDS_MORE_OUTPUT: continue;
+                    case BROTLI_DECODER_RESULT_NEEDS_MORE_INPUT:  return true;
+                    case BROTLI_DECODER_RESULT_SUCCESS:           return availIn == 0;
+                    default:                                      return false;
+                }
+            }
+        }
+
+        [[nodiscard]] bool Finished() const override { return !m_started || BrotliDecoderIsFinished(m_state); }
+
+    private:
+        BrotliDecoderState* m_state{};
+        bool m_started{};
+    };
+#endif
+
+    std::unique_ptr<ContentDecoder::Stage> MakeStage(const NHeaders::ContentEncodingEnum coding) {
+        using enum NHeaders::ContentEncodingEnum;
+
+        switch (coding) {
+#ifdef THOTH_WITH_ZLIB
+            case Gzip:    return std::make_unique<ZlibStage>(true);
+            case Deflate: return std::make_unique<ZlibStage>(false);
+#endif
+#ifdef THOTH_WITH_ZSTD
+            case Zstd:    return std::make_unique<ZstdStage>();
+#endif
+#ifdef THOTH_WITH_BROTLI
+            case Br:      return std::make_unique<BrotliStage>();
+#endif
+            default:      return nullptr; // compress (LZW) and the dictionary codings are not implemented.
+        }
+    }
+}
+
+
+ContentDecoder::ContentDecoder(ContentDecoder&&) noexcept = default;
+ContentDecoder& ContentDecoder::operator=(ContentDecoder&&) noexcept = default;
+ContentDecoder::~ContentDecoder() = default;
+
+
+std::expected<ContentDecoder, ThothError> ContentDecoder::Create(
+        const std::span<const NHeaders::ContentEncodingEnum> codings) {
+    ContentDecoder decoder;
+
+    // Codings are listed in the order they were applied, so they are undone from last to first.
+    for (auto it{ codings.rbegin() }; it != codings.rend(); ++it) {
+        // "identity" changes nothing, it has no stage at all.
+        if (*it == NHeaders::ContentEncodingEnum::Identity)
+            continue;
+
+        auto stage{ MakeStage(*it) };
+        if (!stage)
+            return ThothUnex{ MessageParseErrorEnum::UnsupportedContentEncoding };
+
+        decoder.m_stages.emplace_back(std::move(stage));
+    }
+
+    if (!decoder.m_stages.empty())
+        decoder.m_buffers.resize(decoder.m_stages.size() - 1);
+
+    return std::move(decoder);
+}
+
+bool ContentDecoder::IsSupported(const NHeaders::ContentEncodingEnum coding) {
+    using enum NHeaders::ContentEncodingEnum;
+
+    switch (coding) {
+        case Identity:           return true;
+#ifdef THOTH_WITH_ZLIB
+        case Gzip: case Deflate: return true;
+#endif
+#ifdef THOTH_WITH_ZSTD
+        case Zstd:               return true;
+#endif
+#ifdef THOTH_WITH_BROTLI
+        case Br:                 return true;
+#endif
+        default:                 return false;
+    }
+}
+
+std::vector<NHeaders::AcceptEncoding> ContentDecoder::AcceptedCodings() {
+    std::vector<NHeaders::AcceptEncoding> codings;
+
+#ifdef THOTH_WITH_ZLIB
+    codings.emplace_back(NHeaders::AcceptEncodingEnum::Gzip);
+    codings.emplace_back(NHeaders::AcceptEncodingEnum::Deflate);
+#endif
+#ifdef THOTH_WITH_BROTLI
+    codings.emplace_back(NHeaders::AcceptEncodingEnum::Br);
+#endif
+#ifdef THOTH_WITH_ZSTD
+    codings.emplace_back(NHeaders::AcceptEncodingEnum::Zstd);
+#endif
+
+    return codings;
+}
+
+std::expected<std::monostate, ThothError> ContentDecoder::Feed(
+        std::string_view input, std::string& output, const size_t maxOutput) {
+    if (m_stages.empty()) {
+        if (input.size() > maxOutput)
+            return ThothUnex{ MessageParseErrorEnum::InvalidContentEncoding };
+
+        output.append(input);
+        return std::monostate{};
+    }
+
+    for (size_t i{}; i < m_stages.size(); i++) {
+        const bool isLast{ i + 1 == m_stages.size() };
+        std::string& target{ isLast ? output : m_buffers[i] };
+
+        // The intermediate codings are bounded as the last one, they are never much larger than what they decode to.
+        const size_t maxSize{ maxOutput > std::numeric_limits<size_t>::max() - target.size()
+            ? std::numeric_limits<size_t>::max() : target.size() + maxOutput };
+
+        if (!m_stages[i]->Feed(input, target, maxSize))
+            return ThothUnex{ MessageParseErrorEnum::InvalidContentEncoding };
+
+        if (i != 0) m_buffers[i - 1].clear();
+        if (!isLast) input = m_buffers[i];
+    }
+
+    return std::monostate{};
+}
+
+std::expected<std::monostate, ThothError> ContentDecoder::Finish() const {
+    for (const auto& stage : m_stages)
+        if (!stage->Finished())
+            return ThothUnex{ MessageParseErrorEnum::InvalidContentEncoding };
+
+    return std::monostate{};
+}
+
+
+
+//! @brief The codec behind a ContentEncoder.
+struct ContentEncoder::Stage {
+    virtual ~Stage() = default;
+
+    //! @return `false` if the codec failed.
+    virtual bool Feed(std::string_view input, std::string& output, bool finish) = 0;
+};
+
+namespace {
+#ifdef THOTH_WITH_ZLIB
+    struct ZlibEncodeStage final : ContentEncoder::Stage {
+        explicit ZlibEncodeStage(const bool gzip) {
+            // 15 + 16 writes a gzip wrapper, plain 15 a zlib one (which is what "deflate" means in HTTP).
+            m_ok = deflateInit2(&m_stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, gzip ? 15 + 16 : 15,
+                                8, Z_DEFAULT_STRATEGY) == Z_OK;
+        }
+
+        ~ZlibEncodeStage() override { deflateEnd(&m_stream); }
+
+        bool Feed(std::string_view input, std::string& output, const bool finish) override {
+            if (!m_ok) return false;
+
+            m_stream.next_in  = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+            m_stream.avail_in = static_cast<uInt>(input.size());
+
+            while (true) {
+                m_stream.next_out  = GrowOutput(output);
+                m_stream.avail_out = static_cast<uInt>(k_outputStep);
+
+                const int res{ deflate(&m_stream, finish ? Z_FINISH : Z_NO_FLUSH) };
+                ShrinkOutput(output, m_stream.avail_out);
+
+                if (res == Z_STREAM_END) return true;
+                if (res != Z_OK && res != Z_BUF_ERROR) return false;
+                if (!finish && m_stream.avail_in == 0 && m_stream.avail_out != 0) return true;
+            }
+        }
+
+    private:
+        z_stream m_stream{};
+        bool m_ok{};
+    };
+#endif
+
+#ifdef THOTH_WITH_ZSTD
+    struct ZstdEncodeStage final : ContentEncoder::Stage {
+        ZstdEncodeStage() : m_stream{ ZSTD_createCCtx() } {}
+
+        ~ZstdEncodeStage() override { ZSTD_freeCCtx(m_stream); }
+
+        bool Feed(std::string_view input, std::string& output, const bool finish) override {
+            if (!m_stream) return false;
+
+            ZSTD_inBuffer in{ input.data(), input.size(), 0 };
+            const auto mode{ finish ? ZSTD_e_end : ZSTD_e_continue };
+
+            while (true) {
+                ZSTD_outBuffer out{ GrowOutput(output), k_outputStep, 0 };
+
+                // Returns how much is still buffered internally; 0 means everything up to `mode` was flushed.
+                const size_t res{ ZSTD_compressStream2(m_stream, &out, &in, mode) };
+                ShrinkOutput(output, out.size - out.pos);
+
+                if (ZSTD_isError(res)) return false;
+                if (finish ? res == 0 : in.pos == in.size) return true;
+            }
+        }
+
+    private:
+        ZSTD_CCtx* m_stream{};
+    };
+#endif
+
+    std::unique_ptr<ContentEncoder::Stage> MakeEncodeStage(const NHeaders::ContentEncodingEnum coding) {
+        using enum NHeaders::ContentEncodingEnum;
+
+        switch (coding) {
+#ifdef THOTH_WITH_ZLIB
+            case Gzip:    return std::make_unique<ZlibEncodeStage>(true);
+            case Deflate: return std::make_unique<ZlibEncodeStage>(false);
+#endif
+#ifdef THOTH_WITH_ZSTD
+            case Zstd:    return std::make_unique<ZstdEncodeStage>();
+#endif
+            default:      return nullptr;
+        }
+    }
+}
+
+
+ContentEncoder::ContentEncoder(ContentEncoder&&) noexcept = default;
+ContentEncoder& ContentEncoder::operator=(ContentEncoder&&) noexcept = default;
+ContentEncoder::~ContentEncoder() = default;
+
+
+std::expected<ContentEncoder, ThothError> ContentEncoder::Create(const NHeaders::ContentEncodingEnum coding) {
+    ContentEncoder encoder;
+
+    encoder.m_stage = MakeEncodeStage(coding);
+    if (!encoder.m_stage)
+        return ThothUnex{ MessageParseErrorEnum::UnsupportedContentEncoding };
+
+    return std::move(encoder);
+}
+
+bool ContentEncoder::IsSupported(const NHeaders::ContentEncodingEnum coding) {
+    using enum NHeaders::ContentEncodingEnum;
+
+    switch (coding) {
+#ifdef THOTH_WITH_ZLIB
+        case Gzip: case Deflate: return true;
+#endif
+#ifdef THOTH_WITH_ZSTD
+        case Zstd:               return true;
+#endif
+        default:                 return false;
+    }
+}
+
+std::expected<std::monostate, ThothError> ContentEncoder::Feed(const std::string_view input, std::string& output) {
+    if (!m_stage->Feed(input, output, false))
+        return ThothUnex{ MessageParseErrorEnum::InvalidContentEncoding };
+
+    return std::monostate{};
+}
+
+std::expected<std::monostate, ThothError> ContentEncoder::Finish(std::string& output) {
+    if (!m_stage->Feed({}, output, true))
+        return ThothUnex{ MessageParseErrorEnum::InvalidContentEncoding };
+
+    return std::monostate{};
+}
@@ -0,0 +1,308 @@
+#include <Thoth/Http/Client/Client.hpp>
+#include <Thoth/Http/Client/Download.hpp>
+#include <Thoth/Http/Methods/HeadMethod.hpp>
+#include <Thoth/Dsa/FileOutputRange.hpp>
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <mutex>
+#include <ranges>
+#include <thread>
+
+
+namespace fs = std::filesystem;
+
+using namespace Thoth;
+using namespace Thoth::Http;
+
+namespace {
+    constexpr std::string_view k_stateHeader{ "thoth-download 1" };
+    constexpr std::string_view k_stateExtension{ ".thoth-part" };
+
+    // Only connection failures are retried, any other error would repeat itself.
+    constexpr int k_maxAttempts{ 3 };
+
+    struct Probe {
+        std::optional<uint64_t> length;
+        bool acceptsRanges{};
+        std::string validator;
+    };
+
+    // If-Range needs a strong validator (RFC 9110 §13.1.5), a weak ETag is useless there.
+    std::string GetValidator(const ResponseHeaders& headers) {
+        if (const auto etag{ headers.Get("etag") }; etag && !(*etag)->starts_with("W/"))
+            return std::string{ **etag };
+
+        if (const auto lastModified{ headers.Get("last-modified") })
+            return std::string{ **lastModified };
+
+        return {};
+    }
+
+    Probe ProbeUrl(const Url& url, const ClientOptions& opts) {
+        using NHeaders::AcceptRanges;
+
+        if (const auto res{ Client::Send(Request<HeadMethod>{ { .url = url }, {} }, opts) };
+            res && GetStatusType(res->status) == StatusTypeEnum::SUCCESSFUL) {
+            const auto acceptRanges{ res->headers.AcceptRanges().GetAsOpt() };
+            const auto length      { res->headers.ContentLength().GetAsOpt() };
+
+            if (acceptRanges == AcceptRanges::None)
+                return { .length = length };
+
+            if (acceptRanges == AcceptRanges::Bytes && length)
+                return { .length = length, .acceptsRanges = true, .validator = GetValidator(res->headers) };
+        }
+
+        // HEAD refused or inconclusive (Accept-Ranges is optional), ask for the first byte instead.
+        GetRequest request{ { .url = url }, {} };
+        request.headers.Range().Set(std::vector<NHeaders::Range>{ NHeaders::PrefixedRange{ 0, 0 } });
+
+        const auto onlyPartial{ [](const ResponseHead& head) -> std::expected<std::string, ThothError> {
+            if (head.status != StatusCodeEnum::PartialContent)
+                return ThothUnex{{ GenericError{ "Range requests are not supported" } }};
+            return std::string{};
+        } };
+
+        const auto res{ Client::SendAndParse(std::move(request), onlyPartial, opts) };
+        if (!res) return {};
+
+        const auto contentRange{ res->headers.ContentRange().GetAsOpt() };
+        if (!contentRange || !contentRange->completeLength) return {};
+
+        return { .length = contentRange->completeLength, .acceptsRanges = true, .validator = GetValidator(res->headers) };
+    }
+
+    std::expected<uint64_t, ThothError> DownloadWhole(const Url& url, const fs::path& path, const ClientOptions& opts) {
+        const auto toFile{ [&](const ResponseHead& head) -> std::expected<Dsa::BinFileOutputRange, ThothError> {
+            if (GetStatusType(head.status) != StatusTypeEnum::SUCCESSFUL)
+                return ThothUnex{{ GenericError{ "Download failed, unexpected status" } }};
+
+            Dsa::BinFileOutputRange file{ path, Dsa::FileOutputOptions{
+                .preallocate = head.headers.ContentLength().GetAsOpt()
+            } };
+            if (!file.IsOpen()) return ThothUnex{{ GenericError{ "Unable to open the file" } }};
+
+            return file;
+        } };
+
+        auto res{ Client::SendAsAndParse<GetMethod, std::string, Dsa::BinFileOutputRange>(
+            GetRequest{ { .url = url }, {} }, toFile, opts) };
+        if (!res) return ThothUnex{ res.error() };
+
+        if (auto flushed{ res->body.Flush() }; !flushed)
+            return ThothUnex{ flushed.error() };
+
+        std::error_code ec;
+        const auto size{ fs::file_size(path, ec) };
+        if (ec) return ThothUnex{{ GenericError{ "Unable to read the file size" } }};
+
+        return size;
+    }
+
+    std::expected<std::monostate, ThothError> DownloadChunk(
+        const Url& url, const fs::path& path, const DownloadState& state, const size_t idx, const ClientOptions& opts) {
+        const auto range{ state.ChunkRange(idx) };
+
+        GetRequest request{ { .url = url }, {} };
+        request.headers.Range().Set(std::vector<NHeaders::Range>{ range });
+        if (!state.validator.empty())
+            request.headers.Set("if-range", state.validator);
+
+        const auto writeAtOffset{ [&](const ResponseHead& head) -> std::expected<Dsa::BinFileOutputRange, ThothError> {
+            // A 200 means the range was ignored or If-Range failed, the representation changed.
+            if (head.status != StatusCodeEnum::PartialContent)
+                return ThothUnex{{ GenericError{ "Range request not honored" } }};
+
+            const auto contentRange{ head.headers.ContentRange().GetAsOpt() };
+            const NHeaders::ContentRange::Span expected{ range.start, *range.end };
+
+            if (!contentRange || contentRange->span != expected
+                    || contentRange->completeLength.value_or(state.length) != state.length)
+                return ThothUnex{{ GenericError{ "Unexpected Content-Range" } }};
+
+            // The other chunks are written at the same time, or were by a previous run: chunk 0 mustn't truncate.
+            Dsa::BinFileOutputRange file{ path, Dsa::FileOutputOptions{ .offset = range.start, .keepContent = true } };
+            if (!file.IsOpen()) return ThothUnex{{ GenericError{ "Unable to open the file" } }};
+
+            return file;
+        } };
+
+        return Client::SendAsAndParse<GetMethod, std::string, Dsa::BinFileOutputRange>(std::move(request), writeAtOffset, opts)
+                .and_then([](auto&& response) { return response.body.Flush(); });
+    }
+}
+
+
+#pragma region DownloadState
+
+DownloadState DownloadState::Plan(const uint64_t length, std::string validator, const size_t segments) {
+    const uint64_t pieces{ std::max<uint64_t>(segments, 1) * k_chunksPerSegment };
+    const uint64_t chunkSize{ std::clamp((length + pieces - 1) / pieces, k_minChunkSize, k_maxChunkSize) };
+
+    return {
+        .length    = length,
+        .chunkSize = chunkSize,
+        .validator = std::move(validator),
+        .done      = std::vector<bool>((length + chunkSize - 1) / chunkSize)
+    };
+}
+
+fs::path DownloadState::StatePath(const fs::path& file) {
+    fs::path res{ file };
+    res += k_stateExtension;
+    return res;
+}
+
+std::optional<DownloadState> DownloadState::Load(const fs::path& statePath) {
+    std::ifstream file{ statePath };
+    if (!file) return std::nullopt;
+
+    std::string header, length, chunkSize, validator, done;
+    if (!std::getline(file, header) || header != k_stateHeader) return std::nullopt;
+
+    if (!std::getline(file, length) || !std::getline(file, chunkSize)
+        || !std::getline(file, validator) || !std::getline(file, done))
+        return std::nullopt;
+
+    DownloadState res{
+        .length    = Utils::Scan<uint64_t>(length).value_or(0),
+        .chunkSize = Utils::Scan<uint64_t>(chunkSize).value_or(0),
+        .validator = std::move(validator),
+        .done      = {}
+    };
+
+    if (res.length == 0 || res.chunkSize == 0) return std::nullopt;
+    if (done.size() != (res.length + res.chunkSize - 1) / res.chunkSize) return std::nullopt;
+    if (!std::ranges::all_of(done, [](const char c) { return c == '0' || c == '1'; })) return std::nullopt;
+
+    res.done = done | std::views::transform([](const char c) { return c == '1'; }) | std::ranges::to<std::vector<bool>>();
+
+    return res;
+}
+
+bool DownloadState::Save(const fs::path& statePath) const {
+    fs::path tmpPath{ statePath };
+    tmpPath += ".tmp";
+
+    {
+        std::ofstream file{ tmpPath, std::ios::out | std::ios::trunc };
+        file << k_stateHeader << '\n' << length << '\n' << chunkSize << '\n' << validator << '\n';
+        for (const bool chunk : done)
+            file.put(chunk ? '1' : '0');
+        file << '\n';
+
+        if (!file.flush()) return false;
+    }
+
+    std::error_code ec;
+    fs::rename(tmpPath, statePath, ec);
+
+    return !ec;
+}
+
+size_t DownloadState::Chunks() const {
+    return done.size();
+}
+
+size_t DownloadState::PendingChunks() const {
+    return static_cast<size_t>(std::ranges::count(done, false));
+}
+
+NHeaders::PrefixedRange DownloadState::ChunkRange(const size_t idx) const {
+    const uint64_t start{ idx * chunkSize };
+    return { start, std::min(start + chunkSize, length) - 1 };
+}
+
+bool DownloadState::Matches(const uint64_t length, const std::string_view validator) const {
+    // Without a validator there's no telling whether the bytes on disk still belong to the same representation.
+    return !validator.empty() && this->length == length && this->validator == validator;
+}
+
+#pragma endregion
+
+
+#pragma region Download
+
+auto Client::Download(const Url& url, const fs::path& path, size_t segments, ClientOptions opts)
+    -> std::expected<uint64_t, ThothError> {
+    // The offsets refer to the bytes as sent, a content coding would shift them.
+    opts.decodeContent = false;
+    opts.cache         = nullptr;
+    segments           = std::max<size_t>(segments, 1);
+
+    std::error_code ec;
+    if (path.has_parent_path()) {
+        fs::create_directories(path.parent_path(), ec);
+        if (ec) return ThothUnex{{ GenericError{ "Unable to create file path" } }};
+    }
+
+    const auto statePath{ DownloadState::StatePath(path) };
+    const auto probe    { ProbeUrl(url, opts) };
+
+    if (!probe.acceptsRanges || !probe.length || *probe.length == 0) {
+        fs::remove(statePath, ec);
+        return DownloadWhole(url, path, opts);
+    }
+
+    const uint64_t length{ *probe.length };
+
+    auto state{ DownloadState::Load(statePath) };
+    if (!state || !state->Matches(length, probe.validator) || fs::file_size(path, ec) != length || ec) {
+        state = DownloadState::Plan(length, probe.validator, segments);
+
+        // Preallocates the whole file so every segment writes in place.
+        if (const Dsa::BinFileOutputRange file{ path, Dsa::FileOutputOptions{ .preallocate = length } }; !file.IsOpen())
+            return ThothUnex{{ GenericError{ "Unable to open the file" } }};
+
+        fs::resize_file(path, length, ec);
+        if (ec) return ThothUnex{{ GenericError{ "Unable to preallocate the file" } }};
+
+        if (!state->validator.empty())
+            (void)state->Save(statePath);
+    }
+
+    std::vector<size_t> pending;
+    for (size_t idx{}; idx < state->Chunks(); ++idx)
+        if (!state->done[idx])
+            pending.push_back(idx);
+
+    std::atomic<size_t> next{};
+    std::atomic<bool> failed{};
+    std::mutex stateMutex;
+    std::optional<ThothError> error;
+
+    const auto worker{ [&] {
+        for (size_t i{ next++ }; i < pending.size() && !failed; i = next++) {
+            auto res{ DownloadChunk(url, path, *state, pending[i], opts) };
+            for (int attempt{ 1 }; !res && res.error().Is<ConnectionErrorEnum>() && attempt < k_maxAttempts; ++attempt)
+                res = DownloadChunk(url, path, *state, pending[i], opts);
+
+            std::lock_guard lock{ stateMutex };
+            if (!res) {
+                if (!error) error = std::move(res.error());
+                failed = true;
+                return;
+            }
+
+            state->done[pending[i]] = true;
+            if (!state->validator.empty())
+                (void)state->Save(statePath);
+        }
+    } };
+
+    {
+        std::vector<std::jthread> workers;
+        for (size_t i{}; i < std::min(segments, pending.size()); ++i)
+            workers.emplace_back(worker);
+    }
+
+    // The state file stays behind on failure, the next call resumes from it.
+    if (error) return ThothUnex{ std::move(*error) };
+
+    fs::remove(statePath, ec);
+
+    return length;
+}
+
+#pragma endregion
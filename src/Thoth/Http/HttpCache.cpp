@@ -0,0 +1,299 @@
+#include <Thoth/Http/Client/HttpCache.hpp>
+#include <algorithm>
+#include <ranges>
+#include <set>
+
+
+namespace rg = std::ranges;
+namespace vs = std::views;
+
+using namespace Thoth::Http;
+using namespace Thoth::Http::NHeaders;
+
+namespace {
+    using Directives = std::vector<CacheControl>;
+
+    // Parses the Cache-Control header, an absent header has no directives and a malformed one yields nullopt.
+    template<class H>
+    std::optional<Directives> GetDirectives(const H& headers) {
+        auto directives{ headers.CacheControl().GetWithDefault({}) };
+        if (!directives) return std::nullopt;
+        return std::move(*directives);
+    }
+
+    template<class T>
+    std::optional<T> FindDirective(const Directives& directives) {
+        for (const auto& directive : directives)
+            if (const auto* val{ std::get_if<T>(&directive) })
+                return *val;
+        return std::nullopt;
+    }
+
+    template<class T>
+    bool HasDirective(const Directives& directives) {
+        return FindDirective<T>(directives).has_value();
+    }
+
+    // RFC 9111 §4.2.2, statuses that may use a heuristic freshness.
+    bool IsHeuristicallyCacheable(const StatusCodeEnum status) {
+        using enum StatusCodeEnum;
+        static constexpr StatusCodeEnum k_statuses[]{
+            Ok      , NonAuthoritativeInformation, NoContent, MultipleChoices, MovedPermanently, PermanentRedirect,
+            NotFound, MethodNotAllowed           , Gone     , UriTooLong     , NotImplemented
+        };
+
+        return rg::contains(k_statuses, status);
+    }
+
+    // A tenth of the time since the last modification, the usual heuristic (RFC 9111 §4.2.2).
+    constexpr int k_heuristicFraction{ 10 };
+
+    bool IsHopByHop(const std::string_view key) {
+        static constexpr std::string_view k_excluded[]{
+            "connection", "keep-alive", "proxy-connection", "te", "transfer-encoding", "upgrade",
+            "content-length", "content-encoding"
+        };
+
+        return rg::contains(k_excluded, key);
+    }
+}
+
+
+HttpCache::HttpCache(const size_t maxBytes) : m_maxBytes{ maxBytes } {}
+
+std::string HttpCache::Key(const std::string_view method, const Url& url) {
+    std::string key{ std::format("{} {}", method, url) };
+
+    if (const auto fragment{ key.find('#') }; fragment != std::string::npos)
+        key.resize(fragment);
+
+    return key;
+}
+
+auto HttpCache::Find(const std::string_view key) -> std::optional<Entry> {
+    std::lock_guard lock{ m_mutex };
+
+    const auto it{ m_index.find(key) };
+    if (it == m_index.end()) return std::nullopt;
+
+    m_lru.splice(m_lru.begin(), m_lru, it->second);
+
+    return it->second->entry;
+}
+
+bool HttpCache::Store(std::string key, Entry entry) {
+    const size_t bytes{ EntryBytes_(key, entry) };
+
+    std::lock_guard lock{ m_mutex };
+
+    if (const auto it{ m_index.find(key) }; it != m_index.end()) {
+        m_bytes -= it->second->bytes;
+        m_lru.erase(it->second);
+        m_index.erase(it);
+    }
+
+    if (bytes > m_maxBytes) return false;
+
+    EvictUntil_(m_maxBytes - bytes);
+
+    m_lru.emplace_front(key, std::move(entry), bytes);
+    m_index.emplace(std::move(key), m_lru.begin());
+    m_bytes += bytes;
+
+    return true;
+}
+
+bool HttpCache::Erase(const std::string_view key) {
+    std::lock_guard lock{ m_mutex };
+
+    const auto it{ m_index.find(key) };
+    if (it == m_index.end()) return false;
+
+    m_bytes -= it->second->bytes;
+    m_lru.erase(it->second);
+    m_index.erase(it);
+
+    return true;
+}
+
+void HttpCache::Clear() {
+    std::lock_guard lock{ m_mutex };
+
+    m_index.clear();
+    m_lru.clear();
+    m_bytes = 0;
+}
+
+size_t HttpCache::Size() const {
+    std::lock_guard lock{ m_mutex };
+    return m_lru.size();
+}
+
+size_t HttpCache::Bytes() const {
+    std::lock_guard lock{ m_mutex };
+    return m_bytes;
+}
+
+size_t HttpCache::MaxBytes() const {
+    return m_maxBytes;
+}
+
+
+bool HttpCache::IsStorable(const RequestHeaders& request, const ResponseHead& response) {
+    if (!IsHeuristicallyCacheable(response.status)) return false;
+
+    const auto requestDirectives { GetDirectives(request) };
+    const auto responseDirectives{ GetDirectives(response.headers) };
+
+    if (!requestDirectives || HasDirective<NCacheControl::NoStore>(*requestDirectives)) return false;
+    if (!responseDirectives || HasDirective<NCacheControl::NoStore>(*responseDirectives)) return false;
+
+    if (const auto vary{ response.headers.Vary().GetAsOpt() }; vary && rg::contains(*vary, "*"))
+        return false;
+
+    return HasDirective<NCacheControl::MaxAge>(*responseDirectives)
+        || response.headers.Exists("expires")
+        || response.headers.Exists("etag")
+        || response.headers.Exists("last-modified");
+}
+
+std::chrono::seconds HttpCache::FreshnessLifetime(const Entry& entry) {
+    using std::chrono::seconds;
+    using std::chrono::duration_cast;
+
+    const auto& headers{ entry.head.headers };
+
+    const auto directives{ GetDirectives(headers) };
+    if (!directives) return seconds::zero();
+
+    if (const auto maxAge{ FindDirective<NCacheControl::MaxAge>(*directives) })
+        return maxAge->seconds;
+
+    const auto date{ headers.Date().GetAsOpt().value_or(entry.responseTime) };
+
+    if (headers.Exists("expires")) {
+        // An invalid date, like "0", means already expired.
+        const auto expires{ headers.Expires().GetAsOpt() };
+        if (!expires) return seconds::zero();
+
+        return std::max(duration_cast<seconds>(*expires - date), seconds::zero());
+    }
+
+    if (const auto lastModified{ headers.LastModified().GetAsOpt() };
+        lastModified && IsHeuristicallyCacheable(entry.head.status))
+        return std::max(duration_cast<seconds>(date - *lastModified) / k_heuristicFraction, seconds::zero());
+
+    return seconds::zero();
+}
+
+std::chrono::seconds HttpCache::CurrentAge(const Entry& entry, const TimePoint now) {
+    using std::chrono::seconds;
+    using std::chrono::duration_cast;
+
+    const auto& headers{ entry.head.headers };
+
+    const auto date    { headers.Date().GetAsOpt().value_or(entry.responseTime) };
+    const auto ageValue{ headers.Age().GetAsOpt().value_or(seconds::zero()) };
+
+    const auto apparentAge        { std::max(duration_cast<seconds>(entry.responseTime - date), seconds::zero()) };
+    const auto responseDelay      { duration_cast<seconds>(entry.responseTime - entry.requestTime) };
+    const auto correctedAgeValue  { ageValue + responseDelay };
+    const auto correctedInitialAge{ std::max(apparentAge, correctedAgeValue) };
+    const auto residentTime       { duration_cast<seconds>(now - entry.responseTime) };
+
+    return correctedInitialAge + residentTime;
+}
+
+bool HttpCache::IsFresh(const Entry& entry, const RequestHeaders& request, const TimePoint now) {
+    const auto requestDirectives { GetDirectives(request) };
+    const auto responseDirectives{ GetDirectives(entry.head.headers) };
+
+    if (!requestDirectives || !responseDirectives) return false;
+
+    if (HasDirective<NCacheControl::NoCache>(*requestDirectives))  return false;
+    if (HasDirective<NCacheControl::NoCache>(*responseDirectives)) return false;
+
+    const auto lifetime{ FreshnessLifetime(entry) };
+    const auto age     { CurrentAge(entry, now) };
+
+    if (const auto maxAge{ FindDirective<NCacheControl::MaxAge>(*requestDirectives) }; maxAge && age > maxAge->seconds)
+        return false;
+
+    if (const auto minFresh{ FindDirective<NCacheControl::MinFresh>(*requestDirectives) };
+        minFresh && lifetime - age < minFresh->seconds)
+        return false;
+
+    if (lifetime > age) return true;
+
+    if (HasDirective<NCacheControl::MustRevalidate>(*responseDirectives)) return false;
+
+    const auto maxStale{ FindDirective<NCacheControl::MaxStale>(*requestDirectives) };
+    return maxStale && age - lifetime <= maxStale->seconds;
+}
+
+bool HttpCache::VaryMatches(const Entry& entry, const RequestHeaders& request) {
+    return rg::all_of(entry.varyValues, [&](const auto& nominated) {
+        const auto& [key, value]{ nominated };
+        const auto current{ request.Get(key) };
+
+        if (!current || !value) return !current && !value;
+
+        return String::Trimmed(**current) == String::Trimmed(*value);
+    });
+}
+
+bool HttpCache::AddValidators(const Entry& entry, RequestHeaders& request) {
+    if (request.Exists("if-none-match") || request.Exists("if-modified-since"))
+        return false;
+
+    const auto& headers{ entry.head.headers };
+    bool added{};
+
+    // The validators are sent back verbatim, reformatting them could turn a match into a mismatch.
+    if (const auto etag{ headers.Get("etag") })
+        request.Set("if-none-match", **etag), added = true;
+
+    if (const auto lastModified{ headers.Get("last-modified") })
+        request.Set("if-modified-since", **lastModified), added = true;
+
+    return added;
+}
+
+void HttpCache::Freshen(Entry& entry, const ResponseHeaders& notModified, const TimePoint requestTime, const TimePoint responseTime) {
+    std::set<std::string_view> replaced;
+
+    for (const auto& [key, value] : notModified) {
+        if (IsHopByHop(key)) continue;
+
+        if (replaced.insert(key).second)
+            entry.head.headers.Set(key, value);
+        else
+            entry.head.headers.Add(key, value);
+    }
+
+    entry.requestTime  = requestTime;
+    entry.responseTime = responseTime;
+}
+
+
+size_t HttpCache::EntryBytes_(const std::string_view key, const Entry& entry) {
+    size_t bytes{ key.size() + sizeof(Node) };
+
+    for (const auto& [name, value] : entry.head.headers)
+        bytes += name.size() + value.size();
+
+    for (const auto& [name, value] : entry.varyValues)
+        bytes += name.size() + (value ? value->size() : 0);
+
+    return bytes + (entry.body ? entry.body->size() : 0);
+}
+
+void HttpCache::EvictUntil_(const size_t maxBytes) {
+    while (m_bytes > maxBytes && !m_lru.empty()) {
+        const auto& last{ m_lru.back() };
+
+        m_bytes -= last.bytes;
+        m_index.erase(last.key);
+        m_lru.pop_back();
+    }
+}
@@ -23,69 +23,16 @@ namespace Thoth::Http {
             );
     }
 
-    bool UseSemicolon(std::string_view key) {
-        return InsensitiveCmp(key, std::string_view{"cookie"});
-    }
-
-    bool IsSingleValue(std::string_view key) {
-        constexpr std::string_view values[] {
-            // Date/Time Headers
-            "date",
-            "expires",
-            "last-modified",
-            "if-modified-since",
-            "if-unmodified-since",
-            "if-range",
-            "retry-after",
-
-            // Numeric Headers
-            "age",
-            "content-length",
-            "max-forwards",
-
-            // Location/Redirect Headers
-            "location",
-            "refresh",
-            "content-location",
-
-            // Entity Headers
-            "etag",
-            "server",
-            "content-type",
-            "host",
-            "origin",
-            "from",
-
-            // Authorization
-            "authorization",
-            "proxy-authorization"
-        };
-
-        return rg::any_of(values, std::bind_front(InsensitiveCmp, key));
+    bool IsSingleValue(const std::string_view key) {
+        return NHeaders::HeaderInfoOf(NHeaders::HeaderIdOf(key)).singleValue;
     }
-    bool CanMerge(std::string_view key) {
-        constexpr std::string_view values[] {
-            "set-cookie",
-            "www-authenticate",
-            "proxy-authenticate"
-        };
 
-        return rg::none_of(values, std::bind_front(InsensitiveCmp, key));
+    constexpr uint64_t PresenceBit(const NHeaders::HeaderIdEnum id) {
+        return uint64_t{ 1 } << static_cast<size_t>(id);
     }
 
-
-    template<rg::input_range R, class T>
-    [[nodiscard]] constexpr auto FindInsensitiveKey(R&& r, const T& key) {
-        const std::string_view keySv{ key };
-
-        const auto pred = [&](auto&& element) -> bool {
-            const std::string_view elemKeySv{ element.first };
-
-            return InsensitiveCmp(elemKeySv, keySv);
-        };
-
-        return rg::find_if(std::forward<R>(r), pred);
-    }
+    static_assert(static_cast<size_t>(NHeaders::HeaderIdEnum::WwwAuthenticate) < 64,
+        "Headers::m_present has one bit per well-known header.");
 
     template<rg::input_range R, class T>
     [[nodiscard]] constexpr auto FindInsensitiveKeyWithPair(R&& r, const T& p) {
@@ -110,16 +57,18 @@ namespace Thoth::Http {
 
     Headers::Headers(const MapType& initAs) {
         m_headers.reserve(initAs.size());
+        m_ids.reserve(initAs.size());
 
         for (const auto& [key, val] : initAs)
-            m_headers.emplace_back(key | headerSanitizeStr, val);
+            Emplace_(NHeaders::HeaderIdOf(key), key, val);
     }
 
     Headers::Headers(std::initializer_list<HeaderPair> init) {
         m_headers.reserve(init.size());
+        m_ids.reserve(init.size());
 
         for (const auto& [key, val] : init)
-            m_headers.emplace_back(key | headerSanitizeStr, val);
+            Emplace_(NHeaders::HeaderIdOf(key), key, val);
     }
 
     Headers Headers::DefaultHeaders() {
@@ -132,41 +81,104 @@ namespace Thoth::Http {
 
 
 
-    bool Headers::Exists(const HeaderKeyRef key) const {
-        return FindInsensitiveKey(m_headers, key) != m_headers.end();
-    }
+    std::optional<size_t> Headers::Find_(const NHeaders::HeaderIdEnum id, const HeaderKeyRef key) const {
+        if (id != NHeaders::HeaderIdEnum::Unknown) {
+            if (!(m_present & PresenceBit(id)))
+                return std::nullopt;
 
-    bool Headers::Exists(const HeaderPairRef p) const {
-        return FindInsensitiveKeyWithPair(m_headers, p) != m_headers.end();
+            return static_cast<size_t>(rg::find(m_ids, id) - m_ids.begin());
+        }
+
+        for (size_t idx{}; idx < m_headers.size(); ++idx)
+            if (m_ids[idx] == NHeaders::HeaderIdEnum::Unknown && InsensitiveCmp(m_headers[idx].first, key))
+                return idx;
+
+        return std::nullopt;
     }
 
-    bool Headers::Exists(const HeaderKeyRef key, const HeaderValueRef val) const {
-        return Exists({key, val});
+    void Headers::Emplace_(const NHeaders::HeaderIdEnum id, const HeaderKeyRef key, const HeaderValueRef val) {
+        if (id != NHeaders::HeaderIdEnum::Unknown)
+            m_headers.emplace_back(NHeaders::HeaderName(id), val);
+        else
+            m_headers.emplace_back(key | headerSanitizeStr, val);
+
+        m_ids.push_back(id);
+        m_present |= PresenceBit(id);
+        m_parsed.Invalidate(id);
     }
 
+    void Headers::Erase_(const size_t idx) {
+        const auto id{ m_ids[idx] };
 
+        m_headers.erase(m_headers.begin() + static_cast<std::ptrdiff_t>(idx));
+        m_ids.erase(m_ids.begin() + static_cast<std::ptrdiff_t>(idx));
 
-    void Headers::Add(const HeaderPairRef p) {
-        if (IsSingleValue(p.first)) {
-            Set(p);
+        const bool lastOfId{ !rg::contains(m_ids, id) };
+        if (lastOfId)
+            m_present &= ~PresenceBit(id);
+
+        m_parsed.Erase(id, lastOfId);
+    }
+
+    void Headers::Add_(const NHeaders::HeaderIdEnum id, const HeaderKeyRef key, const HeaderValueRef val) {
+        const auto& info{ NHeaders::HeaderInfoOf(id) };
+
+        if (info.singleValue) {
+            Set_(id, key, val);
             return;
         }
 
-        std::string_view sep{ UseSemicolon(p.first) ? "; " : ", " };
+        if (info.mergeable)
+            if (const auto idx{ Find_(id, key) }) {
+                m_parsed.Invalidate(id);
 
-        if (CanMerge(p.first) )
-            if (const auto it{ FindInsensitiveKey(m_headers, p.first) }; it != m_headers.end()) {
+                auto& current{ m_headers[*idx].second };
+                const std::string_view sep{ info.semicolon ? "; " : ", " };
 #ifdef __cpp_lib_ranges_concat
-                it->second.assign_range(vs::concat(it->second, sep, p.second));
+                current.assign_range(vs::concat(current, sep, val));
 #else
-                it->second += sep;
-                it->second += p.second;
+                current += sep;
+                current += val;
 #endif
                 return;
             }
 
+        Emplace_(id, key, val);
+    }
+
+    void Headers::Set_(const NHeaders::HeaderIdEnum id, const HeaderKeyRef key, const HeaderValueRef val) {
+        while (const auto idx{ Find_(id, key) })
+            Erase_(*idx);
+
+        Emplace_(id, key, val);
+    }
+
+
+
+    bool Headers::Exists(const HeaderKeyRef key) const {
+        return Find_(NHeaders::HeaderIdOf(key), key).has_value();
+    }
+
+    bool Headers::Exists(const HeaderPairRef p) const {
+        const auto id{ NHeaders::HeaderIdOf(p.first) };
+        if (id != NHeaders::HeaderIdEnum::Unknown && !(m_present & PresenceBit(id)))
+            return false;
+
+        return FindInsensitiveKeyWithPair(m_headers, p) != m_headers.end();
+    }
+
+    bool Headers::Exists(const HeaderKeyRef key, const HeaderValueRef val) const {
+        return Exists({key, val});
+    }
+
+    bool Headers::Exists(const NHeaders::HeaderIdEnum id) const {
+        return id != NHeaders::HeaderIdEnum::Unknown && (m_present & PresenceBit(id));
+    }
+
 
-        m_headers.emplace_back(p.first| headerSanitizeStr, p.second);
+
+    void Headers::Add(const HeaderPairRef p) {
+        Add_(NHeaders::HeaderIdOf(p.first), p.first, p.second);
     }
 
     void Headers::Add(const HeaderKeyRef key, const HeaderValueRef val) {
@@ -174,11 +186,7 @@ namespace Thoth::Http {
     }
 
     void Headers::Set(const HeaderPairRef p) {
-        std::erase_if(m_headers, [&](const HeaderPair& current) {
-            return InsensitiveCmp(current.first, p.first);
-        });
-
-        m_headers.emplace_back(p.first | headerSanitizeStr, p.second);
+        Set_(NHeaders::HeaderIdOf(p.first), p.first, p.second);
     }
 
     void Headers::Set(const HeaderKeyRef key, const HeaderValueRef val) {
@@ -187,11 +195,11 @@ namespace Thoth::Http {
 
 
     bool Headers::Remove(HeaderKeyRef k) {
-        auto&& it{ FindInsensitiveKey(m_headers, k) };
-        if (it == m_headers.end())
+        const auto idx{ Find_(NHeaders::HeaderIdOf(k), k) };
+        if (!idx)
             return false;
 
-        m_headers.erase(it);
+        Erase_(*idx);
 
         return true;
     }
@@ -201,7 +209,7 @@ namespace Thoth::Http {
         if (it == m_headers.end())
             return false;
 
-        m_headers.erase(it);
+        Erase_(static_cast<size_t>(it - m_headers.begin()));
 
         return true;
     }
@@ -210,11 +218,21 @@ namespace Thoth::Http {
         return Remove({key, val});
     }
 
+    bool Headers::Remove(const NHeaders::HeaderIdEnum id) {
+        if (!Exists(id))
+            return false;
+
+        Erase_(*Find_(id, {}));
+
+        return true;
+    }
+
     bool Headers::SetIfNull(HeaderPairRef p) {
-        if (Exists(p.first))
+        const auto id{ NHeaders::HeaderIdOf(p.first) };
+        if (Find_(id, p.first))
             return false;
 
-        Set(p);
+        Set_(id, p.first, p.second);
         return true;
     }
 
@@ -225,39 +243,58 @@ namespace Thoth::Http {
 
 
     std::optional<Headers::HeaderValue*> Headers::Get(HeaderKeyRef key) {
-        const auto it{  FindInsensitiveKey(m_headers, key) };
+        const auto id{ NHeaders::HeaderIdOf(key) };
+        m_parsed.Expose(id);
 
-        if (it != m_headers.end())
-            return &it->second;
+        if (const auto idx{ Find_(id, key) })
+            return &m_headers[*idx].second;
 
         return std::nullopt;
     }
 
     std::optional<const Headers::HeaderValue*> Headers::Get(HeaderKeyRef key) const {
-        const auto it{  FindInsensitiveKey(m_headers, key) };
-
-        if (it != m_headers.end())
-            return &it->second;
+        if (const auto idx{ Find_(NHeaders::HeaderIdOf(key), key) })
+            return &m_headers[*idx].second;
 
         return std::nullopt;
     }
 
+    std::optional<Headers::HeaderValue*> Headers::Get(const NHeaders::HeaderIdEnum id) {
+        m_parsed.Expose(id);
+
+        if (!Exists(id))
+            return std::nullopt;
+
+        return &m_headers[*Find_(id, {})].second;
+    }
+
+    std::optional<const Headers::HeaderValue*> Headers::Get(const NHeaders::HeaderIdEnum id) const {
+        if (!Exists(id))
+            return std::nullopt;
+
+        return &m_headers[*Find_(id, {})].second;
+    }
+
     std::vector<Headers::HeaderRef> Headers::GetAll(const HeaderKeyRef key) {
+        const auto id{ NHeaders::HeaderIdOf(key) };
         std::vector<HeaderRef> res;
 
-        for (auto& p : m_headers)
-            if (InsensitiveCmp(p.first, key))
-                res.push_back(&p);
+        m_parsed.Expose(id);
+
+        for (size_t idx{}; idx < m_headers.size(); ++idx)
+            if (m_ids[idx] == id && (id != NHeaders::HeaderIdEnum::Unknown || InsensitiveCmp(m_headers[idx].first, key)))
+                res.push_back(&m_headers[idx]);
 
         return res;
     }
 
     std::vector<Headers::ConstHeaderRef> Headers::GetAll(const HeaderKeyRef key) const {
+        const auto id{ NHeaders::HeaderIdOf(key) };
         std::vector<ConstHeaderRef> res;
 
-        for (const auto& p : m_headers)
-            if (InsensitiveCmp(p.first, key))
-                res.push_back(&p);
+        for (size_t idx{}; idx < m_headers.size(); ++idx)
+            if (m_ids[idx] == id && (id != NHeaders::HeaderIdEnum::Unknown || InsensitiveCmp(m_headers[idx].first, key)))
+                res.push_back(&m_headers[idx]);
 
         return res;
     }
@@ -387,17 +424,29 @@ namespace Thoth::Http {
     }
 
 
-    Headers::IterType Headers::begin() { return m_headers.begin(); }
+    Headers::IterType Headers::begin() {
+        m_parsed.ExposeAll();
+        return m_headers.begin();
+    }
 
-    Headers::IterType Headers::end() { return m_headers.end(); }
+    Headers::IterType Headers::end() {
+        m_parsed.ExposeAll();
+        return m_headers.end();
+    }
 
     Headers::CIterType Headers::begin() const { return m_headers.cbegin(); }
 
     Headers::CIterType Headers::end() const { return m_headers.cend(); }
 
-    Headers::RIterType Headers::rbegin() { return m_headers.rbegin(); }
+    Headers::RIterType Headers::rbegin() {
+        m_parsed.ExposeAll();
+        return m_headers.rbegin();
+    }
 
-    Headers::RIterType Headers::rend() { return m_headers.rend(); }
+    Headers::RIterType Headers::rend() {
+        m_parsed.ExposeAll();
+        return m_headers.rend();
+    }
 
     Headers::CRIterType Headers::rbegin() const { return m_headers.crbegin(); }
 
@@ -405,7 +454,12 @@ namespace Thoth::Http {
 
 
 
-    void Headers::Clear() { m_headers.clear(); }
+    void Headers::Clear() {
+        m_headers.clear();
+        m_ids.clear();
+        m_present = 0;
+        m_parsed.Clear();
+    }
 
     size_t Headers::Size() const { return m_headers.size(); }
 
@@ -414,10 +468,12 @@ namespace Thoth::Http {
 
 
     Headers::HeaderValue& Headers::operator[](HeaderKeyRef key) {
-        if (const auto it{  FindInsensitiveKey(m_headers, key) }; it != m_headers.end())
-            return it->second;
+        const auto id{ NHeaders::HeaderIdOf(key) };
+        m_parsed.Expose(id);
+        if (const auto idx{ Find_(id, key) })
+            return m_headers[*idx].second;
 
-        m_headers.emplace_back(key | headerSanitizeStr, string{});
+        Emplace_(id, key, {});
         return m_headers.back().second;
     }
 
@@ -0,0 +1,135 @@
+#include <Thoth/Http/NHeaders/HeadersView.hpp>
+#include <Thoth/Http/NHeaders/HeaderBlock.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <span>
+
+
+namespace Thoth::Http {
+    namespace rg = std::ranges;
+
+    std::expected<HeadersView, MessageParseErrorEnum> HeadersView::Parse(std::string block, const size_t maxHeadersLength) {
+        if (block.size() > maxHeadersLength || block.size() > std::numeric_limits<uint32_t>::max())
+            return std::unexpected{ MessageParseErrorEnum::HeadersTooLarge };
+
+        HeadersView res;
+        res.m_block = std::move(block);
+        res.m_fields.reserve(static_cast<size_t>(rg::count(res.m_block, '\n')) + 1);
+
+        const auto* base{ res.m_block.data() };
+        bool nameTooLong{};
+
+        const auto scanRes{ NHeaders::details_::ScanHeaderBlock(res.m_block,
+            [&](const NHeaders::HeaderIdEnum id, const std::string_view name, const std::string_view value) {
+                nameTooLong |= name.size() > std::numeric_limits<uint16_t>::max();
+
+                res.m_fields.push_back({
+                    .nameOffset  = static_cast<uint32_t>(name.data() - base),
+                    .valueOffset = static_cast<uint32_t>(value.data() - base),
+                    .valueSize   = static_cast<uint32_t>(value.size()),
+                    .nameSize    = static_cast<uint16_t>(name.size()),
+                    .id          = id
+                });
+                res.m_present |= uint64_t{ 1 } << static_cast<size_t>(id);
+            }) };
+
+        if (!scanRes)
+            return std::unexpected{ scanRes.error() };
+        if (nameTooLong)
+            return std::unexpected{ MessageParseErrorEnum::InvalidHeaders };
+
+        // Names are tokens, lower-casing them in place keeps every offset.
+        for (const auto& entry : res.m_fields)
+            for (auto& c : std::span{ res.m_block.data() + entry.nameOffset, entry.nameSize })
+                if ('A' <= c && c <= 'Z')
+                    c = static_cast<char>(c - 'A' + 'a');
+
+        return res;
+    }
+
+
+
+    std::optional<size_t> HeadersView::Find_(const NHeaders::HeaderIdEnum id, const HeaderKeyRef key) const {
+        if (id != NHeaders::HeaderIdEnum::Unknown) {
+            if (!Exists(id))
+                return std::nullopt;
+
+            return static_cast<size_t>(rg::find(m_fields, id, &Entry_::id) - m_fields.begin());
+        }
+
+        for (size_t idx{}; idx < m_fields.size(); ++idx)
+            if (m_fields[idx].id == NHeaders::HeaderIdEnum::Unknown && InsensitiveCmp(Field_(m_fields[idx]).name, key))
+                return idx;
+
+        return std::nullopt;
+    }
+
+    HeadersView::Field HeadersView::Field_(const Entry_& entry) const {
+        return {
+            .name  = std::string_view{ m_block }.substr(entry.nameOffset, entry.nameSize),
+            .value = std::string_view{ m_block }.substr(entry.valueOffset, entry.valueSize),
+            .id    = entry.id
+        };
+    }
+
+
+
+    bool HeadersView::Exists(const HeaderKeyRef key) const {
+        return Find_(NHeaders::HeaderIdOf(key), key).has_value();
+    }
+
+    bool HeadersView::Exists(const NHeaders::HeaderIdEnum id) const {
+        return id != NHeaders::HeaderIdEnum::Unknown && (m_present & uint64_t{ 1 } << static_cast<size_t>(id));
+    }
+
+    std::optional<std::string_view> HeadersView::Get(const HeaderKeyRef key) const {
+        if (const auto idx{ Find_(NHeaders::HeaderIdOf(key), key) })
+            return Field_(m_fields[*idx]).value;
+
+        return std::nullopt;
+    }
+
+    std::optional<std::string_view> HeadersView::Get(const NHeaders::HeaderIdEnum id) const {
+        if (const auto idx{ Find_(id, {}) })
+            return Field_(m_fields[*idx]).value;
+
+        return std::nullopt;
+    }
+
+    std::vector<std::string_view> HeadersView::GetAll(const HeaderKeyRef key) const {
+        const auto id{ NHeaders::HeaderIdOf(key) };
+        std::vector<std::string_view> res;
+
+        for (const auto& entry : m_fields) {
+            const auto field{ Field_(entry) };
+            if (entry.id == id && (id != NHeaders::HeaderIdEnum::Unknown || InsensitiveCmp(field.name, key)))
+                res.push_back(field.value);
+        }
+
+        return res;
+    }
+
+    HeadersView::Field HeadersView::operator[](const size_t idx) const {
+        return Field_(m_fields[idx]);
+    }
+
+    size_t HeadersView::Size() const { return m_fields.size(); }
+
+    bool HeadersView::Empty() const { return m_fields.empty(); }
+
+    std::string_view HeadersView::Block() const { return m_block; }
+
+
+
+    Headers HeadersView::ToHeaders() const {
+        Headers res;
+
+        for (const auto& entry : m_fields) {
+            const auto field{ Field_(entry) };
+            res.Add(field.name, field.value);
+        }
+
+        return res;
+    }
+}
@@ -0,0 +1,85 @@
+#include <Thoth/Http/NHeaders/ParsedCache.hpp>
+
+#include <algorithm>
+#include <utility>
+
+
+namespace Thoth::Http::NHeaders::details_ {
+    ParsedCache::ParsedCache(const ParsedCache&) noexcept { }
+
+    // The moved fields keep their addresses, and so the references to them.
+    ParsedCache::ParsedCache(ParsedCache&& other) noexcept
+        : m_slots{ std::move(other.m_slots) }, m_next{ other.m_next }, m_exposed{ std::exchange(other.m_exposed, 0) } {
+        for (auto& slot : other.m_slots)
+            slot.Reset();
+    }
+
+    // The fields may be assigned in place, a reference handed out before now sees any ID.
+    ParsedCache& ParsedCache::operator=(const ParsedCache&) noexcept {
+        for (auto& slot : m_slots)
+            slot.Reset();
+        if (m_exposed)
+            ExposeAll();
+        return *this;
+    }
+
+    ParsedCache& ParsedCache::operator=(ParsedCache&& other) noexcept {
+        m_slots   = std::move(other.m_slots);
+        m_next    = other.m_next;
+        m_exposed = std::exchange(other.m_exposed, 0);
+
+        for (auto& slot : other.m_slots)
+            slot.Reset();
+        return *this;
+    }
+
+    void ParsedCache::Invalidate(const HeaderIdEnum id) noexcept {
+        if (id == HeaderIdEnum::Unknown)
+            return;
+
+        for (auto& slot : m_slots)
+            if (slot.id == id)
+                slot.Reset();
+    }
+
+    void ParsedCache::Expose(const HeaderIdEnum id) noexcept {
+        Invalidate(id);
+        if (id != HeaderIdEnum::Unknown)
+            m_exposed |= Bit_(id);
+    }
+
+    void ParsedCache::ExposeAll() noexcept {
+        for (auto& slot : m_slots)
+            slot.Reset();
+        m_exposed = ~uint64_t{};
+    }
+
+    void ParsedCache::Erase(const HeaderIdEnum id, const bool lastOfId) noexcept {
+        Invalidate(id);
+        // The references to its fields died with them.
+        if (lastOfId && id != HeaderIdEnum::Unknown)
+            m_exposed &= ~Bit_(id);
+    }
+
+    void ParsedCache::Clear() noexcept {
+        for (auto& slot : m_slots)
+            slot.Reset();
+        m_exposed = 0;
+    }
+
+    bool ParsedCache::Slot::Matches(
+        const HeaderIdEnum id, const void* type, const std::span<const std::string_view> pattern) const {
+        // By address: the same literal, not merely the same text.
+        const auto sameView{ [](const std::string_view a, const std::string_view b) {
+            return a.data() == b.data() && a.size() == b.size();
+        } };
+
+        return this->id == id && this->type == type && patternSize == pattern.size()
+            && std::ranges::equal(pattern, std::span{ this->pattern }.first(patternSize), sameView);
+    }
+
+    void ParsedCache::Slot::Reset() noexcept {
+        id = HeaderIdEnum::Unknown;
+        value.reset();
+    }
+}
@@ -9,6 +9,12 @@ ValueProxy<false, std::string> RequestHeaders::Authorization() {
 ValueProxy<true, std::string> RequestHeaders::Authorization() const {
     return { "authorization", *this };
 }
+ValueProxy<false, BasicCredentials> RequestHeaders::BasicAuthorization() {
+    return { "authorization", *this };
+}
+ValueProxy<true, BasicCredentials> RequestHeaders::BasicAuthorization() const {
+    return { "authorization", *this };
+}
 ValueProxy<false, std::string> RequestHeaders::Host() {
     return { "host", *this };
 }
@@ -55,8 +61,12 @@ ListProxy<true, Range> RequestHeaders::Range() const {
     return { "range", *this };
 }
 
-// ValueProxy<false, std::string> RequestHeaders::CacheControl();
-// ValueProxy<true, std::string> RequestHeaders::CacheControl() const;
+ListProxy<false, NHeaders::CacheControl> RequestHeaders::CacheControl() {
+    return { "cache-control", *this };
+}
+ListProxy<true, NHeaders::CacheControl> RequestHeaders::CacheControl() const {
+    return { "cache-control", *this };
+}
 
 ValueProxy<false, std::chrono::utc_clock::time_point> RequestHeaders::IfModifiedSince() {
     return { "if-modified-since", *this };
@@ -40,6 +40,14 @@ ValueProxy<true, AcceptRanges> Thoth::Http::ResponseHeaders::AcceptRanges() cons
     return { "accept-ranges", *this };
 }
 
+ValueProxy<false, ContentRange> Thoth::Http::ResponseHeaders::ContentRange() {
+    return { "content-range", *this };
+}
+
+ValueProxy<true, ContentRange> Thoth::Http::ResponseHeaders::ContentRange() const {
+    return { "content-range", *this };
+}
+
 ListProxy<false, MimeType> Thoth::Http::ResponseHeaders::AcceptPatch() {
     return { "accept-patch", *this };
 }
@@ -64,6 +72,14 @@ ValueProxy<true, std::chrono::seconds> Thoth::Http::ResponseHeaders::Age() const
     return { "age", *this }; // %Q for outPattern
 }
 
+ListProxy<false, CacheControl> Thoth::Http::ResponseHeaders::CacheControl() {
+    return { "cache-control", *this };
+}
+
+ListProxy<true, CacheControl> Thoth::Http::ResponseHeaders::CacheControl() const {
+    return { "cache-control", *this };
+}
+
 ValueProxy<false, EntityTag> Thoth::Http::ResponseHeaders::EntityTag() {
     return { "etag", *this };
 }
@@ -72,6 +88,22 @@ ValueProxy<true, EntityTag> Thoth::Http::ResponseHeaders::EntityTag() const {
     return { "etag", *this };
 }
 
+ValueProxy<false, std::chrono::utc_clock::time_point> Thoth::Http::ResponseHeaders::Expires() {
+    return { "expires", *this };
+}
+
+ValueProxy<true, std::chrono::utc_clock::time_point> Thoth::Http::ResponseHeaders::Expires() const {
+    return { "expires", *this };
+}
+
+ValueProxy<false, std::chrono::utc_clock::time_point> Thoth::Http::ResponseHeaders::LastModified() {
+    return { "last-modified", *this };
+}
+
+ValueProxy<true, std::chrono::utc_clock::time_point> Thoth::Http::ResponseHeaders::LastModified() const {
+    return { "last-modified", *this };
+}
+
 ValueProxy<false, std::string> Thoth::Http::ResponseHeaders::Location() {
     return { "location", *this };
 }
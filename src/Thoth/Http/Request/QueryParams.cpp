@@ -27,13 +27,19 @@ namespace Thoth::Http {
             };
         };
 
-        QueryParams params{};
+        std::vector<QueryPair> pairs;
         for (const auto rawParam : paramsStr | vs::split('&')) {
-            const auto [r, l] = splitBetween(rawParam);
+            auto [r, l] = splitBetween(rawParam);
 
-            params[r].emplace_back(l);
+            pairs.emplace_back(std::move(r), QueryValues{ std::move(l) });
         }
 
+        // The values of a repeated key are appended in the order they were given.
+        QueryParams params{};
+        params.m_elements = MapType::FromUnsorted(std::move(pairs), [](QueryValues& kept, QueryValues&& repeated) {
+            kept.insert(kept.end(), std::make_move_iterator(repeated.begin()), std::make_move_iterator(repeated.end()));
+        });
+
         return params;
     }
 
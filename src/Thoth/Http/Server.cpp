@@ -0,0 +1,853 @@
+#include <Thoth/Http/Server.hpp>
+#include <Thoth/Http/Request/Request.hpp>
+#include <Thoth/Http/_base/Http1.hpp>
+#include <Thoth/String/Utils.hpp>
+#include <Thoth/Utils/Ranges/SharedInputView.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <charconv>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <format>
+#include <mutex>
+#include <ranges>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#ifdef __linux__
+#include <arpa/inet.h>
+#include <cerrno>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/sendfile.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+
+using namespace Thoth;
+using namespace Thoth::Http;
+
+#ifdef __linux__
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+    using details_::Http1;
+    using details_::k_crlf;
+    using details_::k_crlfCrlf;
+
+    constexpr size_t k_readBlockSize{ 64 * 1024 };
+    constexpr int k_maxEvents{ 256 };
+
+    // File bytes sent to one connection before the loop serves the others, a fast reader can't starve them.
+    constexpr uint64_t k_fileFlushBudget{ 4 << 20 };
+
+    // The longest chunk-size line accepted, same bound as Http1::ParseBody.
+    constexpr size_t k_maxChunkLineLength{ 64 };
+
+
+    bool HasToken(const Headers& headers, const std::string_view defaultValue, const std::string_view token) {
+        const auto values{ headers.Connection().GetWithDefault({ std::string{ defaultValue } }) };
+        if (!values) return false;
+
+        return std::ranges::any_of(*values, [&](const std::string_view val) {
+            return std::ranges::equal(val, token, &String::CaseInsensitiveCompare);
+        });
+    }
+
+    // RFC 9112 §9.3, persistence is the default since 1.1 and opt-in before.
+    bool WantsKeepAlive(const Headers& headers, const VersionEnum version) {
+        if (version == VersionEnum::HTTP1_0)
+            return HasToken(headers, "close", "keep-alive");
+
+        return !HasToken(headers, "keep-alive", "close");
+    }
+
+    // RFC 9110 §6.4.1, these never have content.
+    bool IsBodyless(const StatusCodeEnum status) {
+        return GetStatusType(status) == StatusTypeEnum::INFORMATIONAL
+            || status == StatusCodeEnum::NoContent || status == StatusCodeEnum::NotModified;
+    }
+
+    //! The head and in-memory body of `res`, its file body is reset when it mustn't be sent.
+    std::string Serialize(ServerResponse& res, const VersionEnum version, const bool isHead, const bool keepAlive) {
+        res.version = version == VersionEnum::HTTP1_0 ? VersionEnum::HTTP1_0 : VersionEnum::HTTP1_1;
+        if (res.statusMessage.empty())
+            res.statusMessage = GetReasonPhrase(res.status);
+
+        const bool bodyless{ IsBodyless(res.status) };
+
+        res.headers.Remove(NHeaders::HeaderIdEnum::TransferEncoding);
+        if (bodyless) res.headers.Remove(NHeaders::HeaderIdEnum::ContentLength);
+        else          res.headers.ContentLength().Set(res.file ? res.file->length : res.body.size());
+
+        if (bodyless || isHead)
+            res.file.reset();
+
+        if (!keepAlive)                              res.headers.Set("connection", "close");
+        else if (version == VersionEnum::HTTP1_0)    res.headers.Set("connection", "keep-alive");
+
+        auto out{ std::format("{}", static_cast<const ResponseHead&>(res)) };
+        if (!bodyless && !isHead && !res.file)
+            out += res.body;
+
+        return out;
+    }
+
+    std::string ErrorResponse(const StatusCodeEnum status) {
+        ServerResponse res{ { .status = status, .headers = {} } };
+        return Serialize(res, VersionEnum::HTTP1_1, false, false);
+    }
+
+
+    // A request whose head is parsed, waiting for the rest of its body.
+    struct PendingRequest {
+        ServerRequest request;
+        size_t headSize{};
+        std::optional<size_t> contentLength;
+        bool chunked{};
+        // Where the chunked scan resumes, the chunks before it are complete.
+        size_t scanned{};
+    };
+
+    //! Finds the end of the chunked body that starts at `bodyStart`, nullopt while it isn't all received.
+    std::expected<std::optional<size_t>, StatusCodeEnum> ScanChunked(
+        const std::string_view buf, const size_t bodyStart, size_t& pos, const size_t maxBodyLength) {
+        while (true) {
+            const auto lineEnd{ buf.find(k_crlf, pos) };
+            if (lineEnd == std::string_view::npos) {
+                if (buf.size() - pos > k_maxChunkLineLength + k_crlf.size())
+                    return std::unexpected{ StatusCodeEnum::BadRequest };
+                return std::nullopt;
+            }
+
+            const auto line{ buf.substr(pos, lineEnd - pos) };
+            size_t size{};
+            const auto [ptr, ec]{ std::from_chars(line.data(), line.data() + line.size(), size, 16) };
+            if (line.empty() || ec != std::errc{} || ptr != line.data() + line.size())
+                return std::unexpected{ StatusCodeEnum::BadRequest };
+
+            // The last chunk, trailers aren't supported (as in Http1::ParseBody).
+            if (size == 0) {
+                const auto end{ lineEnd + 2 * k_crlf.size() };
+                if (buf.size() < end) return std::nullopt;
+                if (buf.substr(lineEnd + k_crlf.size(), k_crlf.size()) != k_crlf)
+                    return std::unexpected{ StatusCodeEnum::BadRequest };
+                return end;
+            }
+
+            if (size > maxBodyLength || lineEnd + size - bodyStart > maxBodyLength)
+                return std::unexpected{ StatusCodeEnum::ContentTooLarge };
+
+            const auto chunkEnd{ lineEnd + k_crlf.size() + size + k_crlf.size() };
+            if (buf.size() < chunkEnd) return std::nullopt;
+            if (buf.substr(chunkEnd - k_crlf.size(), k_crlf.size()) != k_crlf)
+                return std::unexpected{ StatusCodeEnum::BadRequest };
+
+            pos = chunkEnd;
+        }
+    }
+
+    //! RFC 9112 §3.3, rebuilds the target URI from the request-target and Host.
+    std::expected<Url, StatusCodeEnum> ReconstructUrl(
+        const Http1::RequestLine& line, const RequestHead& head, const std::string_view fallbackAuthority) {
+        using enum StatusCodeEnum;
+
+        if (line.method == "CONNECT") return std::unexpected{ NotImplemented };
+
+        const auto host{ head.headers.Host().Get() };
+        if (!host && (head.version != VersionEnum::HTTP1_0 || head.headers.Exists("host")))
+            return std::unexpected{ BadRequest };
+
+        const std::string_view authority{ host ? std::string_view{ *host } : fallbackAuthority };
+
+        std::expected<Url, ThothError> url{ ThothUnex{ MessageParseErrorEnum::InvalidStartLine } };
+        if (line.target.starts_with('/'))
+            url = Url::FromUrl(std::format("http://{}{}", authority, line.target));
+        else if (line.target == "*" && line.method == "OPTIONS")
+            url = Url::FromUrl(std::format("http://{}/", authority));
+        else if (line.target.starts_with("http://") || line.target.starts_with("https://"))
+            url = Url::FromUrl(line.target);
+
+        if (!url) return std::unexpected{ BadRequest };
+        return std::move(*url);
+    }
+
+    std::expected<PendingRequest, StatusCodeEnum> ParseHead(
+        const std::string_view raw, const std::string_view fallbackAuthority, const size_t maxBodyLength) {
+        using Stream = Utils::SharedInputView<std::string_view>;
+        using enum StatusCodeEnum;
+
+        // Url has no empty state, the real one is only known once Host is parsed.
+        static const Url k_placeholder{ Url::FromUrl("http://localhost/").value() };
+
+        const auto toStatus{ [](const ThothError& error) {
+            return error == MessageParseErrorEnum::HeadersTooLarge ? RequestHeaderFieldsTooLarge : BadRequest;
+        } };
+
+        auto lineRes{ Http1::ParseRequestLine(details_::RequestParseStage<Stream>{
+            { .url = k_placeholder, .headers = {} }, Stream{ std::string_view{ raw } }
+        }) };
+        if (!lineRes) return std::unexpected{ toStatus(lineRes.error()) };
+
+        auto& [line, stage]{ *lineRes };
+
+        // No field at all: the request line is directly followed by the empty line.
+        if (raw.find(k_crlf) + k_crlfCrlf.size() != raw.size()) {
+            auto headersRes{ Http1::ParseHeaders(std::move(stage)) };
+            if (!headersRes) return std::unexpected{ toStatus(headersRes.error()) };
+
+            stage = std::move(*headersRes);
+        }
+
+        auto url{ ReconstructUrl(line, stage.data, fallbackAuthority) };
+        if (!url) return std::unexpected{ url.error() };
+
+        PendingRequest res{
+            .request  = { { std::move(*url), stage.data.version, std::move(stage.data.headers) }, std::move(line.method), {} },
+            .headSize = raw.size()
+        };
+
+        const auto& headers{ res.request.headers };
+        if (headers.Exists(NHeaders::HeaderIdEnum::TransferEncoding)) {
+            // Http1::ParseHeaders already refused any other transfer coding.
+            if (res.request.version == VersionEnum::HTTP1_0) return std::unexpected{ BadRequest };
+            res.chunked = true;
+        } else if (headers.Exists(NHeaders::HeaderIdEnum::ContentLength)) {
+            const auto length{ headers.ContentLength().Get() };
+            if (!length) return std::unexpected{ BadRequest };
+            if (*length > maxBodyLength) return std::unexpected{ ContentTooLarge };
+
+            res.contentLength = static_cast<size_t>(*length);
+        }
+
+        return res;
+    }
+
+    //! De-frames the body in `framed` through Http1::ParseBody, the same path the client reads responses with.
+    std::expected<std::string, ThothError> ReadBody(RequestHead& head, const std::string_view framed) {
+        using Stream = Utils::SharedInputView<std::string_view>;
+        using Stage  = details_::RequestParseCompleteStage<Stream, std::string>;
+
+        auto res{ Http1::ParseBody(Stage{ { std::move(head), Stream{ std::string_view{ framed } } }, {} }) };
+        if (!res) return ThothUnex{ res.error() };
+
+        head = std::move(res->data);
+        return std::move(res->body);
+    }
+
+    bool ExpectsContinue(const Headers& headers) {
+        const auto expect{ headers.Get("expect") };
+        return expect && std::ranges::equal(**expect, std::string_view{ "100-continue" }, &String::CaseInsensitiveCompare);
+    }
+}
+
+
+namespace Thoth::Http::details_ {
+    struct ServerLoop;
+
+    struct ServerJob {
+        ServerLoop* loop;
+        int fd;
+        uint64_t connId;
+        ServerRequest request;
+    };
+
+    //! Bytes to write, then the file part if any.
+    struct ServerOutput {
+        std::string bytes;
+        std::optional<ServerFileBody> file;
+    };
+
+    struct ServerCompletion {
+        int fd;
+        uint64_t connId;
+        ServerOutput output;
+        bool keepAlive;
+    };
+
+    struct ServerConnection {
+        int fd;
+        uint64_t id;
+
+        std::string in;
+        std::deque<ServerOutput> out;
+        // Progress in `out.front()`, its file part counted after its bytes.
+        uint64_t outOffset{};
+
+        std::optional<PendingRequest> pending;
+
+        // A request is with the workers, the next ones wait (responses must keep the request order).
+        bool busy{};
+        // Close as soon as `out` is written.
+        bool closing{};
+        bool peerClosed{};
+
+        uint32_t events{};
+        Clock::time_point lastActive{ Clock::now() };
+    };
+
+
+    struct ServerState {
+        ServerHandler handler;
+        ServerOptions opts;
+        uint16_t port{};
+        std::string authority;
+
+        std::atomic<bool> stopping{};
+
+        std::vector<std::unique_ptr<ServerLoop>> loops;
+        std::vector<std::jthread> loopThreads;
+
+        std::mutex jobsMutex;
+        std::condition_variable jobsCv;
+        std::deque<ServerJob> jobs;
+        bool workersDone{};
+        std::vector<std::jthread> workers;
+
+        ~ServerState() { Stop(); }
+
+        void Stop();
+        void Submit(ServerJob job);
+        void WorkerLoop();
+    };
+
+
+    //! One acceptor: a `SO_REUSEPORT` listener and the connections it accepted, all driven by one epoll.
+    struct ServerLoop {
+        ServerState& state;
+        int listenFd{ -1 };
+        int epollFd{ -1 };
+        int wakeFd{ -1 };
+
+        std::unordered_map<int, ServerConnection> connections;
+        uint64_t nextId{};
+
+        std::array<char, k_readBlockSize> readBuffer;
+
+        std::mutex completionsMutex;
+        std::vector<ServerCompletion> completions;
+
+        explicit ServerLoop(ServerState& state) : state{ state } {}
+
+        ServerLoop(const ServerLoop&) = delete;
+        ServerLoop& operator=(const ServerLoop&) = delete;
+
+        ~ServerLoop() {
+            for (const int fd : { listenFd, epollFd, wakeFd })
+                if (fd != -1) close(fd);
+        }
+
+        std::expected<std::monostate, ThothError> Open(const sockaddr_storage& addr, socklen_t addrLen);
+        void Run();
+
+        //! Called by the workers.
+        void Post(ServerCompletion completion);
+
+    private:
+        void Accept_();
+        void OnReadable_(ServerConnection& conn);
+        void OnCompletions_();
+
+        void Advance_(ServerConnection& conn);
+        void Reject_(ServerConnection& conn, StatusCodeEnum status);
+        void Flush_(ServerConnection& conn);
+        void UpdateInterest_(ServerConnection& conn);
+        void Close_(ServerConnection& conn);
+        void SweepIdle_();
+    };
+}
+
+using namespace Thoth::Http::details_;
+
+
+#pragma region ServerLoop
+
+std::expected<std::monostate, ThothError> ServerLoop::Open(const sockaddr_storage& addr, const socklen_t addrLen) {
+    listenFd = socket(addr.ss_family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (listenFd == -1) return ThothUnex{{ GenericError{ "Unable to create the server socket" } }};
+
+    constexpr int on{ 1 };
+    setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    if (setsockopt(listenFd, SOL_SOCKET, SO_REUSEPORT, &on, sizeof(on)) == -1)
+        return ThothUnex{{ GenericError{ "SO_REUSEPORT is not supported" } }};
+
+    if (bind(listenFd, reinterpret_cast<const sockaddr*>(&addr), addrLen) == -1)
+        return ThothUnex{{ GenericError{ std::format("Unable to bind: {}", std::strerror(errno)) } }};
+
+    if (listen(listenFd, SOMAXCONN) == -1)
+        return ThothUnex{{ GenericError{ "Unable to listen" } }};
+
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+    wakeFd  = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (epollFd == -1 || wakeFd == -1)
+        return ThothUnex{{ GenericError{ "Unable to create the event loop" } }};
+
+    for (const int fd : { listenFd, wakeFd }) {
+        epoll_event ev{ .events = EPOLLIN, .data = { .fd = fd } };
+        epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &ev);
+    }
+
+    return std::monostate{};
+}
+
+void ServerLoop::Run() {
+    std::array<epoll_event, k_maxEvents> events;
+
+    const auto sweepEvery{ std::clamp<std::chrono::milliseconds>(
+        state.opts.keepAliveTimeout / 2, std::chrono::milliseconds{ 10 }, std::chrono::seconds{ 1 }) };
+    auto nextSweep{ Clock::now() + sweepEvery };
+
+    while (!state.stopping.load(std::memory_order_relaxed)) {
+        const int count{ epoll_wait(epollFd, events.data(), k_maxEvents, static_cast<int>(sweepEvery.count())) };
+        if (count == -1 && errno != EINTR) break;
+
+        for (int i{}; i < count; ++i) {
+            const int fd{ events[i].data.fd };
+            const uint32_t flags{ events[i].events };
+
+            if (fd == listenFd) { Accept_(); continue; }
+            if (fd == wakeFd)   { OnCompletions_(); continue; }
+
+            const auto it{ connections.find(fd) };
+            if (it == connections.end()) continue;
+            auto& conn{ it->second };
+
+            // Both directions are shut, nothing can be answered anymore.
+            if (flags & (EPOLLHUP | EPOLLERR)) {
+                Close_(conn);
+                continue;
+            }
+
+            if (flags & EPOLLIN) {
+                OnReadable_(conn);
+                if (!connections.contains(fd)) continue;
+            }
+            if (flags & EPOLLOUT)
+                Flush_(conn);
+        }
+
+        if (const auto now{ Clock::now() }; now >= nextSweep) {
+            SweepIdle_();
+            nextSweep = now + sweepEvery;
+        }
+    }
+
+    // Workers may still answer, their completions are dropped with the connections.
+    for (auto& conn : connections | std::views::values)
+        close(conn.fd);
+    connections.clear();
+}
+
+void ServerLoop::Post(ServerCompletion completion) {
+    {
+        std::lock_guard lock{ completionsMutex };
+        completions.emplace_back(std::move(completion));
+    }
+
+    constexpr uint64_t one{ 1 };
+    (void)write(wakeFd, &one, sizeof(one));
+}
+
+void ServerLoop::Accept_() {
+    while (true) {
+        const int fd{ accept4(listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC) };
+        if (fd == -1) {
+            if (errno == EINTR || errno == ECONNABORTED) continue;
+            return; // EAGAIN, or out of descriptors: retried on the next wake up.
+        }
+
+        constexpr int on{ 1 };
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+
+        auto& conn{ connections.insert_or_assign(fd, ServerConnection{ .fd = fd, .id = nextId++ }).first->second };
+        epoll_event ev{ .events = EPOLLIN, .data = { .fd = fd } };
+        if (epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &ev) == -1) {
+            Close_(conn);
+            continue;
+        }
+        conn.events = EPOLLIN;
+    }
+}
+
+void ServerLoop::OnReadable_(ServerConnection& conn) {
+    conn.lastActive = Clock::now();
+
+    const size_t readLimit{ state.opts.maxHeadLength + state.opts.maxBodyLength };
+    while (conn.in.size() < readLimit) {
+        const auto got{ recv(conn.fd, readBuffer.data(), readBuffer.size(), 0) };
+        if (got > 0) {
+            conn.in.append(readBuffer.data(), static_cast<size_t>(got));
+            continue;
+        }
+        if (got == 0) { conn.peerClosed = true; break; }
+        if (errno == EINTR) continue;
+        if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+
+        Close_(conn);
+        return;
+    }
+
+    Advance_(conn);
+}
+
+void ServerLoop::OnCompletions_() {
+    uint64_t count;
+    (void)read(wakeFd, &count, sizeof(count));
+
+    std::vector<ServerCompletion> ready;
+    {
+        std::lock_guard lock{ completionsMutex };
+        ready.swap(completions);
+    }
+
+    for (auto& [fd, connId, output, keepAlive] : ready) {
+        const auto it{ connections.find(fd) };
+        // The connection was closed meanwhile, the descriptor may even belong to another one now.
+        if (it == connections.end() || it->second.id != connId) continue;
+
+        auto& conn{ it->second };
+        conn.busy       = false;
+        conn.closing    = !keepAlive;
+        conn.lastActive = Clock::now();
+
+        conn.out.push_back(std::move(output));
+
+        Flush_(conn);
+        if (connections.contains(fd))
+            Advance_(conn);
+    }
+}
+
+void ServerLoop::Advance_(ServerConnection& conn) {
+    const auto& opts{ state.opts };
+
+    // One request at a time per connection, pipelined ones stay in `in` until the previous is answered.
+    while (!conn.busy && !conn.closing) {
+        if (!conn.pending) {
+            // RFC 9112 §2.2, empty lines before a request are ignored.
+            const auto leading{ conn.in.find_first_not_of(k_crlf) };
+            conn.in.erase(0, std::min(leading, conn.in.size()));
+
+            const auto headEnd{ conn.in.find(k_crlfCrlf) };
+            if (headEnd == std::string::npos) {
+                if (conn.in.size() > opts.maxHeadLength)
+                    return Reject_(conn, StatusCodeEnum::RequestHeaderFieldsTooLarge);
+                break;
+            }
+            if (headEnd + k_crlfCrlf.size() > opts.maxHeadLength)
+                return Reject_(conn, StatusCodeEnum::RequestHeaderFieldsTooLarge);
+
+            auto head{ ParseHead({ conn.in.data(), headEnd + k_crlfCrlf.size() }, state.authority, opts.maxBodyLength) };
+            if (!head) return Reject_(conn, head.error());
+
+            conn.pending.emplace(std::move(*head));
+            conn.pending->scanned = conn.pending->headSize;
+
+            const bool hasBody{ conn.pending->chunked || conn.pending->contentLength.value_or(0) != 0 };
+            if (hasBody && ExpectsContinue(conn.pending->request.headers)
+                    && conn.in.size() == conn.pending->headSize) {
+                const int fd{ conn.fd };
+                conn.out.push_back({ "HTTP/1.1 100 Continue\r\n\r\n" });
+                Flush_(conn);
+                if (!connections.contains(fd)) return;
+            }
+        }
+
+        auto& pending{ *conn.pending };
+
+        size_t messageSize;
+        if (pending.chunked) {
+            const auto end{ ScanChunked(conn.in, pending.headSize, pending.scanned, opts.maxBodyLength) };
+            if (!end) return Reject_(conn, end.error());
+            if (!*end) break;
+
+            messageSize = **end;
+        } else {
+            messageSize = pending.headSize + pending.contentLength.value_or(0);
+            if (conn.in.size() < messageSize) break;
+        }
+
+        auto& request{ pending.request };
+        if (messageSize != pending.headSize) {
+            auto body{ ReadBody(request, std::string_view{ conn.in }.substr(pending.headSize, messageSize - pending.headSize)) };
+            if (!body) return Reject_(conn, StatusCodeEnum::BadRequest);
+
+            request.body = std::move(*body);
+        }
+
+        conn.in.erase(0, messageSize);
+        conn.busy = true;
+
+        state.Submit({ this, conn.fd, conn.id, std::move(request) });
+        conn.pending.reset();
+    }
+
+    if (conn.peerClosed && !conn.busy) {
+        // Nothing more will come, a partial request is dropped.
+        if (conn.out.empty()) return Close_(conn);
+        conn.closing = true;
+    }
+
+    UpdateInterest_(conn);
+}
+
+void ServerLoop::Reject_(ServerConnection& conn, const StatusCodeEnum status) {
+    conn.in.clear();
+    conn.pending.reset();
+    conn.closing = true;
+    conn.out.push_back({ ErrorResponse(status) });
+
+    Flush_(conn);
+}
+
+void ServerLoop::Flush_(ServerConnection& conn) {
+    uint64_t fileBudget{ k_fileFlushBudget };
+
+    while (!conn.out.empty() && fileBudget != 0) {
+        const auto& [bytes, file]{ conn.out.front() };
+        const uint64_t fileLength{ file ? file->length : 0 };
+
+        if (conn.outOffset == bytes.size() + fileLength) {
+            conn.out.pop_front();
+            conn.outOffset = 0;
+            continue;
+        }
+
+        ssize_t sent;
+        if (conn.outOffset < bytes.size()) {
+            // The head waits for the first file bytes, both leave in the same segments.
+            const int flags{ MSG_NOSIGNAL | (fileLength != 0 ? MSG_MORE : 0) };
+            sent = send(conn.fd, bytes.data() + conn.outOffset, bytes.size() - conn.outOffset, flags);
+        } else {
+            const auto done{ conn.outOffset - bytes.size() };
+            auto offset{ static_cast<off_t>(file->offset + done) };
+
+            sent = sendfile(conn.fd, file->file->fd, &offset, std::min(fileLength - done, fileBudget));
+            // The file shrank, the announced length can't be honored anymore.
+            if (sent == 0) return Close_(conn);
+            if (sent > 0)  fileBudget -= static_cast<uint64_t>(sent);
+        }
+
+        if (sent > 0) {
+            conn.outOffset += static_cast<uint64_t>(sent);
+            continue;
+        }
+        if (sent == -1 && errno == EINTR) continue;
+        if (sent == -1 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+
+        return Close_(conn);
+    }
+
+    if (conn.out.empty() && conn.closing && !conn.busy) return Close_(conn);
+
+    UpdateInterest_(conn);
+}
+
+void ServerLoop::UpdateInterest_(ServerConnection& conn) {
+    const size_t readLimit{ state.opts.maxHeadLength + state.opts.maxBodyLength };
+
+    uint32_t wanted{};
+    if (!conn.closing && !conn.peerClosed && conn.in.size() < readLimit) wanted |= EPOLLIN;
+    if (!conn.out.empty())                                               wanted |= EPOLLOUT;
+
+    if (wanted == conn.events) return;
+
+    epoll_event ev{ .events = wanted, .data = { .fd = conn.fd } };
+    epoll_ctl(epollFd, EPOLL_CTL_MOD, conn.fd, &ev);
+    conn.events = wanted;
+}
+
+void ServerLoop::Close_(ServerConnection& conn) {
+    const int fd{ conn.fd };
+
+    epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, nullptr);
+    close(fd);
+    connections.erase(fd);
+}
+
+void ServerLoop::SweepIdle_() {
+    const auto deadline{ Clock::now() - state.opts.keepAliveTimeout };
+
+    std::vector<int> idle;
+    for (const auto& [fd, conn] : connections)
+        if (!conn.busy && conn.out.empty() && conn.lastActive < deadline)
+            idle.push_back(fd);
+
+    for (const int fd : idle)
+        Close_(connections.at(fd));
+}
+
+#pragma endregion
+
+
+#pragma region ServerState
+
+void ServerState::Submit(ServerJob job) {
+    {
+        std::lock_guard lock{ jobsMutex };
+        jobs.emplace_back(std::move(job));
+    }
+    jobsCv.notify_one();
+}
+
+void ServerState::WorkerLoop() {
+    while (true) {
+        std::unique_lock lock{ jobsMutex };
+        jobsCv.wait(lock, [&] { return workersDone || !jobs.empty(); });
+        if (jobs.empty()) return;
+
+        auto job{ std::move(jobs.front()) };
+        jobs.pop_front();
+        lock.unlock();
+
+        const auto& request{ job.request };
+        ServerResponse response{ { .headers = {} } };
+
+        try {
+            handler(request, response);
+        } catch (...) {
+            response = ServerResponse{ { .status = StatusCodeEnum::InternalServerError, .headers = {} } };
+        }
+
+        const bool keepAlive{
+            WantsKeepAlive(request.headers, request.version)
+            && !HasToken(response.headers, "keep-alive", "close")
+        };
+
+        auto bytes{ Serialize(response, request.version, request.method == "HEAD", keepAlive) };
+
+        job.loop->Post({
+            .fd        = job.fd,
+            .connId    = job.connId,
+            .output    = { std::move(bytes), std::move(response.file) },
+            .keepAlive = keepAlive
+        });
+    }
+}
+
+void ServerState::Stop() {
+    if (stopping.exchange(true)) return;
+
+    for (const auto& loop : loops) {
+        constexpr uint64_t one{ 1 };
+        (void)write(loop->wakeFd, &one, sizeof(one));
+    }
+    loopThreads.clear();
+
+    {
+        std::lock_guard lock{ jobsMutex };
+        workersDone = true;
+    }
+    jobsCv.notify_all();
+    workers.clear();
+}
+
+#pragma endregion
+
+
+#pragma region Server
+
+auto Server::Listen(ServerHandler handler, ServerOptions opts) -> std::expected<Server, ThothError> {
+    if (!handler) return ThothUnex{{ GenericError{ "A handler is required" } }};
+
+    const auto cores{ std::max(std::thread::hardware_concurrency(), 1u) };
+    if (opts.acceptors == 0) opts.acceptors = cores;
+    if (opts.workers == 0)   opts.workers   = cores;
+
+    sockaddr_storage addr{};
+    socklen_t addrLen;
+
+    if (auto& v4{ reinterpret_cast<sockaddr_in&>(addr) }; inet_pton(AF_INET, opts.address.c_str(), &v4.sin_addr) == 1) {
+        v4.sin_family = AF_INET;
+        v4.sin_port   = htons(opts.port);
+        addrLen       = sizeof(sockaddr_in);
+    } else if (auto& v6{ reinterpret_cast<sockaddr_in6&>(addr) }; inet_pton(AF_INET6, opts.address.c_str(), &v6.sin6_addr) == 1) {
+        v6.sin6_family = AF_INET6;
+        v6.sin6_port   = htons(opts.port);
+        addrLen        = sizeof(sockaddr_in6);
+    } else
+        return ThothUnex{{ GenericError{ "Invalid server address" } }};
+
+    auto state{ std::make_unique<ServerState>() };
+    state->handler = std::move(handler);
+    state->opts    = std::move(opts);
+
+    for (size_t i{}; i < state->opts.acceptors; ++i) {
+        auto& loop{ *state->loops.emplace_back(std::make_unique<ServerLoop>(*state)) };
+        if (auto res{ loop.Open(addr, addrLen) }; !res)
+            return ThothUnex{ res.error() };
+
+        // With port 0 the first bind picks one, the others must share it.
+        if (i == 0) {
+            sockaddr_storage bound{};
+            socklen_t boundLen{ sizeof(bound) };
+            getsockname(loop.listenFd, reinterpret_cast<sockaddr*>(&bound), &boundLen);
+
+            state->port = ntohs(addr.ss_family == AF_INET
+                ? reinterpret_cast<const sockaddr_in&>(bound).sin_port
+                : reinterpret_cast<const sockaddr_in6&>(bound).sin6_port);
+
+            if (addr.ss_family == AF_INET) reinterpret_cast<sockaddr_in&>(addr).sin_port   = htons(state->port);
+            else                           reinterpret_cast<sockaddr_in6&>(addr).sin6_port = htons(state->port);
+        }
+    }
+
+    // Stands for Host in HTTP/1.0 requests without one.
+    state->authority = addr.ss_family == AF_INET
+        ? std::format("{}:{}", state->opts.address, state->port)
+        : std::format("[{}]:{}", state->opts.address, state->port);
+
+    for (size_t i{}; i < state->opts.workers; ++i)
+        state->workers.emplace_back([s = state.get()] { s->WorkerLoop(); });
+
+    for (const auto& loop : state->loops)
+        state->loopThreads.emplace_back([l = loop.get()] { l->Run(); });
+
+    return Server{ std::move(state) };
+}
+
+#pragma endregion
+
+#else
+
+namespace Thoth::Http::details_ {
+    struct ServerState {
+        uint16_t port{};
+        void Stop() {}
+    };
+}
+
+auto Server::Listen(ServerHandler, ServerOptions) -> std::expected<Server, ThothError> {
+    return ThothUnex{{ GenericError{ "Server is only available on Linux" } }};
+}
+
+#endif
+
+
+ServerFile::~ServerFile() {
+#ifdef __linux__
+    close(fd);
+#endif
+}
+
+
+Server::Server(std::unique_ptr<details_::ServerState> state) : m_state{ std::move(state) } {}
+
+Server::Server(Server&& other) noexcept = default;
+Server& Server::operator=(Server&& other) noexcept = default;
+Server::~Server() = default;
+
+uint16_t Server::Port() const {
+    return m_state ? m_state->port : 0;
+}
+
+void Server::Stop() {
+    if (m_state) m_state->Stop();
+}
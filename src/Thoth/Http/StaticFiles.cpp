@@ -0,0 +1,421 @@
+#include <Thoth/Http/StaticFiles.hpp>
+#include <Thoth/Http/Url/Url.hpp>
+#include <Thoth/String/Utils.hpp>
+#include <Thoth/Utils/Scanner.hpp>
+#include <Hermes/Utils/Overloads.hpp>
+
+#include <algorithm>
+#include <array>
+#include <format>
+#include <list>
+#include <mutex>
+#include <ranges>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+
+#ifdef __linux__
+#include <cerrno>
+#include <fcntl.h>
+#include <linux/openat2.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+
+using namespace Thoth;
+using namespace Thoth::Http;
+
+#ifdef __linux__
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    constexpr std::pair<std::string_view, std::string_view> k_contentTypes[]{
+        { "css",   "text/css; charset=utf-8"               },
+        { "gif",   "image/gif"                             },
+        { "gz",    "application/gzip"                      },
+        { "htm",   "text/html; charset=utf-8"              },
+        { "html",  "text/html; charset=utf-8"              },
+        { "ico",   "image/x-icon"                          },
+        { "jpeg",  "image/jpeg"                            },
+        { "jpg",   "image/jpeg"                            },
+        { "js",    "text/javascript; charset=utf-8"        },
+        { "json",  "application/json"                      },
+        { "mjs",   "text/javascript; charset=utf-8"        },
+        { "mp4",   "video/mp4"                             },
+        { "pdf",   "application/pdf"                       },
+        { "png",   "image/png"                             },
+        { "svg",   "image/svg+xml"                         },
+        { "txt",   "text/plain; charset=utf-8"             },
+        { "wasm",  "application/wasm"                      },
+        { "webp",  "image/webp"                            },
+        { "woff",  "font/woff"                             },
+        { "woff2", "font/woff2"                            },
+        { "xml",   "application/xml"                       },
+        { "zip",   "application/zip"                       },
+    };
+
+    static_assert(std::ranges::is_sorted(k_contentTypes, {}, &std::pair<std::string_view, std::string_view>::first));
+
+    std::string_view ContentTypeOf(const std::string_view path) {
+        const auto dot{ path.rfind('.') };
+        if (dot == std::string_view::npos || path.find('/', dot) != std::string_view::npos)
+            return "application/octet-stream";
+
+        std::string extension{ path.substr(dot + 1) };
+        std::ranges::transform(extension, extension.begin(), [](const unsigned char c) { return std::tolower(c); });
+
+        const auto it{ std::ranges::lower_bound(k_contentTypes, extension, {}, &std::pair<std::string_view, std::string_view>::first) };
+        if (it == std::end(k_contentTypes) || it->first != extension)
+            return "application/octet-stream";
+        return it->second;
+    }
+
+    //! Decodes `raw` into a path relative to the root, refusing anything that could leave it.
+    std::optional<std::string> RelativePath(const std::string_view raw) {
+        auto decoded{ Url::TryDecode(raw) };
+        if (!decoded || decoded->contains('\0'))
+            return std::nullopt;
+
+        std::string res;
+        for (const auto segment : *decoded | std::views::split('/')) {
+            const std::string_view name{ segment.begin(), segment.end() };
+            if (name.empty() || name == ".") continue;
+            if (name == "..") return std::nullopt;
+
+            if (!res.empty()) res += '/';
+            res += name;
+        }
+
+        if (res.empty()) return std::nullopt;
+        return res;
+    }
+
+    //! Opens `path`, as given by @ref RelativePath, without leaving the directory `dirFd` through a symlink.
+    int OpenBeneath(const int dirFd, const std::string& path, const int flags) {
+        open_how how{ .flags = static_cast<uint64_t>(flags | O_CLOEXEC), .mode = 0, .resolve = RESOLVE_BENEATH | RESOLVE_NO_MAGICLINKS };
+
+        const auto fd{ syscall(SYS_openat2, dirFd, path.c_str(), &how, sizeof(how)) };
+        // Before Linux 5.6, or filtered out by a seccomp profile.
+        if (fd != -1 || (errno != ENOSYS && errno != EPERM))
+            return static_cast<int>(fd);
+
+        // No `RESOLVE_BENEATH`: walk the components, refusing every symlink.
+        int current{ dirFd };
+        size_t begin{};
+        for (size_t slash; (slash = path.find('/', begin)) != std::string::npos; begin = slash + 1) {
+            const std::string name{ path.substr(begin, slash - begin) };
+
+            const int next{ openat(current, name.c_str(), O_PATH | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC) };
+            const int error{ errno };
+            if (current != dirFd) close(current);
+            if (next == -1) {
+                errno = error;
+                return -1;
+            }
+            current = next;
+        }
+
+        const int res{ openat(current, path.c_str() + begin, flags | O_NOFOLLOW | O_CLOEXEC) };
+        const int error{ errno };
+        if (current != dirFd) close(current);
+        errno = error;
+        return res;
+    }
+
+    bool SameFile(const struct stat& a, const struct stat& b) {
+        return a.st_dev == b.st_dev && a.st_ino == b.st_ino && a.st_size == b.st_size
+            && a.st_mtim.tv_sec == b.st_mtim.tv_sec && a.st_mtim.tv_nsec == b.st_mtim.tv_nsec;
+    }
+}
+
+
+namespace Thoth::Http::details_ {
+    //! An open file and the validators computed from its `stat`, immutable once cached.
+    struct StaticFile {
+        StaticFile(const int fd, const struct stat& info, const std::string_view path)
+            : file{ fd }, info{ info }, contentType{ ContentTypeOf(path) } {
+            const auto mtime{ std::chrono::seconds{ info.st_mtim.tv_sec } + std::chrono::nanoseconds{ info.st_mtim.tv_nsec } };
+
+            // Changes with any replacement or write that touches the size or the modification time.
+            entityTag    = std::format("{:x}-{:x}-{:x}", info.st_ino, info.st_size, mtime.count());
+            lastModified = std::chrono::utc_clock::from_sys(std::chrono::sys_seconds{ std::chrono::seconds{ info.st_mtim.tv_sec } });
+        }
+
+        ServerFile file;
+        struct stat info;
+
+        std::string entityTag;
+        std::chrono::utc_clock::time_point lastModified;
+        std::string_view contentType;
+    };
+
+    struct StaticFilesCache {
+        struct Entry {
+            std::string path;
+            std::shared_ptr<const StaticFile> file;
+            Clock::time_point checkedAt;
+        };
+
+        int rootFd{ -1 };
+        StaticFilesOptions opts;
+
+        std::mutex mutex;
+        // Most recently used first.
+        std::list<Entry> entries;
+        std::unordered_map<std::string_view, std::list<Entry>::iterator> index;
+
+        ~StaticFilesCache() {
+            if (rootFd != -1) close(rootFd);
+        }
+
+        //! The open file at `path`, or the `errno` of the failed open.
+        std::expected<std::shared_ptr<const StaticFile>, int> Get(const std::string& path);
+
+    private:
+        std::expected<std::shared_ptr<const StaticFile>, int> Open_(const std::string& path) const;
+        void Insert_(const std::string& path, std::shared_ptr<const StaticFile> file, Clock::time_point now);
+    };
+}
+
+using namespace Thoth::Http::details_;
+
+
+#pragma region StaticFilesCache
+
+auto StaticFilesCache::Get(const std::string& path) -> std::expected<std::shared_ptr<const StaticFile>, int> {
+    const auto now{ Clock::now() };
+
+    std::shared_ptr<const StaticFile> cached;
+    {
+        std::lock_guard lock{ mutex };
+
+        if (const auto it{ index.find(path) }; it != index.end()) {
+            entries.splice(entries.begin(), entries, it->second);
+            if (now - it->second->checkedAt < opts.revalidateAfter)
+                return it->second->file;
+
+            cached = it->second->file;
+        }
+    }
+
+    // Stale: still the same file if a `stat` of the path says so.
+    if (cached) {
+        struct stat info;
+        const int fd{ OpenBeneath(rootFd, path, O_PATH) };
+        const bool same{ fd != -1 && fstat(fd, &info) == 0 && SameFile(info, cached->info) };
+        if (fd != -1) close(fd);
+
+        if (same) {
+            std::lock_guard lock{ mutex };
+            if (const auto it{ index.find(path) }; it != index.end() && it->second->file == cached)
+                it->second->checkedAt = now;
+            return cached;
+        }
+    }
+
+    auto file{ Open_(path) };
+    if (!file) {
+        std::lock_guard lock{ mutex };
+        if (const auto it{ index.find(path) }; it != index.end()) {
+            const auto entry{ it->second };
+            index.erase(it);
+            entries.erase(entry);
+        }
+        return file;
+    }
+
+    Insert_(path, *file, now);
+    return file;
+}
+
+auto StaticFilesCache::Open_(const std::string& path) const -> std::expected<std::shared_ptr<const StaticFile>, int> {
+    const int fd{ OpenBeneath(rootFd, path, O_RDONLY | O_NOCTTY) };
+    if (fd == -1) return std::unexpected{ errno };
+
+    struct stat info;
+    if (fstat(fd, &info) == -1 || !S_ISREG(info.st_mode)) {
+        close(fd);
+        return std::unexpected{ ENOENT };
+    }
+
+    return std::make_shared<const StaticFile>(fd, info, path);
+}
+
+void StaticFilesCache::Insert_(const std::string& path, std::shared_ptr<const StaticFile> file, const Clock::time_point now) {
+    std::lock_guard lock{ mutex };
+
+    if (const auto it{ index.find(path) }; it != index.end()) {
+        it->second->file      = std::move(file);
+        it->second->checkedAt = now;
+        entries.splice(entries.begin(), entries, it->second);
+        return;
+    }
+
+    if (opts.maxOpenFiles == 0) return;
+
+    // Evicted descriptors stay open until the responses sending them are written.
+    if (entries.size() == opts.maxOpenFiles) {
+        index.erase(entries.back().path);
+        entries.pop_back();
+    }
+
+    entries.push_front({ path, std::move(file), now });
+    index.emplace(entries.front().path, entries.begin());
+}
+
+#pragma endregion
+
+
+#pragma region StaticFiles
+
+namespace {
+    // RFC 9110 §13.1.2, weak comparison.
+    bool NoneMatch(const RequestHeaders& headers, const StaticFile& file) {
+        const auto raw{ headers.Get("if-none-match") };
+        if (!raw) return true;
+        if (String::Trimmed(**raw) == "*") return false;
+
+        const auto tags{ headers.IfNoneMatch().GetAsOpt() };
+        return !tags || std::ranges::none_of(*tags, [&](const NHeaders::EntityTag& tag) { return tag.tag == file.entityTag; });
+    }
+
+    // RFC 9110 §13.1.5, an entity tag must match strongly, a date must be the exact modification date.
+    bool IfRangeHolds(const RequestHeaders& headers, const StaticFile& file) {
+        const auto raw{ headers.Get("if-range") };
+        if (!raw) return true;
+
+        const auto value{ String::Trimmed(**raw) };
+        if (value.starts_with('"'))
+            return value == std::format("\"{}\"", file.entityTag);
+        if (value.starts_with("W/"))
+            return false;
+
+        const auto date{ Utils::Scan<std::chrono::utc_clock::time_point>(value) };
+        return date && *date == file.lastModified;
+    }
+
+    //! The requested part of the file, the whole file when the range is absent, unusable or several ranges.
+    std::expected<NHeaders::ContentRange::Span, StatusCodeEnum> SelectRange(
+        const RequestHeaders& headers, const StaticFile& file) {
+        const auto size{ static_cast<uint64_t>(file.info.st_size) };
+        const NHeaders::ContentRange::Span whole{ 0, size - 1 };
+
+        if (!headers.Exists("range") || !IfRangeHolds(headers, file))
+            return whole;
+
+        // RFC 9110 §14.2, a Range that can't be parsed is ignored.
+        const auto ranges{ headers.Range().GetAsOpt() };
+        if (!ranges || ranges->size() != 1)
+            return whole;
+
+        return std::visit(Hermes::Utils::Overloaded{
+            [&](const NHeaders::PrefixedRange range) -> std::expected<NHeaders::ContentRange::Span, StatusCodeEnum> {
+                if (range.end && *range.end < range.start) return whole;
+                if (range.start >= size) return std::unexpected{ StatusCodeEnum::RangeNotSatisfiable };
+
+                return NHeaders::ContentRange::Span{ range.start, std::min(range.end.value_or(size - 1), size - 1) };
+            },
+            [&](const NHeaders::SuffixedRange range) -> std::expected<NHeaders::ContentRange::Span, StatusCodeEnum> {
+                if (range.last == 0 || size == 0) return std::unexpected{ StatusCodeEnum::RangeNotSatisfiable };
+
+                return NHeaders::ContentRange::Span{ size - std::min(range.last, size), size - 1 };
+            }
+        }, ranges->front());
+    }
+}
+
+
+StaticFiles::StaticFiles(const std::filesystem::path& root, StaticFilesOptions opts)
+    : m_cache{ std::make_shared<StaticFilesCache>() } {
+    m_cache->rootFd = open(root.c_str(), O_PATH | O_DIRECTORY | O_CLOEXEC);
+    m_cache->opts   = opts;
+}
+
+void StaticFiles::operator()(const ServerRequest& request, ServerResponse& response) const {
+    Serve(request, response, request.url.GetPathOrSep());
+}
+
+void StaticFiles::Serve(const ServerRequest& request, ServerResponse& response, const std::string_view path) const {
+    using enum StatusCodeEnum;
+
+    if (request.method != "GET" && request.method != "HEAD") {
+        response.status = MethodNotAllowed;
+        response.headers.Set("allow", "GET, HEAD");
+        return;
+    }
+
+    const auto relative{ RelativePath(path) };
+    if (!relative || m_cache->rootFd == -1) {
+        response.status = NotFound;
+        return;
+    }
+
+    const auto file{ m_cache->Get(*relative) };
+    if (!file) {
+        response.status = file.error() == EACCES ? Forbidden : NotFound;
+        return;
+    }
+
+    const auto& served{ **file };
+    const auto size{ static_cast<uint64_t>(served.info.st_size) };
+
+    response.headers.EntityTag().Set(NHeaders::EntityTag{ served.entityTag, false });
+    response.headers.LastModified().Set(served.lastModified);
+    response.headers.AcceptRanges().Set(NHeaders::AcceptRanges::Bytes);
+
+    // RFC 9110 §13.2.2, If-None-Match takes precedence over If-Modified-Since.
+    const auto& headers{ request.headers };
+    if (headers.Exists("if-none-match") ? !NoneMatch(headers, served) : [&] {
+        const auto since{ headers.IfModifiedSince().GetAsOpt() };
+        return since && served.lastModified <= *since;
+    }()) {
+        response.status = NotModified;
+        return;
+    }
+
+    response.headers.Set("content-type", served.contentType);
+    if (size == 0) return;
+
+    const auto span{ SelectRange(headers, served) };
+    if (!span) {
+        response.status = span.error();
+        response.headers.ContentRange().Set(NHeaders::ContentRange{ std::nullopt, size });
+        return;
+    }
+
+    if (span->first != 0 || span->last != size - 1) {
+        response.status = PartialContent;
+        response.headers.ContentRange().Set(NHeaders::ContentRange{ *span, size });
+    }
+
+    // Shares the ownership of the cached entry, the descriptor outlives its eviction.
+    response.file = ServerFileBody{
+        .file   = { *file, &served.file },
+        .offset = span->first,
+        .length = span->last - span->first + 1
+    };
+}
+
+#pragma endregion
+
+#else
+
+namespace Thoth::Http::details_ {
+    struct StaticFilesCache {};
+}
+
+StaticFiles::StaticFiles(const std::filesystem::path&, StaticFilesOptions) {}
+
+void StaticFiles::operator()(const ServerRequest& request, ServerResponse& response) const {
+    Serve(request, response, request.url.GetPathOrSep());
+}
+
+void StaticFiles::Serve(const ServerRequest&, ServerResponse& response, std::string_view) const {
+    response.status = StatusCodeEnum::NotImplemented;
+}
+
+#endif
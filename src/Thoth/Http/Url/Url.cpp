@@ -1,6 +1,9 @@
 #include <Thoth/Http/Url/Url.hpp>
+#include <Thoth/Http/Url/UrlView.hpp>
 #include <algorithm>
+#include <cstring>
 
+#include <Thoth/String/Simd.hpp>
 #include <Thoth/String/Utils.hpp>
 
 #pragma push_macro("FAIL_WITH")
@@ -157,16 +160,6 @@ std::string_view Url::View(const RangeIdx range) const noexcept {
     return string_view{ m_rawUrl }.substr(l, r);
 }
 
-Url::RangeIdx Url::MakeRange(const std::string& source, const std::string_view view) noexcept {
-    if (view.data() == nullptr)
-        return {};
-
-    return {
-        static_cast<std::size_t>(view.data() - source.data()),
-        view.size()
-    };
-}
-
 std::string_view Url::GetScheme() const noexcept {
     return View(m_schemeIdx);
 }
@@ -242,315 +235,51 @@ std::string_view Url::GetUrlWithoutFragment() const noexcept {
 
 
 
-// Normally I would do this in a functional way but... Aff, there are to many rules.
-
-// URL parsing from RFC3986
+// URL parsing from RFC3986, the grammar lives in UrlView
 
 
 std::expected<Url, Thoth::ThothError> Url::FromUrl(std::string rawUrl) {
-    if (rawUrl.empty() || !isalpha(rawUrl.front()))
-        FAIL_WITH(EmptyUrl);
-
     Url url{};
     url.m_rawUrl = std::move(rawUrl);
-    std::string_view rawUrlView{ url.m_rawUrl };
-    std::string_view scheme;
-    AuthorityView    auth;
-    std::string_view hostStr;
-    std::string_view path;
-    std::string_view query;
-    std::string_view frag;
-
-    std::string_view hierPart;
-
-#pragma region General
-
-    // URI         = scheme ":" hier-part [ "?" query ] [ "#" fragment ]
-    //
-    //      hier-part   = "//" authority path-abempty
-    //                  / path-absolute
-    //                  / path-rootless
-    //                  / path-empty
-
-    // * Just `hier-part = authority path-abempty` is implemented
-
-    // TODO: reinforce the scheme check
-    // if (!m_rawUrl.starts_with("http:") && !m_rawUrl.starts_with("https:")) // its URL after all
-    //     FAIL_WITH(InvalidScheme); // ill-formed, scheme is mandatory
-
-    const auto schemeIdx{ rawUrlView.find(':') };
-
-    if (schemeIdx == string::npos)
-        FAIL_WITH(InvalidScheme); // ill-formed, scheme is mandatory
-
-    scheme = string_view(rawUrlView.data(), schemeIdx);
-
-    static constexpr auto a_acceptedSchemeChars = [](char c) {
-        constexpr auto bitset{ String::MakeBitset({ String::CharSequences::k_alphanumeric, "+-." }) };
-        return bitset[c];
-    };
-    if (scheme.empty() || !isalpha(scheme[0]) || !rg::all_of(scheme, a_acceptedSchemeChars))
-        FAIL_WITH(InvalidScheme);
-
-    rawUrlView.remove_prefix(schemeIdx + 1);
-
-
-    if (const auto hierPartIdx{ rawUrlView.find_first_of("?#") }; hierPartIdx == string::npos)
-        hierPart = rawUrlView; // no query or fragment
-    else {
-        hierPart = string_view(rawUrlView.data(), hierPartIdx);
-        char hierPartDelimiter{ rawUrlView[hierPartIdx] };
-
-        rawUrlView.remove_prefix(hierPartIdx + 1);
-
-        if (hierPartDelimiter == '#')
-            frag = rawUrlView; // no query, just fragment
-        else {
-            auto it{ rg::find(rawUrlView, '#') }; // a query and maybe a fragment too
-
-            query = string_view(rawUrlView.begin(), it);
-
-            if (it != rawUrlView.end())
-                frag = string_view(it + 1, rawUrlView.end());
-        }
-    }
-
-#pragma endregion
-#pragma region Scheme
-
-    // scheme      = ALPHA *( ALPHA / DIGIT / "+" / "-" / "." )
-
-#pragma endregion
-#pragma region Auth & UserInfo
-
-    // authority   = [ userinfo "@" ] host [ ":" port ]
-    // userinfo    = *( unreserved / pct-encoded / sub-delims / ":" )
-
-
-    if (hierPart.empty())
-        FAIL_WITH(IllFormed);
 
-    if (!hierPart.starts_with("//"))
-        FAIL_WITH(IllFormed); // in HTTP, {"//" authority path-abempty} is mandatory
+    const auto view{ UrlView::FromUrl(url.m_rawUrl) };
+    if (!view)
+        return ThothUnex{ view.error() };
 
-    hierPart.remove_prefix(2);
-    auto pathIdx{ hierPart.find('/') };
-
-    if (pathIdx == 0)
-        FAIL_WITH(IllFormed); // ill-formed, authority is empty
-
-    if (pathIdx != string::npos) {
-        path = string_view{ pathIdx + hierPart.begin(), hierPart.end() }; // includes '/' NOLINT(*-narrowing-conversions)
-
-        hierPart.remove_suffix(path.size());
-    }
-
-
-    auto authIdx{ static_cast<long long>(hierPart.find('@')) };
-
-    auth.userinfo = string_view(hierPart.data(), std::max(0LL, authIdx));
-    hierPart.remove_prefix(authIdx + 1);
-
-    // TODO: check chars from userinfo
-
-    size_t portIdx;
-    if (hierPart.starts_with('[')) {
-        const auto closeBracket{ hierPart.find(']') };
-        if (closeBracket == string_view::npos)
-            FAIL_WITH(IllFormed);
-        portIdx = hierPart.find(':', closeBracket + 1);
-    } else {
-        portIdx = hierPart.find(':');
-    }
-
-    if (portIdx == string_view::npos) // no port
-        hostStr = hierPart;
-    else {
-        hostStr = string_view(hierPart.data(), portIdx);
-
-        // hierPart.rbegin() + 1 is hierPart.end(), but I cant dereference it in MSVC
-
-        auth.port = 0; // placing a value
-        auto [ptr, ec] = std::from_chars(&*hierPart.begin() + portIdx + 1, &*hierPart.rbegin() + 1, *auth.port);
-
-        if (ec != std::errc() || ptr != &*hierPart.rbegin() + 1)
-            FAIL_WITH(InvalidPort);
-
-        hierPart.remove_prefix(portIdx + 1);
-    }
-
-#pragma endregion
-#pragma region Host
-
-    if (hostStr.empty())
-        FAIL_WITH(IllFormed); // ill-formed, in auth host is mandatory
-
-    // (omg there is so much thing on here. Ok, fuck IPs, I will do just reg-name for now)
-
-    // host        = IP-literal / IPv4address / reg-name
-    // IP-literal = "[" ( IPv6address / IPvFuture  ) "]"
-    // IPvFuture  = "v" 1*HEXDIG "." 1*( unreserved / sub-delims / ":" )
-
-    // IPv6address =                            6( h16 ":" ) ls32
-    //             /                       "::" 5( h16 ":" ) ls32
-    //             / [               h16 ] "::" 4( h16 ":" ) ls32
-    //             / [ *1( h16 ":" ) h16 ] "::" 3( h16 ":" ) ls32
-    //             / [ *2( h16 ":" ) h16 ] "::" 2( h16 ":" ) ls32
-    //             / [ *3( h16 ":" ) h16 ] "::"    h16 ":"   ls32
-    //             / [ *4( h16 ":" ) h16 ] "::"              ls32
-    //             / [ *5( h16 ":" ) h16 ] "::"              h16
-    //             / [ *6( h16 ":" ) h16 ] "::"
-    //
-    // ls32        = ( h16 ":" h16 ) / IPv4address
-    //             ; least-significant 32 bits of address
-    //
-    // h16         = 1*4HEXDIG
-    //             ; 16 bits of address represented in hexadecimal
-
-    const auto readIpv6 = [hostStr]() -> std::optional<HostView> {
-        if (!hostStr.starts_with('[') || !hostStr.ends_with(']'))
-            return std::nullopt;
-
-        const std::string inner{ hostStr.substr(1, hostStr.size() - 2) };
-        auto ip{ Hermes::IpAddress::TryParse(inner) };
-
-        if (!ip || !ip->IsIpv6())
-            return std::nullopt;
-
-        return HostView{ *ip };
-    };
-
-    // IPv4address = dec-octet "." dec-octet "." dec-octet "." dec-octet
-    // dec-octet   = DIGIT                 ; 0-9
-    //             / %x31-39 DIGIT         ; 10-99
-    //             / "1" 2DIGIT            ; 100-199
-    //             / "2" %x30-34 DIGIT     ; 200-249
-    //             / "25" %x30-35          ; 250-255
-
-    const auto readIpv4 = [hostStr]() -> std::optional<HostView> {
-        Hermes::IpAddress::Ipv4Type ip{};
-
-        const char* ptr{ hostStr.data() };
-        const char* end{ hostStr.data() + hostStr.size() };
-        for (int i{}; i < 4; ++i) {
-            uint8_t val;
-
-            auto [newPtr, err]{ std::from_chars(ptr, hostStr.data() + hostStr.size(), val) };
-
-            if (err != std::errc{})
-                return std::nullopt;
-            if (i == 3
-                    ? newPtr != end
-                    : newPtr == end || *newPtr != '.')
-                return std::nullopt;
-            if (*ptr == '0' && newPtr > ptr + 1)
-                return std::nullopt;
-
-            ip[i] = val;
-            ptr = newPtr + 1;
-        }
-
-        return { Hermes::IpAddress{ ip } };
-    };
-
-    // reg-name    = *( unreserved / pct-encoded / sub-delims )
-
-    auto readRegName = [hostStr]() -> std::optional<HostView> {
-        constexpr auto set{ String::MakeBitset({ String::CharSequences::Http::k_url }) };
-
-        for (size_t i{}; i < hostStr.size(); ++i) {
-            const char c{ hostStr[i] };
-
-            if (set[static_cast<unsigned char>(c)]) continue;
-
-
-            if (c == '%') {
-                if (i + 2 >= hostStr.size() ||
-                    !std::isxdigit(hostStr[i + 1]) ||
-                    !std::isxdigit(hostStr[i + 2])) {
-                    return std::nullopt;
-                    }
-                i += 2;
-                continue;
-            }
-
-            return std::nullopt;
-        }
-
-        return hostStr;
-    };
-
-    if (auto host{ readIpv6().or_else(readIpv4).or_else(readRegName) }; host)
-        auth.host = *host;
-    else
+    if (!url.SetRanges_(*view))
         FAIL_WITH(HostIsRequired);
 
+    return url;
+}
 
-#pragma endregion
-#pragma region Port
-
-    // port        = *DIGIT
-
-
-#pragma endregion
-#pragma region Path
-
-    // path          = path-abempty    ; begins with "/" or is empty
-    //               / path-absolute   ; begins with "/" but not "//"
-    //               / path-noscheme   ; begins with a non-colon segment
-    //               / path-rootless   ; begins with a segment
-    //               / path-empty      ; zero characters
-    //
-    // path-abempty  = *( "/" segment )
-    // path-absolute = "/" [ segment-nz *( "/" segment ) ]
-    // path-noscheme = segment-nz-nc *( "/" segment )
-    // path-rootless = segment-nz *( "/" segment )
-    // path-empty    = 0<pchar>
-    //
-    //
-    // segment       = *pchar
-    // segment-nz    = 1*pchar
-    // segment-nz-nc = 1*( unreserved / pct-encoded / sub-delims / "@" )
-    //               ; non-zero-length segment without any colon ":"
-    //
-    // pchar         = unreserved / pct-encoded / sub-delims / ":" / "@"
-
-#pragma endregion
-#pragma region Query
-
-    // query       = *( pchar / "/" / "?" )
-
-#pragma endregion
-#pragma region Fragment
-
-    // fragment    = *( pchar / "/" / "?" )
-
-#pragma endregion
-
-
+bool Url::SetRanges_(const UrlView& view) {
+    const auto* base{ view.GetUrl().data() };
+    const auto range{ [base](const std::string_view part) -> RangeIdx {
+        return { static_cast<std::size_t>(part.data() - base), part.size() };
+    } };
 
+    AuthorityIdx authority{};
+    authority.userinfo = range(view.GetUserinfo());
+    authority.host     = range(view.GetHost());
+    authority.port     = view.GetPort();
 
+    bool hostBuilt{ true };
+    if (view.GetHostKind() != UrlView::HostKindEnum::RegName) {
+        const auto host{ view.GetAuthority()->host };
 
-    Url::AuthorityIdx authority{};
-    authority.userinfo = MakeRange(url.m_rawUrl, auth.userinfo);
-    authority.host = std::visit([&](const auto& host) -> std::variant<Url::RangeIdx, Hermes::IpAddress> {
-        using T = std::decay_t<decltype(host)>;
-        if constexpr (std::same_as<T, std::string_view>)
-            return MakeRange(url.m_rawUrl, host);
+        if (std::holds_alternative<Hermes::IpAddress>(host))
+            authority.host = std::get<Hermes::IpAddress>(host);
         else
-            return host;
-    }, auth.host);
-    authority.port = auth.port;
+            hostBuilt = false;
+    }
 
-    url.m_authority = std::move(authority);
-    url.m_schemeIdx = MakeRange(url.m_rawUrl, scheme);
-    url.m_pathIdx   = MakeRange(url.m_rawUrl, path);
-    if (query.data() != nullptr)
-        url.m_queryIdx = MakeRange(url.m_rawUrl, query);
-    if (frag.data() != nullptr)
-        url.m_fragIdx = MakeRange(url.m_rawUrl, frag);
+    m_authority = std::move(authority);
+    m_schemeIdx = range(view.GetScheme());
+    m_pathIdx   = range(view.GetPath());
+    m_queryIdx  = view.HasQuery()    ? std::optional{ range(view.GetQuery())    } : std::nullopt;
+    m_fragIdx   = view.HasFragment() ? std::optional{ range(view.GetFragment()) } : std::nullopt;
 
-    return url;
+    return hostBuilt;
 }
 
 std::expected<Url, Thoth::ThothError> Url::Resolve(std::string_view reference) const {
@@ -663,47 +392,117 @@ std::string Url::Encode(std::string_view str) {
     string buffer;
     buffer.reserve(3 * str.size());
 
-    for (const unsigned char c : str) {
-        if (std::isalnum(c) || c == '-' || c == '_' || c == '.' || c == '~')
-            buffer += static_cast<char>(c);
-        else
-            std::format_to(std::back_inserter(buffer),"%{:02X}", c);
-    }
+    AppendEncoded(buffer, str);
     return buffer;
 }
 
+void Url::AppendEncoded(std::string& out, const std::string_view str) {
+    static constexpr std::string_view hexDigits{ "0123456789ABCDEF" };
+
+    for (size_t pos{}; pos < str.size();) {
+        const auto unsafe{ std::min(String::FindFirstNotUnreserved(str, pos), str.size()) };
+        out.append(str, pos, unsafe - pos);
+
+        if (unsafe == str.size())
+            break;
+
+        const auto c{ static_cast<unsigned char>(str[unsafe]) };
+        const char pct[]{ '%', hexDigits[c >> 4], hexDigits[c & 0xF] };
+        out.append(pct, 3);
+
+        pos = unsafe + 1;
+    }
+}
+
 
 constexpr auto hexCharToInt = [] {
     std::array<int, 256> toHex{};
-    for (char c{'0'}; c <= '9'; c++) toHex[c] = c - '0';
-    for (char c{'a'}; c <= 'z'; c++) toHex[c] = c - 'a' + 10;
-    for (char c{'A'}; c <= 'Z'; c++) toHex[c] = c - 'A' + 10;
+    toHex.fill(-1);
+
+    for (int c{'0'}; c <= '9'; c++) toHex[c] = c - '0';
+    for (int c{'a'}; c <= 'f'; c++) toHex[c] = c - 'a' + 10;
+    for (int c{'A'}; c <= 'F'; c++) toHex[c] = c - 'A' + 10;
 
     return toHex;
 }();
 
 
+Thoth::ThothResultOper Url::AppendDecoded(std::string& out, const std::string_view str) {
+    for (size_t pos{}; pos < str.size();) {
+        const auto special{ std::min(String::FindFirstOf<'%', '+'>(str, pos), str.size()) };
+        out.append(str, pos, special - pos);
+
+        if (special == str.size())
+            break;
+
+        if (str[special] == '+') {
+            out += ' ';
+            pos = special + 1;
+            continue;
+        }
+
+        if (special + 2 >= str.size())
+            FAIL_WITH(IllFormed);
+
+        const int high{ hexCharToInt[static_cast<unsigned char>(str[special + 1])] };
+        const int low { hexCharToInt[static_cast<unsigned char>(str[special + 2])] };
+        if (high < 0 || low < 0)
+            FAIL_WITH(IllFormed);
+
+        out += static_cast<char>((high << 4) | low);
+        pos = special + 3;
+    }
+
+    return {};
+}
+
 std::expected<string, Thoth::ThothError> Url::TryDecode(std::string_view str) {
     std::string buffer;
     buffer.reserve(str.length());
 
+    if (auto res{ AppendDecoded(buffer, str) }; !res)
+        return std::unexpected{ std::move(res.error()) };
 
-    for (int i{}; i < str.size(); i++) {
-        if (str[i] == '%') {
-            if (i + 2 >= str.length() || !std::isxdigit(str[i + 1]) || !std::isxdigit(str[i + 2]))
-                FAIL_WITH(IllFormed);
+    return buffer;
+}
 
-            const int high{ hexCharToInt[str[i + 1]] };
-            const int low{ hexCharToInt[str[i + 2]] };
-            buffer += static_cast<char>((high << 4) + low);
+Thoth::ThothResultOper Url::DecodeInPlace(std::string& str) {
+    const auto first{ String::FindFirstOf<'%', '+'>(str) };
+    if (first == string::npos)
+        return {};
 
-            i += 2;
-        } else if (str[i] == '+')
-            buffer += ' ';
-        else
-            buffer += str[i];
+    // The decoded text is never longer, so it is written behind the read position.
+    const string_view rest{ str.data() + first, str.size() - first };
+    size_t out{ first };
+
+    for (size_t pos{}; pos < rest.size();) {
+        const auto special{ std::min(String::FindFirstOf<'%', '+'>(rest, pos), rest.size()) };
+        std::memmove(str.data() + out, rest.data() + pos, special - pos);
+        out += special - pos;
+
+        if (special == rest.size())
+            break;
+
+        if (rest[special] == '+') {
+            str[out++] = ' ';
+            pos = special + 1;
+            continue;
+        }
+
+        if (special + 2 >= rest.size())
+            FAIL_WITH(IllFormed);
+
+        const int high{ hexCharToInt[static_cast<unsigned char>(rest[special + 1])] };
+        const int low { hexCharToInt[static_cast<unsigned char>(rest[special + 2])] };
+        if (high < 0 || low < 0)
+            FAIL_WITH(IllFormed);
+
+        str[out++] = static_cast<char>((high << 4) | low);
+        pos = special + 3;
     }
-    return buffer;
+
+    str.resize(out);
+    return {};
 }
 
 bool Url::operator==(const Url& other) const noexcept {
@@ -0,0 +1,85 @@
+#include <Thoth/Http/Url/UrlBuilder.hpp>
+#include <algorithm>
+
+
+using Thoth::Http::UrlBuilder;
+using Thoth::Http::Url;
+
+
+UrlBuilder::UrlBuilder(const Url& base, const size_t capacity) {
+    const auto [pathBegin, pathSize]{ base.m_pathIdx };
+
+    m_url.m_rawUrl.reserve(std::max(capacity, pathBegin + pathSize));
+    m_url.m_rawUrl.assign(base.m_rawUrl, 0, pathBegin + pathSize);
+
+    m_url.m_schemeIdx = base.m_schemeIdx;
+    m_url.m_authority = base.m_authority;
+    m_url.m_pathIdx   = base.m_pathIdx;
+}
+
+UrlBuilder::UrlBuilder(const UrlView& base, const size_t capacity) {
+    const auto raw { base.GetUrl() };
+    const auto path{ base.GetPath() };
+    const auto prefix{ raw.substr(0, static_cast<size_t>(path.data() - raw.data()) + path.size()) };
+
+    m_url.m_rawUrl.reserve(std::max(capacity, prefix.size()));
+    m_url.m_rawUrl.assign(prefix);
+
+    m_url.SetRanges_(base);
+    m_url.m_queryIdx.reset();
+    m_url.m_fragIdx.reset();
+}
+
+
+UrlBuilder& UrlBuilder::AppendPath(const std::string_view segment) {
+    auto& raw{ m_url.m_rawUrl };
+    auto& [pathBegin, pathSize]{ m_url.m_pathIdx };
+
+    const auto pathEnd{ pathBegin + pathSize };
+    const bool needsSep{ pathSize == 0 || raw[pathEnd - 1] != '/' };
+
+    if (!m_url.m_queryIdx) {
+        const auto before{ raw.size() };
+
+        if (needsSep)
+            raw += '/';
+        Url::AppendEncoded(raw, segment);
+
+        pathSize += raw.size() - before;
+    } else {
+        std::string encoded{ needsSep ? "/" : "" };
+        Url::AppendEncoded(encoded, segment);
+
+        raw.insert(pathEnd, encoded);
+        pathSize += encoded.size();
+        m_url.m_queryIdx->first += encoded.size();
+    }
+
+    return *this;
+}
+
+UrlBuilder& UrlBuilder::AppendQuery(const std::string_view key, const std::string_view value) {
+    auto& raw{ m_url.m_rawUrl };
+
+    if (m_url.m_queryIdx)
+        raw += '&';
+    else {
+        raw += '?';
+        m_url.m_queryIdx = Url::RangeIdx{ raw.size(), 0 };
+    }
+
+    Url::AppendEncoded(raw, key);
+    raw += '=';
+    Url::AppendEncoded(raw, value);
+
+    m_url.m_queryIdx->second = raw.size() - m_url.m_queryIdx->first;
+
+    return *this;
+}
+
+
+std::string_view UrlBuilder::View() const noexcept { return m_url.m_rawUrl; }
+
+Url UrlBuilder::Build() && { return std::move(m_url); }
+
+Url UrlBuilder::Build() const& { return m_url; }
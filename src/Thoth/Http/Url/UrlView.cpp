@@ -0,0 +1,51 @@
+#include <Thoth/Http/Url/UrlView.hpp>
+
+
+using Thoth::Http::UrlView;
+
+
+UrlView::AuthorityViewOpt UrlView::GetAuthority() const {
+    if (m_rawUrl.empty())
+        return std::nullopt;
+
+    AuthorityView result;
+    result.userinfo = m_userinfo;
+    result.host     = m_host;
+    result.port     = m_port;
+
+    switch (m_hostKind) {
+        case HostKindEnum::Ipv4: {
+            Hermes::IpAddress::Ipv4Type ip{};
+            size_t octet{};
+
+            for (const char c : m_host)
+                if (c == '.')
+                    ++octet;
+                else
+                    ip[octet] = static_cast<uint8_t>(ip[octet] * 10 + (c - '0'));
+
+            result.host = Hermes::IpAddress{ ip };
+            break;
+        }
+        case HostKindEnum::Ipv6:
+            // Validated when parsing, building the address is what costs.
+            if (auto ip{ Hermes::IpAddress::TryParse(std::string{ m_host.substr(1, m_host.size() - 2) }) };
+                    ip && ip->IsIpv6())
+                result.host = *ip;
+            break;
+        case HostKindEnum::RegName:
+            break;
+    }
+
+    return result;
+}
+
+Thoth::Http::QueryParams UrlView::GetQueryParams() const { return QueryParams::Parse(m_query); }
+
+Thoth::Http::Url UrlView::ToUrl() const {
+    Url url{};
+    url.m_rawUrl = std::string{ m_rawUrl };
+    url.SetRanges_(*this);
+
+    return url;
+}
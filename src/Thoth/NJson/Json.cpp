@@ -1,9 +1,12 @@
 // ReSharper disable CppPassValueParameterByConstReference
 
 #include <algorithm>
+#include <bit>
 #include <bitset>
+#include <cstring>
 #include <execution>
 #include <expected>
+#include <thread>
 
 #include <Thoth/String/UnicodeViewer.hpp>
 #include <Thoth/ThothError.hpp>
@@ -158,6 +161,110 @@ bool Json::operator==(const Json& other) const {
 }
 
 
+#pragma region Hash
+
+// The primes, rounds and avalanche of XXH64.
+static constexpr uint64_t k_prime1{ 0x9E3779B185EBCA87ULL };
+static constexpr uint64_t k_prime2{ 0xC2B2AE3D27D4EB4FULL };
+static constexpr uint64_t k_prime3{ 0x165667B19E3779F9ULL };
+static constexpr uint64_t k_prime4{ 0x85EBCA77C2B2AE63ULL };
+static constexpr uint64_t k_prime5{ 0x27D4EB2F165667C5ULL };
+
+static constexpr uint64_t HashRound(uint64_t acc, const uint64_t input) {
+    acc += input * k_prime2;
+    return std::rotl(acc, 31) * k_prime1;
+}
+
+static constexpr uint64_t HashMerge(const uint64_t acc, const uint64_t input) {
+    return std::rotl(acc ^ HashRound(0, input), 27) * k_prime1 + k_prime4;
+}
+
+static constexpr uint64_t HashAvalanche(uint64_t hash) {
+    hash ^= hash >> 33;
+    hash *= k_prime2;
+    hash ^= hash >> 29;
+    hash *= k_prime3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+// The tail of XXH64 over all the text: the strings of a document are mostly shorter than its 32 bytes stripes.
+static uint64_t HashText(std::string_view text, const uint64_t seed) {
+    uint64_t hash{ seed + k_prime5 + text.size() };
+
+    for (; text.size() >= 8; text.remove_prefix(8)) {
+        uint64_t word;
+        std::memcpy(&word, text.data(), sizeof(word));
+        hash = HashMerge(hash, word);
+    }
+    if (text.size() >= 4) {
+        uint32_t word;
+        std::memcpy(&word, text.data(), sizeof(word));
+        hash ^= word * k_prime1;
+        hash = std::rotl(hash, 23) * k_prime2 + k_prime3;
+        text.remove_prefix(4);
+    }
+    for (const char c : text) {
+        hash ^= static_cast<unsigned char>(c) * k_prime5;
+        hash = std::rotl(hash, 11) * k_prime1;
+    }
+
+    return HashAvalanche(hash);
+}
+
+static uint64_t HashJson(const Json& json) {
+    // Seeded by the index of the type, an empty array and an empty object don't collide.
+    const auto seed{ k_prime1 * (static_cast<const Json::Value&>(json).index() + 1) };
+
+    return json.Visit(Hermes::Utils::Overloaded{
+        [&](const Null&)         { return HashAvalanche(seed); },
+        [&](const Bool bln)      { return HashAvalanche(HashRound(seed, bln)); },
+        [&](const String& str)   { return HashText(str.AsView(), seed); },
+        [&](const Number& num) {
+            // Numbers of different types are equal by value, as doubles.
+            const auto val{ num.AsFloat() };
+            return HashAvalanche(HashRound(seed, std::bit_cast<uint64_t>(val == 0 ? 0.0 : val)));
+        },
+        [&](const Array& arr) {
+            uint64_t hash{ seed + arr.size() };
+            for (const auto& elem : arr)
+                hash = HashMerge(hash, HashJson(elem));
+
+            return HashAvalanche(hash);
+        },
+        [&](const Object& obj) {
+            // Summed, the order of the members doesn't matter.
+            uint64_t sum{};
+            for (const auto& [key, val] : *obj)
+                sum += HashAvalanche(HashMerge(HashText(key, k_prime2), HashJson(val)));
+
+            return HashAvalanche(HashMerge(seed + obj->Size(), sum));
+        }
+    });
+}
+
+size_t Json::Hash() const {
+    return static_cast<size_t>(HashJson(*this));
+}
+
+
+HashedJson::HashedJson(Json json) : m_json{ std::move(json) }, m_hash{ m_json.Hash() } { }
+
+const Json& HashedJson::AsJson() const noexcept {
+    return m_json;
+}
+
+size_t HashedJson::Hash() const noexcept {
+    return m_hash;
+}
+
+bool HashedJson::operator==(const HashedJson& other) const {
+    return m_hash == other.m_hash && m_json == other.m_json;
+}
+
+#pragma endregion
+
+
 #pragma region I hate to love c preprocessor
 // This section is dedicated to this cursed amazing feature that deserves
 // to be deprecated/context constrained 10 years ago
@@ -194,65 +301,6 @@ bool Json::operator==(const Json& other) const {
 
 #pragma region Read functions
 
-static bool DecodeUtf16(std::string_view& s, std::string& out) {
-    constexpr auto hex = [](const char c) -> int {
-        if (c >= '0' && c <= '9') return c - '0';
-        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
-        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
-        return -1;
-    };
-
-    auto readU = [&](uint16_t& v) -> bool {
-        if (s.size() < 5 || s[0] != 'u') return false;
-        uint16_t x{};
-        for (int i = 1; i < 5; i++) {
-            const int h{ hex(s[i]) };
-            if (h < 0) return false;
-            x = (x<<4) | h;
-        }
-        v = x;
-        s.remove_prefix(5);
-        return true;
-    };
-
-    uint16_t h;
-    if (!readU(h)) return false;
-
-    uint32_t code{ h };
-
-    // surrogate?
-    if (0xD800 <= h && h <= 0xDBFF) {
-        if (s.empty() || s[0] != '\\') return false;
-        s.remove_prefix(1);
-
-        uint16_t l;
-        if (!readU(l)) return false;
-        if (l < 0xDC00 || l > 0xDFFF) return false;
-        code = 0x10000 + (((h - 0xD800) << 10) | (l - 0xDC00));
-    }
-
-#define char static_cast<char>
-    if (code < 0x80) {
-        out.push_back(char(code));
-    } else if (code < 0x800) {
-        out.push_back(char(0xC0 | (code>>6)));
-        out.push_back(char(0x80 | (code&63)));
-    } else if (code < 0x10000) {
-        out.push_back(char(0xE0 | (code>>12)));
-        out.push_back(char(0x80 | ((code>>6)&63)));
-        out.push_back(char(0x80 | (code&63)));
-    } else {
-        out.push_back(char(0xF0 | (code>>18)));
-        out.push_back(char(0x80 | ((code>>12)&63)));
-        out.push_back(char(0x80 | ((code>>6)&63)));
-        out.push_back(char(0x80 | (code&63)));
-    }
-#undef char
-
-    return true;
-}
-
-
 static bool details_::ReadString(std::string_view& input, auto& val, const BufferInfo& info) {
     if (*input.data() != '"')
         return false;
@@ -280,45 +328,39 @@ static bool details_::ReadString(std::string_view& input, auto& val, const Buffe
     input.remove_prefix(1);
 
     // Well, it doesn't make sense to check for all chars because just std::strings can have UTF-8 chars.
-    // Moreover, now the cache will not blame on me again.
-    if (std::ranges::any_of(strRef, [](const auto c){ return c & 0x80; }) &&
-        !Thoth::String::Utf8View::IsValid(std::bit_cast<std::u8string_view>(strRef)))
+    // IsValid skips the ASCII runs 16 or 32 bytes at a time, no need to look for a non ASCII byte first.
+    if (!Thoth::String::Utf8View::IsValid(std::bit_cast<std::u8string_view>(strRef)))
         return false;
 
     if (iterations == 1) {
-        val = String::FromRef({strRef, info.buffer});
+        // Short strings are copied inline without touching the buffer's reference count.
+        if (strRef.size() <= String::k_inlineCapacity)
+            val = String{ strRef };
+        else
+            val = String::FromRef({ strRef, info.buffer });
         return true;
     }
 
-    std::string str;
-    str.reserve(strRef.size());
-
-    while (true) {
-        const size_t pos{ strRef.find('\\') };
-
-        if (pos == std::string::npos)
-            break;
+    // Only validated now, decoded if the string is ever read.
+    if (info.lazyUnescape) {
+        auto str{ String::FromEscaped({ strRef, info.buffer }) };
+        if (!str)
+            return false;
 
-        str.append_range(std::string_view{ strRef.data(), pos });
-        strRef.remove_prefix(pos + 1);
+        val = std::move(*str);
+        return true;
+    }
 
-        switch (*strRef.data()) {
-            case 'u' : if (!DecodeUtf16(strRef, str)) return false; break;
-            case '\\': str.push_back('\\'); strRef.remove_prefix(1);  break;
-            case '"' : str.push_back('\"'); strRef.remove_prefix(1);  break;
-            case 'n' : str.push_back('\n'); strRef.remove_prefix(1);  break;
-            case 'r' : str.push_back('\r'); strRef.remove_prefix(1);  break;
-            case 't' : str.push_back('\t'); strRef.remove_prefix(1);  break;
+    std::string str;
+    str.reserve(strRef.size());
 
-            default: return false;
-        }
-    }
-    str.append_range(strRef);
+    if (!UnescapeJsonString(strRef, str))
+        return false;
 
     val = String::FromOwned(std::move(str));
     return true;
 }
-static bool details_::ReadNumber(std::string_view& input, auto& val) {
+static bool details_::ReadNumber(std::string_view& input, auto& val, const BufferInfo& info) {
     const auto openValNumber{ input.data() };
     constexpr auto validChars{ []{
         std::bitset<256> res{};
@@ -334,14 +376,16 @@ static bool details_::ReadNumber(std::string_view& input, auto& val) {
 
     const auto closeValNumber{ input.data() };
 
-    auto parsed{ Number::TryParse({ openValNumber, closeValNumber }) };
+    const std::string_view token{ openValNumber, closeValNumber };
+    auto parsed{ info.lazyNumbers ? Number::FromToken(token) : Number::TryParse(token) };
     if (!parsed) return false;
 
     val = *parsed;
     return true;
 }
 static bool details_::ReadObject(std::string_view& input, auto& val, const BufferInfo& info) {
-    JsonObject json;
+    // Collected in the order of the text and sorted once at the end, an insertion per key is O(n²).
+    std::vector<JsonObject::JsonPair> pairs;
 
     ADVANCE_SPACES();
 
@@ -353,7 +397,7 @@ static bool details_::ReadObject(std::string_view& input, auto& val, const Buffe
 
         ADVANCE_SPACES();
 
-        if (json.Size() == 0 && *input.data() == '}')
+        if (pairs.empty() && *input.data() == '}')
             break;
 
         String key;
@@ -368,16 +412,16 @@ static bool details_::ReadObject(std::string_view& input, auto& val, const Buffe
 
         ADVANCE_SPACES();
 
-        auto [newItem, _]{ json.m_pairs.try_emplace(key.AsOwned(), NullV ) };
+        auto& [_, newItem]{ pairs.emplace_back(JsonObjKey{ key.AsView() }, NullV) };
 
         bool success{};
         switch (*input.data()) {
-            CASE_OPEN_STRING   success = ReadString(input, newItem->second, info); break;
-            CASE_OPEN_NUMBER   success = ReadNumber(input, newItem->second);       break;
-            CASE_OPEN_OBJECT   success = ReadObject(input, newItem->second, info); break;
-            CASE_OPEN_BOOLEAN  success = ReadBool(  input, newItem->second);       break;
-            CASE_OPEN_NULLABLE success = ReadNull(  input, newItem->second);       break;
-            CASE_OPEN_ARRAY    success = ReadArray( input, newItem->second, info); break;
+            CASE_OPEN_STRING   success = ReadString(input, newItem, info); break;
+            CASE_OPEN_NUMBER   success = ReadNumber(input, newItem, info); break;
+            CASE_OPEN_OBJECT   success = ReadObject(input, newItem, info); break;
+            CASE_OPEN_BOOLEAN  success = ReadBool(  input, newItem);       break;
+            CASE_OPEN_NULLABLE success = ReadNull(  input, newItem);       break;
+            CASE_OPEN_ARRAY    success = ReadArray( input, newItem, info); break;
             default: return false;
         }
         if (!success)
@@ -390,7 +434,8 @@ static bool details_::ReadObject(std::string_view& input, auto& val, const Buffe
     }
     input.remove_prefix(1);
 
-    val = std::move(json);
+    // A repeated key keeps the last value, as most parsers do.
+    val = JsonObject{ JsonObject::MapType::FromUnsorted(std::move(pairs), Thoth::Dsa::DuplicateKeyEnum::KeepLast) };
     return true;
 }
 static bool details_::ReadBool(std::string_view& input, auto& val) {
@@ -429,7 +474,7 @@ static bool details_::ReadArray(std::string_view& input, auto& val, const Buffer
         bool success{};
         switch (*input.data()) {
             CASE_OPEN_STRING   success = ReadString(input, array.back(), info); break;
-            CASE_OPEN_NUMBER   success = ReadNumber(input, array.back());       break;
+            CASE_OPEN_NUMBER   success = ReadNumber(input, array.back(), info); break;
             CASE_OPEN_OBJECT   success = ReadObject(input, array.back(), info); break;
             CASE_OPEN_BOOLEAN  success = ReadBool(  input, array.back());       break;
             CASE_OPEN_NULLABLE success = ReadNull(  input, array.back());       break;
@@ -457,10 +502,14 @@ std::expected<Json, ThothError> Json::Parse(std::string_view input) {
     return ParseText(input);
 }
 
-std::expected<Json, ThothError> Json::ParseText(std::string_view input, bool copyData, bool checkFinal) {
-    details_::BufferInfo info{};
+std::expected<Json, ThothError> Json::ParseText(std::string_view input, bool copyData, bool checkFinal, bool lazyNumbers) {
+    return ParseText(input, ParseOptions{ .copyData = copyData, .checkFinal = checkFinal, .lazyNumbers = lazyNumbers });
+}
 
-    if (copyData) {
+std::expected<Json, ThothError> Json::ParseText(std::string_view input, const ParseOptions& options) {
+    details_::BufferInfo info{ .lazyNumbers = options.lazyNumbers, .lazyUnescape = options.lazyUnescape };
+
+    if (options.copyData) {
         info.buffer = std::make_shared<std::string>(input);
         info.bufferView = *info.buffer;
         input = info.bufferView;
@@ -483,7 +532,7 @@ std::expected<Json, ThothError> Json::ParseText(std::string_view input, bool cop
 
     switch (input[0]){
         CASE_OPEN_STRING   success = details_::ReadString(input, json, info); break;
-        CASE_OPEN_NUMBER   success = details_::ReadNumber(input, json);       break;
+        CASE_OPEN_NUMBER   success = details_::ReadNumber(input, json, info); break;
         CASE_OPEN_OBJECT   success = details_::ReadObject(input, json, info); break;
         CASE_OPEN_NULLABLE success = details_::ReadNull(  input, json);       break;
         CASE_OPEN_BOOLEAN  success = details_::ReadBool(  input, json);       break;
@@ -494,12 +543,12 @@ std::expected<Json, ThothError> Json::ParseText(std::string_view input, bool cop
         return error();
 
 #define return json; // Oh god, no again
-    if (checkFinal) {
+    if (options.checkFinal) {
         ADVANCE_SPACES();
     }
 #undef return
 
-    if (input.empty() || !checkFinal)
+    if (input.empty() || !options.checkFinal)
         return json;
 
     return error();
@@ -675,4 +724,16 @@ ExpValWrapper Json::FindAndMoveOrError(const Keys keys) && {
 }
 
 
+#pragma endregion
+
+
+#pragma region Parallel Functions
+
+size_t details_::ParallelChunkCount(const size_t count, const ParallelOptions& options) {
+    const size_t threads{ options.threads ? options.threads : std::max(size_t{ 1 }, size_t{ std::thread::hardware_concurrency() }) };
+
+    // Each chunk has at least `grain` children, the few left over spread over them.
+    return std::clamp(count / std::max(options.grain, size_t{ 1 }), size_t{ 1 }, threads);
+}
+
 #pragma endregion
\ No newline at end of file
@@ -0,0 +1,60 @@
+#include <Thoth/NJson/JsonLiteral.hpp>
+
+#include <bit>
+#include <cstdlib>
+#include <vector>
+
+using namespace Thoth::NJson;
+using details_::LiteralToken;
+using details_::LiteralTokenEnum;
+
+
+// Builds the value at `token` and its children, leaving `token` past them.
+static Json BuildValue(const LiteralToken*& token, const std::string_view text) {
+    const auto& [kind, size, value]{ *token++ };
+
+    switch (kind) {
+        case LiteralTokenEnum::Null:     return Json{};
+        case LiteralTokenEnum::True:     return Json{ true };
+        case LiteralTokenEnum::False:    return Json{ false };
+        case LiteralTokenEnum::Signed:   return Json{ Json::Value{ Number{ static_cast<int64_t>(value) } } };
+        case LiteralTokenEnum::Unsigned: return Json{ Json::Value{ Number{ value } } };
+        case LiteralTokenEnum::Float:    return Json{ Json::Value{ Number{ std::bit_cast<double>(value) } } };
+        // Correctly rounded as from_chars, but also rounding the ones out of range as Number::Materialized.
+        case LiteralTokenEnum::FloatText: return Json{ Json::Value{ Number{ std::strtod(text.data() + value, nullptr) } } };
+
+        // The text is in the static storage of the literal: referenced, with nothing to keep alive.
+        case LiteralTokenEnum::String:
+            return Json{ Json::Value{ String::FromRef(StringRef{ text.substr(value, size), std::shared_ptr<std::string>{} }) } };
+
+        case LiteralTokenEnum::Array: {
+            Array arr;
+            arr.reserve(size);
+            for (uint32_t i{}; i < size; ++i)
+                arr.push_back(BuildValue(token, text));
+
+            return Json{ std::move(arr) };
+        }
+
+        case LiteralTokenEnum::Object: {
+            std::vector<JsonObject::JsonPair> pairs;
+            pairs.reserve(size);
+            for (uint32_t i{}; i < size; ++i) {
+                const auto& key{ *token++ };
+                JsonObjKey name{ text.substr(key.value, key.size) };
+
+                pairs.emplace_back(std::move(name), BuildValue(token, text));
+            }
+
+            // A repeated key keeps the last value, as Json::Parse.
+            return Json{ JsonObject{ JsonObject::MapType::FromUnsorted(std::move(pairs), Thoth::Dsa::DuplicateKeyEnum::KeepLast) } };
+        }
+    }
+
+    return Json{};
+}
+
+Json details_::BuildJson(const std::span<const LiteralToken> tokens, const std::string_view text) {
+    const auto* token{ tokens.data() };
+    return BuildValue(token, text);
+}
@@ -137,6 +137,15 @@ ValWrapper JsonObject::GetOrNullAndMove(JsonObjKeyRef key) && {
 }
 
 
+std::span<Json> JsonObject::Values() {
+    return m_pairs.values();
+}
+
+std::span<const Json> JsonObject::Values() const {
+    return m_pairs.values();
+}
+
+
 void JsonObject::Clear() {
     m_pairs.clear();
 }
@@ -0,0 +1,136 @@
+#include <Thoth/NJson/JsonString.hpp>
+
+#include <algorithm>
+#include <limits>
+
+using namespace Thoth::NJson;
+
+
+namespace {
+    // Only validates the escapes.
+    struct NullSink {
+        void push_back(char) {}
+        void append(std::string_view) {}
+    };
+}
+
+
+JsonString::JsonString(const JsonString& other) : JsonString{} {
+    if (other.IsShared_())
+        SetRef_(other.RefData_(), other.RefSize_(), other.m_kind);
+    else
+        SetText_(other.AsView());
+}
+
+JsonString& JsonString::operator=(const JsonString& other) {
+    if (this == &other)
+        return *this;
+
+    if (other.IsShared_()) {
+        Reset_();
+        SetRef_(other.RefData_(), other.RefSize_(), other.m_kind);
+    } else
+        SetText_(other.AsView());
+
+    return *this;
+}
+
+std::optional<JsonString> JsonString::FromEscaped(const StringRef& escaped) {
+    const auto text{ escaped.str };
+
+    // As in SetRef short text is stored inline, here decoded right away: it only gets shorter.
+    if (text.size() <= k_inlineCapacity) {
+        char decoded[k_inlineCapacity];
+        details_::BufferSink sink{ decoded };
+        if (!details_::UnescapeJsonString(text, sink))
+            return std::nullopt;
+
+        return JsonString{ std::string_view{ decoded, sink.size } };
+    }
+
+    NullSink validate;
+    if (!details_::UnescapeJsonString(text, validate))
+        return std::nullopt;
+
+    // The size has to fit beside the pointer, as for a reference.
+    if (text.size() > std::numeric_limits<uint32_t>::max()) {
+        std::string heap;
+        details_::UnescapeJsonString(text, heap);
+        return FromOwned(std::move(heap));
+    }
+
+    // Aliasing the block rather than the text: the decoded text hangs from it.
+    auto block{ std::make_shared<const EscapedText_>(RefData{ escaped.m_data, text.data() }) };
+    const auto* blockData{ reinterpret_cast<const char*>(block.get()) };
+
+    JsonString res;
+    res.SetRef_(RefData{ std::move(block), blockData }, static_cast<uint32_t>(text.size()), KindEnum::Escaped);
+
+    return res;
+}
+
+JsonString JsonString::FromOwned(const std::string& own) {
+    JsonString res;
+    res.SetText_(own);
+
+    return res;
+}
+
+JsonString& JsonString::SetOwned(const std::string& own) {
+    SetText_(own);
+    return *this;
+}
+
+std::string& JsonString::AsOwned() {
+    if (m_kind != KindEnum::Owned) {
+        auto* heap{ new std::string{ AsView() } };
+        Reset_();
+        SetOwned_(heap);
+    }
+
+    return *Owned_();
+}
+
+std::string JsonString::AsCopy() const {
+    return std::string{ AsView() };
+}
+
+StringRef JsonString::AsRef() const {
+    if (IsRef())
+        return StringRef{ AsView(), RefData_() };
+
+    return StringRef{ AsView(), RefData{} };
+}
+
+bool JsonString::operator==(const JsonString& other) const {
+    // The same escaped text decodes to the same string, no need to decode it.
+    if (IsEscaped() && other.IsEscaped() && SourceView() == other.SourceView())
+        return true;
+
+    return AsView() == other.AsView();
+}
+
+
+const std::string& JsonString::Decoded_() const {
+    const auto& escaped{ Escaped_() };
+    if (const auto* decoded{ escaped.decoded.load(std::memory_order_acquire) })
+        return *decoded;
+
+    auto decoded{ std::make_unique<std::string>() };
+    decoded->reserve(RefSize_());
+    details_::UnescapeJsonString(SourceView(), *decoded); // validated by FromEscaped
+
+    // Threads reading at once each decode, the first to publish wins and the others drop their copy.
+    const std::string* published{};
+    if (escaped.decoded.compare_exchange_strong(published, decoded.get(), std::memory_order_acq_rel))
+        return *decoded.release();
+
+    return *published;
+}
+
+
+JsonString::EscapedText_::EscapedText_(RefData source) noexcept : source{ std::move(source) } {}
+
+JsonString::EscapedText_::~EscapedText_() {
+    delete decoded.load(std::memory_order_relaxed);
+}
@@ -1,6 +1,114 @@
 #include <Thoth/NJson/Number.hpp>
 
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
 using Thoth::NJson::Number;
+using Thoth::NJson::NumberToken;
+
+
+namespace {
+    Number Convert(const std::string_view text) noexcept {
+        if (auto parsed{ Number::TryParse(text) })
+            return *parsed;
+
+        // Only a double out of range gets here, from_chars refuses it where strtod rounds it.
+        std::array<char, NumberToken::k_capacity + 1> str{};
+        std::ranges::copy(text, str.begin());
+        return Number{ std::strtod(str.data(), nullptr) };
+    }
+
+    template<class T>
+    T Load(const std::array<std::byte, sizeof(uint64_t)>& bytes) noexcept {
+        T res;
+        std::memcpy(&res, bytes.data(), sizeof(res));
+
+        return res;
+    }
+}
+
+
+NumberToken::NumberToken(const std::string_view literal) noexcept {
+    m_packed.fill(0xFF);
+    for (size_t i{}; i < literal.size(); ++i) {
+        const auto index{ static_cast<uint8_t>(Thoth::NJson::details_::k_numberChars.find(literal[i])) };
+        m_packed[i / 2] &= static_cast<uint8_t>(i % 2 ? index << 4 | 0x0F : index | 0xF0);
+    }
+}
+
+NumberToken::NumberToken(const NumberToken& other) noexcept : m_packed{ other.m_packed } {
+    const auto cache{ other.m_cache.load(std::memory_order_acquire) };
+    if (cache != CacheEnum::Empty && cache != CacheEnum::Writing) {
+        m_value = other.m_value;
+        m_cache.store(cache, std::memory_order_relaxed);
+    }
+}
+
+NumberToken& NumberToken::operator=(const NumberToken& other) noexcept {
+    if (this == &other)
+        return *this;
+
+    m_packed = other.m_packed;
+
+    const auto cache{ other.m_cache.load(std::memory_order_acquire) };
+    if (cache != CacheEnum::Empty && cache != CacheEnum::Writing) {
+        m_value = other.m_value;
+        m_cache.store(cache, std::memory_order_relaxed);
+    } else
+        m_cache.store(CacheEnum::Empty, std::memory_order_relaxed);
+
+    return *this;
+}
+
+NumberToken::Text NumberToken::Literal() const noexcept {
+    Text res{};
+    for (; res.size < k_capacity; ++res.size) {
+        const auto index{ (m_packed[res.size / 2] >> (res.size % 2 * 4)) & 0x0F };
+        if (index == 0x0F)
+            break;
+
+        res.chars[res.size] = Thoth::NJson::details_::k_numberChars[index];
+    }
+
+    return res;
+}
+
+bool NumberToken::operator==(const NumberToken& other) const noexcept {
+    // The padding is the same for any literal, the bytes compare as the text.
+    return m_packed == other.m_packed;
+}
+
+std::optional<Number> NumberToken::Cached_() const noexcept {
+    switch (m_cache.load(std::memory_order_acquire)) {
+        case CacheEnum::I64:   return Number{ Load<int64_t>(m_value) };
+        case CacheEnum::UI64:  return Number{ Load<uint64_t>(m_value) };
+        case CacheEnum::Float: return Number{ Load<double>(m_value) };
+        default:               return std::nullopt;
+    }
+}
+
+void NumberToken::Cache_(const Number& value) const noexcept {
+    // Only the first to claim the cache writes it, the others keep their value without waiting.
+    auto expected{ CacheEnum::Empty };
+    if (!m_cache.compare_exchange_strong(expected, CacheEnum::Writing, std::memory_order_relaxed))
+        return;
+
+    const auto cache{ std::visit([this]<class T>(const T& v) {
+        if constexpr (std::same_as<T, NumberToken>)
+            return CacheEnum::Empty; // Materialized never returns a token
+        else {
+            std::memcpy(m_value.data(), &v, sizeof(v));
+
+            if constexpr (std::same_as<T, int64_t>)       return CacheEnum::I64;
+            else if constexpr (std::same_as<T, uint64_t>) return CacheEnum::UI64;
+            else                                          return CacheEnum::Float;
+        }
+    }, static_cast<const Number::variant&>(value)) };
+
+    m_cache.store(cache, std::memory_order_release);
+}
+
 
 std::optional<Number> Number::TryParse(const std::string_view str) noexcept {
     if (str.empty()) return std::nullopt;
@@ -32,14 +140,43 @@ std::optional<Number> Number::TryParse(const std::string_view str) noexcept {
     return Number{ val };
 }
 
+std::optional<Number> Number::FromToken(const std::string_view str) noexcept {
+    if (str.size() > NumberToken::k_capacity)
+        return TryParse(str);
+
+    if (!Thoth::NJson::details_::IsNumberLiteral(str)) return std::nullopt;
+
+    return Number{ NumberToken{ str } };
+}
+
+
+bool Number::IsToken() const noexcept {
+    return std::holds_alternative<NumberToken>(*this);
+}
+
+Number Number::Materialized() const noexcept {
+    const auto* token{ std::get_if<NumberToken>(this) };
+    if (token == nullptr) return *this;
+
+    if (auto cached{ token->Cached_() })
+        return *cached;
+
+    auto res{ Convert(token->Literal().View()) };
+    token->Cache_(res);
+
+    return res;
+}
+
 
 std::optional<int64_t> Number::AsI64() const noexcept {
     // 2^63: one past INT64_MAX, exactly representable as double (power of 2)
     static constexpr double k_max{  9223372036854775808.0 };
     static constexpr double k_min{ -9223372036854775808.0 }; // == INT64_MIN exactly
 
-    return std::visit([]<class T>(const T v) -> std::optional<int64_t> {
-        if constexpr (std::same_as<T, int64_t>) {
+    return std::visit([this]<class T>(const T& v) -> std::optional<int64_t> {
+        if constexpr (std::same_as<T, NumberToken>) {
+            return Materialized().AsI64();
+        } else if constexpr (std::same_as<T, int64_t>) {
             return v;
         } else if constexpr (std::same_as<T, uint64_t>) {
             if (v > static_cast<uint64_t>(std::numeric_limits<int64_t>::max()))
@@ -50,7 +187,7 @@ std::optional<int64_t> Number::AsI64() const noexcept {
             if (v < k_min || v >= k_max)                 return std::nullopt;
             return static_cast<int64_t>(v);
         }
-    }, static_cast<const std::variant<int64_t, uint64_t, double>&>(*this));
+    }, static_cast<const variant&>(*this));
 }
 
 
@@ -58,8 +195,10 @@ std::optional<uint64_t> Number::AsUI64() const noexcept {
     // 2^64: one past UINT64_MAX, exactly representable as double
     static constexpr double k_max{ 18446744073709551616.0 };
 
-    return std::visit([]<class T>(const T v) -> std::optional<uint64_t> {
-        if constexpr (std::same_as<T, int64_t>) {
+    return std::visit([this]<class T>(const T& v) -> std::optional<uint64_t> {
+        if constexpr (std::same_as<T, NumberToken>) {
+            return Materialized().AsUI64();
+        } else if constexpr (std::same_as<T, int64_t>) {
             if (v < 0) return std::nullopt;
             return static_cast<uint64_t>(v);
         } else if constexpr (std::same_as<T, uint64_t>) {
@@ -69,39 +208,54 @@ std::optional<uint64_t> Number::AsUI64() const noexcept {
             if (v >= k_max)                                           return std::nullopt;
             return static_cast<uint64_t>(v);
         }
-    }, static_cast<const std::variant<int64_t, uint64_t, double>&>(*this));
+    }, static_cast<const variant&>(*this));
 }
 
 
 double Number::AsFloat() const noexcept {
-    return std::visit([]<class T>(const T v) -> double {
-        return static_cast<double>(v);
-    }, static_cast<const std::variant<int64_t, uint64_t, double>&>(*this));
+    return std::visit([this]<class T>(const T& v) -> double {
+        if constexpr (std::same_as<T, NumberToken>)
+            return Materialized().AsFloat();
+        else
+            return static_cast<double>(v);
+    }, static_cast<const variant&>(*this));
 }
 
 
 bool Number::IsIntegral() const noexcept {
     return std::holds_alternative<int64_t>(*this)
-        || std::holds_alternative<uint64_t>(*this);
+        || std::holds_alternative<uint64_t>(*this)
+        || (IsToken() && !IsFloat());
 }
 
 bool Number::IsFloat() const noexcept {
+    // The same rule as TryParse, no need to convert.
+    if (const auto* token{ std::get_if<NumberToken>(this) })
+        return token->Literal().View().find_first_of(".eE") != std::string_view::npos;
+
     return std::holds_alternative<double>(*this);
 }
 
 bool Number::IsNegative() const noexcept {
-    return std::visit([]<class T>(const T v) -> bool {
-        if constexpr (std::same_as<T, uint64_t>) return false;
+    return std::visit([this]<class T>(const T& v) -> bool {
+        if constexpr (std::same_as<T, NumberToken>) return Materialized().IsNegative();
+        else if constexpr (std::same_as<T, uint64_t>) return false;
         else if constexpr (std::same_as<T, int64_t>) return v < 0;
         else return std::signbit(v); // handles -0.0
-    }, static_cast<const std::variant<int64_t, uint64_t, double>&>(*this));
+    }, static_cast<const variant&>(*this));
 }
 
 
 
 bool Number::operator==(const Number& other) const noexcept {
-    return std::visit([]<class T, class U>(const T a, const U b) -> bool {
-        if constexpr (std::same_as<T, U>) {
+    // Tokens compare by value, "1.0" equals "1.00".
+    if (IsToken() || other.IsToken())
+        return Materialized() == other.Materialized();
+
+    return std::visit([]<class T, class U>(const T& a, const U& b) -> bool {
+        if constexpr (std::same_as<T, NumberToken> || std::same_as<U, NumberToken>) {
+            return false; // converted above
+        } else if constexpr (std::same_as<T, U>) {
             return a == b;
         } else if constexpr (std::same_as<T, int64_t> && std::same_as<U, uint64_t>) {
             return a >= 0 && static_cast<uint64_t>(a) == b;
@@ -110,6 +264,6 @@ bool Number::operator==(const Number& other) const noexcept {
         } else {
             return static_cast<double>(a) == static_cast<double>(b);
         }
-    }, static_cast<const std::variant<int64_t, uint64_t, double>&>(*this),
-       static_cast<const std::variant<int64_t, uint64_t, double>&>(other));
+    }, static_cast<const variant&>(*this),
+       static_cast<const variant&>(other));
 }
\ No newline at end of file
@@ -7,7 +7,10 @@ using namespace Thoth::NJson;
 StringRef::StringRef(const std::string& other) : str{ other } { }
 
 // NOLINTNEXTLINE(*)
-StringRef::StringRef(const std::string_view other, const std::shared_ptr<std::string> data) : str{ other }, m_data{ data } { }
+StringRef::StringRef(const std::string_view other, std::shared_ptr<std::string> data) : str{ other }, m_data{ std::move(data), other.data() } { }
+
+StringRef::StringRef(const std::string_view other, std::shared_ptr<const char> data) noexcept
+    : str{ other }, m_data{ std::move(data) } { }
 
 StringRef::operator std::string_view() const noexcept {
     return str;
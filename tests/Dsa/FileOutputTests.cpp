@@ -138,4 +138,170 @@ protected:
 //     EXPECT_EQ(a, a);
 // }
 
-#pragma endregion
\ No newline at end of file
+#pragma endregion
+
+#pragma region Buffered Writes
+
+using Thoth::Dsa::BinFileOutputRange;
+using Thoth::Dsa::FileOutputOptions;
+
+struct FileOutputRangeWriteTest : testing::Test {
+    const std::filesystem::path tmp{ MakeTempPath("thoth_test_write.bin") };
+
+    void TearDown() override {
+        std::filesystem::remove(tmp);
+    }
+
+    static std::string Payload(const size_t size) {
+        std::string res(size, '\0');
+        for (size_t i{}; i < size; ++i)
+            res[i] = static_cast<char>('a' + i % 26);
+        return res;
+    }
+
+    void WriteWith(const std::string& text, const FileOutputOptions& options) const {
+        TextFileOutputRange range{ tmp, options };
+        std::ranges::copy(text, range.begin());
+        ASSERT_TRUE(range.Flush());
+    }
+};
+
+TEST_F(FileOutputRangeWriteTest, Write_LargerThanBuffer_FileContainsContent) {
+    const auto text{ Payload(3 * Thoth::Dsa::details_::FileWriter::k_bufferSize + 123) };
+    WriteWith(text, {});
+    EXPECT_EQ(ReadFile(tmp), text);
+}
+
+TEST_F(FileOutputRangeWriteTest, Write_Bytes_FileContainsContent) {
+    {
+        BinFileOutputRange range{ tmp };
+        auto it{ range.begin() };
+        *it = std::byte{ 0x00 }; *it = std::byte{ 0xFF }; *it = std::byte{ 0x0A };
+    }
+    EXPECT_EQ(ReadFile(tmp), std::string("\x00\xFF\x0A", 3));
+}
+
+TEST_F(FileOutputRangeWriteTest, Write_ExistingFile_Truncates) {
+    std::ofstream{ tmp } << "a much longer previous content";
+    WriteWith("new", {});
+    EXPECT_EQ(ReadFile(tmp), "new");
+}
+
+TEST_F(FileOutputRangeWriteTest, Write_AtOffset_KeepsContent) {
+    std::ofstream{ tmp } << "0123456789";
+    WriteWith("abc", { .offset = 4, .keepContent = true });
+    EXPECT_EQ(ReadFile(tmp), "0123abc789");
+}
+
+TEST_F(FileOutputRangeWriteTest, Write_AtOffsetZero_KeepsBytesAfter) {
+    // As the first segment of a download, the others already written.
+    std::ofstream{ tmp } << "0123456789";
+    WriteWith("abc", { .keepContent = true });
+    EXPECT_EQ(ReadFile(tmp), "abc3456789");
+}
+
+TEST_F(FileOutputRangeWriteTest, Write_AtOffset_TruncatesUnlessKept) {
+    std::ofstream{ tmp } << "0123456789";
+    WriteWith("abc", { .offset = 4 });
+    EXPECT_EQ(ReadFile(tmp), std::string("\0\0\0\0abc", 7));
+}
+
+TEST_F(FileOutputRangeWriteTest, Write_Append_AddsAtEnd) {
+    std::ofstream{ tmp } << "head-";
+    WriteWith("tail", { .mode = std::ios::app });
+    EXPECT_EQ(ReadFile(tmp), "head-tail");
+}
+
+TEST_F(FileOutputRangeWriteTest, Write_AfterMove_IteratorStillValid) {
+    const auto other{ MakeTempPath("thoth_test_write_other.bin") };
+    {
+        TextFileOutputRange a{ tmp };
+        auto it{ a.begin() };
+        *it = 'a';
+
+        TextFileOutputRange b{ std::move(a) };
+        *it = 'b';
+
+        TextFileOutputRange c{ other };
+        c = std::move(b);
+        *it = 'c';
+    }
+    EXPECT_EQ(ReadFile(tmp), "abc");
+    EXPECT_EQ(ReadFile(other), "");
+    std::filesystem::remove(other);
+}
+
+TEST_F(FileOutputRangeWriteTest, Flush_WritesBufferedBytes) {
+    TextFileOutputRange range{ tmp };
+    std::ranges::copy(std::string{ "flushed" }, range.begin());
+
+    ASSERT_TRUE(range.Flush());
+    EXPECT_EQ(ReadFile(tmp), "flushed");
+}
+
+TEST_F(FileOutputRangeWriteTest, Open_MissingDirectory_NotOpenAndFlushFails) {
+    TextFileOutputRange range{ MakeTempPath("thoth_missing_dir") / "file.txt" };
+
+    EXPECT_FALSE(range.IsOpen());
+    *range.begin() = 'x';
+    EXPECT_FALSE(range.Flush());
+}
+
+#pragma endregion
+
+
+#pragma region Options
+
+struct FileOutputRangeOptionsTest : FileOutputRangeWriteTest {
+    // The hints only change how the bytes reach the disk, never which ones.
+    static constexpr FileOutputOptions k_hints[]{
+        {},
+        { .preallocate = 0 },
+        { .directIo = true },
+        { .noReuse = true },
+        { .preallocate = 0, .directIo = true, .noReuse = true },
+    };
+};
+
+TEST_F(FileOutputRangeOptionsTest, Write_WithHints_FileContainsContent) {
+    // Not a multiple of the alignment, the O_DIRECT tail is written without it.
+    const auto text{ Payload(2 * Thoth::Dsa::details_::FileWriter::k_bufferSize + 4097) };
+
+    for (size_t i{}; i < std::size(k_hints); ++i) {
+        SCOPED_TRACE(i);
+
+        auto options{ k_hints[i] };
+        if (options.preallocate) options.preallocate = text.size();
+
+        WriteWith(text, options);
+        EXPECT_EQ(ReadFile(tmp), text);
+        EXPECT_EQ(std::filesystem::file_size(tmp), text.size());
+    }
+}
+
+TEST_F(FileOutputRangeOptionsTest, Write_ShorterThanPreallocated_NoTrailingZeros) {
+    // As a failed transfer, or a decoded body smaller than its Content-Length.
+    WriteWith("short", { .preallocate = 1024 * 1024 });
+
+    EXPECT_EQ(ReadFile(tmp), "short");
+    EXPECT_EQ(std::filesystem::file_size(tmp), 5u);
+}
+
+TEST_F(FileOutputRangeOptionsTest, Write_WithHintsAtOffset_KeepsContent) {
+    const auto head{ Payload(8192) };
+
+    for (size_t i{}; i < std::size(k_hints); ++i) {
+        SCOPED_TRACE(i);
+        std::ofstream{ tmp } << head;
+
+        auto options{ k_hints[i] };
+        options.offset      = 4096;
+        options.keepContent = true;
+        if (options.preallocate) options.preallocate = 4096 + 3;
+
+        WriteWith("XYZ", options);
+        EXPECT_EQ(ReadFile(tmp), head.substr(0, 4096) + "XYZ" + head.substr(4099));
+    }
+}
+
+#pragma endregion
@@ -1,8 +1,11 @@
 #include <gtest/gtest.h>
 #include <Thoth/Dsa/LinearMap.hpp>
 
+#include <ranges>
 #include <string>
+#include <vector>
 
+using Thoth::Dsa::DuplicateKeyEnum;
 using Thoth::Dsa::LinearMap;
 using IntMap    = LinearMap<int, std::string>;
 using StringMap = LinearMap<std::string, int>;
@@ -63,6 +66,52 @@ TEST_F(LinearMapConstructTest, MoveAssign_Succeeds) {
 #pragma endregion
 
 
+#pragma region FromUnsorted
+
+struct LinearMapFromUnsortedTest : testing::Test {
+    std::vector<std::pair<int, std::string>> pairs{ {3, "c"}, {1, "a"}, {3, "C"}, {2, "b"}, {1, "A"} };
+};
+
+TEST_F(LinearMapFromUnsortedTest, KeepFirst_SameAsTryEmplace) {
+    IntMap expected;
+    for (const auto& [k, v] : pairs)
+        expected.try_emplace(k, v);
+
+    EXPECT_EQ(IntMap::FromUnsorted(pairs), expected);
+    EXPECT_EQ(IntMap::FromUnsorted(pairs, DuplicateKeyEnum::KeepFirst).find(3)->second, "c");
+}
+
+TEST_F(LinearMapFromUnsortedTest, KeepLast_SameAsInsertOrAssign) {
+    IntMap expected;
+    for (const auto& [k, v] : pairs)
+        expected.insert_or_assign(k, v);
+
+    EXPECT_EQ(IntMap::FromUnsorted(pairs, DuplicateKeyEnum::KeepLast), expected);
+}
+
+TEST_F(LinearMapFromUnsortedTest, Merge_FoldsInInputOrder) {
+    const auto map{ IntMap::FromUnsorted(std::move(pairs), [](std::string& kept, std::string&& repeated) {
+        kept += repeated;
+    }) };
+
+    EXPECT_EQ(map, (IntMap{{ {1, "aA"}, {2, "b"}, {3, "cC"} }}));
+}
+
+TEST_F(LinearMapFromUnsortedTest, AnyInputRange) {
+    const auto map{ StringMap::FromUnsorted(std::views::iota(0, 40) | std::views::reverse
+        | std::views::transform([](const int i) { return std::pair{ std::to_string(i % 20), i }; })) };
+
+    EXPECT_EQ(map.size(), 20u);
+    EXPECT_EQ(map.find("7")->second, 27);
+}
+
+TEST_F(LinearMapFromUnsortedTest, Empty) {
+    EXPECT_TRUE(IntMap::FromUnsorted(std::vector<std::pair<int, std::string>>{}).empty());
+}
+
+#pragma endregion
+
+
 #pragma region try_emplace / insert_or_assign
 
 struct LinearMapInsertTest : testing::Test {
@@ -312,4 +361,18 @@ TEST(LinearMapStressTest, FindAfterManyInsertions) {
     }
 }
 
+TEST(LinearMapStressTest, LookupsAroundLinearScanThreshold) {
+    // Small maps scan the keys, larger ones bisect them; both must agree with the sorted order.
+    constexpr auto threshold{ static_cast<int>(IntMap::k_linearScanMax) };
+
+    for (int size{ threshold - 2 }; size < threshold + 3; ++size) {
+        IntMap m;
+        for (int i{}; i < size; ++i)
+            m.try_emplace(i * 2, std::to_string(i));
+
+        for (int i{ -1 }; i <= size * 2; ++i)
+            EXPECT_EQ(m.contains(i), i % 2 == 0 && i >= 0 && i < size * 2) << "size " << size << ", key " << i;
+    }
+}
+
 #pragma endregion
\ No newline at end of file
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include <Thoth/Dsa/SoaLinearMap.hpp>
+
+#include <string>
+#include <vector>
+
+using Thoth::Dsa::DuplicateKeyEnum;
+using Thoth::Dsa::SoaLinearMap;
+using IntMap    = SoaLinearMap<int, std::string>;
+using StringMap = SoaLinearMap<std::string, int>;
+
+
+#pragma region Construction
+
+struct SoaLinearMapConstructTest : testing::Test {};
+
+TEST_F(SoaLinearMapConstructTest, DefaultConstruct_IsEmpty) {
+    IntMap m;
+    EXPECT_TRUE(m.empty());
+    EXPECT_EQ(m.begin(), m.end());
+}
+
+TEST_F(SoaLinearMapConstructTest, InitializerList_SortedAndDeduplicated) {
+    IntMap m{{ {3, "c"}, {1, "a"}, {2, "b"}, {1, "other"} }};
+
+    EXPECT_EQ(m.size(), 3u);
+    EXPECT_EQ(std::vector(m.keys().begin(), m.keys().end()), (std::vector{ 1, 2, 3 }));
+    EXPECT_EQ(m.values()[0], "a");
+}
+
+TEST_F(SoaLinearMapConstructTest, FromUnsorted_Policies) {
+    const std::vector<std::pair<int, std::string>> pairs{ {2, "b"}, {1, "a"}, {2, "B"} };
+
+    EXPECT_EQ(IntMap::FromUnsorted(pairs).find(2)->second, "b");
+    EXPECT_EQ(IntMap::FromUnsorted(pairs, DuplicateKeyEnum::KeepLast).find(2)->second, "B");
+    EXPECT_EQ(IntMap::FromUnsorted(pairs, [](std::string& kept, std::string&& repeated) { kept += repeated; }),
+              (IntMap{{ {1, "a"}, {2, "bB"} }}));
+}
+
+#pragma endregion
+
+
+#pragma region Lookup and modifiers
+
+struct SoaLinearMapModifyTest : testing::Test {
+    IntMap m{{ {1, "one"}, {3, "three"} }};
+};
+
+TEST_F(SoaLinearMapModifyTest, TryEmplace_KeepsExisting) {
+    const auto [it, inserted]{ m.try_emplace(2, "two") };
+    EXPECT_TRUE(inserted);
+    EXPECT_EQ(it->first, 2);
+    EXPECT_EQ(it->second, "two");
+
+    EXPECT_FALSE(m.try_emplace(1, "other").second);
+    EXPECT_EQ(m.find(1)->second, "one");
+}
+
+TEST_F(SoaLinearMapModifyTest, InsertOrAssign_Overwrites) {
+    EXPECT_FALSE(m.insert_or_assign(3, std::string{ "THREE" }).second);
+    EXPECT_EQ(m[3], "THREE");
+}
+
+TEST_F(SoaLinearMapModifyTest, OperatorBracket_InsertsDefault) {
+    m[0] += "zero";
+    EXPECT_EQ(m.begin()->second, "zero");
+    EXPECT_EQ(m.size(), 3u);
+}
+
+TEST_F(SoaLinearMapModifyTest, Erase_KeepsKeysAndValuesAligned) {
+    m.try_emplace(2, "two");
+    EXPECT_TRUE(m.erase(2));
+    EXPECT_FALSE(m.erase(2));
+
+    const auto next{ m.erase(m.find(1)) };
+    EXPECT_EQ(next->first, 3);
+    EXPECT_EQ(next->second, "three");
+    EXPECT_EQ(m.size(), 1u);
+}
+
+TEST_F(SoaLinearMapModifyTest, Find_HeterogeneousLookup) {
+    const StringMap sm{{ {"alpha", 1}, {"beta", 2} }};
+    EXPECT_EQ(sm.find(std::string_view{ "beta" })->second, 2);
+    EXPECT_EQ(sm.find("gamma"), sm.end());
+}
+
+TEST_F(SoaLinearMapModifyTest, Iteration_YieldsReferences) {
+    for (auto [key, val] : m)
+        val += std::to_string(key);
+
+    EXPECT_EQ(m, (IntMap{{ {1, "one1"}, {3, "three3"} }}));
+    EXPECT_EQ(m.cend() - m.cbegin(), 2);
+}
+
+#pragma endregion
+
+
+#pragma region Stress
+
+TEST(SoaLinearMapStressTest, SameAsLinearMap) {
+    Thoth::Dsa::LinearMap<int, std::string> aos;
+    IntMap soa;
+
+    for (int i{}; i < 300; ++i) {
+        const int key{ (i * 37) % 101 };
+        aos.insert_or_assign(key, std::to_string(i));
+        soa.insert_or_assign(key, std::to_string(i));
+    }
+
+    ASSERT_EQ(aos.size(), soa.size());
+    for (int key{ -1 }; key < 102; ++key) {
+        ASSERT_EQ(aos.contains(key), soa.contains(key));
+
+        if (aos.contains(key)) {
+            EXPECT_EQ(aos.find(key)->second, soa.find(key)->second);
+        }
+    }
+}
+
+#pragma endregion
@@ -2,6 +2,7 @@
 
 #include <Hermes/Utils/Overloads.hpp>
 #include <Thoth/Http/Client/Client.hpp>
+#include <Thoth/Http/Methods/HeadMethod.hpp>
 #include <Thoth/Http/Request/Request.hpp>
 #include <Thoth/Http/_base/Http1.hpp>
 #include <Thoth/Utils/Ranges/SharedInputView.hpp>
@@ -106,3 +107,23 @@ TEST_F(ClientTest, PrepareBodyHeaders_SizedBody_UsesContentLength) {
     EXPECT_FALSE(headers.Exists("transfer-encoding"));
 }
 
+
+TEST_F(ClientTest, BuildResponse_HeadOrNotModified_IgnoresContentLength) {
+    const auto parse{ []<class Method>(Method, const std::string_view raw) {
+        return details_::Http1::BuildResponse<Method, std::string>(
+            Thoth::Utils::SharedInputView{ raw },
+            [](const ResponseHead&) -> std::expected<std::string, Thoth::ThothError> { return {}; },
+            false
+        );
+    } };
+
+    // Neither message carries a body, reading the announced length would wait on the next response.
+    const auto head{ parse(HeadMethod{}, "HTTP/1.1 200 OK\r\nContent-Length: 5000\r\n\r\nHTTP/1.1") };
+    ASSERT_TRUE(head);
+    EXPECT_TRUE(head->body.empty());
+
+    const auto notModified{ parse(GetMethod{}, "HTTP/1.1 304 Not Modified\r\nContent-Length: 5000\r\n\r\nHTTP/1.1") };
+    ASSERT_TRUE(notModified);
+    EXPECT_EQ(notModified->status, StatusCodeEnum::NotModified);
+    EXPECT_TRUE(notModified->body.empty());
+}
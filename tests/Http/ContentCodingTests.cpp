@@ -0,0 +1,310 @@
+#include <gtest/gtest.h>
+
+#include <Thoth/Http/_base/ContentCoding.hpp>
+#include <Thoth/Http/_base/Http1.hpp>
+#include <Thoth/Http/Methods/GetMethod.hpp>
+#include <Thoth/Http/Client/Client.hpp>
+#include <Thoth/Http/Request/Request.hpp>
+#include <Thoth/Http/Response/Response.hpp>
+#include <Thoth/Http/Server.hpp>
+#include <Thoth/Utils/Ranges/SharedInputView.hpp>
+
+#include <array>
+#include <string>
+#include <string_view>
+
+using namespace Thoth::Http;
+using details_::ContentDecoder;
+using details_::ContentEncoder;
+using NHeaders::ContentEncodingEnum;
+
+namespace {
+    std::string PlainFixture() {
+        std::string plain{ R"({"message":"hello, compressed world","items":[1,2,3,4,5,6,7,8,9,10],"repeat":")" };
+        for (int i{}; i < 20; i++) plain += "abcabcabc";
+        plain += R"("})";
+        return plain;
+    }
+
+    // PlainFixture() compressed with `gzip.compress(data, mtime=0)`.
+    constexpr std::array<unsigned char, 103> k_gzipFixture{
+        0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xab, 0x56, 0xca, 0x4d, 0x2d, 0x2e, 0x4e, 0x4c,
+        0x4f, 0x55, 0xb2, 0x52, 0xca, 0x48, 0xcd, 0xc9, 0xc9, 0xd7, 0x51, 0x48, 0xce, 0xcf, 0x2d, 0x28, 0x02, 0x0a,
+        0xa6, 0xa6, 0x28, 0x94, 0xe7, 0x17, 0xe5, 0xa4, 0x28, 0xe9, 0x28, 0x65, 0x96, 0xa4, 0xe6, 0x16, 0x2b, 0x59,
+        0x45, 0x1b, 0xea, 0x18, 0xe9, 0x18, 0xeb, 0x98, 0xe8, 0x98, 0xea, 0x98, 0xe9, 0x98, 0xeb, 0x58, 0xe8, 0x58,
+        0xea, 0x18, 0x1a, 0xc4, 0xea, 0x28, 0x15, 0xa5, 0x16, 0xa4, 0x26, 0x96, 0x00, 0x4d, 0x48, 0x4c, 0x4a, 0x1e,
+        0x72, 0x48, 0xa9, 0x16, 0x00, 0xfd, 0x2b, 0xa8, 0xbe, 0x04, 0x01, 0x00, 0x00
+    };
+
+    // PlainFixture() as raw DEFLATE (no zlib wrapper), which some servers send for "deflate".
+    constexpr std::array<unsigned char, 85> k_rawDeflateFixture{
+        0xab, 0x56, 0xca, 0x4d, 0x2d, 0x2e, 0x4e, 0x4c, 0x4f, 0x55, 0xb2, 0x52, 0xca, 0x48, 0xcd, 0xc9, 0xc9, 0xd7,
+        0x51, 0x48, 0xce, 0xcf, 0x2d, 0x28, 0x02, 0x0a, 0xa6, 0xa6, 0x28, 0x94, 0xe7, 0x17, 0xe5, 0xa4, 0x28, 0xe9,
+        0x28, 0x65, 0x96, 0xa4, 0xe6, 0x16, 0x2b, 0x59, 0x45, 0x1b, 0xea, 0x18, 0xe9, 0x18, 0xeb, 0x98, 0xe8, 0x98,
+        0xea, 0x98, 0xe9, 0x98, 0xeb, 0x58, 0xe8, 0x58, 0xea, 0x18, 0x1a, 0xc4, 0xea, 0x28, 0x15, 0xa5, 0x16, 0xa4,
+        0x26, 0x96, 0x00, 0x4d, 0x48, 0x4c, 0x4a, 0x1e, 0x72, 0x48, 0xa9, 0x16, 0x00
+    };
+
+    template<size_t N>
+    std::string_view AsView(const std::array<unsigned char, N>& bytes) {
+        return { reinterpret_cast<const char*>(bytes.data()), N };
+    }
+
+    auto ParseRaw(const std::string& raw, const bool decodeContent) {
+        return details_::Http1::BuildResponse<GetMethod, std::string>(
+            Thoth::Utils::SharedInputView{ std::string_view{ raw } },
+            [](const ResponseHead&) -> std::expected<std::string, Thoth::ThothError> { return {}; },
+            decodeContent
+        );
+    }
+}
+
+
+struct ContentDecoderTest : testing::Test {
+    void SetUp() override {
+        if (!ContentDecoder::IsSupported(ContentEncodingEnum::Gzip))
+            GTEST_SKIP() << "Thoth was built without THOTH_WITH_ZLIB";
+    }
+};
+
+#pragma region ContentDecoder
+
+TEST_F(ContentDecoderTest, Gzip_WholeBlock_Decodes) {
+    auto decoder{ ContentDecoder::Create(std::array{ ContentEncodingEnum::Gzip }) };
+    ASSERT_TRUE(decoder);
+
+    std::string out;
+    ASSERT_TRUE(decoder->Feed(AsView(k_gzipFixture), out));
+    ASSERT_TRUE(decoder->Finish());
+
+    EXPECT_EQ(out, PlainFixture());
+}
+
+TEST_F(ContentDecoderTest, Gzip_ByteByByte_Decodes) {
+    auto decoder{ ContentDecoder::Create(std::array{ ContentEncodingEnum::Gzip }) };
+    ASSERT_TRUE(decoder);
+
+    std::string out;
+    for (const char c : AsView(k_gzipFixture))
+        ASSERT_TRUE(decoder->Feed({ &c, 1 }, out));
+    ASSERT_TRUE(decoder->Finish());
+
+    EXPECT_EQ(out, PlainFixture());
+}
+
+TEST_F(ContentDecoderTest, Deflate_RawStream_Decodes) {
+    auto decoder{ ContentDecoder::Create(std::array{ ContentEncodingEnum::Deflate }) };
+    ASSERT_TRUE(decoder);
+
+    std::string out;
+    ASSERT_TRUE(decoder->Feed(AsView(k_rawDeflateFixture), out));
+    ASSERT_TRUE(decoder->Finish());
+
+    EXPECT_EQ(out, PlainFixture());
+}
+
+TEST_F(ContentDecoderTest, Gzip_Truncated_FailsOnFinish) {
+    auto decoder{ ContentDecoder::Create(std::array{ ContentEncodingEnum::Gzip }) };
+    ASSERT_TRUE(decoder);
+
+    std::string out;
+    ASSERT_TRUE(decoder->Feed(AsView(k_gzipFixture).substr(0, 50), out));
+
+    const auto res{ decoder->Finish() };
+    ASSERT_FALSE(res);
+    EXPECT_EQ(res.error(), MessageParseErrorEnum::InvalidContentEncoding);
+}
+
+TEST_F(ContentDecoderTest, Gzip_Corrupt_FailsOnFeed) {
+    auto decoder{ ContentDecoder::Create(std::array{ ContentEncodingEnum::Gzip }) };
+    ASSERT_TRUE(decoder);
+
+    std::string out;
+    EXPECT_FALSE(decoder->Feed("definitely not gzip", out));
+}
+
+TEST_F(ContentDecoderTest, Compress_IsUnsupported) {
+    const auto decoder{ ContentDecoder::Create(std::array{ ContentEncodingEnum::Compress }) };
+
+    ASSERT_FALSE(decoder);
+    EXPECT_EQ(decoder.error(), MessageParseErrorEnum::UnsupportedContentEncoding);
+}
+
+TEST_F(ContentDecoderTest, Identity_IsANoOp) {
+    EXPECT_TRUE(ContentDecoder::IsSupported(ContentEncodingEnum::Identity));
+
+    auto decoder{ ContentDecoder::Create(std::array{ ContentEncodingEnum::Gzip, ContentEncodingEnum::Identity }) };
+    ASSERT_TRUE(decoder);
+
+    std::string out;
+    ASSERT_TRUE(decoder->Feed(AsView(k_gzipFixture), out));
+    ASSERT_TRUE(decoder->Finish());
+
+    EXPECT_EQ(out, PlainFixture());
+}
+
+TEST_F(ContentDecoderTest, Bomb_StopsAtTheBudget) {
+    // 64 MiB of zeros gzip to ~64 KiB: the decoder must stop long before expanding the whole block.
+    constexpr size_t k_budget{ 256 * 1024 };
+
+    auto encoder{ ContentEncoder::Create(ContentEncodingEnum::Gzip) };
+    ASSERT_TRUE(encoder);
+
+    const std::string zeros(1024 * 1024, '\0');
+    std::string bomb;
+    for (int i{}; i < 64; i++)
+        ASSERT_TRUE(encoder->Feed(zeros, bomb));
+    ASSERT_TRUE(encoder->Finish(bomb));
+
+    auto decoder{ ContentDecoder::Create(std::array{ ContentEncodingEnum::Gzip }) };
+    ASSERT_TRUE(decoder);
+
+    std::string out;
+    const auto res{ decoder->Feed(bomb, out, k_budget) };
+    ASSERT_FALSE(res);
+    EXPECT_EQ(res.error(), MessageParseErrorEnum::InvalidContentEncoding);
+    EXPECT_LE(out.size(), k_budget + 16 * 1024);
+}
+
+TEST_F(ContentDecoderTest, Budget_ExactFitSucceeds) {
+    auto decoder{ ContentDecoder::Create(std::array{ ContentEncodingEnum::Gzip }) };
+    ASSERT_TRUE(decoder);
+
+    std::string out;
+    ASSERT_TRUE(decoder->Feed(AsView(k_gzipFixture), out, PlainFixture().size()));
+    EXPECT_EQ(out, PlainFixture());
+}
+
+TEST_F(ContentDecoderTest, AcceptedCodings_ContainsGzip) {
+    const auto codings{ ContentDecoder::AcceptedCodings() };
+
+    EXPECT_TRUE(std::ranges::contains(codings, NHeaders::AcceptEncodingEnum::Gzip, &NHeaders::AcceptEncoding::value));
+}
+
+#pragma endregion
+
+#pragma region ContentEncoder
+
+TEST_F(ContentDecoderTest, Encoder_Gzip_RoundTripsInBlocks) {
+    std::string plain;
+    for (int i{}; i < 5000; i++) plain += PlainFixture();
+
+    auto encoder{ ContentEncoder::Create(ContentEncodingEnum::Gzip) };
+    ASSERT_TRUE(encoder);
+
+    std::string encoded;
+    for (size_t offset{}; offset < plain.size(); offset += 4096)
+        ASSERT_TRUE(encoder->Feed(std::string_view{ plain }.substr(offset, 4096), encoded));
+    ASSERT_TRUE(encoder->Finish(encoded));
+
+    EXPECT_LT(encoded.size(), plain.size() / 10);
+
+    auto decoder{ ContentDecoder::Create(std::array{ ContentEncodingEnum::Gzip }) };
+    ASSERT_TRUE(decoder);
+
+    std::string decoded;
+    ASSERT_TRUE(decoder->Feed(encoded, decoded));
+    ASSERT_TRUE(decoder->Finish());
+
+    EXPECT_EQ(decoded, plain);
+}
+
+TEST_F(ContentDecoderTest, Encoder_Br_IsUnsupported) {
+    const auto encoder{ ContentEncoder::Create(ContentEncodingEnum::Br) };
+
+    ASSERT_FALSE(encoder);
+    EXPECT_EQ(encoder.error(), MessageParseErrorEnum::UnsupportedContentEncoding);
+}
+
+TEST_F(ContentDecoderTest, PrepareEncodedBodyHeaders_UsesChunkedAndAppendsCoding) {
+    Headers headers{ { "content-length", "999" } };
+
+    details_::Http1::PrepareEncodedBodyHeaders(headers, ContentEncodingEnum::Gzip);
+
+    EXPECT_FALSE(headers.Exists("content-length"));
+    EXPECT_TRUE(headers.Exists("transfer-encoding", "chunked"));
+    EXPECT_TRUE(headers.Exists("content-encoding", "gzip"));
+}
+
+#pragma endregion
+
+#pragma region Http1::ParseBody
+
+TEST_F(ContentDecoderTest, ParseBody_ContentLength_DecodesAndDropsHeaders) {
+    const auto body{ AsView(k_gzipFixture) };
+    const std::string raw{
+        std::format("HTTP/1.1 200 OK\r\ncontent-encoding: gzip\r\ncontent-length: {}\r\n\r\n{}", body.size(), body)
+    };
+
+    const auto response{ ParseRaw(raw, true) };
+    ASSERT_TRUE(response);
+
+    EXPECT_EQ(response->body, PlainFixture());
+    EXPECT_FALSE(response->headers.Exists("content-encoding"));
+    EXPECT_FALSE(response->headers.Exists("content-length"));
+}
+
+TEST_F(ContentDecoderTest, ParseBody_Chunked_Decodes) {
+    const auto body{ AsView(k_gzipFixture) };
+    const std::string raw{ std::format(
+        "HTTP/1.1 200 OK\r\ncontent-encoding: gzip\r\ntransfer-encoding: chunked\r\n\r\n"
+        "{:x}\r\n{}\r\n{:x}\r\n{}\r\n0\r\n\r\n",
+        40, body.substr(0, 40), body.size() - 40, body.substr(40)
+    ) };
+
+    const auto response{ ParseRaw(raw, true) };
+    ASSERT_TRUE(response);
+
+    EXPECT_EQ(response->body, PlainFixture());
+}
+
+TEST_F(ContentDecoderTest, ParseBody_Identity_KeepsBody) {
+    const std::string raw{ "HTTP/1.1 200 OK\r\ncontent-encoding: identity\r\ncontent-length: 5\r\n\r\nplain" };
+
+    const auto response{ ParseRaw(raw, true) };
+    ASSERT_TRUE(response);
+
+    EXPECT_EQ(response->body, "plain");
+}
+
+TEST_F(ContentDecoderTest, ParseBody_DecodeDisabled_KeepsRawBytes) {
+    const auto body{ AsView(k_gzipFixture) };
+    const std::string raw{
+        std::format("HTTP/1.1 200 OK\r\ncontent-encoding: gzip\r\ncontent-length: {}\r\n\r\n{}", body.size(), body)
+    };
+
+    const auto response{ ParseRaw(raw, false) };
+    ASSERT_TRUE(response);
+
+    EXPECT_EQ(response->body, body);
+    EXPECT_TRUE(response->headers.Exists("content-encoding"));
+}
+
+#pragma endregion
+
+#pragma region Loopback
+
+TEST_F(ContentDecoderTest, Loopback_ClientDecodesServerBody) {
+#ifndef __linux__
+    GTEST_SKIP() << "Server is only available on Linux";
+#else
+    auto server{ Server::Listen([](const ServerRequest&, ServerResponse& res) {
+        res.headers.Set("content-encoding", "gzip");
+        res.body = AsView(k_gzipFixture);
+    }, { .acceptors = 1, .workers = 1 }) };
+    ASSERT_TRUE(server);
+
+    const auto url{ std::format("http://127.0.0.1:{}/", server->Port()) };
+
+    const auto decoded{ Client::Send(GetRequest::FromUrl(url).value()) };
+    ASSERT_TRUE(decoded);
+    EXPECT_EQ(decoded->body, PlainFixture());
+    EXPECT_FALSE(decoded->headers.Exists("content-encoding"));
+
+    const auto raw{ Client::Send(GetRequest::FromUrl(url).value(), { .decodeContent = false }) };
+    ASSERT_TRUE(raw);
+    EXPECT_EQ(raw->body, AsView(k_gzipFixture));
+#endif
+}
+
+#pragma endregion
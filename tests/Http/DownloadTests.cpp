@@ -0,0 +1,221 @@
+#include <gtest/gtest.h>
+
+#include <Thoth/Http/Client/Client.hpp>
+#include <Thoth/Http/Client/Download.hpp>
+#include <Thoth/Http/Request/Request.hpp>
+#include <Thoth/Http/Server.hpp>
+#include <Thoth/Http/StaticFiles.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <string_view>
+
+using namespace Thoth::Http;
+namespace fs = std::filesystem;
+
+
+struct DownloadStateTest : testing::Test {
+    const std::filesystem::path statePath{
+        DownloadState::StatePath(std::filesystem::temp_directory_path() / "thoth_test_download.bin")
+    };
+
+    void TearDown() override {
+        std::filesystem::remove(statePath);
+    }
+};
+
+#pragma region Plan
+
+TEST_F(DownloadStateTest, Plan_SplitsIntoChunksPerSegment) {
+    const auto state{ DownloadState::Plan(64 << 20, "\"v1\"", 4) };
+
+    EXPECT_EQ(state.chunkSize, 4u << 20);
+    EXPECT_EQ(state.Chunks(), 16u);
+    EXPECT_EQ(state.PendingChunks(), 16u);
+}
+
+TEST_F(DownloadStateTest, Plan_ClampsChunkSize) {
+    EXPECT_EQ(DownloadState::Plan(100, "", 4).chunkSize, DownloadState::k_minChunkSize);
+    EXPECT_EQ(DownloadState::Plan(100, "", 4).Chunks(), 1u);
+
+    EXPECT_EQ(DownloadState::Plan(uint64_t{ 8 } << 30, "", 2).chunkSize, DownloadState::k_maxChunkSize);
+}
+
+TEST_F(DownloadStateTest, ChunkRange_LastChunkEndsAtLength) {
+    const auto state{ DownloadState::Plan((3 << 20) + 10, "", 1) };
+    ASSERT_EQ(state.Chunks(), 4u);
+
+    const auto first{ state.ChunkRange(0) };
+    EXPECT_EQ(first.start, 0u);
+    EXPECT_EQ(first.end, state.chunkSize - 1);
+
+    const auto last{ state.ChunkRange(3) };
+    EXPECT_EQ(last.start, 3 * state.chunkSize);
+    EXPECT_EQ(last.end, state.length - 1);
+}
+
+#pragma endregion
+
+#pragma region Resume
+
+TEST_F(DownloadStateTest, Save_Load_RoundTrips) {
+    auto state{ DownloadState::Plan(10 << 20, "Tue, 15 Nov 1994 12:45:26 GMT", 2) };
+    state.done[1] = state.done[3] = true;
+
+    ASSERT_TRUE(state.Save(statePath));
+
+    const auto loaded{ DownloadState::Load(statePath) };
+    ASSERT_TRUE(loaded);
+    EXPECT_EQ(loaded->length, state.length);
+    EXPECT_EQ(loaded->chunkSize, state.chunkSize);
+    EXPECT_EQ(loaded->validator, state.validator);
+    EXPECT_EQ(loaded->done, state.done);
+    EXPECT_EQ(loaded->PendingChunks(), state.Chunks() - 2);
+}
+
+TEST_F(DownloadStateTest, Load_MissingOrCorrupt_ReturnsNullopt) {
+    EXPECT_FALSE(DownloadState::Load(statePath));
+
+    std::ofstream{ statePath } << "thoth-download 1\n100\n0\n\"v1\"\n1\n";
+    EXPECT_FALSE(DownloadState::Load(statePath));
+
+    std::ofstream{ statePath } << "thoth-download 1\n" << (3 << 20) << '\n' << (1 << 20) << "\n\"v1\"\n10\n";
+    EXPECT_FALSE(DownloadState::Load(statePath));
+}
+
+TEST_F(DownloadStateTest, Matches_RequiresSameLengthAndValidator) {
+    const auto state{ DownloadState::Plan(10 << 20, "\"v1\"", 2) };
+
+    EXPECT_TRUE(state.Matches(10 << 20, "\"v1\""));
+    EXPECT_FALSE(state.Matches(10 << 20, "\"v2\""));
+    EXPECT_FALSE(state.Matches(11 << 20, "\"v1\""));
+    EXPECT_FALSE(DownloadState::Plan(10 << 20, "", 2).Matches(10 << 20, ""));
+}
+
+#pragma endregion
+
+
+#pragma region Client::Download
+
+struct DownloadClientTest : testing::Test {
+    // Several chunks, the last one partial, and bytes that differ from one offset to the next.
+    inline static const std::string k_source{ [] {
+        std::string res((5 << 20) + 123, '\0');
+        for (size_t i{}; i < res.size(); ++i)
+            res[i] = static_cast<char>((i * 131 + i / 4096) % 251);
+        return res;
+    }() };
+
+    fs::path root;
+    fs::path target;
+    std::optional<Server> server;
+    // Chunk requests, the only ones sent with `If-Range`.
+    std::atomic<int> chunkRequests{};
+
+    void SetUp() override {
+#ifndef __linux__
+        GTEST_SKIP() << "Server is only available on Linux";
+#endif
+        root   = fs::temp_directory_path() / std::format("thoth-download-{}", testing::UnitTest::GetInstance()->random_seed());
+        target = root / "out" / "file.bin";
+
+        fs::create_directories(root);
+        std::ofstream{ root / "file.bin", std::ios::binary } << k_source;
+    }
+
+    void TearDown() override {
+        server.reset();
+        fs::remove_all(root);
+    }
+
+    void Listen(ServerHandler handler) {
+        auto res{ Server::Listen(std::move(handler), { .acceptors = 1, .workers = 4 }) };
+        ASSERT_TRUE(res.has_value());
+        server.emplace(std::move(*res));
+    }
+
+    void ListenStatic() {
+        Listen([this, files = StaticFiles{ root }](const ServerRequest& request, ServerResponse& response) {
+            if (request.headers.Exists("if-range")) ++chunkRequests;
+            files(request, response);
+        });
+    }
+
+    [[nodiscard]] Url UrlTo(const std::string_view target) const {
+        return Url::FromUrl(std::format("http://127.0.0.1:{}{}", server->Port(), target)).value();
+    }
+
+    [[nodiscard]] static std::string ReadFile(const fs::path& path) {
+        std::ifstream file{ path, std::ios::binary };
+        return { std::istreambuf_iterator<char>(file), {} };
+    }
+};
+
+TEST_F(DownloadClientTest, Download_Segmented_MatchesSource) {
+    ListenStatic();
+
+    const auto res{ Client::Download(UrlTo("/file.bin"), target, 4) };
+    ASSERT_TRUE(res.has_value());
+
+    EXPECT_EQ(*res, k_source.size());
+    EXPECT_EQ(ReadFile(target), k_source);
+    EXPECT_EQ(chunkRequests, static_cast<int>(DownloadState::Plan(k_source.size(), "", 4).Chunks()));
+    EXPECT_FALSE(fs::exists(DownloadState::StatePath(target)));
+}
+
+TEST_F(DownloadClientTest, Download_RangeIgnored_FallsBackToWhole) {
+    // Always the whole body with a 200, neither Accept-Ranges nor Content-Range.
+    Listen([](const ServerRequest&, ServerResponse& response) {
+        response.headers.Set("content-type", "application/octet-stream");
+        response.body = k_source;
+    });
+
+    // Left by an earlier download, longer than the file: neither may survive.
+    fs::create_directories(target.parent_path());
+    std::ofstream{ target, std::ios::binary } << k_source << "trailing bytes";
+    ASSERT_TRUE(DownloadState::Plan(k_source.size(), "\"v1\"", 4).Save(DownloadState::StatePath(target)));
+
+    const auto res{ Client::Download(UrlTo("/file.bin"), target, 4) };
+    ASSERT_TRUE(res.has_value());
+
+    EXPECT_EQ(*res, k_source.size());
+    EXPECT_EQ(ReadFile(target), k_source);
+    EXPECT_FALSE(fs::exists(DownloadState::StatePath(target)));
+}
+
+TEST_F(DownloadClientTest, Download_ResumeWithChunkZeroPending_KeepsDoneChunks) {
+    ListenStatic();
+
+    const auto head{ Client::Send(GetRequest::FromUrl(std::format("http://127.0.0.1:{}/file.bin", server->Port())).value()) };
+    ASSERT_TRUE(head.has_value());
+    const auto etag{ head->headers.Get("etag") };
+    ASSERT_TRUE(etag);
+
+    // Every chunk but the first is already on disk.
+    auto state{ DownloadState::Plan(k_source.size(), **etag, 4) };
+    ASSERT_GT(state.Chunks(), 2u);
+    std::ranges::fill(state.done, true);
+    state.done[0] = false;
+
+    std::string partial{ k_source };
+    std::fill_n(partial.begin(), state.chunkSize, '\0');
+
+    fs::create_directories(target.parent_path());
+    std::ofstream{ target, std::ios::binary } << partial;
+    ASSERT_TRUE(state.Save(DownloadState::StatePath(target)));
+
+    const auto res{ Client::Download(UrlTo("/file.bin"), target, 4) };
+    ASSERT_TRUE(res.has_value());
+
+    EXPECT_EQ(*res, k_source.size());
+    EXPECT_EQ(chunkRequests, 1);
+    EXPECT_EQ(ReadFile(target), k_source);
+    EXPECT_FALSE(fs::exists(DownloadState::StatePath(target)));
+}
+
+#pragma endregion
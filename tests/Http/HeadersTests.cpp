@@ -471,4 +471,86 @@ TEST_F(HeadersTest, ConstructFromVector_LowercasesKeys) {
     EXPECT_EQ(fromVec.Size(), 2u);
 }
 
-#pragma endregion
\ No newline at end of file
+#pragma endregion
+
+#pragma region Well-known IDs
+
+static_assert(NHeaders::HeaderIdOf("Transfer-Encoding") == NHeaders::HeaderIdEnum::TransferEncoding);
+static_assert(NHeaders::HeaderIdOf("x-transfer-encoding") == NHeaders::HeaderIdEnum::Unknown);
+
+TEST_F(HeadersTest, HeaderIdOf_EveryWellKnownName_RoundTrips) {
+    for (size_t idx{ 1 }; idx <= static_cast<size_t>(NHeaders::HeaderIdEnum::WwwAuthenticate); ++idx) {
+        const auto id{ static_cast<NHeaders::HeaderIdEnum>(idx) };
+        const auto name{ NHeaders::HeaderName(id) };
+        SCOPED_TRACE(name);
+
+        auto upper{ std::string{ name } };
+        for (auto& c : upper)
+            if ('a' <= c && c <= 'z') c = static_cast<char>(c - 'a' + 'A');
+
+        EXPECT_EQ(NHeaders::HeaderIdOf(name), id);
+        EXPECT_EQ(NHeaders::HeaderIdOf(upper), id);
+    }
+}
+
+TEST_F(HeadersTest, HeaderIdOf_OtherNames_Unknown) {
+    static constexpr std::string_view k_names[]{ "", "x-custom", "hosts", "hos", "content-lengths", "etah", "t" };
+
+    for (const auto name : k_names) {
+        SCOPED_TRACE(name);
+        EXPECT_EQ(NHeaders::HeaderIdOf(name), NHeaders::HeaderIdEnum::Unknown);
+    }
+}
+
+TEST_F(HeadersTest, ById_MatchesTheStringLookup) {
+    using enum NHeaders::HeaderIdEnum;
+
+    EXPECT_TRUE(h1.Exists(ContentType));
+    EXPECT_FALSE(h1.Exists(ContentLength));
+    EXPECT_FALSE(h1.Exists(Unknown));
+
+    const auto value{ h1.Get(Authorization) };
+    ASSERT_TRUE(value);
+    EXPECT_EQ(**value, "Bearer token123");
+    EXPECT_FALSE(h1.Get(Host));
+}
+
+TEST_F(HeadersTest, ById_Remove_KeepsTheOtherFields) {
+    using enum NHeaders::HeaderIdEnum;
+
+    Headers tmp{ h2 };
+    EXPECT_TRUE(tmp.Remove(SetCookie));
+    EXPECT_TRUE(tmp.Exists(SetCookie));
+    EXPECT_TRUE(tmp.Remove(SetCookie));
+    EXPECT_FALSE(tmp.Exists(SetCookie));
+    EXPECT_FALSE(tmp.Remove(SetCookie));
+
+    EXPECT_TRUE(tmp.Exists(CacheControl));
+    EXPECT_EQ(tmp.Size(), 2u);
+}
+
+TEST_F(HeadersTest, ById_FollowsEveryMutation) {
+    using enum NHeaders::HeaderIdEnum;
+
+    Headers tmp;
+    tmp["Content-Length"] = "3";
+    EXPECT_TRUE(tmp.Exists(ContentLength));
+
+    tmp.Set("content-length", "4");
+    EXPECT_EQ(**tmp.Get(ContentLength), "4");
+    EXPECT_EQ(tmp.Size(), 1u);
+
+    EXPECT_TRUE(tmp.Remove("Content-Length", "4"));
+    EXPECT_FALSE(tmp.Exists(ContentLength));
+
+    tmp.Add("connection", "close");
+    tmp.Clear();
+    EXPECT_FALSE(tmp.Exists(Connection));
+}
+
+TEST_F(HeadersTest, Parse_RepeatedSingleValue_Fails) {
+    EXPECT_FALSE(Headers::Parse("Content-Length: 1\r\ncontent-length: 1\r\n"));
+    EXPECT_TRUE(Headers::Parse("Via: a\r\nVIA: b\r\n"));
+}
+
+#pragma endregion
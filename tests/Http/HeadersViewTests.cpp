@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+#include <Thoth/Http/NHeaders/HeadersView.hpp>
+#include <Thoth/String/Simd.hpp>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace Thoth::Http;
+
+
+struct HeadersViewTest : testing::Test {
+    static constexpr std::string_view k_raw{
+        "Content-Type: application/json\r\n"
+        "Set-Cookie: a=1\r\n"
+        "X-Trace:   abc  \t\r\n"
+        "set-cookie: b=2\r\n"
+        "Via: 1.1 proxy\r\n"
+    };
+
+    static HeadersView Parse(const std::string_view raw) {
+        auto res{ HeadersView::Parse(std::string{ raw }) };
+        EXPECT_TRUE(res.has_value());
+
+        return res ? std::move(*res) : HeadersView{};
+    }
+};
+
+
+#pragma region FindFirstOf
+
+TEST_F(HeadersViewTest, FindFirstOf_EveryPosition) {
+    // Covers the 16 byte steps and the byte loop on the tail.
+    for (size_t size{ 1 }; size <= 40; ++size)
+        for (size_t hit{}; hit < size; ++hit) {
+            std::string str(size, 'x');
+            str[hit] = '\n';
+
+            const auto first{ Thoth::String::FindFirstOf<'\r', '\n'>(str) };
+            const auto next { Thoth::String::FindFirstOf<'\r', '\n'>(str, hit + 1) };
+
+            EXPECT_EQ(first, hit);
+            EXPECT_EQ(next, std::string_view::npos);
+        }
+
+    static_assert(Thoth::String::FindFirstOf<':'>("key: value") == 3);
+}
+
+#pragma endregion
+
+
+#pragma region Parse
+
+TEST_F(HeadersViewTest, Parse_ViewsTheBlock) {
+    const auto view{ Parse(k_raw) };
+
+    ASSERT_EQ(view.Size(), 5u);
+    EXPECT_EQ(view[0].name, "content-type");
+    EXPECT_EQ(view[0].value, "application/json");
+    EXPECT_EQ(view[0].id, NHeaders::HeaderIdEnum::ContentType);
+    EXPECT_EQ(view[2].value, "abc");
+
+    const auto block{ view.Block() };
+    for (const auto& [name, value, id] : view.Fields()) {
+        EXPECT_GE(name.data(), block.data());
+        EXPECT_LE(value.data() + value.size(), block.data() + block.size());
+    }
+}
+
+TEST_F(HeadersViewTest, Parse_SurvivesAMove) {
+    auto view{ Parse("Host: a\r\n") };
+    const HeadersView moved{ std::move(view) };
+
+    EXPECT_EQ(moved.Get(NHeaders::HeaderIdEnum::Host), "a");
+}
+
+TEST_F(HeadersViewTest, Parse_Invalid_Fails) {
+    static constexpr std::string_view k_cases[]{
+        "missing-colon\r\n",
+        ": no-name\r\n",
+        "content-type : text/plain\r\n",
+        " content-type: text/plain\r\n",
+        "x-a: 1\r\n\r\nx-b: 2\r\n",
+        "x-bare: a\rb\r\n",
+        "x-bare: a\nb\r\n",
+        "host: a\r\nHost: b\r\n",
+    };
+
+    for (const auto raw : k_cases) {
+        SCOPED_TRACE(raw);
+
+        const auto res{ HeadersView::Parse(std::string{ raw }) };
+        ASSERT_FALSE(res.has_value());
+        EXPECT_EQ(res.error(), MessageParseErrorEnum::InvalidHeaders);
+
+        EXPECT_FALSE(Headers::Parse(raw).has_value());
+    }
+}
+
+TEST_F(HeadersViewTest, Parse_TooLarge_Fails) {
+    const auto res{ HeadersView::Parse("x-header: value\r\n", 4) };
+    ASSERT_FALSE(res.has_value());
+    EXPECT_EQ(res.error(), MessageParseErrorEnum::HeadersTooLarge);
+}
+
+TEST_F(HeadersViewTest, Parse_WithoutFinalCrlf) {
+    const auto view{ Parse("a: 1\r\nb: 2") };
+
+    ASSERT_EQ(view.Size(), 2u);
+    EXPECT_EQ(view.Get("b"), "2");
+}
+
+#pragma endregion
+
+
+#pragma region Lookup
+
+TEST_F(HeadersViewTest, Get_ByNameAndId) {
+    const auto view{ Parse(k_raw) };
+
+    EXPECT_EQ(view.Get("CONTENT-TYPE"), "application/json");
+    EXPECT_EQ(view.Get(NHeaders::HeaderIdEnum::Via), "1.1 proxy");
+    EXPECT_EQ(view.Get("x-trace"), "abc");
+    EXPECT_FALSE(view.Get("x-missing"));
+    EXPECT_FALSE(view.Exists(NHeaders::HeaderIdEnum::ContentLength));
+}
+
+TEST_F(HeadersViewTest, GetAll_KeepsRepeatedFields) {
+    const auto view{ Parse(k_raw) };
+
+    EXPECT_EQ(view.GetAll("set-cookie"), (std::vector<std::string_view>{ "a=1", "b=2" }));
+    EXPECT_EQ(view.Get("set-cookie"), "a=1");
+}
+
+TEST_F(HeadersViewTest, ToHeaders_MatchesHeadersParse) {
+    constexpr std::string_view k_folded{ "Accept: a\r\nAccept: b\r\nSet-Cookie: x\r\nSet-Cookie: y\r\n" };
+
+    EXPECT_EQ(Parse(k_raw).ToHeaders(), Headers::Parse(k_raw).value());
+    EXPECT_EQ(Parse(k_folded).ToHeaders(), Headers::Parse(k_folded).value());
+}
+
+#pragma endregion
@@ -0,0 +1,221 @@
+#include <gtest/gtest.h>
+
+#include <Thoth/Http/Client/HttpCache.hpp>
+
+#include <chrono>
+#include <string>
+
+using namespace Thoth::Http;
+using namespace std::chrono_literals;
+
+namespace {
+    using TimePoint = HttpCache::TimePoint;
+
+    std::string HttpDate(const TimePoint tp) {
+        const auto sys{ std::chrono::floor<std::chrono::seconds>(std::chrono::utc_clock::to_sys(tp)) };
+        return std::format("{:%a, %d %b %Y %H:%M:%S GMT}", sys);
+    }
+}
+
+
+struct HttpCacheTest : testing::Test {
+    const TimePoint now{ std::chrono::floor<std::chrono::seconds>(std::chrono::utc_clock::now()) };
+
+    HttpCache::Entry MakeEntry(std::initializer_list<NHeaders::HeaderPair> headers, std::string body = "payload",
+        const RequestHeaders& request = {}) const {
+        ResponseHead head{ .headers = ResponseHeaders{ headers } };
+        head.headers.Set("date", HttpDate(now));
+
+        return HttpCache::MakeEntry(request, std::move(head), body, now, now);
+    }
+};
+
+#pragma region Storage
+
+TEST_F(HttpCacheTest, Key_DropsFragment) {
+    const auto url{ Url::FromUrl("https://example.com/feed?page=2#top") };
+    ASSERT_TRUE(url);
+
+    EXPECT_EQ(HttpCache::Key("GET", *url), "GET https://example.com/feed?page=2");
+}
+
+TEST_F(HttpCacheTest, Store_Find_ReturnsSharedBody) {
+    HttpCache cache{};
+    ASSERT_TRUE(cache.Store("GET a", MakeEntry({ { "cache-control", "max-age=60" } })));
+
+    const auto first { cache.Find("GET a") };
+    const auto second{ cache.Find("GET a") };
+    ASSERT_TRUE(first && second);
+
+    EXPECT_EQ(*first->body, "payload");
+    EXPECT_EQ(first->body, second->body);
+    EXPECT_FALSE(cache.Find("GET b"));
+}
+
+TEST_F(HttpCacheTest, Store_OverBudget_EvictsLeastRecentlyUsed) {
+    const std::string body(1000, 'x');
+    HttpCache cache{ 3000 };
+
+    ASSERT_TRUE(cache.Store("GET a", MakeEntry({}, body)));
+    ASSERT_TRUE(cache.Store("GET b", MakeEntry({}, body)));
+    ASSERT_TRUE(cache.Find("GET a")); // b becomes the least recently used
+
+    ASSERT_TRUE(cache.Store("GET c", MakeEntry({}, body)));
+
+    EXPECT_TRUE(cache.Find("GET a"));
+    EXPECT_FALSE(cache.Find("GET b"));
+    EXPECT_TRUE(cache.Find("GET c"));
+    EXPECT_LE(cache.Bytes(), cache.MaxBytes());
+}
+
+TEST_F(HttpCacheTest, Store_BiggerThanCache_IsRejected) {
+    HttpCache cache{ 100 };
+
+    EXPECT_FALSE(cache.Store("GET a", MakeEntry({}, std::string(1000, 'x'))));
+    EXPECT_EQ(cache.Size(), 0u);
+    EXPECT_EQ(cache.Bytes(), 0u);
+}
+
+TEST_F(HttpCacheTest, Store_SameKey_ReplacesEntry) {
+    HttpCache cache{};
+    cache.Store("GET a", MakeEntry({}, "old"));
+    cache.Store("GET a", MakeEntry({}, "new"));
+
+    ASSERT_EQ(cache.Size(), 1u);
+    EXPECT_EQ(*cache.Find("GET a")->body, "new");
+}
+
+TEST_F(HttpCacheTest, Erase_And_Clear_ReleaseBytes) {
+    HttpCache cache{};
+    cache.Store("GET a", MakeEntry({}));
+    cache.Store("GET b", MakeEntry({}));
+
+    EXPECT_TRUE(cache.Erase("GET a"));
+    EXPECT_FALSE(cache.Erase("GET a"));
+    EXPECT_EQ(cache.Size(), 1u);
+
+    cache.Clear();
+    EXPECT_EQ(cache.Size(), 0u);
+    EXPECT_EQ(cache.Bytes(), 0u);
+}
+
+#pragma endregion
+
+#pragma region Policy
+
+TEST_F(HttpCacheTest, IsStorable_NeedsFreshnessOrValidator) {
+    const RequestHeaders request{};
+
+    EXPECT_TRUE(HttpCache::IsStorable(request, { .headers = {{ { "cache-control", "max-age=60" } }} }));
+    EXPECT_TRUE(HttpCache::IsStorable(request, { .headers = {{ { "etag", "\"v1\"" } }} }));
+    EXPECT_FALSE(HttpCache::IsStorable(request, { .headers = {} }));
+}
+
+TEST_F(HttpCacheTest, IsStorable_NoStoreVaryStarOrPartial_AreRejected) {
+    const RequestHeaders request{};
+    const RequestHeaders noStore{{ { "cache-control", "no-store" } }};
+
+    EXPECT_FALSE(HttpCache::IsStorable(request, { .headers = {{ { "cache-control", "no-store, max-age=60" } }} }));
+    EXPECT_FALSE(HttpCache::IsStorable(noStore, { .headers = {{ { "cache-control", "max-age=60" } }} }));
+    EXPECT_FALSE(HttpCache::IsStorable(request, { .headers = {{ { "cache-control", "max-age=60" }, { "vary", "*" } }} }));
+    EXPECT_FALSE(HttpCache::IsStorable(request, {
+        .status = StatusCodeEnum::PartialContent, .headers = {{ { "cache-control", "max-age=60" } }} }));
+}
+
+TEST_F(HttpCacheTest, FreshnessLifetime_MaxAgeWinsOverExpires) {
+    const auto entry{ MakeEntry({ { "cache-control", "max-age=60" }, { "expires", HttpDate(now + 1h) } }) };
+
+    EXPECT_EQ(HttpCache::FreshnessLifetime(entry), 60s);
+}
+
+TEST_F(HttpCacheTest, FreshnessLifetime_ExpiresRelativeToDate) {
+    EXPECT_EQ(HttpCache::FreshnessLifetime(MakeEntry({ { "expires", HttpDate(now + 1h) } })), 1h);
+    EXPECT_EQ(HttpCache::FreshnessLifetime(MakeEntry({ { "expires", "0" } })), 0s);
+}
+
+TEST_F(HttpCacheTest, FreshnessLifetime_HeuristicIsTenthOfLastModified) {
+    const auto entry{ MakeEntry({ { "last-modified", HttpDate(now - 100h) } }) };
+
+    EXPECT_EQ(HttpCache::FreshnessLifetime(entry), 10h);
+}
+
+TEST_F(HttpCacheTest, CurrentAge_AddsAgeHeaderAndResidentTime) {
+    const auto entry{ MakeEntry({ { "age", "30" } }) };
+
+    EXPECT_EQ(HttpCache::CurrentAge(entry, now + 10s), 40s);
+}
+
+TEST_F(HttpCacheTest, IsFresh_WithinMaxAge) {
+    const auto entry{ MakeEntry({ { "cache-control", "max-age=60" } }) };
+    const RequestHeaders request{};
+
+    EXPECT_TRUE(HttpCache::IsFresh(entry, request, now + 59s));
+    EXPECT_FALSE(HttpCache::IsFresh(entry, request, now + 61s));
+}
+
+TEST_F(HttpCacheTest, IsFresh_NoCacheOnEitherSide_ForcesRevalidation) {
+    const RequestHeaders noCache{{ { "cache-control", "no-cache" } }};
+
+    EXPECT_FALSE(HttpCache::IsFresh(MakeEntry({ { "cache-control", "max-age=60" } }), noCache, now));
+    EXPECT_FALSE(HttpCache::IsFresh(MakeEntry({ { "cache-control", "no-cache, max-age=60" } }), {}, now));
+}
+
+TEST_F(HttpCacheTest, IsFresh_RequestDirectives) {
+    const auto entry{ MakeEntry({ { "cache-control", "max-age=60" } }) };
+
+    EXPECT_FALSE(HttpCache::IsFresh(entry, {{ { "cache-control", "max-age=10" } }}, now + 20s));
+    EXPECT_FALSE(HttpCache::IsFresh(entry, {{ { "cache-control", "min-fresh=50" } }}, now + 20s));
+    EXPECT_TRUE(HttpCache::IsFresh(entry, {{ { "cache-control", "max-stale=30" } }}, now + 80s));
+    EXPECT_TRUE(HttpCache::IsFresh(entry, {{ { "cache-control", "max-stale" } }}, now + 1h));
+}
+
+TEST_F(HttpCacheTest, IsFresh_MustRevalidate_IgnoresMaxStale) {
+    const auto entry{ MakeEntry({ { "cache-control", "max-age=60, must-revalidate" } }) };
+
+    EXPECT_FALSE(HttpCache::IsFresh(entry, {{ { "cache-control", "max-stale" } }}, now + 80s));
+}
+
+TEST_F(HttpCacheTest, VaryMatches_ComparesNominatedHeaders) {
+    const RequestHeaders json{{ { "accept", "application/json" } }};
+    const auto entry{ MakeEntry({ { "vary", "Accept, X-Tenant" } }, "payload", json) };
+
+    EXPECT_TRUE(HttpCache::VaryMatches(entry, json));
+    EXPECT_FALSE(HttpCache::VaryMatches(entry, RequestHeaders{{ { "accept", "text/html" } }}));
+    EXPECT_FALSE(HttpCache::VaryMatches(entry, RequestHeaders{{ { "accept", "application/json" }, { "x-tenant", "a" } }}));
+}
+
+TEST_F(HttpCacheTest, AddValidators_CopiesValidatorsVerbatim) {
+    const auto lastModified{ HttpDate(now - 1h) };
+    const auto entry{ MakeEntry({ { "etag", "W/\"v1\"" }, { "last-modified", lastModified } }) };
+
+    RequestHeaders request{};
+    ASSERT_TRUE(HttpCache::AddValidators(entry, request));
+
+    EXPECT_TRUE(request.Exists("if-none-match", "W/\"v1\""));
+    EXPECT_TRUE(request.Exists("if-modified-since", lastModified));
+}
+
+TEST_F(HttpCacheTest, AddValidators_AlreadyConditional_KeepsRequest) {
+    const auto entry{ MakeEntry({ { "etag", "\"v1\"" } }) };
+
+    RequestHeaders request{{ { "if-none-match", "\"mine\"" } }};
+    EXPECT_FALSE(HttpCache::AddValidators(entry, request));
+    EXPECT_TRUE(request.Exists("if-none-match", "\"mine\""));
+}
+
+TEST_F(HttpCacheTest, Freshen_UpdatesHeadersAndTimes) {
+    auto entry{ MakeEntry({ { "cache-control", "max-age=60" }, { "etag", "\"v1\"" }, { "content-type", "text/plain" } }) };
+    const ResponseHeaders notModified{{
+        { "cache-control", "max-age=120" }, { "etag", "\"v1\"" }, { "content-length", "0" }
+    }};
+
+    HttpCache::Freshen(entry, notModified, now + 1h, now + 1h);
+
+    EXPECT_TRUE(entry.head.headers.Exists("cache-control", "max-age=120"));
+    EXPECT_TRUE(entry.head.headers.Exists("content-type", "text/plain"));
+    EXPECT_FALSE(entry.head.headers.Exists("content-length"));
+    EXPECT_EQ(entry.responseTime, now + 1h);
+    EXPECT_EQ(*entry.body, "payload");
+}
+
+#pragma endregion
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+
+#include <Thoth/Http/Client/Client.hpp>
+#include <Thoth/Http/_base/Http1.hpp>
+#include <Thoth/Utils/Ranges/SharedInputView.hpp>
+
+#include <chrono>
+#include <string_view>
+#include <vector>
+
+using namespace std::chrono_literals;
+using namespace Thoth::Http;
+
+namespace {
+    struct RecordingObserver : RequestObserver {
+        std::vector<RequestTimings> calls;
+
+        void OnTimings(const RequestTimings& timings) override {
+            calls.push_back(timings);
+        }
+    };
+}
+
+
+struct RequestTimingsTest : testing::Test {};
+
+#pragma region Durations
+
+TEST_F(RequestTimingsTest, Durations_FollowPhases) {
+    const RequestTimings::TimePoint t0{ 1s };
+
+    const RequestTimings timings{
+        .start = t0, .resolved = t0 + 1ms, .connected = t0 + 3ms, .requestSent = t0 + 4ms,
+        .firstByte = t0 + 10ms, .headersReceived = t0 + 11ms, .end = t0 + 20ms,
+    };
+
+    EXPECT_EQ(timings.Dns()     , 1ms);
+    EXPECT_EQ(timings.Connect() , 2ms);
+    EXPECT_EQ(timings.Send()    , 1ms);
+    EXPECT_EQ(timings.Wait()    , 6ms);
+    EXPECT_EQ(timings.Download(), 10ms);
+    EXPECT_EQ(timings.Total()   , 20ms);
+}
+
+TEST_F(RequestTimingsTest, Durations_UnreachedPhase_Zero) {
+    const RequestTimings::TimePoint t0{ 1s };
+    const RequestTimings timings{ .start = t0, .resolved = t0 + 1ms, .end = t0 + 5ms };
+
+    EXPECT_EQ(timings.Dns()    , 1ms);
+    EXPECT_EQ(timings.Connect(), RequestTimings::Duration::zero());
+    EXPECT_EQ(timings.Wait()   , RequestTimings::Duration::zero());
+    EXPECT_EQ(timings.Total()  , 5ms);
+}
+
+#pragma endregion
+
+#pragma region MeteredStream
+
+TEST_F(RequestTimingsTest, MeteredStream_CountsEveryByteOfTheResponse) {
+    constexpr std::string_view raw{
+        "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n5\r\nhello\r\n6\r\n thoth\r\n0\r\n\r\n"
+    };
+
+    RequestTimings timings;
+    const auto response{ details_::Http1::BuildResponse<GetMethod, std::string>(
+        details_::MeteredStream{ Thoth::Utils::SharedInputView{ raw }, timings },
+        [](const ResponseHead&) -> std::expected<std::string, Thoth::ThothError> { return {}; }
+    ) };
+
+    ASSERT_TRUE(response);
+    EXPECT_EQ(response->body, "hello thoth");
+    EXPECT_EQ(timings.bytesReceived, raw.size());
+    EXPECT_NE(timings.firstByte, RequestTimings::TimePoint{});
+}
+
+TEST_F(RequestTimingsTest, MeteredStream_StopsAtTheEndOfTheMessage) {
+    constexpr std::string_view message{ "HTTP/1.1 200 OK\r\nContent-Length: 3\r\n\r\nabc" };
+    const std::string raw{ std::string{ message } + "HTTP/1.1 200 OK\r\n" };
+
+    RequestTimings timings;
+    const auto response{ details_::Http1::BuildResponse<GetMethod, std::string>(
+        details_::MeteredStream{ Thoth::Utils::SharedInputView{ std::string_view{ raw } }, timings },
+        [](const ResponseHead&) -> std::expected<std::string, Thoth::ThothError> { return {}; }
+    ) };
+
+    ASSERT_TRUE(response);
+    EXPECT_EQ(timings.bytesReceived, message.size());
+}
+
+#pragma endregion
+
+#pragma region Client
+
+TEST_F(RequestTimingsTest, Send_ConnectionRefused_NotifiesFailure) {
+    // Nothing listens on the port 1 of the loopback, the connection fails right away.
+    auto request{ GetRequest::FromUrl("http://127.0.0.1:1/") };
+    ASSERT_TRUE(request.has_value());
+
+    RecordingObserver observer;
+    const auto result{ Client::Send(std::move(*request), { .observer = &observer }) };
+    ASSERT_FALSE(result.has_value());
+
+    ASSERT_EQ(observer.calls.size(), 1u);
+    const auto& timings{ observer.calls.front() };
+
+    EXPECT_FALSE(timings.succeeded);
+    EXPECT_FALSE(timings.secure);
+    EXPECT_NE(timings.resolved, RequestTimings::TimePoint{});
+    EXPECT_EQ(timings.connected, RequestTimings::TimePoint{});
+    EXPECT_EQ(timings.bytesSent, 0u);
+    EXPECT_GE(timings.end, timings.start);
+}
+
+TEST_F(RequestTimingsTest, Send_ExampleCom_FillsEveryPhase) {
+    auto request{ GetRequest::FromUrl("http://www.example.com/") };
+    ASSERT_TRUE(request.has_value());
+
+    RecordingObserver observer;
+    const auto result{ Client::Send(std::move(*request), { .connectionTimeout = 5s, .observer = &observer }) };
+    if (!result && result.error().Is<ConnectionErrorEnum>())
+        GTEST_SKIP() << "www.example.com is unavailable";
+
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(observer.calls.size(), 1u);
+    const auto& timings{ observer.calls.front() };
+
+    EXPECT_TRUE(timings.succeeded);
+    EXPECT_LE(timings.start, timings.resolved);
+    EXPECT_LE(timings.resolved, timings.connected);
+    EXPECT_LE(timings.connected, timings.requestSent);
+    EXPECT_LE(timings.requestSent, timings.firstByte);
+    EXPECT_LE(timings.firstByte, timings.headersReceived);
+    EXPECT_LE(timings.headersReceived, timings.end);
+
+    EXPECT_GT(timings.bytesSent, 0u);
+    EXPECT_GT(timings.bytesReceived, 0u);
+}
+
+#pragma endregion
@@ -0,0 +1,260 @@
+#include <gtest/gtest.h>
+
+#include <Thoth/Http/Methods/DeleteMethod.hpp>
+#include <Thoth/Http/Methods/GetMethod.hpp>
+#include <Thoth/Http/Methods/PostMethod.hpp>
+#include <Thoth/Http/Methods/PutMethod.hpp>
+#include <Thoth/Http/Router.hpp>
+
+#include <array>
+#include <format>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace Thoth::Http;
+
+namespace {
+    constexpr std::array k_routes{
+        Route::For<GetMethod>("/"),
+        Route::For<GetMethod>("/users"),
+        Route::For<PostMethod>("/users"),
+        Route::For<GetMethod>("/users/new"),
+        Route::For<GetMethod>("/users/{id}"),
+        Route::For<PutMethod>("/users/{id}"),
+        Route::For<GetMethod>("/users/{id}/posts/{post}"),
+        Route::For<GetMethod>("/users/new/edit/{field}"),
+        Route::For<GetMethod>("/userspace"),
+        Route::For<GetMethod>("/static/{path...}"),
+    };
+
+    constexpr auto k_table{ MakeRouteTable<k_routes>() };
+
+    static_assert(k_table.Match("GET", "/users/new")->route == 3);
+    static_assert(k_table.Match("GET", "/users/7")->params[0] == "7");
+    static_assert(k_table.Match("GET", "/nope").error() == StatusCodeEnum::NotFound);
+
+    constexpr std::array k_methodRoutes{
+        Route::For<GetMethod>("/users/me"),
+        Route::For<DeleteMethod>("/users/{id}"),
+    };
+
+    constexpr auto k_methodTable{ MakeRouteTable<k_methodRoutes>() };
+
+    static_assert(k_methodTable.Match("DELETE", "/users/me")->route == 1);
+}
+
+
+struct RouterTest : testing::Test {
+    static ServerRequest MakeRequest(const std::string_view method, const std::string_view path) {
+        ServerRequest req{ { .url = Url::FromUrl(std::format("http://localhost{}", path)).value() } };
+        req.method = method;
+
+        return req;
+    }
+};
+
+#pragma region RouteTable
+
+TEST_F(RouterTest, Match_Static) {
+    const auto match{ k_table.Match("GET", "/users") };
+    ASSERT_TRUE(match.has_value());
+
+    EXPECT_EQ(match->route, 1u);
+    EXPECT_EQ(match->params.size(), 0u);
+}
+
+TEST_F(RouterTest, Match_SplitPrefixes) {
+    EXPECT_EQ(k_table.Match("GET", "/")->route, 0u);
+    EXPECT_EQ(k_table.Match("GET", "/userspace")->route, 8u);
+    EXPECT_EQ(k_table.Match("GET", "/users")->route, 1u);
+}
+
+TEST_F(RouterTest, Match_ByMethod) {
+    EXPECT_EQ(k_table.Match("POST", "/users")->route, 2u);
+    EXPECT_EQ(k_table.Match("PUT", "/users/3")->route, 5u);
+}
+
+TEST_F(RouterTest, Match_Params_ViewThePath) {
+    constexpr std::string_view k_path{ "/users/42/posts/hello%20world" };
+
+    const auto match{ k_table.Match("GET", k_path) };
+    ASSERT_TRUE(match.has_value());
+
+    EXPECT_EQ(match->route, 6u);
+    EXPECT_EQ(match->params.Get("id"), "42");
+    EXPECT_EQ(match->params.Get("post"), "hello%20world");
+    EXPECT_FALSE(match->params.Get("missing").has_value());
+
+    EXPECT_EQ(match->params[1].data(), k_path.data() + 16);
+}
+
+TEST_F(RouterTest, Match_StaticBeforeParam) {
+    EXPECT_EQ(k_table.Match("GET", "/users/new")->route, 3u);
+    EXPECT_EQ(k_table.Match("GET", "/users/newer")->route, 4u);
+}
+
+TEST_F(RouterTest, Match_BacktracksToParam) {
+    // `/users/new` is static but has no `/posts/...` below it.
+    const auto match{ k_table.Match("GET", "/users/new/posts/1") };
+    ASSERT_TRUE(match.has_value());
+
+    EXPECT_EQ(match->route, 6u);
+    EXPECT_EQ(match->params.Get("id"), "new");
+    EXPECT_EQ(match->params.Get("post"), "1");
+}
+
+TEST_F(RouterTest, Match_CatchAll) {
+    const auto match{ k_table.Match("GET", "/static/css/site.css") };
+    ASSERT_TRUE(match.has_value());
+
+    EXPECT_EQ(match->route, 9u);
+    EXPECT_EQ(match->params.Get("path"), "css/site.css");
+    EXPECT_EQ(k_table.Match("GET", "/static/")->params.Get("path"), "");
+}
+
+TEST_F(RouterTest, Match_HeadFallsBackToGet) {
+    EXPECT_EQ(k_table.Match("HEAD", "/users/9")->route, 4u);
+}
+
+TEST_F(RouterTest, Match_Unmatched_NotFound) {
+    static constexpr std::string_view k_paths[]{
+        "", "/user", "/users/", "/users/1/", "/users/1/posts", "/users/1/posts/", "/static", "/other",
+    };
+
+    for (const auto path : k_paths) {
+        SCOPED_TRACE(path);
+        EXPECT_EQ(k_table.Match("GET", path).error(), StatusCodeEnum::NotFound);
+    }
+}
+
+TEST_F(RouterTest, Match_WrongMethod_MethodNotAllowed) {
+    EXPECT_EQ(k_table.Match("DELETE", "/users").error(), StatusCodeEnum::MethodNotAllowed);
+    EXPECT_EQ(k_table.Match("BREW", "/users").error(), StatusCodeEnum::MethodNotAllowed);
+    EXPECT_EQ(k_table.AllowedMethods("/users"), "GET, HEAD, POST");
+    EXPECT_EQ(k_table.AllowedMethods("/users/1"), "GET, HEAD, PUT");
+    EXPECT_EQ(k_table.AllowedMethods("/users/new"), "GET, HEAD, PUT");
+}
+
+TEST_F(RouterTest, Match_OtherMethod_BacktracksToParam) {
+    // `/users/me` is static but only routes GET, DELETE is on the param below `/users/`.
+    const auto match{ k_methodTable.Match("DELETE", "/users/me") };
+    ASSERT_TRUE(match.has_value());
+
+    EXPECT_EQ(match->route, 1u);
+    EXPECT_EQ(match->params.Get("id"), "me");
+
+    EXPECT_EQ(k_methodTable.Match("GET", "/users/me")->route, 0u);
+    EXPECT_EQ(k_methodTable.Match("HEAD", "/users/me")->route, 0u);
+    EXPECT_EQ(k_methodTable.Match("GET", "/users/7").error(), StatusCodeEnum::MethodNotAllowed);
+    EXPECT_EQ(k_methodTable.Match("POST", "/users/me").error(), StatusCodeEnum::MethodNotAllowed);
+    EXPECT_EQ(k_methodTable.AllowedMethods("/users/me"), "GET, HEAD, DELETE");
+    EXPECT_EQ(k_methodTable.AllowedMethods("/users/7"), "DELETE");
+}
+
+TEST_F(RouterTest, Build_Invalid_Fails) {
+    static constexpr std::pair<Route, RouteErrorEnum> k_cases[]{
+        { { "GET",  "users"           }, RouteErrorEnum::InvalidPattern },
+        { { "GET",  "/a{id}"          }, RouteErrorEnum::InvalidPattern },
+        { { "GET",  "/{id}b"          }, RouteErrorEnum::InvalidPattern },
+        { { "GET",  "/{}"             }, RouteErrorEnum::InvalidPattern },
+        { { "GET",  "/{id"            }, RouteErrorEnum::InvalidPattern },
+        { { "GET",  "/a}"             }, RouteErrorEnum::InvalidPattern },
+        { { "GET",  "/{rest...}/more" }, RouteErrorEnum::InvalidPattern },
+        { { "BREW", "/coffee"         }, RouteErrorEnum::UnknownMethod  },
+        { { "GET",  "/{a}/{b}/{c}/{d}/{e}/{f}/{g}/{h}/{i}" }, RouteErrorEnum::TooManyParams },
+    };
+
+    for (const auto& [route, error] : k_cases) {
+        SCOPED_TRACE(route.pattern);
+
+        RouteTable<1, 64> table;
+        const std::array routes{ route };
+        EXPECT_EQ(table.Build(routes).error(), error);
+    }
+}
+
+TEST_F(RouterTest, Build_Duplicate_Fails) {
+    const std::array routes{ Route{ "GET", "/users/{id}" }, Route{ "GET", "/users/{name}" } };
+
+    RouteTable<2, 64> table;
+    EXPECT_EQ(table.Build(routes).error(), RouteErrorEnum::DuplicateRoute);
+}
+
+TEST_F(RouterTest, Build_AtRunTime_ThousandsOfRoutes) {
+    constexpr size_t k_count{ 2000 };
+
+    std::vector<std::string> patterns;
+    for (size_t i{}; i < k_count; ++i)
+        patterns.push_back(std::format("/api/v{}/resource{}/{{id}}", i % 3, i));
+
+    std::vector<Route> routes;
+    for (const auto& pattern : patterns)
+        routes.push_back({ "GET", pattern });
+
+    const auto table{ std::make_unique<RouteTable<k_count, 64 * k_count>>() };
+    ASSERT_TRUE(table->Build(routes).has_value());
+
+    const auto match{ table->Match("GET", "/api/v1/resource1234/abc") };
+    ASSERT_TRUE(match.has_value());
+    EXPECT_EQ(match->route, 1234u);
+    EXPECT_EQ(match->params.Get("id"), "abc");
+}
+
+#pragma endregion
+
+#pragma region Router
+
+namespace {
+    constexpr std::array k_apiRoutes{
+        Route::For<GetMethod>("/users/{id}"),
+        Route::For<PostMethod>("/users"),
+    };
+}
+
+TEST_F(RouterTest, Router_DispatchesToTheRouteHandler) {
+    const auto router{ MakeRouter<k_apiRoutes>(
+        [](const ServerRequest&, ServerResponse& res, const RouteParams& params) {
+            res.body = std::format("user {}", *params.Get("id"));
+        },
+        [](const ServerRequest& req, ServerResponse& res, const RouteParams&) {
+            res.status = StatusCodeEnum::Created;
+            res.body   = req.body;
+        }
+    ) };
+
+    ServerResponse get;
+    router(MakeRequest("GET", "/users/5"), get);
+    EXPECT_EQ(get.status, StatusCodeEnum::Ok);
+    EXPECT_EQ(get.body, "user 5");
+
+    auto post{ MakeRequest("POST", "/users") };
+    post.body = "alice";
+
+    ServerResponse created;
+    router(post, created);
+    EXPECT_EQ(created.status, StatusCodeEnum::Created);
+    EXPECT_EQ(created.body, "alice");
+}
+
+TEST_F(RouterTest, Router_Unmatched_SetsTheStatus) {
+    const auto router{ MakeRouter<k_apiRoutes>(
+        [](const ServerRequest&, ServerResponse&, const RouteParams&) { },
+        [](const ServerRequest&, ServerResponse&, const RouteParams&) { }
+    ) };
+
+    ServerResponse missing;
+    router(MakeRequest("GET", "/posts"), missing);
+    EXPECT_EQ(missing.status, StatusCodeEnum::NotFound);
+
+    ServerResponse wrongMethod;
+    router(MakeRequest("DELETE", "/users"), wrongMethod);
+    EXPECT_EQ(wrongMethod.status, StatusCodeEnum::MethodNotAllowed);
+
+    const auto allow{ wrongMethod.headers.Get("allow") };
+    ASSERT_TRUE(allow.has_value());
+    EXPECT_EQ(**allow, "POST");
+}
+
+#pragma endregion
@@ -0,0 +1,274 @@
+#include <gtest/gtest.h>
+
+#include <Thoth/Http/Client/Client.hpp>
+#include <Thoth/Http/Methods/PutMethod.hpp>
+#include <Thoth/Http/Request/Request.hpp>
+#include <Thoth/Http/Server.hpp>
+#include <Thoth/Http/_base/Http1.hpp>
+#include <Thoth/Utils/Ranges/SharedInputView.hpp>
+
+#include <array>
+#include <format>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+#ifdef __linux__
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+using namespace std::chrono_literals;
+using namespace Thoth::Http;
+
+namespace {
+    using Stream = Thoth::Utils::SharedInputView<std::string_view>;
+
+    auto ParseLine(const std::string_view raw) {
+        return details_::Http1::ParseRequestLine(details_::RequestParseStage<Stream>{
+            { .url = Url::FromUrl("http://localhost/").value() }, Stream{ std::string_view{ raw } }
+        });
+    }
+
+    // Answers "<method> <path> <body>", `/close` asks to close the connection and `/throw` fails.
+    void EchoHandler(const ServerRequest& req, ServerResponse& res) {
+        const auto path{ req.url.GetPathOrSep() };
+        if (path == "/throw") throw std::runtime_error{ "handler failed" };
+        if (path == "/close") res.headers.Set("connection", "close");
+
+        res.headers.Set("content-type", "text/plain");
+        res.body = std::format("{} {} {}", req.method, path, req.body);
+    }
+
+    struct CountingObserver : RequestObserver {
+        std::vector<bool> reused;
+
+        void OnTimings(const RequestTimings& timings) override {
+            reused.push_back(timings.reused);
+        }
+    };
+}
+
+
+struct ServerTest : testing::Test {
+    inline static const ServerOptions k_options{ .acceptors = 2, .workers = 2 };
+
+    std::optional<Server> server;
+
+    void SetUp() override {
+#ifndef __linux__
+        GTEST_SKIP() << "Server is only available on Linux";
+#endif
+        auto res{ Server::Listen(EchoHandler, k_options) };
+        ASSERT_TRUE(res.has_value());
+        server.emplace(std::move(*res));
+    }
+
+    [[nodiscard]] std::string UrlTo(const std::string_view target) const {
+        return std::format("http://127.0.0.1:{}{}", server->Port(), target);
+    }
+};
+
+#pragma region ParseRequestLine
+
+TEST_F(ServerTest, ParseRequestLine_OriginForm) {
+    const auto res{ ParseLine("GET /users?id=3 HTTP/1.1\r\nhost: x\r\n\r\n") };
+    ASSERT_TRUE(res.has_value());
+
+    const auto& [line, stage]{ *res };
+    EXPECT_EQ(line.method, "GET");
+    EXPECT_EQ(line.target, "/users?id=3");
+    EXPECT_EQ(stage.data.version, VersionEnum::HTTP1_1);
+}
+
+TEST_F(ServerTest, ParseRequestLine_Http10) {
+    const auto res{ ParseLine("OPTIONS * HTTP/1.0\r\n\r\n") };
+    ASSERT_TRUE(res.has_value());
+
+    EXPECT_EQ(res->first.target, "*");
+    EXPECT_EQ(res->second.data.version, VersionEnum::HTTP1_0);
+}
+
+TEST_F(ServerTest, ParseRequestLine_Malformed_Fails) {
+    static constexpr std::string_view k_lines[]{
+        "GET /\r\n\r\n",
+        "GET  / HTTP/1.1\r\n",
+        "G(T / HTTP/1.1\r\n",
+        "GET / HTTP/2.0\r\n",
+        "GET / HTTP/1.1\n",
+        "GET / HTTP/1.2\r\n",
+    };
+
+    for (const auto raw : k_lines) {
+        SCOPED_TRACE(raw);
+        EXPECT_FALSE(ParseLine(raw).has_value());
+    }
+}
+
+TEST_F(ServerTest, ParseRequestLine_HugeTarget_Fails) {
+    const auto raw{ std::format("GET /{} HTTP/1.1\r\n\r\n", std::string(16 * 1024, 'a')) };
+    EXPECT_FALSE(ParseLine(raw).has_value());
+}
+
+#pragma endregion
+
+#pragma region Client Round Trip
+
+TEST_F(ServerTest, Get_ReachesTheHandler) {
+    const auto res{ Client::Send(GetRequest::FromUrl(UrlTo("/hello?x=1")).value()) };
+    ASSERT_TRUE(res.has_value());
+
+    EXPECT_EQ(res->status, StatusCodeEnum::Ok);
+    EXPECT_EQ(res->statusMessage, "OK");
+    EXPECT_EQ(res->body, "GET /hello ");
+
+    const auto contentType{ res->headers.Get("content-type") };
+    ASSERT_TRUE(contentType.has_value());
+    EXPECT_EQ(**contentType, "text/plain");
+}
+
+TEST_F(ServerTest, Post_BodyReachesTheHandler) {
+    const std::string body(256 * 1024, 'p');
+
+    const auto res{ Client::Send(PostRequest::FromUrl(UrlTo("/upload"), body).value()) };
+    ASSERT_TRUE(res.has_value());
+
+    EXPECT_EQ(res->body, std::format("POST /upload {}", body));
+}
+
+TEST_F(ServerTest, KeepAlive_ReusesTheConnection) {
+    CountingObserver observer;
+
+    for (int i{}; i < 3; ++i)
+        ASSERT_TRUE(Client::Send(GetRequest::FromUrl(UrlTo("/again")).value(), { .observer = &observer }));
+
+    ASSERT_EQ(observer.reused.size(), 3u);
+    EXPECT_TRUE(observer.reused[1]);
+    EXPECT_TRUE(observer.reused[2]);
+}
+
+TEST_F(ServerTest, ConnectionClose_IsHonored) {
+    CountingObserver observer;
+
+    ASSERT_TRUE(Client::Send(GetRequest::FromUrl(UrlTo("/close")).value(), { .observer = &observer }));
+    ASSERT_TRUE(Client::Send(GetRequest::FromUrl(UrlTo("/close")).value(), { .observer = &observer }));
+
+    ASSERT_EQ(observer.reused.size(), 2u);
+    EXPECT_FALSE(observer.reused[1]);
+}
+
+TEST_F(ServerTest, HandlerThrows_Answers500) {
+    const auto res{ Client::Send(GetRequest::FromUrl(UrlTo("/throw")).value()) };
+    ASSERT_TRUE(res.has_value());
+
+    EXPECT_EQ(res->status, StatusCodeEnum::InternalServerError);
+}
+
+TEST_F(ServerTest, TypedHandler_ReceivesTypedRequests) {
+    auto typed{ Server::Listen(MakeTypedHandler<std::vector<std::byte>, GetMethod, PostMethod>(
+        [](const std::variant<GetBinRequest, PostBinRequest>& req, ServerResponse& res) {
+            if (const auto* post{ std::get_if<PostBinRequest>(&req) })
+                res.body = std::format("POST {} bytes", post->body.size());
+            else
+                res.body = std::format("GET {}", std::get<GetBinRequest>(req).url.GetPathOrSep());
+        }), k_options) };
+    ASSERT_TRUE(typed.has_value());
+
+    const auto url{ std::format("http://127.0.0.1:{}/typed", typed->Port()) };
+
+    const auto get{ Client::Send(GetRequest::FromUrl(url).value()) };
+    ASSERT_TRUE(get.has_value());
+    EXPECT_EQ(get->body, "GET /typed");
+
+    const auto post{ Client::Send(PostRequest::FromUrl(url, "12345").value()) };
+    ASSERT_TRUE(post.has_value());
+    EXPECT_EQ(post->body, "POST 5 bytes");
+
+    const auto put{ Client::Send(Request<PutMethod>::FromUrl(url, "x").value()) };
+    ASSERT_TRUE(put.has_value());
+    EXPECT_EQ(put->status, StatusCodeEnum::MethodNotAllowed);
+
+    const auto allow{ put->headers.Get("allow") };
+    ASSERT_TRUE(allow.has_value());
+    EXPECT_EQ(**allow, "GET, POST");
+}
+
+#pragma endregion
+
+#pragma region Raw Socket
+
+#ifdef __linux__
+
+namespace {
+    // Writes `raw` on a fresh connection and reads until the server closes it.
+    std::string Exchange(const uint16_t port, const std::string_view raw) {
+        const int fd{ socket(AF_INET, SOCK_STREAM, 0) };
+
+        sockaddr_in addr{ .sin_family = AF_INET, .sin_port = htons(port) };
+        inet_pton(AF_INET, "127.0.0.1", &addr.sin_addr);
+        if (connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == -1) {
+            close(fd);
+            return {};
+        }
+
+        (void)send(fd, raw.data(), raw.size(), MSG_NOSIGNAL);
+
+        std::string res;
+        std::array<char, 4096> buffer;
+        for (ssize_t got; (got = recv(fd, buffer.data(), buffer.size(), 0)) > 0;)
+            res.append(buffer.data(), static_cast<size_t>(got));
+
+        close(fd);
+        return res;
+    }
+}
+
+TEST_F(ServerTest, Pipelined_AnsweredInOrder) {
+    const auto res{ Exchange(server->Port(),
+        "GET /one HTTP/1.1\r\nHost: x\r\n\r\n"
+        "POST /two HTTP/1.1\r\nHost: x\r\nTransfer-Encoding: chunked\r\n\r\n3\r\nabc\r\n0\r\n\r\n"
+        "GET /three HTTP/1.1\r\nHost: x\r\nConnection: close\r\n\r\n"
+    ) };
+
+    const auto one{ res.find("GET /one ") }, two{ res.find("POST /two abc") }, three{ res.find("GET /three ") };
+    ASSERT_NE(one, std::string::npos);
+    ASSERT_NE(two, std::string::npos);
+    ASSERT_NE(three, std::string::npos);
+    EXPECT_LT(one, two);
+    EXPECT_LT(two, three);
+}
+
+TEST_F(ServerTest, MissingHost_Answers400) {
+    const auto res{ Exchange(server->Port(), "GET / HTTP/1.1\r\n\r\n") };
+    EXPECT_TRUE(res.starts_with("HTTP/1.1 400 Bad Request\r\n"));
+}
+
+TEST_F(ServerTest, Http10_ClosesByDefault) {
+    const auto res{ Exchange(server->Port(), "GET /old HTTP/1.0\r\n\r\n") };
+
+    EXPECT_TRUE(res.starts_with("HTTP/1.0 200 OK\r\n"));
+    EXPECT_TRUE(res.contains("connection: close\r\n"));
+    EXPECT_TRUE(res.ends_with("GET /old "));
+}
+
+TEST_F(ServerTest, HugeHead_Answers431) {
+    const auto res{ Exchange(server->Port(),
+        std::format("GET / HTTP/1.1\r\nHost: x\r\nx-pad: {}\r\n\r\n", std::string(k_options.maxHeadLength, 'a'))) };
+    EXPECT_TRUE(res.starts_with("HTTP/1.1 431 "));
+}
+
+TEST_F(ServerTest, HeadRequest_HasNoBody) {
+    const auto res{ Exchange(server->Port(), "HEAD /head HTTP/1.1\r\nHost: x\r\nConnection: close\r\n\r\n") };
+
+    EXPECT_TRUE(res.starts_with("HTTP/1.1 200 OK\r\n"));
+    EXPECT_TRUE(res.contains("content-length: 11\r\n"));
+    EXPECT_TRUE(res.ends_with("\r\n\r\n"));
+}
+
+#endif
+
+#pragma endregion
@@ -0,0 +1,199 @@
+#include <gtest/gtest.h>
+
+#include <Thoth/Http/Client/Client.hpp>
+#include <Thoth/Http/Request/Request.hpp>
+#include <Thoth/Http/StaticFiles.hpp>
+
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+
+using namespace Thoth::Http;
+namespace fs = std::filesystem;
+
+
+struct StaticFilesTest : testing::Test {
+    inline static const std::string k_hello{ "hello static world" };
+
+    fs::path root;
+    std::optional<Server> server;
+
+    void SetUp() override {
+#ifndef __linux__
+        GTEST_SKIP() << "Server is only available on Linux";
+#endif
+        root = fs::temp_directory_path() / std::format("thoth-static-{}", testing::UnitTest::GetInstance()->random_seed());
+        fs::create_directories(root / "sub");
+
+        Write("hello.txt", k_hello);
+        Write("sub/data.bin", std::string(300 * 1024, 'd'));
+        Write("empty.txt", "");
+
+        auto res{ Server::Listen(StaticFiles{ root }, { .acceptors = 1, .workers = 2 }) };
+        ASSERT_TRUE(res.has_value());
+        server.emplace(std::move(*res));
+    }
+
+    void TearDown() override {
+        server.reset();
+        fs::remove_all(root);
+    }
+
+    void Write(const fs::path& name, const std::string_view content) const {
+        std::ofstream{ root / name, std::ios::binary } << content;
+    }
+
+    [[nodiscard]] auto Get(const std::string_view target, const std::initializer_list<std::pair<std::string_view, std::string_view>> headers = {}) const {
+        auto request{ GetRequest::FromUrl(std::format("http://127.0.0.1:{}{}", server->Port(), target)).value() };
+        for (const auto& [name, value] : headers)
+            request.headers.Set(name, value);
+
+        return Client::Send(std::move(request));
+    }
+
+    [[nodiscard]] static std::string Header(const ResponseHead& res, const std::string_view name) {
+        const auto value{ res.headers.Get(name) };
+        return value ? **value : std::string{};
+    }
+};
+
+
+TEST_F(StaticFilesTest, Get_ServesTheFile) {
+    const auto res{ Get("/hello.txt") };
+    ASSERT_TRUE(res.has_value());
+
+    EXPECT_EQ(res->status, StatusCodeEnum::Ok);
+    EXPECT_EQ(res->body, k_hello);
+    EXPECT_EQ(Header(*res, "content-type"), "text/plain; charset=utf-8");
+    EXPECT_EQ(Header(*res, "accept-ranges"), "bytes");
+    EXPECT_FALSE(Header(*res, "etag").empty());
+    EXPECT_FALSE(Header(*res, "last-modified").empty());
+}
+
+TEST_F(StaticFilesTest, Get_LargeFile) {
+    const auto res{ Get("/sub/data.bin") };
+    ASSERT_TRUE(res.has_value());
+
+    EXPECT_EQ(res->body, std::string(300 * 1024, 'd'));
+    EXPECT_EQ(Header(*res, "content-type"), "application/octet-stream");
+}
+
+TEST_F(StaticFilesTest, Get_EmptyFile) {
+    const auto res{ Get("/empty.txt") };
+    ASSERT_TRUE(res.has_value());
+
+    EXPECT_EQ(res->status, StatusCodeEnum::Ok);
+    EXPECT_TRUE(res->body.empty());
+}
+
+TEST_F(StaticFilesTest, Get_Missing_NotFound) {
+    static constexpr std::string_view k_targets[]{ "/missing.txt", "/sub", "/sub/../../etc/passwd", "/%2e%2e/hello.txt", "/" };
+
+    for (const auto target : k_targets) {
+        SCOPED_TRACE(target);
+
+        const auto res{ Get(target) };
+        ASSERT_TRUE(res.has_value());
+        EXPECT_EQ(res->status, StatusCodeEnum::NotFound);
+    }
+}
+
+TEST_F(StaticFilesTest, Get_SymlinkOutOfRoot_NotFound) {
+    const auto outside{ root.parent_path() / std::format("{}-outside", root.filename().string()) };
+    fs::create_directories(outside);
+    std::ofstream{ outside / "secret.txt", std::ios::binary } << "secret";
+
+    fs::create_symlink(outside / "secret.txt", root / "file-link.txt");
+    fs::create_symlink(outside, root / "dir-link");
+    fs::create_symlink("../" + outside.filename().string() + "/secret.txt", root / "sub/relative-link.txt");
+
+    for (const auto target : { "/file-link.txt", "/dir-link/secret.txt", "/sub/relative-link.txt" }) {
+        SCOPED_TRACE(target);
+
+        const auto res{ Get(target) };
+        ASSERT_TRUE(res.has_value());
+        EXPECT_EQ(res->status, StatusCodeEnum::NotFound);
+        EXPECT_NE(res->body, "secret");
+    }
+
+    fs::remove_all(outside);
+}
+
+TEST_F(StaticFilesTest, Range_PartialContent) {
+    static constexpr std::tuple<std::string_view, std::string_view, std::string_view> k_cases[]{
+        { "bytes=0-4",  "hello",  "bytes 0-4/18"   },
+        { "bytes=13-",  "world",  "bytes 13-17/18" },
+        { "bytes=-5",   "world",  "bytes 13-17/18" },
+        { "bytes=6-99", "static world", "bytes 6-17/18" },
+    };
+
+    for (const auto& [range, body, contentRange] : k_cases) {
+        SCOPED_TRACE(range);
+
+        const auto res{ Get("/hello.txt", { { "range", range } }) };
+        ASSERT_TRUE(res.has_value());
+
+        EXPECT_EQ(res->status, StatusCodeEnum::PartialContent);
+        EXPECT_EQ(res->body, body);
+        EXPECT_EQ(Header(*res, "content-range"), contentRange);
+    }
+}
+
+TEST_F(StaticFilesTest, Range_Unsatisfiable) {
+    const auto res{ Get("/hello.txt", { { "range", "bytes=100-" } }) };
+    ASSERT_TRUE(res.has_value());
+
+    EXPECT_EQ(res->status, StatusCodeEnum::RangeNotSatisfiable);
+    EXPECT_EQ(Header(*res, "content-range"), "bytes */18");
+}
+
+TEST_F(StaticFilesTest, Range_IfRangeMismatch_WholeFile) {
+    const auto res{ Get("/hello.txt", { { "range", "bytes=0-4" }, { "if-range", "\"stale\"" } }) };
+    ASSERT_TRUE(res.has_value());
+
+    EXPECT_EQ(res->status, StatusCodeEnum::Ok);
+    EXPECT_EQ(res->body, k_hello);
+}
+
+TEST_F(StaticFilesTest, Conditional_NotModified) {
+    const auto first{ Get("/hello.txt") };
+    ASSERT_TRUE(first.has_value());
+
+    const auto byTag{ Get("/hello.txt", { { "if-none-match", Header(*first, "etag") } }) };
+    ASSERT_TRUE(byTag.has_value());
+    EXPECT_EQ(byTag->status, StatusCodeEnum::NotModified);
+    EXPECT_TRUE(byTag->body.empty());
+
+    const auto byDate{ Get("/hello.txt", { { "if-modified-since", Header(*first, "last-modified") } }) };
+    ASSERT_TRUE(byDate.has_value());
+    EXPECT_EQ(byDate->status, StatusCodeEnum::NotModified);
+
+    const auto otherTag{ Get("/hello.txt", { { "if-none-match", "\"other\"" } }) };
+    ASSERT_TRUE(otherTag.has_value());
+    EXPECT_EQ(otherTag->status, StatusCodeEnum::Ok);
+}
+
+TEST_F(StaticFilesTest, ReplacedFile_IsReopened) {
+    StaticFiles files{ root, { .revalidateAfter = std::chrono::milliseconds{ 0 } } };
+
+    ServerRequest request{ { .url = Url::FromUrl("http://localhost/hello.txt").value() } };
+    request.method = "GET";
+
+    ServerResponse before;
+    files(request, before);
+    ASSERT_TRUE(before.file.has_value());
+    EXPECT_EQ(before.file->length, k_hello.size());
+
+    Write("replacement.txt", "replaced");
+    fs::rename(root / "replacement.txt", root / "hello.txt");
+
+    ServerResponse after;
+    files(request, after);
+    ASSERT_TRUE(after.file.has_value());
+    EXPECT_EQ(after.file->length, 8u);
+    EXPECT_NE(before.file->file->fd, after.file->file->fd);
+}
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 #include <Thoth/Http/Url/Url.hpp>
+#include <Thoth/Http/Url/UrlBuilder.hpp>
+#include <Thoth/Http/Url/UrlView.hpp>
 #include <Thoth/Http/Request/QueryParams.hpp>
 
 #include <string>
@@ -542,6 +544,60 @@ TEST_F(UrlEncodeTest, TryDecode_IncompleteSequence_ReturnsError) {
     EXPECT_FALSE(Url::TryDecode("incomplete%2"));
 }
 
+TEST_F(UrlEncodeTest, Encode_LongText_EveryReservedPosition) {
+    // Runs longer than a vector, the reserved byte at each offset of it.
+    for (size_t at{}; at < 70; ++at) {
+        std::string text(70, 'a');
+        text[at] = '/';
+
+        std::string expected(70 - 1, 'a');
+        expected.insert(at, "%2F");
+
+        EXPECT_EQ(Url::Encode(text), expected) << "at " << at;
+    }
+}
+
+TEST_F(UrlEncodeTest, Encode_NonAsciiAndMarks_Encoded) {
+    EXPECT_EQ(Url::Encode("Jos\xC3\xA9-._~Az09@[`{"), "Jos%C3%A9-._~Az09%40%5B%60%7B");
+}
+
+TEST_F(UrlEncodeTest, TryDecode_LongText_EveryEscapePosition) {
+    for (size_t at{}; at < 70; ++at) {
+        std::string text(70, 'a');
+        text.replace(at, 1, "%2F");
+
+        std::string expected(70, 'a');
+        expected[at] = '/';
+
+        const auto decoded{ Url::TryDecode(text) };
+        ASSERT_TRUE(decoded) << "at " << at;
+        EXPECT_EQ(*decoded, expected) << "at " << at;
+    }
+}
+
+TEST_F(UrlEncodeTest, TryDecode_PlusBecomesSpace) {
+    const auto decoded{ Url::TryDecode("a+b%2Bc") };
+    ASSERT_TRUE(decoded);
+    EXPECT_EQ(*decoded, "a b+c");
+}
+
+TEST_F(UrlEncodeTest, AppendDecoded_AppendsToBuffer) {
+    std::string out{ "q=" };
+    ASSERT_TRUE(Url::AppendDecoded(out, "thoth%20http"));
+    EXPECT_EQ(out, "q=thoth http");
+}
+
+TEST_F(UrlEncodeTest, DecodeInPlace_ShrinksString) {
+    std::string text{ "redirect_uri=https%3A%2F%2Fapp.example.com%2Fcallback+now" };
+    ASSERT_TRUE(Url::DecodeInPlace(text));
+    EXPECT_EQ(text, "redirect_uri=https://app.example.com/callback now");
+}
+
+TEST_F(UrlEncodeTest, DecodeInPlace_InvalidSequence_ReturnsError) {
+    std::string text{ "bad%G0" };
+    EXPECT_FALSE(Url::DecodeInPlace(text));
+}
+
 // — GetDefaultPort —
 
 struct UrlDefaultPortTest : testing::Test {};
@@ -618,4 +674,135 @@ TEST_F(UrlTest, ResolveRelative_RelativePath_ResolvesAgainstBasePath) {
     EXPECT_EQ(std::format("{}", *resolved), "https://example.com/a/v2/users");
 }
 
-#pragma endregion
\ No newline at end of file
+#pragma endregion
+
+
+#pragma region UrlView
+
+struct UrlViewTest : testing::Test {
+    static constexpr auto k_api{ UrlView::FromUrl("https://u:p@api.example.com:8443/v1/users?page=2#top").value() };
+};
+
+static_assert(UrlViewTest::k_api.GetScheme() == "https");
+static_assert(UrlViewTest::k_api.GetHost() == "api.example.com");
+static_assert(UrlViewTest::k_api.GetPath() == "/v1/users");
+static_assert(UrlView::FromUrl("http://[::1]:80/").value().GetHostKind() == UrlView::HostKindEnum::Ipv6);
+static_assert(UrlView::FromUrl("http://localhost:65536/").error() == UrlParseErrorEnum::InvalidPort);
+
+TEST_F(UrlViewTest, Accessors_MatchUrl) {
+    const auto url{ Url::FromUrl(std::string{ k_api.GetUrl() }) };
+    ASSERT_TRUE(url);
+
+    EXPECT_EQ(k_api.GetScheme(), url->GetScheme());
+    EXPECT_EQ(k_api.GetUserinfo(), url->GetAuthority()->userinfo);
+    EXPECT_EQ(k_api.GetPort(), url->GetAuthority()->port);
+    EXPECT_EQ(k_api.GetPath(), url->GetPath());
+    EXPECT_EQ(k_api.GetQuery(), url->GetQuery());
+    EXPECT_EQ(k_api.GetFragment(), url->GetFragment());
+    EXPECT_EQ(k_api.GetUrlWithoutFragment(), url->GetUrlWithoutFragment());
+}
+
+TEST_F(UrlViewTest, ViewsTheSource) {
+    const std::string raw{ "http://example.com/a?b#c" };
+    const auto view{ UrlView::FromUrl(raw) };
+    ASSERT_TRUE(view);
+
+    EXPECT_EQ(view->GetPath().data(), raw.data() + 18);
+    EXPECT_EQ(view->GetUrl().data(), raw.data());
+}
+
+TEST_F(UrlViewTest, IpHosts_BuiltOnGetAuthority) {
+    const auto v4{ UrlView::FromUrl("http://192.168.0.1:8080/") };
+    const auto v6{ UrlView::FromUrl("http://[2001:db8::1]/") };
+    ASSERT_TRUE(v4);
+    ASSERT_TRUE(v6);
+
+    EXPECT_EQ(v4->GetHostKind(), UrlView::HostKindEnum::Ipv4);
+    EXPECT_EQ(v4->GetAuthority()->GetHostString(), "192.168.0.1");
+    EXPECT_EQ(v6->GetHost(), "[2001:db8::1]");
+    EXPECT_TRUE(std::holds_alternative<Hermes::IpAddress>(v6->GetAuthority()->host));
+}
+
+TEST_F(UrlViewTest, Invalid_SameErrorsAsUrl) {
+    static constexpr std::string_view k_cases[]{
+        "", "www.google.com/path", "invalid scheme://host.com", "http:/path/only", "http://localhost:abc/",
+        "https://localhost:65536/", "https://user@/path", "http://[::1/", "http://[1::2::3]/", "http://ho st/"
+    };
+
+    for (const auto raw : k_cases) {
+        SCOPED_TRACE(raw);
+
+        const auto view{ UrlView::FromUrl(raw) };
+        const auto url { Url::FromUrl(std::string{ raw }) };
+        ASSERT_FALSE(view);
+        ASSERT_FALSE(url);
+        EXPECT_EQ(ThothError{ view.error() }, url.error());
+    }
+}
+
+TEST_F(UrlViewTest, ToUrl_OwnsACopy) {
+    std::string raw{ "https://example.com:81/a?b=c#d" };
+    const auto url{ UrlView::FromUrl(raw)->ToUrl() };
+    raw.assign(raw.size(), 'x');
+
+    EXPECT_EQ(std::format("{}", url), "https://example.com:81/a?b=c#d");
+    EXPECT_EQ(url.GetPath(), "/a");
+    EXPECT_EQ(url.GetQuery(), "b=c");
+    EXPECT_EQ(*url.GetAuthority()->port, 81u);
+}
+
+#pragma endregion
+
+
+#pragma region UrlBuilder
+
+struct UrlBuilderTest : testing::Test {
+    const Url base{ Url::FromUrl("https://api.example.com/v1?dropped=1#dropped").value() };
+};
+
+TEST_F(UrlBuilderTest, AppendPathAndQuery_EncodedInPlace) {
+    const auto url{ UrlBuilder{ base, 128 }
+        .AppendPath("users")
+        .AppendPath("a b/c")
+        .AppendQuery("page", "2")
+        .AppendQuery("q", "x&y")
+        .Build() };
+
+    EXPECT_EQ(std::format("{}", url), "https://api.example.com/v1/users/a%20b%2Fc?page=2&q=x%26y");
+    EXPECT_EQ(url.GetPath(), "/v1/users/a%20b%2Fc");
+    EXPECT_EQ(url.GetQuery(), "page=2&q=x%26y");
+    EXPECT_EQ(url.GetFragment(), "");
+    EXPECT_EQ(url.GetAuthority()->GetHostString(), "api.example.com");
+}
+
+TEST_F(UrlBuilderTest, PathAfterQuery_StaysInThePath) {
+    UrlBuilder builder{ base };
+    builder.AppendQuery("a", "1").AppendPath("late");
+
+    const auto url{ builder.Build() };
+    EXPECT_EQ(builder.View(), "https://api.example.com/v1/late?a=1");
+    EXPECT_EQ(url.GetPath(), "/v1/late");
+    EXPECT_EQ(url.GetQuery(), "a=1");
+}
+
+TEST_F(UrlBuilderTest, Separators_NotDoubled) {
+    const auto slash  { UrlBuilder{ Url::FromUrl("http://h/").value() }.AppendPath("x").Build() };
+    const auto noPath { UrlBuilder{ Url::FromUrl("http://h").value() }.AppendPath("x").Build() };
+
+    EXPECT_EQ(slash.GetPath(), "/x");
+    EXPECT_EQ(noPath.GetPath(), "/x");
+}
+
+TEST_F(UrlBuilderTest, FromView_MatchesParse) {
+    constexpr auto k_base{ UrlView::FromUrl("http://[::1]:8080/api").value() };
+    const auto built{ UrlBuilder{ k_base }.AppendPath("items").AppendQuery("id", "7").Build() };
+    const auto parsed{ Url::FromUrl("http://[::1]:8080/api/items?id=7") };
+
+    ASSERT_TRUE(parsed);
+    EXPECT_EQ(built, *parsed);
+    EXPECT_EQ(built.GetPath(), parsed->GetPath());
+    EXPECT_EQ(built.GetQuery(), parsed->GetQuery());
+    EXPECT_EQ(built.GetAuthority()->port, parsed->GetAuthority()->port);
+}
+
+#pragma endregion
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include <Thoth/NJson/JsonLiteral.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <string_view>
+
+using namespace Thoth::NJson;
+using namespace Thoth::NJson::Literals;
+
+
+namespace {
+    constexpr bool IsValidLiteral(const std::string_view text) {
+        return details_::TokenizeJson<64, 64>(text).has_value();
+    }
+}
+
+static_assert(IsValidLiteral(R"({ "a": [1, -2, 3.5, true, false, null], "b": {} })"));
+static_assert(IsValidLiteral(R"("café 😀")"));
+static_assert(IsValidLiteral(" [ ] "));
+
+static_assert(!IsValidLiteral(""));
+static_assert(!IsValidLiteral("[1,]"));
+static_assert(!IsValidLiteral("[1 2]"));
+static_assert(!IsValidLiteral(R"({"a" 1})"));
+static_assert(!IsValidLiteral(R"({1: 1})"));
+static_assert(!IsValidLiteral(R"("open)"));
+static_assert(!IsValidLiteral(R"("\x")"));
+static_assert(!IsValidLiteral(R"("\ud83d")"));
+static_assert(!IsValidLiteral("\"\xC3\""));
+static_assert(!IsValidLiteral("1.2.3"));
+static_assert(!IsValidLiteral("18446744073709551616"));
+static_assert(!IsValidLiteral("-9223372036854775809"));
+static_assert(!IsValidLiteral("tru"));
+static_assert(!IsValidLiteral("null null"));
+
+static_assert(details_::TokenizeJson<8, 8>("[1, 2]")->tokenCount == 3);
+static_assert(details_::TokenizeJson<8, 8>("[1 2]").error().idx == 3);
+
+
+#pragma region Json literals
+
+struct JsonLiteralTest : testing::Test {};
+
+TEST_F(JsonLiteralTest, ToJson_EqualsParse) {
+    constexpr std::string_view k_text{
+        R"({"name": "Thoth", "tags": ["http", "json"], "retries": 3, "ratio": 0.25, "debug": false, "proxy": null})"
+    };
+    const Json json{ R"({"name": "Thoth", "tags": ["http", "json"], "retries": 3, "ratio": 0.25, "debug": false, "proxy": null})"_json };
+
+    EXPECT_EQ(json, *Json::Parse(k_text));
+}
+
+TEST_F(JsonLiteralTest, Numbers_AsTryParse) {
+    const Json json{ "[0, -0, 42, -42, 18446744073709551615, -9223372036854775808, 0.1, -2.5e3, 1e22, 123456789012345678.5]"_json };
+    const auto& arr{ json.AsRef<Array>() };
+
+    const auto expected{ *Json::Parse("[0, -0, 42, -42, 18446744073709551615, -9223372036854775808, 0.1, -2.5e3, 1e22, 123456789012345678.5]") };
+    EXPECT_EQ(json, expected);
+
+    EXPECT_EQ(arr[4].AsRef<Number>().AsUI64(), std::numeric_limits<uint64_t>::max());
+    EXPECT_EQ(arr[5].AsRef<Number>().AsI64(), std::numeric_limits<int64_t>::min());
+    EXPECT_EQ(arr[6].AsRef<Number>().AsFloat(), 0.1);
+}
+
+TEST_F(JsonLiteralTest, Strings_DecodedAndReferenced) {
+    const Json json{ R"(["short", "a string long enough to be referenced", "café 😀 \"quoted\""])"_json };
+    const auto& arr{ json.AsRef<Array>() };
+
+    EXPECT_TRUE(arr[0].AsRef<String>().IsInline());
+    EXPECT_TRUE(arr[1].AsRef<String>().IsRef());
+    EXPECT_EQ(arr[2].AsRef<String>().AsView(), "café \U0001F600 \"quoted\"");
+
+    // Every document built from the literal references the same text.
+    const Json again{ R"(["short", "a string long enough to be referenced", "café 😀 \"quoted\""])"_json };
+    EXPECT_EQ(again.AsRef<Array>()[1].AsRef<String>().AsView().data(), arr[1].AsRef<String>().AsView().data());
+}
+
+TEST_F(JsonLiteralTest, Object_RepeatedKeyKeepsLast) {
+    const Json json{ R"({"b": 1, "a": 2, "b": 3})"_json };
+
+    EXPECT_EQ(json, *Json::Parse(R"({"a": 2, "b": 3})"));
+}
+
+TEST_F(JsonLiteralTest, ToJson_IndependentCopies) {
+    const auto& literal{ R"({"list": [1, 2]})"_json };
+
+    Json first{ literal.ToJson() };
+    (*first.AsMut<Object>())["list"].AsMut<Array>().emplace_back(3);
+
+    EXPECT_EQ(literal.ToJson(), *Json::Parse(R"({"list": [1, 2]})"));
+    EXPECT_NE(first, literal.ToJson());
+}
+
+#pragma endregion
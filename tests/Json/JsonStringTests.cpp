@@ -0,0 +1,268 @@
+#include <gtest/gtest.h>
+#include <Thoth/NJson/JsonString.hpp>
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Thoth::NJson;
+
+
+static_assert(sizeof(JsonString) == 24);
+
+
+namespace {
+    const std::string k_short(JsonString::k_inlineCapacity, 's');
+    const std::string k_long(JsonString::k_inlineCapacity + 1, 'l');
+
+    // As written between the quotes in a document, and decoded.
+    const std::string k_escaped{ R"(<p class=\"note\">caf\u00e9\n\ud83d\ude00</p>)" };
+    const std::string k_unescaped{ "<p class=\"note\">caf\u00e9\n\U0001F600</p>" };
+
+    StringRef RefTo(const std::shared_ptr<std::string>& buffer) {
+        return StringRef{ *buffer, buffer };
+    }
+
+    // 0 inline, 1 a reference, 2 owned, 3 escaped.
+    JsonString OfKind(const int kind, const std::shared_ptr<std::string>& buffer) {
+        switch (kind) {
+            case 0:  return JsonString::FromOwned(k_short);
+            case 1:  return JsonString::FromRef(RefTo(buffer));
+            case 2:  return JsonString::FromOwned(k_long + k_long);
+            default: return *JsonString::FromEscaped(RefTo(std::make_shared<std::string>(k_escaped)));
+        }
+    }
+}
+
+
+#pragma region Storage
+
+struct JsonStringStorageTest : testing::Test {};
+
+TEST_F(JsonStringStorageTest, Default_EmptyInline) {
+    const JsonString str;
+    EXPECT_TRUE(str.IsInline());
+    EXPECT_EQ(str.AsView(), "");
+}
+
+TEST_F(JsonStringStorageTest, FromOwned_InlineUpToCapacity) {
+    EXPECT_TRUE(JsonString::FromOwned(k_short).IsInline());
+    EXPECT_EQ(JsonString::FromOwned(k_short).AsView(), k_short);
+
+    const auto str{ JsonString::FromOwned(std::string{ k_long }) };
+    EXPECT_FALSE(str.IsInline());
+    EXPECT_FALSE(str.IsRef());
+    EXPECT_EQ(str.AsView(), k_long);
+}
+
+TEST_F(JsonStringStorageTest, Inline_EverySize) {
+    const std::string text{ "abcdefghijklmnopqrstuvwxyz" };
+
+    for (size_t size{}; size <= JsonString::k_inlineCapacity; ++size) {
+        const JsonString str{ std::string_view{ text }.substr(0, size) };
+
+        EXPECT_TRUE(str.IsInline()) << "size " << size;
+        EXPECT_EQ(str.AsView(), text.substr(0, size)) << "size " << size;
+    }
+}
+
+TEST_F(JsonStringStorageTest, FromRef_LongSharesBuffer) {
+    const auto buffer{ std::make_shared<std::string>(k_long) };
+    const auto str{ JsonString::FromRef(RefTo(buffer)) };
+
+    EXPECT_TRUE(str.IsRef());
+    EXPECT_EQ(str.AsView().data(), buffer->data());
+    EXPECT_EQ(buffer.use_count(), 2);
+}
+
+TEST_F(JsonStringStorageTest, FromRef_ShortCopiedInline) {
+    const auto buffer{ std::make_shared<std::string>(k_short) };
+    const auto str{ JsonString::FromRef(RefTo(buffer)) };
+
+    EXPECT_TRUE(str.IsInline());
+    EXPECT_EQ(str.AsView(), k_short);
+    EXPECT_EQ(buffer.use_count(), 1);
+}
+
+TEST_F(JsonStringStorageTest, Ref_KeepsBufferAlive) {
+    auto buffer{ std::make_shared<std::string>(k_long) };
+    const auto str{ JsonString::FromRef(RefTo(buffer)) };
+    buffer.reset();
+
+    EXPECT_EQ(str.AsView(), k_long);
+    EXPECT_EQ(str.AsRef().str, k_long);
+}
+
+TEST_F(JsonStringStorageTest, AsOwned_EditsOnTheHeap) {
+    auto str{ JsonString::FromOwned("abc") };
+    str.AsOwned() += k_long;
+
+    EXPECT_FALSE(str.IsInline());
+    EXPECT_EQ(str.AsView(), "abc" + k_long);
+}
+
+TEST_F(JsonStringStorageTest, SetOwned_BackToInline) {
+    auto str{ JsonString::FromOwned(std::string{ k_long }) };
+    str.SetOwned(std::string{ "tiny" });
+
+    EXPECT_TRUE(str.IsInline());
+    EXPECT_EQ(str.AsView(), "tiny");
+}
+
+TEST_F(JsonStringStorageTest, SetOwned_FromItself) {
+    auto str{ JsonString::FromOwned(std::string{ k_long }) };
+    str.SetOwned(str.AsOwned().substr(0, 3));
+    EXPECT_EQ(str.AsView(), "lll");
+
+    str.SetOwned(str.AsCopy());
+    EXPECT_EQ(str.AsView(), "lll");
+}
+
+#pragma endregion
+
+
+#pragma region Copy and move
+
+struct JsonStringCopyTest : testing::TestWithParam<int> {
+    std::shared_ptr<std::string> buffer{ std::make_shared<std::string>(k_long) };
+
+    [[nodiscard]] JsonString Make() const { return OfKind(GetParam(), buffer); }
+};
+
+TEST_P(JsonStringCopyTest, Copy_EqualAndIndependent) {
+    auto original{ Make() };
+    const JsonString copy{ original };
+    EXPECT_EQ(copy, original);
+
+    original.AsOwned() += "!";
+    EXPECT_NE(copy, original);
+}
+
+TEST_P(JsonStringCopyTest, Move_LeavesEmpty) {
+    auto original{ Make() };
+    const auto text{ original.AsCopy() };
+
+    const JsonString moved{ std::move(original) };
+    EXPECT_EQ(moved.AsView(), text);
+    EXPECT_EQ(original.AsView(), "");  // NOLINT(*-use-after-move)
+}
+
+TEST_P(JsonStringCopyTest, Assign_OverEveryKind) {
+    for (int kind{}; kind < 4; ++kind) {
+        auto target{ OfKind(kind, buffer) };
+        auto source{ Make() };
+        const auto text{ source.AsCopy() };
+
+        target = source;
+        EXPECT_EQ(target.AsView(), text);
+
+        target = JsonString{};
+        target = std::move(source);
+        EXPECT_EQ(target.AsView(), text);
+    }
+}
+
+TEST_P(JsonStringCopyTest, Visit_SeesTheText) {
+    const auto str{ Make() };
+    const auto size{ str.Visit([](const auto& val) { return std::string_view{ val }.size(); }) };
+
+    EXPECT_EQ(size, str.AsView().size());
+}
+
+INSTANTIATE_TEST_SUITE_P(Kinds, JsonStringCopyTest, testing::Values(0, 1, 2, 3));
+
+#pragma endregion
+
+
+#pragma region Escaped
+
+struct JsonStringEscapedTest : testing::Test {
+    std::shared_ptr<std::string> buffer{ std::make_shared<std::string>(k_escaped) };
+};
+
+TEST_F(JsonStringEscapedTest, FromEscaped_KeptUntilRead) {
+    const auto str{ JsonString::FromEscaped(RefTo(buffer)) };
+    ASSERT_TRUE(str);
+
+    EXPECT_TRUE(str->IsEscaped());
+    EXPECT_EQ(str->SourceView(), k_escaped);
+    EXPECT_EQ(buffer.use_count(), 2);
+
+    EXPECT_EQ(str->AsView(), k_unescaped);
+    EXPECT_TRUE(str->IsEscaped());
+    EXPECT_EQ(str->SourceView(), k_escaped);
+    EXPECT_EQ(str->AsView().data(), str->AsView().data());
+}
+
+TEST_F(JsonStringEscapedTest, AsOwned_ReleasesBuffer) {
+    auto str{ *JsonString::FromEscaped(RefTo(buffer)) };
+    EXPECT_EQ(str.AsOwned(), k_unescaped);
+
+    EXPECT_FALSE(str.IsEscaped());
+    EXPECT_EQ(buffer.use_count(), 1);
+}
+
+TEST_F(JsonStringEscapedTest, ConcurrentReads_DecodedOnce) {
+    const auto str{ *JsonString::FromEscaped(RefTo(buffer)) };
+    const JsonString copy{ str };
+
+    std::vector<std::string_view> views(8);
+    {
+        std::vector<std::jthread> threads;
+        for (size_t i{}; i < views.size(); ++i)
+            threads.emplace_back([&, i] { views[i] = (i % 2 ? copy : str).AsView(); });
+    }
+
+    for (const auto view : views) {
+        EXPECT_EQ(view, k_unescaped);
+        EXPECT_EQ(view.data(), views.front().data());
+    }
+    EXPECT_TRUE(str.IsEscaped());
+}
+
+TEST_F(JsonStringEscapedTest, FromEscaped_ShortDecodedInline) {
+    const auto small{ std::make_shared<std::string>(R"(a\tb\u0041)") };
+    const auto str{ JsonString::FromEscaped(RefTo(small)) };
+    ASSERT_TRUE(str);
+
+    EXPECT_TRUE(str->IsInline());
+    EXPECT_EQ(str->AsView(), "a\tbA");
+    EXPECT_EQ(small.use_count(), 1);
+}
+
+TEST_F(JsonStringEscapedTest, FromEscaped_Invalid_Nullopt) {
+    for (const std::string tail : { R"(\x)", R"(\u12)", R"(\ud83d)", R"(\ud83d\u0041)", "\\" }) {
+        const auto text{ std::make_shared<std::string>(k_long + tail) };
+        EXPECT_FALSE(JsonString::FromEscaped(RefTo(text))) << tail;
+
+        const auto small{ std::make_shared<std::string>(tail) };
+        EXPECT_FALSE(JsonString::FromEscaped(RefTo(small))) << tail;
+    }
+}
+
+TEST_F(JsonStringEscapedTest, Copy_SharesUndecoded) {
+    const auto str{ *JsonString::FromEscaped(RefTo(buffer)) };
+    const JsonString copy{ str };
+
+    EXPECT_TRUE(copy.IsEscaped());
+    EXPECT_EQ(copy, str);
+    EXPECT_EQ(copy.AsView(), k_unescaped);
+    EXPECT_TRUE(str.IsEscaped());
+}
+
+TEST_F(JsonStringEscapedTest, Equal_AcrossKinds) {
+    const auto str{ *JsonString::FromEscaped(RefTo(buffer)) };
+
+    EXPECT_EQ(str, JsonString::FromOwned(k_unescaped));
+    EXPECT_NE(str, JsonString::FromOwned(k_escaped));
+}
+
+TEST_F(JsonStringEscapedTest, AsOwned_DecodesAndEdits) {
+    auto str{ *JsonString::FromEscaped(RefTo(buffer)) };
+    str.AsOwned() += "!";
+
+    EXPECT_EQ(str.AsView(), k_unescaped + "!");
+}
+
+#pragma endregion
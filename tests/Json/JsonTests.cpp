@@ -1,6 +1,14 @@
 #include <gtest/gtest.h>
 #include <Thoth/NJson/Json.hpp>
 #include <Thoth/NJson/JsonObject.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+#include <vector>
  
 
 using namespace Thoth::NJson;
@@ -235,6 +243,161 @@ TEST_F(JsonParseTest, Parse_TrailingGarbage_CheckFinalFalse_Succeeds) {
 
 #pragma endregion
 
+
+#pragma region Lazy numbers
+
+// The token and its cached value fit beside the other alternatives.
+static_assert(sizeof(Number) == 24);
+
+struct JsonLazyNumberTest : testing::Test {
+    static Json ParseLazy(std::string_view input) {
+        auto result{ Json::ParseText(input, true, true, true) };
+        EXPECT_TRUE(result) << "Parse failed for: " << input;
+        return result.value_or(Json{});
+    }
+};
+
+TEST_F(JsonLazyNumberTest, FromToken_KeepsTheText) {
+    const auto num{ Number::FromToken("12.50") };
+    ASSERT_TRUE(num);
+
+    EXPECT_TRUE(num->IsToken());
+    EXPECT_TRUE(num->IsFloat());
+    EXPECT_DOUBLE_EQ(num->AsFloat(), 12.5);
+    EXPECT_EQ(std::format("{}", *num), "12.50");
+}
+
+TEST_F(JsonLazyNumberTest, FromToken_Invalid_Nullopt) {
+    for (const std::string_view token : { "", "-", ".", "1.2.3", "1e", "1e-", "--1", "1-2", "e5" })
+        EXPECT_FALSE(Number::FromToken(token)) << token;
+}
+
+TEST_F(JsonLazyNumberTest, FromToken_TooLong_ConvertedNow) {
+    const auto num{ Number::FromToken("12345678901234567") };
+    ASSERT_TRUE(num);
+
+    EXPECT_FALSE(num->IsToken());
+    EXPECT_EQ(num->AsUI64(), 12345678901234567u);
+}
+
+TEST_F(JsonLazyNumberTest, Token_ReadsAsTryParse) {
+    for (const std::string_view token : { "0", "-0", "42", "-42", "0.5", "-0.0", "1e3", "2.5E-3", "9007199254740993" }) {
+        const auto lazy{ Number::FromToken(token) };
+        const auto eager{ Number::TryParse(token) };
+        ASSERT_TRUE(lazy && eager) << token;
+
+        EXPECT_EQ(lazy->AsI64(), eager->AsI64()) << token;
+        EXPECT_EQ(lazy->AsUI64(), eager->AsUI64()) << token;
+        EXPECT_EQ(lazy->AsFloat(), eager->AsFloat()) << token;
+        EXPECT_EQ(lazy->IsIntegral(), eager->IsIntegral()) << token;
+        EXPECT_EQ(lazy->IsNegative(), eager->IsNegative()) << token;
+        EXPECT_EQ(*lazy, *eager) << token;
+    }
+}
+
+TEST_F(JsonLazyNumberTest, Token_ComparesByValue) {
+    EXPECT_EQ(*Number::FromToken("1.0"), *Number::FromToken("1.00"));
+    EXPECT_EQ(*Number::FromToken("7"), Number{ int64_t{ 7 } });
+    EXPECT_NE(*Number::FromToken("7"), *Number::FromToken("8"));
+}
+
+TEST_F(JsonLazyNumberTest, Token_Read_CachedAndKeptOnCopy) {
+    const auto num{ *Number::FromToken("1700000000000") };
+    EXPECT_EQ(num.AsUI64(), 1700000000000u);
+
+    const auto copy{ num };
+    EXPECT_TRUE(copy.IsToken());
+    EXPECT_EQ(copy.AsUI64(), 1700000000000u);
+    EXPECT_EQ(copy.AsI64(), 1700000000000);
+    EXPECT_EQ(std::format("{}", copy), "1700000000000");
+}
+
+TEST_F(JsonLazyNumberTest, Token_ConcurrentReads_SameValue) {
+    const auto num{ *Number::FromToken("-19.990") };
+
+    std::vector<double> values(8);
+    {
+        std::vector<std::jthread> threads;
+        for (size_t i{}; i < values.size(); ++i)
+            threads.emplace_back([&, i] { values[i] = (i % 2 ? Number{ num } : num).AsFloat(); });
+    }
+
+    for (const auto value : values)
+        EXPECT_DOUBLE_EQ(value, -19.99);
+}
+
+TEST_F(JsonLazyNumberTest, Token_OutOfRange_RoundsToInfinity) {
+    EXPECT_FALSE(Number::TryParse("1e999"));
+
+    const auto num{ Number::FromToken("1e999") };
+    ASSERT_TRUE(num);
+    EXPECT_EQ(num->AsFloat(), std::numeric_limits<double>::infinity());
+}
+
+TEST_F(JsonLazyNumberTest, Parse_Lazy_FormatsVerbatim) {
+    const auto j{ ParseLazy("[19.990, 1e2, -0, 1700000000000]") };
+
+    EXPECT_TRUE(j.AsRef<Array>()[0].AsRef<Number>().IsToken());
+    EXPECT_EQ(std::format("{}", j), "[19.990,1e2,-0,1700000000000]");
+    EXPECT_EQ(j, ParseOk("[19.99, 100.0, 0, 1700000000000]"));
+}
+
+TEST_F(JsonLazyNumberTest, Parse_Lazy_InvalidNumber_ReturnsError) {
+    EXPECT_FALSE(Json::ParseText("[1.2.3]", true, true, true));
+    EXPECT_FALSE(Json::ParseText(R"({"a": -})", true, true, true));
+}
+
+TEST_F(JsonLazyNumberTest, Parse_Default_ConvertsNow) {
+    EXPECT_FALSE(ParseOk("19.990").AsRef<Number>().IsToken());
+}
+
+#pragma endregion
+
+
+#pragma region Lazy unescape
+
+struct JsonLazyUnescapeTest : testing::Test {
+    static constexpr std::string_view k_body{ R"(<div class=\"post\">\n  <p>caf\u00e9 \ud83d\ude00</p>\n</div>)" };
+    const std::string html{ std::format(R"(["{}", "a\tb"])", k_body) };
+
+    static Json ParseLazy(std::string_view input) {
+        auto result{ Json::ParseText(input, { .lazyUnescape = true }) };
+        EXPECT_TRUE(result) << "Parse failed for: " << input;
+        return result.value_or(Json{});
+    }
+
+    static const String& At(const Json& json, const size_t idx) {
+        return json.AsRef<Array>()[idx].AsRef<String>();
+    }
+};
+
+TEST_F(JsonLazyUnescapeTest, Parse_Lazy_DecodedWhenRead) {
+    const auto j{ ParseLazy(html) };
+
+    EXPECT_TRUE(At(j, 0).IsEscaped());
+    EXPECT_TRUE(At(j, 1).IsInline());
+    EXPECT_EQ(At(j, 0).AsView(), "<div class=\"post\">\n  <p>caf\u00e9 \U0001F600</p>\n</div>");
+    EXPECT_FALSE(At(j, 0).IsEscaped());
+}
+
+TEST_F(JsonLazyUnescapeTest, Parse_Lazy_EqualsEager) {
+    EXPECT_EQ(ParseLazy(html), ParseOk(html));
+}
+
+TEST_F(JsonLazyUnescapeTest, Parse_Lazy_FormatsVerbatim) {
+    const auto j{ ParseLazy(html) };
+
+    EXPECT_EQ(std::format("{}", j), std::format(R"(["{}","a\tb"])", k_body));
+    EXPECT_TRUE(At(j, 0).IsEscaped());
+}
+
+TEST_F(JsonLazyUnescapeTest, Parse_Lazy_InvalidEscape_ReturnsError) {
+    EXPECT_FALSE(Json::ParseText(R"(["a long enough string with \x in it"])", { .lazyUnescape = true }));
+    EXPECT_FALSE(Json::ParseText(R"(["a long enough string with \ud83d alone"])", { .lazyUnescape = true }));
+}
+
+#pragma endregion
+
  
 #pragma region Ensure / EnsureOrError
 
@@ -258,13 +421,26 @@ TEST_F(JsonEnsureTest, EnsureOrError_CorrectType_HasValue) {
 TEST_F(JsonEnsureTest, EnsureOrError_WrongType_HasError) {
     const auto result{ numJ.EnsureOrError<Bool>() };
     EXPECT_FALSE(result);
-    EXPECT_TRUE(std::holds_alternative<Thoth::NJson::JsonWrongTypeError>(result.error()));
+    EXPECT_TRUE(result.error().Is<Thoth::NJson::JsonWrongTypeError>());
 }
  
 TEST_F(JsonEnsureTest, EnsureRef_CorrectType_HasValue) {
     EXPECT_TRUE(boolJ.EnsureRef<Bool>());
 }
 
+TEST_F(JsonEnsureTest, EnsureBytes_RoundTripsFromBytes) {
+    const std::string bytes{ "\x89PNG\r\n\x1a\n\0\xff", 10 };
+    const auto json{ Json::FromBytes(bytes) };
+
+    EXPECT_EQ(json.As<String>().AsCopy(), "iVBORw0KGgoA/w==");
+    EXPECT_EQ(json.EnsureBytes(), bytes);
+}
+
+TEST_F(JsonEnsureTest, EnsureBytes_NotBase64_ReturnsNullopt) {
+    EXPECT_FALSE(Json{ "not base64!" }.EnsureBytes());
+    EXPECT_FALSE(numJ.EnsureBytes());
+}
+
 #pragma endregion
 
  
@@ -312,7 +488,7 @@ TEST_F(JsonGetTest, GetOrError_ExistingKey_HasValue) {
 TEST_F(JsonGetTest, GetOrError_MissingKey_HasError) {
     auto result{ obj.GetOrError(Key{ std::string("ghost") }) };
     EXPECT_FALSE(result);
-    EXPECT_TRUE(std::holds_alternative<Thoth::NJson::JsonGetError>(result.error()));
+    EXPECT_TRUE(result.error().Is<Thoth::NJson::JsonGetError>());
 }
  
 TEST_F(JsonGetTest, GetCopy_ReturnsIndependentCopy) {
@@ -432,7 +608,7 @@ TEST_F(JsonSearchTest, SearchOrError_NoMatch_HasError) {
     auto pred = [](const Json& j) { return j.IsOf<Array>(); };
     auto result{ arr.SearchOrError(pred) };
     EXPECT_FALSE(result);
-    EXPECT_TRUE(std::holds_alternative<Thoth::NJson::JsonSearchError>(result.error()));
+    EXPECT_TRUE(result.error().Is<Thoth::NJson::JsonSearchError>());
 }
  
 TEST_F(JsonSearchTest, SearchCopyOrNull_NoMatch_ReturnsNull) {
@@ -508,6 +684,12 @@ TEST_F(JsonFormatTest, Format_StringWithSpecialChars_Escapes) {
     const auto formatted{ std::format("{}", j) };
     EXPECT_EQ(formatted, R"("a\"b\\c\nd")");
 }
+
+TEST_F(JsonFormatTest, Format_StringWithControlChars_EscapedOnce) {
+    const Json j{ std::string("a\x01" "b\x1F") };
+    EXPECT_EQ(std::format("{}", j), R"("a\u0001b\u001f")");
+    EXPECT_EQ(ParseOk(std::format("{}", j)), j);
+}
  
 TEST_F(JsonFormatTest, Format_EmptyArray) {
     EXPECT_EQ(std::format("{}", ParseOk("[]")), "[]");
@@ -564,6 +746,160 @@ TEST_F(JsonFormatTest, Format_ComplexNestedStructure_WithUtf8AndEscaping) {
 
 #pragma endregion
 
+
+#pragma region Hash & canonical form
+
+struct JsonHashTest : testing::Test {};
+
+TEST_F(JsonHashTest, Hash_EqualDocumentsHashTheSame) {
+    const auto a{ ParseOk(R"({"name": "Bob", "tags": ["x", "y"], "score": 1})") };
+    const auto b{ ParseOk(R"({"score": 1.0, "tags": ["x", "y"], "name": "Bob"})") };
+
+    ASSERT_EQ(a, b);
+    EXPECT_EQ(a.Hash(), b.Hash());
+    EXPECT_EQ(std::hash<Json>{}(a), a.Hash());
+}
+
+TEST_F(JsonHashTest, Hash_IgnoresStorage) {
+    const std::string_view text{ R"(["a string long enough to be referenced", "caf\u00e9 with an escape in it", 12.50, -0.0])" };
+    const auto lazy{ *Json::ParseText(text, { .lazyNumbers = true, .lazyUnescape = true }) };
+    const auto eager{ ParseOk(text) };
+
+    EXPECT_EQ(lazy.Hash(), eager.Hash());
+    EXPECT_EQ(ParseOk("0").Hash(), ParseOk("-0.0").Hash());
+}
+
+TEST_F(JsonHashTest, Hash_DiffersOnContent) {
+    const std::string_view texts[]{
+        "null", "false", "true", "0", "1", R"("")", R"("1")", "[]", "{}", "[[]]", "[{}]", "[1, 2]", "[2, 1]",
+        R"({"a": 1})", R"({"a": 2})", R"({"b": 1})", R"({"a": 1, "b": 2})", R"({"a": 2, "b": 1})"
+    };
+
+    std::vector<size_t> hashes;
+    for (const auto text : texts)
+        hashes.push_back(ParseOk(text).Hash());
+
+    std::ranges::sort(hashes);
+    EXPECT_EQ(std::ranges::adjacent_find(hashes), hashes.end());
+}
+
+TEST_F(JsonHashTest, HashedJson_KeysAHashMap) {
+    std::unordered_set<HashedJson> cache;
+    cache.emplace(ParseOk(R"({"a": [1, 2], "b": null})"));
+    cache.emplace(ParseOk(R"({"b": null, "a": [1, 2.0]})"));
+    cache.emplace(ParseOk(R"({"a": [2, 1], "b": null})"));
+
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_TRUE(cache.contains(HashedJson{ ParseOk(R"({"a": [2, 1], "b": null})") }));
+}
+
+TEST_F(JsonHashTest, Canonical_SortsAndMinimizes) {
+    const auto json{ ParseOk(R"({ "b": [1.0, 1e21, 1.5e-7, 0.000001, -0.0, 18446744073709551615],
+        "a": "caf\u00e9\n\u0001", "\ufb01": 1, "\ud83d\ude00": 2 })") };
+
+    // U+1F600 sorts before U+FB01 in UTF-16, after it in UTF-8.
+    EXPECT_EQ(std::format("{:c}", json),
+        "{\"a\":\"caf\u00e9\\n\\u0001\",\"b\":[1,1e+21,1.5e-7,0.000001,0,18446744073709551615],"
+        "\"\U0001F600\":2,\"\uFB01\":1}");
+}
+
+TEST_F(JsonHashTest, Canonical_SortsCharsAboveFFFFByCodePoint) {
+    const auto json{ ParseOk(R"({ "\ue000": 1, "\udbc0\udc00": 2, "\ud800\udc00": 3 })") };
+
+    // U+10000 then U+100000, as their surrogates D800 and DBC0, both before U+E000.
+    EXPECT_EQ(std::format("{:c}", json), "{\"\U00010000\":3,\"\U00100000\":2,\"\uE000\":1}");
+}
+
+TEST_F(JsonHashTest, Canonical_SameForEqualDocuments) {
+    const auto a{ *Json::ParseText(R"({"x": 12.50, "y": "\u0041"})", { .lazyNumbers = true, .lazyUnescape = true }) };
+    const auto b{ ParseOk(R"({"y": "A", "x": 12.5})") };
+
+    EXPECT_EQ(std::format("{:c}", a), std::format("{:c}", b));
+    EXPECT_EQ(std::format("{:c}", b), R"({"x":12.5,"y":"A"})");
+}
+
+#pragma endregion
+
+
+#pragma region Parallel Functions
+
+struct JsonParallelTest : testing::Test {
+    // Small chunks so that even these arrays are split between threads.
+    static constexpr ParallelOptions k_options{ .threads = 4, .grain = 16 };
+
+    Json numbers{ [] {
+        Array arr;
+        for (int i{}; i < 10'000; ++i)
+            arr.emplace_back(i % 100);
+        return arr;
+    }() };
+
+    static bool IsOdd(const Json& json) { return *json.AsRef<Number>().AsI64() % 2; }
+};
+
+TEST_F(JsonParallelTest, ParallelSearch_FirstMatch) {
+    const auto is42{ [](const Json& json) { return json == Json{ 42 }; } };
+
+    const auto found{ std::as_const(numbers).ParallelSearch(is42, k_options) };
+    ASSERT_TRUE(found);
+    EXPECT_EQ(*found, &numbers.AsRef<Array>()[42]);
+    EXPECT_EQ(*found, *std::as_const(numbers).Search(is42));
+
+    EXPECT_FALSE(numbers.ParallelSearch([](const Json& json) { return json == Json{ 100 }; }, k_options));
+}
+
+TEST_F(JsonParallelTest, ParallelSearch_MutableAndObject) {
+    auto found{ numbers.ParallelSearch([](const Json& json) { return json == Json{ 99 }; }, k_options) };
+    ASSERT_TRUE(found);
+    **found = "changed";
+    EXPECT_EQ(numbers.AsRef<Array>()[99], Json{ "changed" });
+
+    const auto obj{ ParseOk(R"({"a": 1, "b": 2, "c": 3})") };
+    const auto inObj{ obj.ParallelSearch([](const Json& json) { return json != Json{ 1 }; }, { .threads = 2, .grain = 1 }) };
+    ASSERT_TRUE(inObj);
+    EXPECT_EQ(**inObj, Json{ 2 });
+
+    EXPECT_FALSE(ParseOk("42").ParallelSearch(IsOdd));
+}
+
+TEST_F(JsonParallelTest, ParallelFilter_InOrder) {
+    const auto filtered{ numbers.ParallelFilter(IsOdd, k_options) };
+    ASSERT_TRUE(filtered);
+
+    Array expected;
+    std::ranges::copy_if(numbers.AsRef<Array>(), std::back_inserter(expected), IsOdd);
+    EXPECT_EQ(*filtered, Json{ expected });
+
+    EXPECT_EQ(numbers.ParallelFilter(IsOdd), filtered);
+    EXPECT_EQ(*ParseOk(R"({"a": 1, "b": 2, "c": 3})").ParallelFilter(IsOdd, { .grain = 1 }), ParseOk("[1, 3]"));
+    EXPECT_FALSE(ParseOk(R"("text")").ParallelFilter(IsOdd));
+}
+
+TEST_F(JsonParallelTest, ParallelTransform_EveryChild) {
+    const auto doubled{ numbers.ParallelTransform([](const Json& json) { return *json.AsRef<Number>().AsI64() * 2; }, k_options) };
+    ASSERT_TRUE(doubled);
+
+    const auto& arr{ doubled->AsRef<Array>() };
+    ASSERT_EQ(arr.size(), 10'000u);
+    for (size_t i{}; i < arr.size(); ++i)
+        ASSERT_EQ(arr[i], Json{ static_cast<int>(i % 100) * 2 });
+
+    const auto names{ ParseOk(R"([{"name": "a"}, {"name": "b"}])").ParallelTransform([](const Json& json) { return json.GetCopyOrNull("name"); }) };
+    EXPECT_EQ(names, ParseOk(R"(["a", "b"])"));
+}
+
+TEST_F(JsonParallelTest, Parallel_RethrowsFromThreads) {
+    const auto throwsOn99{ [](const Json& json) -> bool {
+        if (json == Json{ 99 })
+            throw std::runtime_error{ "99" };
+        return false;
+    } };
+
+    EXPECT_THROW((void)numbers.ParallelFilter(throwsOn99, k_options), std::runtime_error);
+}
+
+#pragma endregion
+
  
 #pragma region JsonObject
 
@@ -683,6 +1019,24 @@ TEST_F(JsonObjectTest, IterateKeys_AllKeysPresent) {
         keys.push_back(k);
     EXPECT_EQ(keys.size(), 3u);
 }
+
+TEST_F(JsonObjectTest, Values_InKeyOrder) {
+    obj["key0"] = Json{ 0 };
+
+    const auto values{ std::as_const(obj).Values() };
+    ASSERT_EQ(values.size(), 4u);
+    EXPECT_EQ(values[0], Json{ 0 });
+    EXPECT_EQ(values[1], Json{ 1 });
+    EXPECT_EQ(values[3], Json{ true });
+}
+
+TEST_F(JsonObjectTest, Iterate_WritesThroughTheValues) {
+    for (auto [key, value] : obj)
+        if (key == "key2")
+            value = Json{ 2 };
+
+    EXPECT_EQ(obj["key2"], Json{ 2 });
+}
  
 TEST_F(JsonObjectTest, GetCopy_ReturnsValue) {
     const auto copy{ obj.GetCopy("key2") };
@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include <Thoth/String/Base64Viewer.hpp>
+
+#include <array>
+#include <ranges>
+#include <string>
+
+using namespace Thoth::String;
+
+
+static_assert(std::ranges::input_range<Base64View>);
+static_assert(std::ranges::input_range<Base64View::EncodeView>);
+static_assert(Base64View::IsValid("Zm9vYg==") && !Base64View::IsValid("Zm9vY"));
+static_assert(Base64UrlView::IsValid("-_-_") && !Base64View::IsValid("-_-_"));
+
+
+namespace {
+    std::string Bytes(const size_t size) {
+        std::string res(size, '\0');
+        for (size_t i{}; i < size; ++i)
+            res[i] = static_cast<char>(i * 7 + i / 251);
+        return res;
+    }
+}
+
+
+#pragma region Base64View - Encode
+
+struct Base64EncodeTest : testing::Test {};
+
+TEST_F(Base64EncodeTest, Rfc4648Vectors_Padded) {
+    EXPECT_EQ(Base64View::Encode(""), "");
+    EXPECT_EQ(Base64View::Encode("f"), "Zg==");
+    EXPECT_EQ(Base64View::Encode("fo"), "Zm8=");
+    EXPECT_EQ(Base64View::Encode("foo"), "Zm9v");
+    EXPECT_EQ(Base64View::Encode("foob"), "Zm9vYg==");
+    EXPECT_EQ(Base64View::Encode("fooba"), "Zm9vYmE=");
+    EXPECT_EQ(Base64View::Encode("foobar"), "Zm9vYmFy");
+}
+
+TEST_F(Base64EncodeTest, Url_NoPadding_DashAndUnderscore) {
+    EXPECT_EQ(Base64UrlView::Encode("\xfb\xff"), "-_8");
+    EXPECT_EQ(Base64View::Encode("\xfb\xff"), "+/8=");
+}
+
+TEST_F(Base64EncodeTest, CallerBuffer_TooSmall_ReturnsNullopt) {
+    std::array<char, 3> small{};
+    EXPECT_FALSE(Base64View::Encode("foo", small));
+
+    std::array<char, 4> exact{};
+    EXPECT_EQ(Base64View::Encode("foo", exact), 4u);
+    EXPECT_EQ(std::string_view(exact.data(), exact.size()), "Zm9v");
+}
+
+TEST_F(Base64EncodeTest, AppendEncoded_KeepsPrefix) {
+    std::string out{ "Basic " };
+    Base64View::AppendEncoded(out, "user:pass");
+    EXPECT_EQ(out, "Basic dXNlcjpwYXNz");
+}
+
+TEST_F(Base64EncodeTest, Encoded_LazyView_MatchesEncode) {
+    for (size_t size{}; size < 10; ++size) {
+        const auto bytes{ Bytes(size) };
+
+        std::string lazy;
+        for (const char c : Base64UrlView::Encoded(bytes))
+            lazy += c;
+
+        EXPECT_EQ(lazy, Base64UrlView::Encode(bytes)) << "size " << size;
+        EXPECT_EQ(Base64UrlView::Encoded(bytes).size(), lazy.size());
+    }
+}
+
+#pragma endregion
+
+
+#pragma region Base64View - Decode
+
+struct Base64DecodeTest : testing::Test {};
+
+TEST_F(Base64DecodeTest, Rfc4648Vectors_Padded) {
+    EXPECT_EQ(Base64View::TryDecode("Zg=="), "f");
+    EXPECT_EQ(Base64View::TryDecode("Zm8="), "fo");
+    EXPECT_EQ(Base64View::TryDecode("Zm9vYmFy"), "foobar");
+}
+
+TEST_F(Base64DecodeTest, MissingPadding_Accepted) {
+    EXPECT_EQ(Base64View::TryDecode("Zm9vYg"), "foob");
+    EXPECT_EQ(Base64UrlView::TryDecode("-_8"), "\xfb\xff");
+}
+
+TEST_F(Base64DecodeTest, Invalid_ReturnsNullopt) {
+    EXPECT_FALSE(Base64View::TryDecode("Zm9vY"));     // a lone char in the last group
+    EXPECT_FALSE(Base64View::TryDecode("Zm9v Yg=="));  // whitespace
+    EXPECT_FALSE(Base64View::TryDecode("Zg=a"));
+    EXPECT_FALSE(Base64View::TryDecode("-_8="));
+    EXPECT_FALSE(Base64UrlView::TryDecode("+/8="));
+}
+
+TEST_F(Base64DecodeTest, AppendDecoded_Invalid_LeavesOutput) {
+    std::string out{ "keep" };
+    EXPECT_FALSE(Base64View::AppendDecoded(out, "%%%%"));
+    EXPECT_EQ(out, "keep");
+}
+
+TEST_F(Base64DecodeTest, LazyView_YieldsBytes) {
+    std::string decoded;
+    for (const char c : Base64View{ "Zm9vYmE=" })
+        decoded += c;
+
+    EXPECT_EQ(decoded, "fooba");
+}
+
+TEST_F(Base64DecodeTest, LazyView_StopsAtInvalid) {
+    std::string decoded;
+    for (const char c : Base64View{ "Zm9v!mFy" })
+        decoded += c;
+
+    EXPECT_EQ(decoded, "foo");
+}
+
+#pragma endregion
+
+
+#pragma region Base64View - Bulk
+
+struct Base64BulkTest : testing::TestWithParam<size_t> {};
+
+TEST_P(Base64BulkTest, RoundTrip_BothAlphabets) {
+    const auto bytes{ Bytes(GetParam()) };
+
+    EXPECT_EQ(Base64View::TryDecode(Base64View::Encode(bytes)), bytes);
+    EXPECT_EQ(Base64UrlView::TryDecode(Base64UrlView::Encode(bytes)), bytes);
+}
+
+TEST_P(Base64BulkTest, InvalidCharAnywhere_Rejected) {
+    const auto text{ Base64View::Encode(Bytes(GetParam())) };
+
+    // The vector kernels see most of the text, the scalar tail the rest.
+    for (size_t at{}; at < text.size(); at += 5) {
+        auto corrupted{ text };
+        corrupted[at] = '*';
+
+        EXPECT_FALSE(Base64View::TryDecode(corrupted)) << "at " << at;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(Sizes, Base64BulkTest, testing::Values(1, 2, 3, 11, 12, 13, 23, 24, 25, 47, 48, 49, 100, 1000, 4099));
+
+#pragma endregion
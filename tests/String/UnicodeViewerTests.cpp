@@ -1,9 +1,39 @@
 #include <gtest/gtest.h>
 #include <Thoth/String/UnicodeViewer.hpp>
 
+#include <ranges>
+#include <string>
+
 using namespace Thoth::String;
 
 
+static_assert(Utf8View::IsValid(u8"h\u00E9llo \u4E2D\U0001F600") && !Utf8View::IsValid(u8"\uFDD0"));
+static_assert(Utf8View::ConvertTo<char16_t>(u8"a\U0001F600b") == u"a\U0001F600b");
+
+
+namespace {
+    // ASCII runs of growing length between multibyte chars, so that both the blocks and the tails are exercised.
+    std::u8string Text(const size_t size) {
+        constexpr std::u8string_view k_runes[]{ u8"\u00E9", u8"\u4E2D", u8"\U0001F600" };
+
+        std::u8string res;
+        for (size_t i{}; res.size() < size; ++i) {
+            res.append(i % 37, static_cast<char8_t>('a' + i % 26));
+            res += k_runes[i % 3];
+        }
+
+        return res;
+    }
+
+    std::u32string Runes(const std::u8string_view str) {
+        std::u32string res;
+        for (const auto rune : Utf8View{ str })
+            res += rune;
+        return res;
+    }
+}
+
+
 #pragma region Utf8View - ASCII
 
 struct Utf8ViewAsciiTest : testing::Test {};
@@ -83,6 +113,19 @@ TEST_F(Utf8ViewMultibyteTest, IsValid_InvalidByte_False) {
     EXPECT_FALSE(Utf8View::IsValid(s));
 }
 
+TEST_F(Utf8ViewMultibyteTest, IsValid_ReplacementChar_True) {
+    // U+FFFD written in the text is a char as any other
+    EXPECT_TRUE(Utf8View::IsValid(u8"a\uFFFDb"));
+}
+
+TEST_F(Utf8ViewMultibyteTest, IsValid_SameRulesAsIterator) {
+    EXPECT_FALSE(Utf8View::IsValid(u8"\xED\xA0\x80"));     // encoded surrogate
+    EXPECT_FALSE(Utf8View::IsValid(u8"\xEF\xBF\xBE"));     // U+FFFE
+    EXPECT_FALSE(Utf8View::IsValid(u8"\xF4\x90\x80\x80")); // above U+10FFFF
+    EXPECT_FALSE(Utf8View::IsValid(u8"abc\xE4\xB8"));      // truncated at the end
+    EXPECT_FALSE(Utf8View::IsValid(u8"\x80" "abc"));       // lone continuation byte
+}
+
 #pragma endregion
 
 
@@ -109,6 +152,13 @@ TEST_F(Utf8ViewConvertTest, ConvertTo_Empty_ReturnsEmpty) {
     EXPECT_TRUE(result.empty());
 }
 
+TEST_F(Utf8ViewConvertTest, ConvertTo_Invalid_YieldsUnknownCharAsIterator) {
+    const std::u8string src{ u8"ab\xE4\xB8z\xFF\u00E9" };
+
+    EXPECT_EQ(Utf8View::ConvertTo<char32_t>(src), Runes(src));
+    EXPECT_EQ(Utf8View::ConvertTo<char16_t>(src), Utf32View::ConvertTo<char16_t>(Runes(src)));
+}
+
 #pragma endregion
 
 
@@ -182,4 +232,49 @@ TEST_F(Utf32ViewTest, EmptyString_BeginEqualsEnd) {
     EXPECT_EQ(view.begin(), view.end());
 }
 
-#pragma endregion
\ No newline at end of file
+#pragma endregion
+
+
+#pragma region Unicode - Bulk
+
+struct UnicodeBulkTest : testing::TestWithParam<size_t> {};
+
+TEST_P(UnicodeBulkTest, IsValid_MixedText_True) {
+    const auto text{ Text(GetParam()) };
+
+    EXPECT_TRUE(Utf8View::IsValid(text));
+    EXPECT_TRUE(Utf16View::IsValid(Utf8View::ConvertTo<char16_t>(text)));
+    EXPECT_TRUE(Utf32View::IsValid(Utf8View::ConvertTo<char32_t>(text)));
+}
+
+TEST_P(UnicodeBulkTest, IsValid_InvalidByteAnywhere_False) {
+    const std::u8string ascii(GetParam(), u8'x');
+
+    for (size_t at{}; at < ascii.size(); ++at) {
+        auto corrupted{ ascii };
+        corrupted[at] = 0xC3; // a lead byte followed by ASCII
+
+        EXPECT_FALSE(Utf8View::IsValid(corrupted)) << "at " << at;
+    }
+}
+
+TEST_P(UnicodeBulkTest, ConvertTo_MatchesIterator) {
+    const auto text{ Text(GetParam()) };
+    const auto runes{ Runes(text) };
+
+    EXPECT_EQ(Utf8View::ConvertTo<char32_t>(text), runes);
+    EXPECT_EQ(Utf32View::ConvertTo<char8_t>(runes), text);
+}
+
+TEST_P(UnicodeBulkTest, ConvertTo_RoundTrips) {
+    const auto text{ Text(GetParam()) };
+    const auto utf16{ Utf8View::ConvertTo<char16_t>(text) };
+
+    EXPECT_EQ(Utf16View::ConvertTo<char8_t>(utf16), text);
+    EXPECT_EQ(Utf16View::ConvertTo<char32_t>(utf16), Utf8View::ConvertTo<char32_t>(text));
+    EXPECT_EQ(Utf32View::ConvertTo<char16_t>(Utf16View::ConvertTo<char32_t>(utf16)), utf16);
+}
+
+INSTANTIATE_TEST_SUITE_P(Sizes, UnicodeBulkTest, testing::Values(1, 15, 16, 17, 31, 32, 33, 64, 100, 1000, 4099));
+
+#pragma endregion
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include <Thoth/ThothError.hpp>
+
+#include <format>
+#include <string>
+
+using namespace Thoth;
+using namespace Thoth::NJson;
+using namespace Thoth::Http;
+
+
+static_assert(sizeof(ThothError) == 16);
+static_assert(sizeof(ThothResultOper) <= 24);
+static_assert(ThothError{ UrlParseErrorEnum::InvalidPort } == UrlParseErrorEnum::InvalidPort);
+static_assert(ThothError{ JsonWrongTypeError{ 1, 4 } }.As<JsonWrongTypeError>().idxGot == 4);
+
+
+#pragma region ThothError - Alternatives
+
+struct ThothErrorTest : testing::Test {};
+
+TEST_F(ThothErrorTest, Enum_RoundTrips) {
+    const ThothError err{ MessageParseErrorEnum::HeadersTooLarge };
+
+    EXPECT_TRUE(err.Is<MessageParseErrorEnum>());
+    EXPECT_FALSE(err.Is<UrlParseErrorEnum>());
+    EXPECT_EQ(err.As<MessageParseErrorEnum>(), MessageParseErrorEnum::HeadersTooLarge);
+    EXPECT_EQ(err, MessageParseErrorEnum::HeadersTooLarge);
+    EXPECT_NE(err, MessageParseErrorEnum::InvalidHeaders);
+}
+
+TEST_F(ThothErrorTest, JsonParseError_KeepsIndexAndChar) {
+    const ThothError err{ JsonParseError{ 1'234'567'890'123, '}' } };
+
+    const auto parse{ err.Ensure<JsonParseError>() };
+    ASSERT_TRUE(parse);
+    EXPECT_EQ(parse->idx, 1'234'567'890'123u);
+    EXPECT_EQ(parse->c, '}');
+}
+
+TEST_F(ThothErrorTest, Payload_KeepsStrings) {
+    const ThothError err{ JsonFindError{ "name", { Key{ "users" }, Key{ 3 } } } };
+
+    ASSERT_TRUE(err.Is<JsonFindError>());
+    const auto find{ err.As<JsonFindError>() };
+    EXPECT_EQ(find.key, Key{ "name" });
+    ASSERT_EQ(find.currentPath.size(), 2u);
+    EXPECT_EQ(find.currentPath[1], Key{ 3 });
+
+    EXPECT_EQ(ThothError{ GenericError{ "Invalid scheme" } }, GenericError{ "Invalid scheme" });
+}
+
+TEST_F(ThothErrorTest, Ensure_WrongType_Nullopt) {
+    const ThothError err{ GenericError{ "boom" } };
+
+    EXPECT_FALSE(err.Ensure<JsonGetError>());
+    EXPECT_FALSE(err.Ensure<UrlParseErrorEnum>());
+    EXPECT_THROW(std::ignore = err.As<JsonSearchError>(), std::bad_variant_access);
+}
+
+TEST_F(ThothErrorTest, Visit_GetsTheType) {
+    const ThothError err{ JsonGetError{ "key" } };
+
+    EXPECT_TRUE(err.Visit([]<class T>(const T&) { return std::same_as<T, JsonGetError>; }));
+}
+
+#pragma endregion
+
+
+#pragma region ThothError - Value semantics
+
+TEST_F(ThothErrorTest, Copy_EqualAndIndependent) {
+    ThothError err{ GenericError{ "a message long enough to be on the heap" } };
+    const ThothError copy{ err };
+
+    EXPECT_EQ(copy, err);
+    err = UrlParseErrorEnum::EmptyUrl;
+    EXPECT_EQ(copy, GenericError{ "a message long enough to be on the heap" });
+    EXPECT_NE(copy, err);
+}
+
+TEST_F(ThothErrorTest, Move_TakesThePayload) {
+    ThothError err{ JsonGetError{ 7 } };
+    const ThothError moved{ std::move(err) };
+
+    EXPECT_EQ(moved, JsonGetError{ 7 });
+    EXPECT_FALSE(err.Is<JsonGetError>()); // NOLINT(*-use-after-move)
+}
+
+TEST_F(ThothErrorTest, Assign_OverPayload) {
+    ThothError err{ GenericError{ "first" } };
+    err = ThothError{ JsonFindError{ "x", {} } };
+    EXPECT_TRUE(err.Is<JsonFindError>());
+
+    const ThothError other{ JsonParseError{ 3, 'x' } };
+    err = other;
+    EXPECT_EQ(err, other);
+}
+
+TEST_F(ThothErrorTest, Format_MatchesTheAlternative) {
+    EXPECT_EQ(std::format("{}", ThothError{ GenericError{ "Invalid scheme" } }), "Invalid scheme");
+    EXPECT_EQ(std::format("{}", ThothError{ JsonParseError{ 4, '@' } }), "Unknown character '@' at position 4");
+}
+
+#pragma endregion